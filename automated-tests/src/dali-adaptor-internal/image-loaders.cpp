@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,8 @@
 #include "image-loaders.h"
 #include <dali-test-suite-utils.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <cstring>
+#include <vector>
 
 AutoCloseFile::AutoCloseFile(FILE* fp)
 : filePtr(fp)
@@ -126,6 +128,38 @@ void TestImageLoading(const ImageDetails& image, const LoadFunctions& functions,
   }
 }
 
+void TestImageLoadingFromMemory(const ImageDetails& image, const LoadFunctions& functions)
+{
+  FILE*         fp = fopen(image.name.c_str(), "rb");
+  AutoCloseFile autoClose(fp);
+  DALI_TEST_CHECK(fp != NULL);
+
+  // Read the whole file, as the image loader maps it.
+  fseek(fp, 0, SEEK_END);
+  std::vector<uint8_t> encodedData(ftell(fp));
+  fseek(fp, 0, SEEK_SET);
+  DALI_TEST_EQUALS(fread(encodedData.data(), 1, encodedData.size(), fp), encodedData.size(), TEST_LOCATION);
+  fseek(fp, 0, SEEK_SET);
+
+  unsigned int                   width(0), height(0);
+  const Dali::ImageLoader::Input input(fp, Dali::ImageLoader::ScalingParameters(), true, encodedData.data(), encodedData.size());
+  DALI_TEST_CHECK(functions.header(input, width, height));
+
+  DALI_TEST_EQUALS(width, image.reportedWidth, TEST_LOCATION);
+  DALI_TEST_EQUALS(height, image.reportedHeight, TEST_LOCATION);
+
+  // Loaders which don't use the data in memory read the file again.
+  fseek(fp, 0, SEEK_SET);
+
+  Dali::Devel::PixelBuffer bitmap;
+  DALI_TEST_CHECK(functions.loader(input, bitmap));
+  DALI_TEST_EQUALS(image.width, bitmap.GetWidth(), TEST_LOCATION);
+  DALI_TEST_EQUALS(image.height, bitmap.GetHeight(), TEST_LOCATION);
+
+  // Compare buffer generated with reference buffer.
+  DALI_TEST_EQUALS(memcmp(bitmap.GetBuffer(), image.refBuffer, image.refBufferSize), 0, TEST_LOCATION);
+}
+
 void CompareLoadedImageData(const ImageDetails& image, const LoadFunctions& functions, const uint32_t* master)
 {
   FILE*         filePointer = fopen(image.name.c_str(), "rb");
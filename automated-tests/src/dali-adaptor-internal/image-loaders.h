@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -100,6 +100,15 @@ struct LoadFunctions
  */
 void TestImageLoading(const ImageDetails& image, const LoadFunctions& functions, Dali::Integration::Bitmap::Profile bitmapProfile = Dali::Integration::Bitmap::BITMAP_2D_PACKED_PIXELS);
 
+/**
+ * Use this method to test the header and bitmap loading of an image whose whole file is given in memory,
+ * as when the image loader maps the file.
+ *
+ * @param[in]  image         The image details.
+ * @param[in]  functions     The loader functions that need to be called.
+ */
+void TestImageLoadingFromMemory(const ImageDetails& image, const LoadFunctions& functions);
+
 /**
  * Helper method to compare the resultant loaded image data of the specified image with a golden master data.
  *
@@ -0,0 +1,416 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/accessibility/bridge/accessible-spatial-index.h>
+
+using namespace Dali;
+using namespace Dali::Accessibility;
+
+namespace
+{
+class TestAccessible : public Component
+{
+public:
+  explicit TestAccessible(Rect<> extents)
+  : mExtents(extents)
+  {
+  }
+
+  ~TestAccessible() override;
+
+  TestAccessible* AddChild(Rect<> extents)
+  {
+    mChildren.push_back(std::make_shared<TestAccessible>(extents));
+    mChildren.back()->mParent = this;
+    return mChildren.back().get();
+  }
+
+  std::string GetName() const override
+  {
+    return {};
+  }
+
+  std::string GetDescription() const override
+  {
+    return {};
+  }
+
+  Accessible* GetParent() override
+  {
+    return mParent;
+  }
+
+  std::size_t GetChildCount() const override
+  {
+    return mChildren.size();
+  }
+
+  std::vector<Accessible*> GetChildren() override
+  {
+    std::vector<Accessible*> children;
+    for(auto& child : mChildren)
+    {
+      children.push_back(child.get());
+    }
+    return children;
+  }
+
+  Accessible* GetChildAtIndex(std::size_t index) override
+  {
+    return mChildren[index].get();
+  }
+
+  std::size_t GetIndexInParent() override
+  {
+    return 0u;
+  }
+
+  Role GetRole() const override
+  {
+    return Role::PUSH_BUTTON;
+  }
+
+  States GetStates() override
+  {
+    return {};
+  }
+
+  Attributes GetAttributes() const override
+  {
+    return {};
+  }
+
+  bool DoGesture(const GestureInfo& gestureInfo) override
+  {
+    return false;
+  }
+
+  std::vector<Relation> GetRelationSet() override
+  {
+    return {};
+  }
+
+  Dali::Actor GetInternalActor() const override
+  {
+    return {};
+  }
+
+  Rect<> GetExtents(CoordinateType type) const override
+  {
+    return mExtents;
+  }
+
+  ComponentLayer GetLayer() const override
+  {
+    return ComponentLayer::WINDOW;
+  }
+
+  int16_t GetMdiZOrder() const override
+  {
+    return 0;
+  }
+
+  bool GrabFocus() override
+  {
+    return false;
+  }
+
+  double GetAlpha() const override
+  {
+    return 1.0;
+  }
+
+  bool GrabHighlight() override
+  {
+    return false;
+  }
+
+  bool ClearHighlight() override
+  {
+    return false;
+  }
+
+  bool IsScrollable() const override
+  {
+    return false;
+  }
+
+  Rect<>                                       mExtents;
+  TestAccessible*                              mParent{nullptr};
+  std::vector<std::shared_ptr<TestAccessible>> mChildren;
+};
+
+/**
+ * Registers the objects held by the index, and reports their destruction to it, as the bridge does.
+ */
+struct TestRegistry
+{
+  TestRegistry();
+  ~TestRegistry();
+
+  AccessibleSpatialIndex                index;
+  std::unordered_set<const Accessible*> registeredObjects;
+};
+
+TestRegistry* gRegistry = nullptr;
+
+TestRegistry::TestRegistry()
+: index([this](const Accessible* object) { registeredObjects.insert(object); })
+{
+  gRegistry = this;
+}
+
+TestRegistry::~TestRegistry()
+{
+  gRegistry = nullptr;
+}
+
+TestAccessible::~TestAccessible()
+{
+  if(gRegistry && gRegistry->registeredObjects.erase(this) > 0u)
+  {
+    gRegistry->index.Remove(this);
+  }
+}
+
+/**
+ * A window of 1000x1000 with 100 containers of 100x100 in a grid, each one with 100 items of 10x10 in a grid: 10101 nodes.
+ * The items touch, so points on their borders are in several items.
+ */
+std::shared_ptr<TestAccessible> CreateTree()
+{
+  auto root = std::make_shared<TestAccessible>(Rect<>(0.0f, 0.0f, 1000.0f, 1000.0f));
+  for(int containerIndex = 0; containerIndex < 100; ++containerIndex)
+  {
+    const float containerX = (containerIndex % 10) * 100.0f;
+    const float containerY = (containerIndex / 10) * 100.0f;
+    auto*       container  = root->AddChild(Rect<>(containerX, containerY, 100.0f, 100.0f));
+    for(int itemIndex = 0; itemIndex < 100; ++itemIndex)
+    {
+      container->AddChild(Rect<>(containerX + (itemIndex % 10) * 10.0f, containerY + (itemIndex / 10) * 10.0f, 10.0f, 10.0f));
+    }
+  }
+  return root;
+}
+
+/**
+ * The recursive hit-test of the bridge, collecting every component it would check.
+ */
+void FindComponentsRecursively(Accessible* root, Point point, uint32_t maximumDepth, std::vector<Component*>& components)
+{
+  if(!root || maximumDepth == 0u)
+  {
+    return;
+  }
+
+  auto rootComponent = dynamic_cast<Component*>(root);
+  if(rootComponent && !rootComponent->IsAccessibleContainingPoint(point, CoordinateType::WINDOW))
+  {
+    return;
+  }
+
+  auto children = root->GetChildren();
+  for(auto childIt = children.rbegin(); childIt != children.rend(); childIt++)
+  {
+    FindComponentsRecursively(*childIt, point, maximumDepth - 1u, components);
+  }
+
+  if(rootComponent)
+  {
+    components.push_back(rootComponent);
+  }
+}
+
+} // namespace
+
+void utc_dali_internal_accessible_spatial_index_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_accessible_spatial_index_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliAccessibleSpatialIndexFindComponentsAtPoint(void)
+{
+  tet_infoline("The components at a point are the ones the recursive hit-test checks, in the same order.");
+
+  auto                   root = CreateTree();
+  AccessibleSpatialIndex index;
+
+  std::vector<Component*> components;
+  std::vector<Component*> expectedComponents;
+  for(int y = -5; y <= 1005; y += 5)
+  {
+    for(int x = -5; x <= 1005; x += 5)
+    {
+      expectedComponents.clear();
+      FindComponentsRecursively(root.get(), Point(x, y), 10000u, expectedComponents);
+      DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(x, y), CoordinateType::WINDOW, 10000u, components));
+      if(components != expectedComponents)
+      {
+        tet_printf("Different components at %d, %d\n", x, y);
+        DALI_TEST_CHECK(false);
+      }
+    }
+  }
+
+  tet_infoline("The components deeper than the maximum depth are ignored.");
+  expectedComponents.clear();
+  FindComponentsRecursively(root.get(), Point(15, 15), 2u, expectedComponents);
+  DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(15, 15), CoordinateType::WINDOW, 2u, components));
+  DALI_TEST_EQUALS(components.size(), static_cast<std::size_t>(2u), TEST_LOCATION);
+  DALI_TEST_CHECK(components == expectedComponents);
+
+  END_TEST;
+}
+
+int UtcDaliAccessibleSpatialIndexInvalidate(void)
+{
+  tet_infoline("The index is rebuilt when it is invalidated, and when an object it holds is destroyed.");
+
+  TestRegistry            registry;
+  AccessibleSpatialIndex& index = registry.index;
+  auto                    root  = CreateTree();
+
+  std::vector<Component*> components;
+  DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(5, 5), CoordinateType::WINDOW, 10000u, components));
+  DALI_TEST_EQUALS(components.size(), static_cast<std::size_t>(3u), TEST_LOCATION);
+  DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(505, 505), CoordinateType::WINDOW, 10000u, components));
+  DALI_TEST_EQUALS(index.GetStatistics().builds, static_cast<uint64_t>(1u), TEST_LOCATION);
+
+  // The root, the containers and the items
+  DALI_TEST_EQUALS(registry.registeredObjects.size(), static_cast<std::size_t>(10101u), TEST_LOCATION);
+
+  tet_infoline("A moved item is found at its new position after an invalidation.");
+  DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(52, 52), CoordinateType::WINDOW, 10000u, components));
+  DALI_TEST_EQUALS(components.size(), static_cast<std::size_t>(3u), TEST_LOCATION);
+  auto* item     = root->mChildren[0]->mChildren[0].get();
+  item->mExtents = Rect<>(50.0f, 50.0f, 10.0f, 10.0f);
+  index.Invalidate();
+  DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(52, 52), CoordinateType::WINDOW, 10000u, components));
+  DALI_TEST_EQUALS(index.GetStatistics().builds, static_cast<uint64_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(components.size(), static_cast<std::size_t>(4u), TEST_LOCATION);
+  DALI_TEST_CHECK(components[1] == item); // Below the item added after it
+
+  tet_infoline("A destroyed item is never returned.");
+  DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(555, 555), CoordinateType::WINDOW, 10000u, components));
+  DALI_TEST_EQUALS(components.size(), static_cast<std::size_t>(3u), TEST_LOCATION);
+  auto& container = root->mChildren[55]->mChildren;
+  container.erase(container.begin() + 55);
+  DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(555, 555), CoordinateType::WINDOW, 10000u, components));
+  DALI_TEST_EQUALS(components.size(), static_cast<std::size_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(index.GetStatistics().builds, static_cast<uint64_t>(3u), TEST_LOCATION);
+
+  tet_infoline("A destroyed item is never returned, even where the point is not in it.");
+  DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(5, 5), CoordinateType::WINDOW, 10000u, components));
+  DALI_TEST_EQUALS(index.GetStatistics().builds, static_cast<uint64_t>(3u), TEST_LOCATION);
+  root->mChildren[99]->mChildren.clear();
+  DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(5, 5), CoordinateType::WINDOW, 10000u, components));
+  DALI_TEST_EQUALS(index.GetStatistics().builds, static_cast<uint64_t>(4u), TEST_LOCATION);
+  DALI_TEST_CHECK(index.FindComponentsAtPoint(root.get(), Point(995, 995), CoordinateType::WINDOW, 10000u, components));
+  DALI_TEST_EQUALS(components.size(), static_cast<std::size_t>(2u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliAccessibleSpatialIndexGetChildren(void)
+{
+  tet_infoline("The children are sorted from top left, line by line, and read from the tree once.");
+
+  TestRegistry            registry;
+  AccessibleSpatialIndex& index = registry.index;
+
+  auto root = std::make_shared<TestAccessible>(Rect<>(0.0f, 0.0f, 300.0f, 300.0f));
+  auto* c   = root->AddChild(Rect<>(100.0f, 100.0f, 50.0f, 50.0f));
+  auto* a   = root->AddChild(Rect<>(100.0f, 0.0f, 50.0f, 50.0f));
+  auto* d   = root->AddChild(Rect<>(0.0f, 100.0f, 50.0f, 50.0f));
+  auto* b   = root->AddChild(Rect<>(0.0f, 0.0f, 50.0f, 50.0f));
+  root->AddChild(Rect<>(0.0f, 0.0f, 0.0f, 50.0f)); // No area
+
+  for(int i = 0; i < 3; ++i)
+  {
+    const auto& children = index.GetChildren(root.get());
+    DALI_TEST_EQUALS(children.components.size(), static_cast<std::size_t>(5u), TEST_LOCATION);
+    DALI_TEST_CHECK(children.sortedComponents == std::vector<Component*>({b, a, d, c}));
+    DALI_TEST_CHECK(children.firstChild == c);
+  }
+  DALI_TEST_EQUALS(index.GetStatistics().childrenMisses, static_cast<uint64_t>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(index.GetStatistics().childrenHits, static_cast<uint64_t>(2u), TEST_LOCATION);
+
+  tet_infoline("A removed child makes the children read again.");
+  root->mChildren.erase(root->mChildren.begin());
+  DALI_TEST_CHECK(index.GetChildren(root.get()).sortedComponents == std::vector<Component*>({b, a, d}));
+  DALI_TEST_EQUALS(index.GetStatistics().childrenMisses, static_cast<uint64_t>(2u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliAccessibleSpatialIndexBenchmark(void)
+{
+  tet_infoline("Measure the hit-tests of a tree of 10k nodes, with the index and with the recursive walk.");
+
+  auto                   root = CreateTree();
+  AccessibleSpatialIndex index;
+
+  const int numberOfQueries = 10000;
+  std::vector<Point> points;
+  for(int i = 0; i < numberOfQueries; ++i)
+  {
+    points.emplace_back((i * 7919) % 1000, (i * 104729) % 1000);
+  }
+
+  std::vector<Component*> components;
+  uint64_t                indexCount = 0u;
+  auto                    start      = std::chrono::steady_clock::now();
+  for(const Point& point : points)
+  {
+    index.FindComponentsAtPoint(root.get(), point, CoordinateType::WINDOW, 10000u, components);
+    indexCount += components.size();
+  }
+  const double indexSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  uint64_t recursiveCount = 0u;
+  start                   = std::chrono::steady_clock::now();
+  for(const Point& point : points)
+  {
+    components.clear();
+    FindComponentsRecursively(root.get(), point, 10000u, components);
+    recursiveCount += components.size();
+  }
+  const double recursiveSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  DALI_TEST_EQUALS(indexCount, recursiveCount, TEST_LOCATION);
+
+  const auto& statistics = index.GetStatistics();
+  tet_printf("Accessible spatial index : %d queries, %llu builds, %f us per query (%f us with the recursive walk)\n",
+             numberOfQueries,
+             static_cast<unsigned long long>(statistics.builds),
+             indexSeconds * 1e6 / numberOfQueries,
+             recursiveSeconds * 1e6 / numberOfQueries);
+
+  END_TEST;
+}
@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <adaptor-test-application.h>
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/async-task-manager-impl.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Dali;
+
+void utc_dali_async_task_manager_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_async_task_manager_cleanup(void)
+{
+  unsetenv(DALI_ENV_ASYNC_MANAGER_THREAD_POOL_SIZE);
+  unsetenv(DALI_ENV_ASYNC_MANAGER_LOW_PRIORITY_THREAD_POOL_SIZE);
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr auto WAIT_TIMEOUT = std::chrono::seconds(5);
+
+/**
+ * @brief Records the tasks processed by the worker threads.
+ */
+struct TaskRecord
+{
+  std::mutex              mutex;
+  std::condition_variable condition;
+  std::vector<uint32_t>   processOrder; ///< The ids of the tasks, in the order their Process() started.
+  uint32_t                completedCount{0u};
+  bool                    gateOpened{false};
+};
+
+class TestTask : public AsyncTask
+{
+public:
+  TestTask(TaskRecord& record, uint32_t id, PriorityType priorityType, bool gated = false)
+  : AsyncTask(MakeCallback(&TestTask::OnCompleted), priorityType, ThreadType::WORKER_THREAD),
+    mRecord(record),
+    mId(id),
+    mGated(gated)
+  {
+  }
+
+  void Process() override
+  {
+    std::unique_lock<std::mutex> lock(mRecord.mutex);
+    mRecord.processOrder.push_back(mId);
+    mRecord.condition.notify_all();
+    if(mGated)
+    {
+      mRecord.condition.wait(lock, [this]() { return mRecord.gateOpened; });
+    }
+    mCanceledInProcess = IsCanceled();
+  }
+
+  bool IsReady() override
+  {
+    return true;
+  }
+
+  std::string_view GetTaskName() const override
+  {
+    return "TestTask";
+  }
+
+  static void OnCompleted(AsyncTaskPtr task)
+  {
+    TaskRecord&                 record = static_cast<TestTask*>(task.Get())->mRecord;
+    std::lock_guard<std::mutex> lock(record.mutex);
+    ++record.completedCount;
+    record.condition.notify_all();
+  }
+
+  bool IsCanceledInProcess() const
+  {
+    return mCanceledInProcess;
+  }
+
+private:
+  TaskRecord&    mRecord;
+  const uint32_t mId;
+  const bool     mGated;
+  bool           mCanceledInProcess{false};
+};
+
+/**
+ * @brief A short task, which measures the time from AddTask() to its completion.
+ */
+class LatencyTask : public AsyncTask
+{
+public:
+  LatencyTask(TaskRecord& record, PriorityType priorityType)
+  : AsyncTask(MakeCallback(&LatencyTask::OnCompleted), priorityType, ThreadType::WORKER_THREAD),
+    mRecord(record),
+    mAddedTime(Clock::now())
+  {
+  }
+
+  void Process() override
+  {
+    // A few microseconds of work, like a small decoding job.
+    volatile uint32_t value = 0u;
+    for(uint32_t i = 0u; i < 2000u; ++i)
+    {
+      value = value + i;
+    }
+  }
+
+  bool IsReady() override
+  {
+    return true;
+  }
+
+  std::string_view GetTaskName() const override
+  {
+    return "LatencyTask";
+  }
+
+  static void OnCompleted(AsyncTaskPtr task)
+  {
+    LatencyTask* latencyTask = static_cast<LatencyTask*>(task.Get());
+    latencyTask->mLatency    = Clock::now() - latencyTask->mAddedTime;
+
+    std::lock_guard<std::mutex> lock(latencyTask->mRecord.mutex);
+    ++latencyTask->mRecord.completedCount;
+    latencyTask->mRecord.condition.notify_all();
+  }
+
+  TaskRecord&             mRecord;
+  const Clock::time_point mAddedTime;
+  Clock::duration         mLatency{};
+};
+
+using TestTaskPtr    = IntrusivePtr<TestTask>;
+using LatencyTaskPtr = IntrusivePtr<LatencyTask>;
+
+using AsyncTaskManagerPtr = IntrusivePtr<Internal::Adaptor::AsyncTaskManager>;
+
+AsyncTaskManagerPtr CreateAsyncTaskManager(uint32_t numberOfThreads, uint32_t numberOfLowPriorityThreads)
+{
+  setenv(DALI_ENV_ASYNC_MANAGER_THREAD_POOL_SIZE, std::to_string(numberOfThreads).c_str(), 1);
+  setenv(DALI_ENV_ASYNC_MANAGER_LOW_PRIORITY_THREAD_POOL_SIZE, std::to_string(numberOfLowPriorityThreads).c_str(), 1);
+  return AsyncTaskManagerPtr(new Internal::Adaptor::AsyncTaskManager());
+}
+
+bool WaitForCompleted(TaskRecord& record, uint32_t count)
+{
+  std::unique_lock<std::mutex> lock(record.mutex);
+  return record.condition.wait_for(lock, WAIT_TIMEOUT, [&record, count]() { return record.completedCount >= count; });
+}
+
+bool WaitForProcessed(TaskRecord& record, uint32_t count)
+{
+  std::unique_lock<std::mutex> lock(record.mutex);
+  return record.condition.wait_for(lock, WAIT_TIMEOUT, [&record, count]() { return record.processOrder.size() >= count; });
+}
+
+void OpenGate(TaskRecord& record)
+{
+  std::lock_guard<std::mutex> lock(record.mutex);
+  record.gateOpened = true;
+  record.condition.notify_all();
+}
+
+std::vector<uint32_t> GetProcessOrder(TaskRecord& record)
+{
+  std::lock_guard<std::mutex> lock(record.mutex);
+  return record.processOrder;
+}
+
+} // namespace
+
+int UtcDaliAsyncTaskManagerProcessInAddedOrder(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that the high and low priority tasks are processed in the order they were added");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager(1u, 1u);
+  TaskRecord          record;
+
+  // Keep the only thread busy until all the tasks are added.
+  manager->AddTask(new TestTask(record, 0u, AsyncTask::PriorityType::HIGH, true));
+  DALI_TEST_CHECK(WaitForProcessed(record, 1u));
+
+  manager->AddTask(new TestTask(record, 1u, AsyncTask::PriorityType::LOW));
+  manager->AddTask(new TestTask(record, 2u, AsyncTask::PriorityType::HIGH));
+  manager->AddTask(new TestTask(record, 3u, AsyncTask::PriorityType::LOW));
+  manager->AddTask(new TestTask(record, 4u, AsyncTask::PriorityType::HIGH));
+
+  OpenGate(record);
+  DALI_TEST_CHECK(WaitForCompleted(record, 5u));
+
+  const std::vector<uint32_t> expectOrder{0u, 1u, 2u, 3u, 4u};
+  DALI_TEST_CHECK(record.processOrder == expectOrder);
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskManagerLowPriorityThreadLimit(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that the low priority tasks don't take more threads than allowed, and don't block the high priority ones");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager(2u, 1u);
+  TaskRecord          record;
+
+  // The only low priority slot is busy.
+  manager->AddTask(new TestTask(record, 0u, AsyncTask::PriorityType::LOW, true));
+  DALI_TEST_CHECK(WaitForProcessed(record, 1u));
+
+  manager->AddTask(new TestTask(record, 1u, AsyncTask::PriorityType::LOW));
+  manager->AddTask(new TestTask(record, 2u, AsyncTask::PriorityType::HIGH));
+
+  // The high priority task added later runs on the other thread, the low priority one waits.
+  DALI_TEST_CHECK(WaitForCompleted(record, 1u));
+  {
+    std::lock_guard<std::mutex> lock(record.mutex);
+    const std::vector<uint32_t> expectOrder{0u, 2u};
+    DALI_TEST_CHECK(record.processOrder == expectOrder);
+  }
+
+  OpenGate(record);
+
+  // The low priority task is taken when the slot is free again.
+  manager->AddTask(new TestTask(record, 3u, AsyncTask::PriorityType::HIGH));
+  DALI_TEST_CHECK(WaitForCompleted(record, 4u));
+  DALI_TEST_EQUALS(record.processOrder.size(), static_cast<size_t>(4u), TEST_LOCATION);
+  DALI_TEST_CHECK(std::find(record.processOrder.begin(), record.processOrder.end(), 1u) != record.processOrder.end());
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskManagerStressBenchmark(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Measure the throughput and the p99 latency of short tasks, at 1 to 16 worker threads");
+
+  constexpr uint32_t TASK_COUNT = 4000u;
+
+  for(const uint32_t numberOfThreads : {1u, 2u, 4u, 8u, 16u})
+  {
+    AsyncTaskManagerPtr manager = CreateAsyncTaskManager(numberOfThreads, std::max(1u, numberOfThreads * 3u / 4u));
+    TaskRecord          record;
+
+    std::vector<LatencyTaskPtr> tasks;
+    tasks.reserve(TASK_COUNT);
+
+    const auto startTime = Clock::now();
+    for(uint32_t i = 0u; i < TASK_COUNT; ++i)
+    {
+      // One of four tasks is low priority.
+      tasks.push_back(new LatencyTask(record, (i % 4u == 3u) ? AsyncTask::PriorityType::LOW : AsyncTask::PriorityType::HIGH));
+      manager->AddTask(tasks.back());
+    }
+    DALI_TEST_CHECK(WaitForCompleted(record, TASK_COUNT));
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - startTime).count();
+
+    std::vector<Clock::duration> latencies;
+    latencies.reserve(TASK_COUNT);
+    for(const auto& task : tasks)
+    {
+      latencies.push_back(task->mLatency);
+    }
+    std::sort(latencies.begin(), latencies.end());
+    const auto p99 = std::chrono::duration<double, std::milli>(latencies[TASK_COUNT * 99u / 100u]).count();
+
+    tet_printf("%2u threads : %8.0f tasks/sec, p99 latency %7.3f ms\n", numberOfThreads, TASK_COUNT / elapsed, p99);
+
+    manager.Reset();
+  }
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskManagerDependencyOrder(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that the task is processed after its dependencies are completed, even if some threads are idle");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager(4u, 3u);
+  TaskRecord          record;
+
+  TestTaskPtr task0 = new TestTask(record, 0u, AsyncTask::PriorityType::HIGH, true);
+  TestTaskPtr task1 = new TestTask(record, 1u, AsyncTask::PriorityType::HIGH);
+  TestTaskPtr task2 = new TestTask(record, 2u, AsyncTask::PriorityType::LOW);
+  task1->AddDependency(task0);
+  task2->AddDependency(task1);
+  task2->AddDependency(task0);
+
+  manager->AddTask(task0);
+  manager->AddTask(task1);
+  manager->AddTask(task2);
+
+  DALI_TEST_CHECK(WaitForProcessed(record, 1u));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  DALI_TEST_EQUALS(GetProcessOrder(record).size(), static_cast<size_t>(1u), TEST_LOCATION);
+
+  OpenGate(record);
+  DALI_TEST_CHECK(WaitForCompleted(record, 3u));
+
+  const std::vector<uint32_t> expectOrder{0u, 1u, 2u};
+  DALI_TEST_CHECK(GetProcessOrder(record) == expectOrder);
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskManagerDependencyNotAdded(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that the dependency which is not added to the manager doesn't block the task");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager(2u, 1u);
+  TaskRecord          record;
+
+  TestTaskPtr neverAdded = new TestTask(record, 0u, AsyncTask::PriorityType::HIGH);
+  TestTaskPtr task       = new TestTask(record, 1u, AsyncTask::PriorityType::HIGH);
+  task->AddDependency(neverAdded);
+
+  manager->AddTask(task);
+  DALI_TEST_CHECK(WaitForCompleted(record, 1u));
+
+  const std::vector<uint32_t> expectOrder{1u};
+  DALI_TEST_CHECK(GetProcessOrder(record) == expectOrder);
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskManagerCancelBeforeRun(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that the task removed before it runs is never processed, and its dependents are released");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager(1u, 1u);
+  TaskRecord          record;
+
+  manager->AddTask(new TestTask(record, 0u, AsyncTask::PriorityType::HIGH, true));
+  DALI_TEST_CHECK(WaitForProcessed(record, 1u));
+
+  TestTaskPtr removed   = new TestTask(record, 1u, AsyncTask::PriorityType::HIGH);
+  TestTaskPtr dependent = new TestTask(record, 2u, AsyncTask::PriorityType::HIGH);
+  dependent->AddDependency(removed);
+
+  manager->AddTask(removed);
+  manager->AddTask(dependent);
+  manager->RemoveTask(removed);
+
+  OpenGate(record);
+  DALI_TEST_CHECK(WaitForCompleted(record, 2u));
+
+  const std::vector<uint32_t> expectOrder{0u, 2u};
+  DALI_TEST_CHECK(GetProcessOrder(record) == expectOrder);
+  DALI_TEST_CHECK(!removed->IsCanceled());
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskManagerCancelWhileRunning(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that the running task sees IsCanceled() when it is removed");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager(1u, 1u);
+  TaskRecord          record;
+
+  TestTaskPtr task = new TestTask(record, 0u, AsyncTask::PriorityType::HIGH, true);
+  manager->AddTask(task);
+  DALI_TEST_CHECK(WaitForProcessed(record, 1u));
+  DALI_TEST_CHECK(!task->IsCanceled());
+
+  manager->RemoveTask(task);
+  DALI_TEST_CHECK(task->IsCanceled());
+
+  OpenGate(record);
+
+  // The completed callback of the canceled task is not called. Wait for the next task.
+  manager->AddTask(new TestTask(record, 1u, AsyncTask::PriorityType::HIGH));
+  DALI_TEST_CHECK(WaitForCompleted(record, 1u));
+  DALI_TEST_CHECK(task->IsCanceledInProcess());
+
+  // Added again, it is not canceled anymore.
+  manager->AddTask(task);
+  DALI_TEST_CHECK(!task->IsCanceled());
+  DALI_TEST_CHECK(WaitForCompleted(record, 2u));
+  DALI_TEST_CHECK(!task->IsCanceledInProcess());
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskManagerPriorityValueOrder(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that the task with the larger priority value is processed first");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager(1u, 1u);
+  TaskRecord          record;
+
+  manager->AddTask(new TestTask(record, 0u, AsyncTask::PriorityType::HIGH, true));
+  DALI_TEST_CHECK(WaitForProcessed(record, 1u));
+
+  const int32_t priorityValues[] = {1, 5, 0, 3, 5};
+  for(uint32_t i = 0u; i < 5u; ++i)
+  {
+    TestTaskPtr task = new TestTask(record, i + 1u, (i % 2u) ? AsyncTask::PriorityType::LOW : AsyncTask::PriorityType::HIGH);
+    task->SetPriorityValue(priorityValues[i]);
+    DALI_TEST_EQUALS(task->GetPriorityValue(), priorityValues[i], TEST_LOCATION);
+    manager->AddTask(task);
+  }
+
+  OpenGate(record);
+  DALI_TEST_CHECK(WaitForCompleted(record, 6u));
+
+  // The same priority values are processed in the order they were added.
+  const std::vector<uint32_t> expectOrder{0u, 2u, 5u, 4u, 1u, 3u};
+  DALI_TEST_CHECK(GetProcessOrder(record) == expectOrder);
+
+  END_TEST;
+}
+
+int UtcDaliAsyncTaskManagerDeadlineOrder(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that the task which missed its deadline is processed after the others");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager(1u, 1u);
+  TaskRecord          record;
+
+  manager->AddTask(new TestTask(record, 0u, AsyncTask::PriorityType::HIGH, true));
+  DALI_TEST_CHECK(WaitForProcessed(record, 1u));
+
+  TestTaskPtr late = new TestTask(record, 1u, AsyncTask::PriorityType::HIGH);
+  late->SetDeadline(1u);
+  late->SetPriorityValue(10);
+  manager->AddTask(late);
+
+  manager->AddTask(new TestTask(record, 2u, AsyncTask::PriorityType::HIGH));
+
+  TestTaskPtr inTime = new TestTask(record, 3u, AsyncTask::PriorityType::HIGH);
+  inTime->SetDeadline(60000u);
+  manager->AddTask(inTime);
+
+  // Let the deadline pass.
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+  OpenGate(record);
+  DALI_TEST_CHECK(WaitForCompleted(record, 4u));
+
+  const std::vector<uint32_t> expectOrder{0u, 2u, 3u, 1u};
+  DALI_TEST_CHECK(GetProcessOrder(record) == expectOrder);
+
+  END_TEST;
+}
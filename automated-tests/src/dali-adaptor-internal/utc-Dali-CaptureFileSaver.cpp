@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <adaptor-test-application.h>
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/async-task-manager-impl.h>
+#include <dali/internal/system/common/capture-file-saver.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <stdlib.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_capture_file_saver_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_capture_file_saver_cleanup(void)
+{
+  unsetenv(DALI_ENV_ASYNC_MANAGER_THREAD_POOL_SIZE);
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr auto WAIT_TIMEOUT = std::chrono::seconds(5);
+
+using AsyncTaskManagerPtr = IntrusivePtr<Internal::Adaptor::AsyncTaskManager>;
+
+/**
+ * @brief Encode functions, which wait for the test to let them finish.
+ */
+struct EncodeGate
+{
+  std::mutex              mutex;
+  std::condition_variable condition;
+  bool                    opened{false};
+
+  CaptureFileSaver::EncodeFunction MakeEncodeFunction(bool succeeded)
+  {
+    return [this, succeeded](const std::string& path) {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [this]() { return opened; });
+      return succeeded;
+    };
+  }
+
+  void Open()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    opened = true;
+    condition.notify_all();
+  }
+};
+
+using FinishedRecord = std::vector<std::pair<std::string, bool>>;
+
+AsyncTaskManagerPtr CreateAsyncTaskManager()
+{
+  setenv(DALI_ENV_ASYNC_MANAGER_THREAD_POOL_SIZE, "2", 1);
+  return AsyncTaskManagerPtr(new Internal::Adaptor::AsyncTaskManager());
+}
+
+/**
+ * @brief Run the completion callbacks on this thread, as the event thread would, until the number of finished saves is reached.
+ */
+bool WaitForFinished(AsyncTaskManagerPtr manager, const FinishedRecord& record, size_t count)
+{
+  const auto deadline = Clock::now() + WAIT_TIMEOUT;
+  while(record.size() < count && Clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    manager->TasksCompleted();
+  }
+  return record.size() == count;
+}
+
+} // namespace
+
+int UtcDaliCaptureFileSaverFinishedAfterEncode(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that the finished function is called on the event thread once the file is encoded");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager();
+  EncodeGate          gate;
+  FinishedRecord      record;
+  CaptureFileSaver    saver(*manager, [&record](const std::string& path, bool succeeded) { record.emplace_back(path, succeeded); });
+
+  DALI_TEST_CHECK(!saver.IsSaving());
+  saver.Save("capture.png", gate.MakeEncodeFunction(true));
+  DALI_TEST_CHECK(saver.IsSaving());
+
+  // Nothing is reported while the file is encoded.
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  manager->TasksCompleted();
+  DALI_TEST_EQUALS(record.size(), static_cast<size_t>(0u), TEST_LOCATION);
+  DALI_TEST_CHECK(saver.IsSaving());
+
+  gate.Open();
+  DALI_TEST_CHECK(WaitForFinished(manager, record, 1u));
+  DALI_TEST_EQUALS(record[0].first, std::string("capture.png"), TEST_LOCATION);
+  DALI_TEST_CHECK(record[0].second);
+  DALI_TEST_CHECK(!saver.IsSaving());
+
+  END_TEST;
+}
+
+int UtcDaliCaptureFileSaverFailed(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that a failed encode is reported as failed");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager();
+  EncodeGate          gate;
+  FinishedRecord      record;
+  CaptureFileSaver    saver(*manager, [&record](const std::string& path, bool succeeded) { record.emplace_back(path, succeeded); });
+
+  gate.Open();
+  saver.Save("failed.png", gate.MakeEncodeFunction(false));
+  DALI_TEST_CHECK(WaitForFinished(manager, record, 1u));
+  DALI_TEST_EQUALS(record[0].first, std::string("failed.png"), TEST_LOCATION);
+  DALI_TEST_CHECK(!record[0].second);
+  DALI_TEST_CHECK(!saver.IsSaving());
+
+  END_TEST;
+}
+
+int UtcDaliCaptureFileSaverSaveWhilePending(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that a save started while another is pending reports its own path and state, as well as the pending one");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager();
+  EncodeGate          gate;
+  FinishedRecord      record;
+  CaptureFileSaver    saver(*manager, [&record](const std::string& path, bool succeeded) { record.emplace_back(path, succeeded); });
+
+  // As a capture started before the previous one is saved.
+  saver.Save("first.png", gate.MakeEncodeFunction(false));
+  saver.Save("second.png", gate.MakeEncodeFunction(true));
+  DALI_TEST_CHECK(saver.IsSaving());
+
+  gate.Open();
+  DALI_TEST_CHECK(WaitForFinished(manager, record, 2u));
+  DALI_TEST_CHECK(!saver.IsSaving());
+
+  // The saves may complete in any order, each one with its own path.
+  for(const auto& finished : record)
+  {
+    DALI_TEST_CHECK(finished.first == "first.png" || finished.first == "second.png");
+    DALI_TEST_EQUALS(finished.second, finished.first == "second.png", TEST_LOCATION);
+  }
+  DALI_TEST_CHECK(record[0].first != record[1].first);
+
+  END_TEST;
+}
+
+int UtcDaliCaptureFileSaverDestroyedWhilePending(void)
+{
+  AdaptorTestApplication application;
+
+  tet_infoline("Check that a saver destroyed with a pending save doesn't report it");
+
+  AsyncTaskManagerPtr manager = CreateAsyncTaskManager();
+  EncodeGate          gate;
+  FinishedRecord      record;
+  {
+    CaptureFileSaver saver(*manager, [&record](const std::string& path, bool succeeded) { record.emplace_back(path, succeeded); });
+    saver.Save("destroyed.png", gate.MakeEncodeFunction(true));
+  }
+
+  gate.Open();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  manager->TasksCompleted();
+  DALI_TEST_EQUALS(record.size(), static_cast<size_t>(0u), TEST_LOCATION);
+
+  END_TEST;
+}
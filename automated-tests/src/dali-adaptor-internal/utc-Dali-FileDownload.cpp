@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/imaging/common/file-download.h>
+#include <dali/internal/imaging/common/http-disk-cache.h>
+
+using namespace Dali;
+using namespace Dali::TizenPlatform::Network;
+
+namespace
+{
+constexpr size_t   MAXIMUM_DOWNLOAD_SIZE = 50u * 1024u * 1024u;
+constexpr uint32_t NUMBER_OF_IMAGES      = 1000u;
+constexpr size_t   IMAGE_SIZE            = 3000u;
+
+/**
+ * @brief Minimal HTTP/1.1 server on the loopback interface. It answers every request with the same body and keeps the connections alive.
+ *
+ * If an ETag is given, the requests with a matching If-None-Match header are answered with 304 Not Modified.
+ */
+class LocalHttpServer
+{
+public:
+  LocalHttpServer(std::vector<uint8_t> body, std::string cacheHeaders = std::string(), std::string etag = std::string())
+  : mBody(std::move(body)),
+    mCacheHeaders(std::move(cacheHeaders)),
+    mETag(std::move(etag))
+  {
+    // The urls are unique to this server, so the entries cached by previous runs are not used.
+    mUrlPrefix = "/" + std::to_string(getpid()) + "-" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "/";
+
+    mListenSocket = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse     = 1;
+    setsockopt(mListenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address{};
+    address.sin_family      = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port        = 0; // Any free port.
+    bind(mListenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+    listen(mListenSocket, 64);
+
+    socklen_t length = sizeof(address);
+    getsockname(mListenSocket, reinterpret_cast<sockaddr*>(&address), &length);
+    mPort = ntohs(address.sin_port);
+
+    mAcceptThread = std::thread([this]() { AcceptLoop(); });
+  }
+
+  ~LocalHttpServer()
+  {
+    mRunning = false;
+    mAcceptThread.join();
+    for(auto& thread : mConnectionThreads)
+    {
+      thread.join();
+    }
+    close(mListenSocket);
+  }
+
+  std::string GetUrl(uint32_t index) const
+  {
+    return "http://127.0.0.1:" + std::to_string(mPort) + mUrlPrefix + "image" + std::to_string(index) + ".png";
+  }
+
+  uint32_t GetConnectionCount() const
+  {
+    return mConnectionCount;
+  }
+
+  uint32_t GetRequestCount() const
+  {
+    return mRequestCount;
+  }
+
+  uint32_t GetNotModifiedCount() const
+  {
+    return mNotModifiedCount;
+  }
+
+private:
+  void AcceptLoop()
+  {
+    while(mRunning)
+    {
+      pollfd fd{mListenSocket, POLLIN, 0};
+      if(poll(&fd, 1, 50) > 0)
+      {
+        int connection = accept(mListenSocket, nullptr, nullptr);
+        if(connection >= 0)
+        {
+          ++mConnectionCount;
+          mConnectionThreads.emplace_back([this, connection]() { Serve(connection); });
+        }
+      }
+    }
+  }
+
+  void Serve(int connection)
+  {
+    std::string request;
+    char        buffer[4096];
+    while(mRunning)
+    {
+      pollfd fd{connection, POLLIN, 0};
+      if(poll(&fd, 1, 50) <= 0)
+      {
+        continue;
+      }
+
+      const ssize_t received = recv(connection, buffer, sizeof(buffer), 0);
+      if(received <= 0)
+      {
+        break;
+      }
+      request.append(buffer, received);
+
+      size_t end;
+      while((end = request.find("\r\n\r\n")) != std::string::npos)
+      {
+        const bool isHead        = (request.compare(0u, 4u, "HEAD") == 0);
+        const bool isNotModified = !mETag.empty() && request.substr(0u, end + 2u).find("If-None-Match: " + mETag + "\r\n") != std::string::npos;
+        request.erase(0u, end + 4u);
+        ++mRequestCount;
+
+        std::string headers = mCacheHeaders + (mETag.empty() ? std::string() : "ETag: " + mETag + "\r\n");
+        std::string response;
+        if(isNotModified)
+        {
+          ++mNotModifiedCount;
+          response = "HTTP/1.1 304 Not Modified\r\n" + headers + "\r\n";
+        }
+        else
+        {
+          response = "HTTP/1.1 200 OK\r\nContent-Type: image/png\r\n" + headers + "Content-Length: " + std::to_string(mBody.size()) + "\r\n\r\n";
+          if(!isHead)
+          {
+            response.append(mBody.begin(), mBody.end());
+          }
+        }
+        send(connection, response.data(), response.size(), MSG_NOSIGNAL);
+      }
+    }
+    close(connection);
+  }
+
+private:
+  std::vector<uint8_t>     mBody;
+  std::string              mCacheHeaders;
+  std::string              mETag;
+  std::string              mUrlPrefix;
+  int                      mListenSocket{-1};
+  uint16_t                 mPort{0u};
+  std::atomic<bool>        mRunning{true};
+  std::atomic<uint32_t>    mConnectionCount{0u};
+  std::atomic<uint32_t>    mRequestCount{0u};
+  std::atomic<uint32_t>    mNotModifiedCount{0u};
+  std::thread              mAcceptThread;
+  std::vector<std::thread> mConnectionThreads;
+};
+
+std::vector<uint8_t> CreateImageData()
+{
+  std::vector<uint8_t> data(IMAGE_SIZE);
+  for(size_t i = 0u; i < data.size(); ++i)
+  {
+    data[i] = static_cast<uint8_t>(i * 7u);
+  }
+  return data;
+}
+
+} // namespace
+
+void utc_dali_internal_file_download_startup(void)
+{
+  test_return_value = TET_UNDEF;
+
+  // The local server must be reached directly.
+  unsetenv("http_proxy");
+}
+
+void utc_dali_internal_file_download_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliFileDownloadReuseConnection(void)
+{
+  tet_infoline("Download many small images from a local server, one after another.");
+
+  const std::vector<uint8_t> imageData = CreateImageData();
+  LocalHttpServer            server(imageData);
+
+  uint32_t   succeededCount = 0u;
+  const auto start          = std::chrono::steady_clock::now();
+  for(uint32_t i = 0u; i < NUMBER_OF_IMAGES; ++i)
+  {
+    Dali::Vector<uint8_t> dataBuffer;
+    size_t                dataSize = 0u;
+    if(DownloadRemoteFileIntoMemory(server.GetUrl(i), dataBuffer, dataSize, MAXIMUM_DOWNLOAD_SIZE) &&
+       dataSize == imageData.size() &&
+       memcmp(dataBuffer.Begin(), imageData.data(), dataSize) == 0)
+    {
+      ++succeededCount;
+    }
+  }
+  const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  tet_printf("Downloaded %u images : %f requests/sec, %u connections\n", NUMBER_OF_IMAGES, NUMBER_OF_IMAGES * 1000.0 / milliseconds, server.GetConnectionCount());
+
+  DALI_TEST_EQUALS(succeededCount, NUMBER_OF_IMAGES, TEST_LOCATION);
+
+  // A single request per image, over a reused connection.
+  DALI_TEST_EQUALS(server.GetRequestCount(), NUMBER_OF_IMAGES, TEST_LOCATION);
+  DALI_TEST_EQUALS(server.GetConnectionCount(), 1u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFileDownloadBatch(void)
+{
+  tet_infoline("Download many small images from a local server at the same time.");
+
+  const std::vector<uint8_t> imageData = CreateImageData();
+  LocalHttpServer            server(imageData);
+
+  std::vector<std::string> urls;
+  for(uint32_t i = 0u; i < NUMBER_OF_IMAGES; ++i)
+  {
+    urls.push_back(server.GetUrl(i));
+  }
+
+  std::vector<DownloadResult> results;
+
+  const auto   start        = std::chrono::steady_clock::now();
+  const bool   succeeded    = DownloadRemoteFilesIntoMemory(urls, results, MAXIMUM_DOWNLOAD_SIZE, 8u);
+  const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  tet_printf("Downloaded %u images in batch : %f requests/sec, %u connections\n", NUMBER_OF_IMAGES, NUMBER_OF_IMAGES * 1000.0 / milliseconds, server.GetConnectionCount());
+
+  DALI_TEST_CHECK(succeeded);
+  DALI_TEST_EQUALS(results.size(), urls.size(), TEST_LOCATION);
+  for(const auto& result : results)
+  {
+    DALI_TEST_CHECK(result.succeeded);
+    DALI_TEST_EQUALS(result.dataSize, imageData.size(), TEST_LOCATION);
+    DALI_TEST_CHECK(memcmp(result.dataBuffer.Begin(), imageData.data(), result.dataSize) == 0);
+  }
+  DALI_TEST_EQUALS(server.GetRequestCount(), NUMBER_OF_IMAGES, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFileDownloadMaximumSize(void)
+{
+  tet_infoline("Fail to download an image bigger than the maximum allowed size.");
+
+  const std::vector<uint8_t> imageData = CreateImageData();
+  LocalHttpServer            server(imageData);
+
+  Dali::Vector<uint8_t> dataBuffer;
+  size_t                dataSize = 0u;
+  DALI_TEST_CHECK(!DownloadRemoteFileIntoMemory(server.GetUrl(0u), dataBuffer, dataSize, imageData.size() / 2u));
+
+  tet_infoline("Fail to download an empty url.");
+  DALI_TEST_CHECK(!DownloadRemoteFileIntoMemory(std::string(), dataBuffer, dataSize, MAXIMUM_DOWNLOAD_SIZE));
+
+  END_TEST;
+}
+
+int UtcDaliFileDownloadDiskCacheFresh(void)
+{
+  tet_infoline("Download an image twice. The second time it is loaded from the disk cache without any request.");
+
+  if(!HttpDiskCache::Get().IsEnabled())
+  {
+    tet_infoline("The http disk cache is not available");
+    END_TEST;
+  }
+
+  const std::vector<uint8_t> imageData = CreateImageData();
+  LocalHttpServer            server(imageData, "Cache-Control: max-age=3600\r\n");
+
+  for(uint32_t i = 0u; i < 2u; ++i)
+  {
+    Dali::Vector<uint8_t> dataBuffer;
+    size_t                dataSize = 0u;
+    DALI_TEST_CHECK(DownloadRemoteFileIntoMemory(server.GetUrl(0u), dataBuffer, dataSize, MAXIMUM_DOWNLOAD_SIZE));
+    DALI_TEST_EQUALS(dataSize, imageData.size(), TEST_LOCATION);
+    DALI_TEST_CHECK(memcmp(dataBuffer.Begin(), imageData.data(), dataSize) == 0);
+  }
+  DALI_TEST_EQUALS(server.GetRequestCount(), 1u, TEST_LOCATION);
+
+  tet_infoline("The cached image is used in batch too.");
+  std::vector<DownloadResult> results;
+  DALI_TEST_CHECK(DownloadRemoteFilesIntoMemory({server.GetUrl(0u), server.GetUrl(1u)}, results, MAXIMUM_DOWNLOAD_SIZE));
+  for(const auto& result : results)
+  {
+    DALI_TEST_EQUALS(result.dataSize, imageData.size(), TEST_LOCATION);
+    DALI_TEST_CHECK(memcmp(result.dataBuffer.Begin(), imageData.data(), result.dataSize) == 0);
+  }
+  DALI_TEST_EQUALS(server.GetRequestCount(), 2u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFileDownloadDiskCacheRevalidate(void)
+{
+  tet_infoline("Download an image which must be revalidated. The second time the server answers 304 and the cached image is used.");
+
+  if(!HttpDiskCache::Get().IsEnabled())
+  {
+    tet_infoline("The http disk cache is not available");
+    END_TEST;
+  }
+
+  const std::vector<uint8_t> imageData = CreateImageData();
+  LocalHttpServer            server(imageData, "Cache-Control: no-cache\r\n", "\"v1\"");
+
+  for(uint32_t i = 0u; i < 2u; ++i)
+  {
+    Dali::Vector<uint8_t> dataBuffer;
+    size_t                dataSize = 0u;
+    DALI_TEST_CHECK(DownloadRemoteFileIntoMemory(server.GetUrl(0u), dataBuffer, dataSize, MAXIMUM_DOWNLOAD_SIZE));
+    DALI_TEST_EQUALS(dataSize, imageData.size(), TEST_LOCATION);
+    DALI_TEST_CHECK(memcmp(dataBuffer.Begin(), imageData.data(), dataSize) == 0);
+  }
+  DALI_TEST_EQUALS(server.GetRequestCount(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(server.GetNotModifiedCount(), 1u, TEST_LOCATION);
+
+  tet_infoline("A no-store response is never cached.");
+  LocalHttpServer noStoreServer(imageData, "Cache-Control: no-store\r\n", "\"v1\"");
+  for(uint32_t i = 0u; i < 2u; ++i)
+  {
+    Dali::Vector<uint8_t> dataBuffer;
+    size_t                dataSize = 0u;
+    DALI_TEST_CHECK(DownloadRemoteFileIntoMemory(noStoreServer.GetUrl(0u), dataBuffer, dataSize, MAXIMUM_DOWNLOAD_SIZE));
+    DALI_TEST_EQUALS(dataSize, imageData.size(), TEST_LOCATION);
+  }
+  DALI_TEST_EQUALS(noStoreServer.GetRequestCount(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(noStoreServer.GetNotModifiedCount(), 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFileDownloadDiskCacheUpdateExpiryTime(void)
+{
+  tet_infoline("Update the expiry time of a cached entry. The content and the validators are kept.");
+
+  HttpDiskCache& cache = HttpDiskCache::Get();
+  if(!cache.IsEnabled())
+  {
+    tet_infoline("The http disk cache is not available");
+    END_TEST;
+  }
+
+  const std::vector<uint8_t> imageData = CreateImageData();
+  const std::string          url       = "http://127.0.0.1/" + std::to_string(getpid()) + "/update-expiry-time.png";
+  const int64_t              now       = HttpDiskCache::GetCurrentTime();
+
+  HttpDiskCache::Metadata metadata;
+  metadata.expiryTime = now;
+  metadata.etag       = "\"v1\"";
+  cache.Store(url, metadata, imageData.data(), imageData.size());
+
+  tet_infoline("Store again, as the size of a replaced entry is not counted twice.");
+  cache.Store(url, metadata, imageData.data(), imageData.size());
+  cache.UpdateExpiryTime(url, now + 3600);
+
+  HttpDiskCache::Metadata loadedMetadata;
+  DALI_TEST_CHECK(cache.LoadMetadata(url, loadedMetadata));
+  DALI_TEST_EQUALS(loadedMetadata.expiryTime, now + 3600, TEST_LOCATION);
+  DALI_TEST_EQUALS(loadedMetadata.etag, metadata.etag, TEST_LOCATION);
+
+  Dali::Vector<uint8_t> dataBuffer;
+  size_t                dataSize = 0u;
+  DALI_TEST_CHECK(cache.LoadData(url, dataBuffer, dataSize));
+  DALI_TEST_EQUALS(dataSize, imageData.size(), TEST_LOCATION);
+  DALI_TEST_CHECK(memcmp(dataBuffer.Begin(), imageData.data(), dataSize) == 0);
+
+  tet_infoline("An url which isn't cached stays not cached.");
+  cache.UpdateExpiryTime(url + ".missing", now + 3600);
+  DALI_TEST_CHECK(!cache.LoadMetadata(url + ".missing", loadedMetadata));
+
+  END_TEST;
+}
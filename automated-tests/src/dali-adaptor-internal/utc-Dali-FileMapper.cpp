@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/file-mapper.h>
+#include <stdio.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace Dali;
+
+void utc_dali_file_mapper_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_file_mapper_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+constexpr size_t FILE_SIZE = 1024u * 1024u;
+
+FILE* CreateFile()
+{
+  FILE* file = tmpfile();
+  if(file)
+  {
+    std::vector<uint8_t> content(FILE_SIZE, 0x5au);
+    fwrite(content.data(), 1u, content.size(), file);
+    fflush(file);
+  }
+  return file;
+}
+} // namespace
+
+int UtcDaliFileMapperWritableFile(void)
+{
+  tet_infoline("Check that a large file of a writable file system is mapped");
+
+  FILE* file = CreateFile();
+  DALI_TEST_CHECK(file);
+
+  Internal::Platform::FileMapper fileMapper;
+  DALI_TEST_CHECK(fileMapper.Map(file));
+  DALI_TEST_CHECK(fileMapper.IsMapped());
+  DALI_TEST_CHECK(!fileMapper.IsTruncated());
+  DALI_TEST_EQUALS(fileMapper.GetSize(), FILE_SIZE, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(fileMapper.GetData()[0]), 0x5au, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(fileMapper.GetData()[FILE_SIZE - 1u]), 0x5au, TEST_LOCATION);
+
+  fileMapper.Unmap();
+  DALI_TEST_CHECK(!fileMapper.IsMapped());
+  DALI_TEST_CHECK(fileMapper.GetData() == nullptr);
+  DALI_TEST_EQUALS(fileMapper.GetSize(), static_cast<size_t>(0u), TEST_LOCATION);
+
+  fclose(file);
+
+  END_TEST;
+}
+
+int UtcDaliFileMapperTruncatedFile(void)
+{
+  tet_infoline("Check that reading a mapped file truncated meanwhile reads zeros instead of crashing");
+
+  FILE* file = CreateFile();
+  DALI_TEST_CHECK(file);
+
+  Internal::Platform::FileMapper fileMapper;
+  DALI_TEST_CHECK(fileMapper.Map(file));
+
+  // e.g. a download cache rewrites the file while it is decoded.
+  DALI_TEST_EQUALS(ftruncate(fileno(file), 0), 0, TEST_LOCATION);
+
+  uint32_t sum = 0u;
+  for(size_t i = 0u; i < fileMapper.GetSize(); ++i)
+  {
+    sum += fileMapper.GetData()[i];
+  }
+  DALI_TEST_EQUALS(sum, 0u, TEST_LOCATION);
+  DALI_TEST_CHECK(fileMapper.IsTruncated());
+
+  // The next mapping of the slot is not truncated.
+  fileMapper.Unmap();
+  DALI_TEST_CHECK(!fileMapper.IsTruncated());
+
+  fclose(file);
+
+  file = CreateFile();
+  DALI_TEST_CHECK(fileMapper.Map(file));
+  DALI_TEST_CHECK(!fileMapper.IsTruncated());
+  DALI_TEST_EQUALS(static_cast<uint32_t>(fileMapper.GetData()[FILE_SIZE - 1u]), 0x5au, TEST_LOCATION);
+
+  fclose(file);
+
+  END_TEST;
+}
+
+int UtcDaliFileMapperMemoryFile(void)
+{
+  tet_infoline("Check that a FILE opened on a memory buffer is not mapped");
+
+  std::vector<uint8_t> content(1024u * 1024u, 0x5au);
+  FILE*                file = fmemopen(content.data(), content.size(), "rb");
+  DALI_TEST_CHECK(file);
+
+  Internal::Platform::FileMapper fileMapper;
+  DALI_TEST_CHECK(!fileMapper.Map(file));
+  DALI_TEST_CHECK(!fileMapper.Map(static_cast<FILE*>(nullptr)));
+  DALI_TEST_CHECK(!fileMapper.Map("/not/existing/file"));
+
+  fclose(file);
+
+  END_TEST;
+}
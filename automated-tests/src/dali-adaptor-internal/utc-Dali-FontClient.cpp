@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,10 +21,14 @@
 #include <dali/dali.h>
 #include <dali/devel-api/text-abstraction/bitmap-font.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
+#include <dali/devel-api/text-abstraction/shaping.h>
 #include <dali/internal/text/text-abstraction/plugin/font-client-utils.h>
+#include <dali/internal/text/text-abstraction/plugin/font-face-glyph-cache-manager.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <chrono>
+#include <clocale>
 #include <iostream>
 
 using namespace Dali;
@@ -945,3 +949,234 @@ int UtcDaliFontClientTestBitmapFont(void)
 
   END_TEST;
 }
+
+int UtcDaliFontClientShapeShortLabels(void)
+{
+  TestApplication application;
+  tet_infoline(" UtcDaliFontClientShapeShortLabels");
+
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  TextAbstraction::FontDescription fontDescription;
+  fontDescription.path   = pathName + DEFAULT_FONT_DIR + "/dejavu/DejaVuSans.ttf";
+  fontDescription.family = "DejaVuSans";
+  fontDescription.width  = TextAbstraction::FontWidth::NONE;
+  fontDescription.weight = TextAbstraction::FontWeight::NORMAL;
+  fontDescription.slant  = TextAbstraction::FontSlant::NONE;
+
+  const TextAbstraction::FontId fontId = fontClient.GetFontId(fontDescription, TextAbstraction::FontClient::DEFAULT_POINT_SIZE);
+  DALI_TEST_CHECK(fontId != 0u);
+
+  TextAbstraction::Shaping shaping = TextAbstraction::Shaping::Get();
+
+  // Short labels, where the cost of each shaping call dominates the cost of the shaping itself.
+  const std::vector<std::string> labels = {"OK", "Cancel", "Settings", "Wi-Fi", "12:30", "Back", "Next page", "Volume"};
+
+  std::vector<std::vector<TextAbstraction::Character>> utf32Labels;
+  std::vector<std::vector<TextAbstraction::GlyphIndex>> expectedIndices;
+  for(const auto& label : labels)
+  {
+    std::vector<TextAbstraction::Character> utf32(label.begin(), label.end());
+
+    const Length numberOfGlyphs = shaping.Shape(utf32.data(), static_cast<Length>(utf32.size()), fontId, TextAbstraction::LATIN);
+    DALI_TEST_CHECK(numberOfGlyphs > 0u);
+
+    std::vector<TextAbstraction::GlyphInfo>      glyphs(numberOfGlyphs);
+    std::vector<TextAbstraction::CharacterIndex> glyphToCharacterMap(numberOfGlyphs);
+    shaping.GetGlyphs(glyphs.data(), glyphToCharacterMap.data());
+
+    std::vector<TextAbstraction::GlyphIndex> indices;
+    for(const auto& glyph : glyphs)
+    {
+      DALI_TEST_EQUALS(glyph.fontId, fontId, TEST_LOCATION);
+      indices.push_back(glyph.index);
+    }
+
+    utf32Labels.push_back(std::move(utf32));
+    expectedIndices.push_back(std::move(indices));
+  }
+
+  tet_infoline("Check the reused shaping buffer gives the same glyphs, also after the locale changes.");
+  const std::string previousLocale(setlocale(LC_MESSAGES, NULL));
+  setlocale(LC_MESSAGES, "C");
+
+  for(size_t index = 0u; index < utf32Labels.size(); ++index)
+  {
+    const auto&  utf32          = utf32Labels[index];
+    const Length numberOfGlyphs = shaping.Shape(utf32.data(), static_cast<Length>(utf32.size()), fontId, TextAbstraction::LATIN);
+    DALI_TEST_EQUALS(numberOfGlyphs, static_cast<Length>(expectedIndices[index].size()), TEST_LOCATION);
+
+    std::vector<TextAbstraction::GlyphInfo>      glyphs(numberOfGlyphs);
+    std::vector<TextAbstraction::CharacterIndex> glyphToCharacterMap(numberOfGlyphs);
+    shaping.GetGlyphs(glyphs.data(), glyphToCharacterMap.data());
+
+    for(Length glyphIndex = 0u; glyphIndex < numberOfGlyphs; ++glyphIndex)
+    {
+      DALI_TEST_EQUALS(glyphs[glyphIndex].index, expectedIndices[index][glyphIndex], TEST_LOCATION);
+    }
+  }
+
+  setlocale(LC_MESSAGES, previousLocale.c_str());
+
+  // Benchmark. Prints the time, doesn't check it as it depends on the machine.
+  const uint32_t    ITERATIONS       = 2000u;
+  const std::size_t cacheMaximumSize = shaping.GetCacheMaximumSize();
+
+  std::vector<TextAbstraction::GlyphInfo>      glyphs(64u);
+  std::vector<TextAbstraction::CharacterIndex> glyphToCharacterMap(64u);
+
+  for(const bool useCache : {false, true})
+  {
+    shaping.SetCacheMaximumSize(useCache ? 256u * 1024u : 0u);
+
+    const auto start = std::chrono::steady_clock::now();
+    for(uint32_t iteration = 0u; iteration < ITERATIONS; ++iteration)
+    {
+      for(const auto& utf32 : utf32Labels)
+      {
+        shaping.Shape(utf32.data(), static_cast<Length>(utf32.size()), fontId, TextAbstraction::LATIN);
+        shaping.GetGlyphs(glyphs.data(), glyphToCharacterMap.data());
+      }
+    }
+    const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    tet_printf("Shaping %u short labels %s cache : %f ms (%f us per label)\n", ITERATIONS * static_cast<uint32_t>(utf32Labels.size()), useCache ? "with" : "without", milliseconds, 1000.0 * milliseconds / (ITERATIONS * utf32Labels.size()));
+  }
+
+  shaping.SetCacheMaximumSize(cacheMaximumSize);
+
+  END_TEST;
+}
+
+int UtcDaliFontClientShapeCache(void)
+{
+  TestApplication application;
+  tet_infoline(" UtcDaliFontClientShapeCache");
+
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+
+  TextAbstraction::FontDescription fontDescription;
+  fontDescription.path   = pathName + DEFAULT_FONT_DIR + "/dejavu/DejaVuSans.ttf";
+  fontDescription.family = "DejaVuSans";
+  fontDescription.width  = TextAbstraction::FontWidth::NONE;
+  fontDescription.weight = TextAbstraction::FontWeight::NORMAL;
+  fontDescription.slant  = TextAbstraction::FontSlant::NONE;
+
+  const TextAbstraction::FontId fontId      = fontClient.GetFontId(fontDescription, TextAbstraction::FontClient::DEFAULT_POINT_SIZE);
+  const TextAbstraction::FontId otherFontId = fontClient.GetFontId(fontDescription, 2u * TextAbstraction::FontClient::DEFAULT_POINT_SIZE);
+
+  TextAbstraction::Shaping shaping = TextAbstraction::Shaping::Get();
+  shaping.SetCacheMaximumSize(64u * 1024u);
+  shaping.ClearCache();
+
+  const std::vector<TextAbstraction::Character> text = {'H', 'e', 'l', 'l', 'o'};
+  const Length                                  size = static_cast<Length>(text.size());
+
+  const uint32_t hitCount  = shaping.GetCacheHitCount();
+  const uint32_t missCount = shaping.GetCacheMissCount();
+
+  const Length numberOfGlyphs = shaping.Shape(text.data(), size, fontId, TextAbstraction::LATIN);
+  DALI_TEST_EQUALS(shaping.GetCacheMissCount(), missCount + 1u, TEST_LOCATION);
+
+  std::vector<TextAbstraction::GlyphInfo>      glyphs(numberOfGlyphs);
+  std::vector<TextAbstraction::CharacterIndex> glyphToCharacterMap(numberOfGlyphs);
+  shaping.GetGlyphs(glyphs.data(), glyphToCharacterMap.data());
+
+  tet_infoline("Shaping the same text again is a hit and gives the same glyphs.");
+  DALI_TEST_EQUALS(shaping.Shape(text.data(), size, fontId, TextAbstraction::LATIN), numberOfGlyphs, TEST_LOCATION);
+  DALI_TEST_EQUALS(shaping.GetCacheHitCount(), hitCount + 1u, TEST_LOCATION);
+
+  std::vector<TextAbstraction::GlyphInfo>      cachedGlyphs(numberOfGlyphs);
+  std::vector<TextAbstraction::CharacterIndex> cachedGlyphToCharacterMap(numberOfGlyphs);
+  shaping.GetGlyphs(cachedGlyphs.data(), cachedGlyphToCharacterMap.data());
+  for(Length index = 0u; index < numberOfGlyphs; ++index)
+  {
+    DALI_TEST_EQUALS(cachedGlyphs[index].fontId, glyphs[index].fontId, TEST_LOCATION);
+    DALI_TEST_EQUALS(cachedGlyphs[index].index, glyphs[index].index, TEST_LOCATION);
+    DALI_TEST_EQUALS(cachedGlyphs[index].advance, glyphs[index].advance, TEST_LOCATION);
+    DALI_TEST_EQUALS(cachedGlyphToCharacterMap[index], glyphToCharacterMap[index], TEST_LOCATION);
+  }
+
+  tet_infoline("Another font or text is a miss.");
+  shaping.Shape(text.data(), size, otherFontId, TextAbstraction::LATIN);
+  shaping.Shape(text.data(), size - 1u, fontId, TextAbstraction::LATIN);
+  DALI_TEST_EQUALS(shaping.GetCacheMissCount(), missCount + 3u, TEST_LOCATION);
+
+  tet_infoline("Clearing the font client's cache invalidates the shaping cache.");
+  fontClient.ClearCache();
+  const TextAbstraction::FontId newFontId = fontClient.GetFontId(fontDescription, TextAbstraction::FontClient::DEFAULT_POINT_SIZE);
+  shaping.Shape(text.data(), size, newFontId, TextAbstraction::LATIN);
+  DALI_TEST_EQUALS(shaping.GetCacheMissCount(), missCount + 4u, TEST_LOCATION);
+
+  tet_infoline("A disabled cache is never hit.");
+  shaping.SetCacheMaximumSize(0u);
+  shaping.Shape(text.data(), size, newFontId, TextAbstraction::LATIN);
+  DALI_TEST_EQUALS(shaping.GetCacheHitCount(), hitCount + 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(shaping.GetCacheMaximumSize(), static_cast<std::size_t>(0u), TEST_LOCATION);
+
+  shaping.SetCacheMaximumSize(256u * 1024u);
+
+  END_TEST;
+}
+
+int UtcDaliFontClientGlyphMipLevels(void)
+{
+  // The environment is read when the first glyph is rendered.
+  setenv("DALI_ENABLE_GLYPH_MIP_LEVELS", "1", 1);
+
+  TestApplication application;
+  tet_infoline(" UtcDaliFontClientGlyphMipLevels");
+
+  char*             pathNamePtr = get_current_dir_name();
+  const std::string pathName(pathNamePtr);
+  free(pathNamePtr);
+
+  TextAbstraction::FontClient fontClient = TextAbstraction::FontClient::Get();
+  fontClient.SetDpi(96u, 96u);
+
+  TextAbstraction::FontDescription fontDescription;
+  fontDescription.path   = pathName + DEFAULT_FONT_DIR + "/dejavu/DejaVuSans.ttf";
+  fontDescription.family = "DejaVuSans";
+  fontDescription.width  = TextAbstraction::FontWidth::NONE;
+  fontDescription.weight = TextAbstraction::FontWeight::NORMAL;
+  fontDescription.slant  = TextAbstraction::FontSlant::NONE;
+
+  // Animated point sizes, from 32 to 40 pixels. 32 is a mip level, rendered by FreeType as any other size.
+  // The glyphs of the sizes between two mip levels are resampled from the bigger level, 45 pixels, rendered once.
+  for(uint32_t pointSize = 24u; pointSize <= 30u; ++pointSize)
+  {
+    const TextAbstraction::FontId fontId     = fontClient.GetFontId(fontDescription, pointSize * TextAbstraction::FontClient::NUMBER_OF_POINTS_PER_ONE_UNIT_OF_POINT_SIZE);
+    const GlyphIndex              glyphIndex = fontClient.GetGlyphIndex(fontId, 'W');
+
+    TextAbstraction::GlyphInfo glyphInfo(fontId, glyphIndex);
+    DALI_TEST_CHECK(fontClient.GetGlyphMetrics(&glyphInfo, 1u, TextAbstraction::BITMAP_GLYPH));
+
+    const uint32_t renderCount = TextAbstraction::Internal::GlyphCacheManager::GetFreeTypeRenderCount();
+
+    TextAbstraction::GlyphBufferData glyphBufferData;
+    fontClient.CreateBitmap(fontId, glyphIndex, false, false, glyphBufferData, 0);
+
+    const uint32_t addedRenderCount = TextAbstraction::Internal::GlyphCacheManager::GetFreeTypeRenderCount() - renderCount;
+    tet_printf("Point size %u : metrics %f x %f, bitmap %u x %u, FreeType renders %u\n", pointSize, glyphInfo.width, glyphInfo.height, glyphBufferData.width, glyphBufferData.height, addedRenderCount);
+
+    // The size of the level, and the first size resampled from the next level, render once. The other sizes don't render.
+    DALI_TEST_EQUALS(addedRenderCount, pointSize <= 25u ? 1u : 0u, TEST_LOCATION);
+
+    // The resampled bitmap may differ of a pixel from the rendered one.
+    DALI_TEST_CHECK(glyphBufferData.buffer != nullptr);
+    DALI_TEST_EQUALS(static_cast<float>(glyphBufferData.width), glyphInfo.width, 2.f, TEST_LOCATION);
+    DALI_TEST_EQUALS(static_cast<float>(glyphBufferData.height), glyphInfo.height, 2.f, TEST_LOCATION);
+  }
+
+  unsetenv("DALI_ENABLE_GLYPH_MIP_LEVELS");
+
+  END_TEST;
+}
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <string>
+#include <vector>
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/frame-time-histogram.h>
+#include <dali/internal/system/common/frame-time-stats.h>
+#include <dali/internal/system/common/stat-context-manager.h>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+namespace
+{
+void AddTime(FrameTimeStats& stats, uint64_t start, uint64_t end)
+{
+  stats.StartTime(FrameTimeStamp(0, start));
+  stats.EndTime(FrameTimeStamp(0, end));
+}
+
+void AddMarker(StatContextManager& manager, PerformanceInterface::MarkerType type, uint64_t microseconds)
+{
+  manager.AddInternalMarker(PerformanceMarker(type, FrameTimeStamp(0, microseconds)));
+}
+
+struct TestLogInterface : public StatContextLogInterface
+{
+  void LogContextStatistics(const char* const text) override
+  {
+    logs.push_back(text);
+  }
+
+  void TransmitContextStatistics(const char* const text) override
+  {
+    transmitted.push_back(text);
+  }
+
+  std::vector<std::string> logs;
+  std::vector<std::string> transmitted;
+};
+
+} // namespace
+
+void utc_dali_internal_frame_time_stats_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_frame_time_stats_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliFrameTimeHistogramPercentiles(void)
+{
+  tet_infoline("The percentiles are exact for small values, and within 1/32 for any other value.");
+
+  FrameTimeHistogram histogram;
+  DALI_TEST_EQUALS(histogram.GetPercentile(50.f), 0u, TEST_LOCATION);
+
+  for(unsigned int value = 1u; value <= 63u; ++value)
+  {
+    histogram.Add(value);
+  }
+  DALI_TEST_EQUALS(histogram.GetPercentile(50.f), 32u, TEST_LOCATION);
+  DALI_TEST_EQUALS(histogram.GetPercentile(0.f), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(histogram.GetPercentile(100.f), 63u, TEST_LOCATION);
+
+  histogram.Reset();
+  DALI_TEST_EQUALS(histogram.GetCount(), static_cast<uint64_t>(0u), TEST_LOCATION);
+
+  for(unsigned int value = 1u; value <= 1000000u; ++value)
+  {
+    histogram.Add(value);
+  }
+  DALI_TEST_EQUALS(histogram.GetCount(), static_cast<uint64_t>(1000000u), TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<float>(histogram.GetPercentile(50.f)), 500000.f, 500000.f / 32.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<float>(histogram.GetPercentile(90.f)), 900000.f, 900000.f / 32.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<float>(histogram.GetPercentile(99.f)), 990000.f, 990000.f / 32.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<float>(histogram.GetPercentile(99.9f)), 999000.f, 999000.f / 32.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(histogram.GetPercentile(100.f), 1000000u, TEST_LOCATION);
+
+  tet_infoline("The whole range of unsigned int is supported.");
+  histogram.Add(0xFFFFFFFFu);
+  DALI_TEST_EQUALS(histogram.GetMax(), 0xFFFFFFFFu, TEST_LOCATION);
+  DALI_TEST_EQUALS(histogram.GetPercentile(100.f), 0xFFFFFFFFu, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFrameTimeStatsPercentiles(void)
+{
+  tet_infoline("A long run of frames gives the percentiles, mean and standard deviation of the times.");
+
+  FrameTimeStats stats;
+
+  // A frame in a hundred takes 20 ms, the other ones 1 ms.
+  uint64_t time = 0u;
+  for(unsigned int frame = 0u; frame < 100000u; ++frame)
+  {
+    const uint64_t duration = (frame % 100u == 99u) ? 20000u : 1000u;
+    AddTime(stats, time, time + duration);
+    time += 16667u;
+  }
+
+  DALI_TEST_EQUALS(stats.GetRunCount(), 100000u, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetMinTime(), 0.001f, 0.00001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetMaxTime(), 0.020f, 0.00001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetPercentile(50.f), 0.001f, 0.001f / 32.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetPercentile(90.f), 0.001f, 0.001f / 32.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetPercentile(99.f), 0.001f, 0.001f / 32.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetPercentile(99.9f), 0.020f, 0.020f / 32.f, TEST_LOCATION);
+
+  float mean, standardDeviation;
+  stats.CalculateMean(mean, standardDeviation);
+  DALI_TEST_EQUALS(mean, 0.00119f, 0.000001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(standardDeviation, 0.0018904f, 0.000001f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliFrameTimeStatsReset(void)
+{
+  tet_infoline("A reset clears the times of the period, but not the total percentiles nor a running timer.");
+
+  FrameTimeStats stats;
+  AddTime(stats, 0u, 5000u);
+  AddTime(stats, 10000u, 11000u);
+
+  stats.StartTime(FrameTimeStamp(0, 20000u));
+  stats.Reset();
+  DALI_TEST_EQUALS(stats.GetRunCount(), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetPercentile(50.f), 0.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetTotalPercentile(100.f), 0.005f, 0.00001f, TEST_LOCATION);
+
+  stats.EndTime(FrameTimeStamp(0, 22000u));
+  DALI_TEST_EQUALS(stats.GetRunCount(), 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetMinTime(), 0.002f, 0.00001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetTotalTime(), 0.008f, 0.00001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetTotalPercentile(0.f), 0.001f, 0.00001f, TEST_LOCATION);
+
+  tet_infoline("Two start times in a row measure from the latest one, and an end time without a start is ignored.");
+  stats.StartTime(FrameTimeStamp(0, 30000u));
+  stats.StartTime(FrameTimeStamp(0, 40000u));
+  stats.EndTime(FrameTimeStamp(0, 40050u));
+  stats.EndTime(FrameTimeStamp(0, 50000u));
+  DALI_TEST_EQUALS(stats.GetRunCount(), 2u, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetMinTime(), 0.00005f, 0.000001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(stats.GetMaxTime(), 0.002f, 0.00001f, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliStatContextManagerVSyncToPresent(void)
+{
+  tet_infoline("The time from v-sync to the end of the render is measured, and logged with the percentiles.");
+
+  TestLogInterface   logInterface;
+  StatContextManager manager(logInterface);
+  manager.SetLoggingLevel(PerformanceInterface::LOG_UPDATE_RENDER, 1u);
+
+  const PerformanceInterface::ContextId presentContext = manager.GetContextId("VSyncToPresent");
+  DALI_TEST_CHECK(presentContext != 0u);
+
+  // 2 seconds of frames, the render of a frame in ten isn't done.
+  for(uint64_t frame = 0u; frame < 120u; ++frame)
+  {
+    const uint64_t time = frame * 16667u;
+    AddMarker(manager, PerformanceInterface::VSYNC, time);
+    AddMarker(manager, PerformanceInterface::UPDATE_START, time + 100u);
+    AddMarker(manager, PerformanceInterface::UPDATE_END, time + 1100u);
+    if(frame % 10u != 9u)
+    {
+      AddMarker(manager, PerformanceInterface::RENDER_START, time + 1200u);
+      AddMarker(manager, PerformanceInterface::RENDER_END, time + 4000u);
+    }
+  }
+
+  DALI_TEST_EQUALS(manager.GetPercentile(0.f, presentContext), 0.004f, 0.00001f, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetPercentile(99.9f, presentContext), 0.004f, 0.004f / 32.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetPercentile(50.f, manager.GetContextId("Update")), 0.001f, 0.001f / 32.f, TEST_LOCATION);
+  DALI_TEST_EQUALS(manager.GetPercentile(50.f, manager.GetContextId("Render")), 0.0028f, 0.0028f / 32.f, TEST_LOCATION);
+
+  bool presentLogged = false;
+  for(const std::string& log : logInterface.logs)
+  {
+    if(log.find("VSyncToPresent, min 4.00 ms, max 4.00 ms") == 0u)
+    {
+      presentLogged = true;
+      DALI_TEST_CHECK(log.find(", p50 ") != std::string::npos);
+      DALI_TEST_CHECK(log.find(", p99.9 ") != std::string::npos);
+    }
+  }
+  DALI_TEST_CHECK(presentLogged);
+
+  tet_infoline("The event statistics aren't logged, but are still sent to the network clients.");
+  bool eventLogged      = false;
+  bool eventTransmitted = false;
+  for(const std::string& log : logInterface.logs)
+  {
+    eventLogged |= (log.find("Event,") == 0u);
+  }
+  for(const std::string& log : logInterface.transmitted)
+  {
+    eventTransmitted |= (log.find("Event,") == 0u);
+  }
+  DALI_TEST_CHECK(!eventLogged);
+  DALI_TEST_CHECK(eventTransmitted);
+
+  END_TEST;
+}
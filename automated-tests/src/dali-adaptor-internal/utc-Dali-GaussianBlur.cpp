@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/imaging/common/gaussian-blur.h>
+#include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_gaussian_blur_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_gaussian_blur_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+constexpr int IMAGE_WIDTH  = 320;
+constexpr int IMAGE_HEIGHT = 300;
+
+/**
+ * @brief Fill the buffer with blocks of random colors, and noise, so the blur has edges and details to smooth.
+ */
+PixelBufferPtr CreateImage()
+{
+  PixelBufferPtr buffer = PixelBuffer::New(IMAGE_WIDTH, IMAGE_HEIGHT, Pixel::RGBA8888);
+  uint8_t*       pixels = buffer->GetBuffer();
+
+  srand48(1);
+  std::vector<uint8_t> blockColors(64 * 4);
+  for(auto& component : blockColors)
+  {
+    component = static_cast<uint8_t>(lrand48() & 0xff);
+  }
+
+  for(int y = 0; y < IMAGE_HEIGHT; ++y)
+  {
+    for(int x = 0; x < IMAGE_WIDTH; ++x)
+    {
+      const int block = ((y / 40) * 8 + (x / 40)) % 64;
+      for(int channel = 0; channel < 4; ++channel)
+      {
+        const int noise                              = static_cast<int>(lrand48() % 33) - 16;
+        pixels[(y * IMAGE_WIDTH + x) * 4 + channel] = static_cast<uint8_t>(std::max(0, std::min(blockColors[block * 4 + channel] + noise, 255)));
+      }
+    }
+  }
+  return buffer;
+}
+
+/**
+ * @brief The exact Gaussian blur of one pass in float, with the same kernel, written transposed.
+ */
+void ReferenceConvoluteAndTranspose(const uint8_t* inBuffer, uint8_t* outBuffer, int width, int height, float blurRadius)
+{
+  const int   radius          = static_cast<int>(std::ceil(blurRadius));
+  const float sigma           = blurRadius * 0.4f + 0.6f;
+  const float sigma22         = 2.0f * sigma * sigma;
+  float       normalizeFactor = 0.0f;
+
+  std::vector<float> weights;
+  for(int i = -radius; i <= radius; ++i)
+  {
+    weights.push_back(std::exp(-static_cast<float>(i * i) / sigma22));
+    normalizeFactor += weights.back();
+  }
+
+  for(int y = 0; y < height; ++y)
+  {
+    for(int x = 0; x < width; ++x)
+    {
+      for(int channel = 0; channel < 4; ++channel)
+      {
+        float value = 0.0f;
+        for(int i = -radius; i <= radius; ++i)
+        {
+          const int ix = std::max(0, std::min(x + i, width - 1));
+          value += weights[i + radius] / normalizeFactor * inBuffer[(y * width + ix) * 4 + channel];
+        }
+        outBuffer[(x * height + y) * 4 + channel] = static_cast<uint8_t>(std::max(0, std::min(static_cast<int>(value + 0.5f), 255)));
+      }
+    }
+  }
+}
+
+std::vector<uint8_t> ReferenceGaussianBlur(const uint8_t* pixels, float blurRadius)
+{
+  std::vector<uint8_t> result(pixels, pixels + IMAGE_WIDTH * IMAGE_HEIGHT * 4);
+  std::vector<uint8_t> transposed(result.size());
+  ReferenceConvoluteAndTranspose(result.data(), transposed.data(), IMAGE_WIDTH, IMAGE_HEIGHT, blurRadius);
+  ReferenceConvoluteAndTranspose(transposed.data(), result.data(), IMAGE_HEIGHT, IMAGE_WIDTH, blurRadius);
+  return result;
+}
+
+/**
+ * @brief Compare the blurred buffer with the exact Gaussian blur.
+ * @param[out] maxDifference The largest difference of a component
+ * @param[out] meanDifference The mean difference of the components
+ */
+void CompareWithReference(const PixelBuffer& buffer, const std::vector<uint8_t>& expected, int& maxDifference, float& meanDifference)
+{
+  const uint8_t* pixels = buffer.GetBuffer();
+
+  maxDifference = 0;
+  uint64_t sum  = 0u;
+  for(size_t i = 0u; i < expected.size(); ++i)
+  {
+    const int difference = std::abs(static_cast<int>(pixels[i]) - static_cast<int>(expected[i]));
+    maxDifference        = std::max(maxDifference, difference);
+    sum += static_cast<uint64_t>(difference);
+  }
+  meanDifference = static_cast<float>(sum) / static_cast<float>(expected.size());
+}
+
+} // namespace
+
+int UtcDaliGaussianBlurBoxApproximation(void)
+{
+  tet_infoline("Check that the box blurs approximate the exact Gaussian blur within a few levels");
+
+  for(const float blurRadius : {4.0f, 10.0f, 25.0f})
+  {
+    PixelBufferPtr             buffer   = CreateImage();
+    const std::vector<uint8_t> expected = ReferenceGaussianBlur(buffer->GetBuffer(), blurRadius);
+
+    PerformGaussianBlurRGBA(*buffer, blurRadius, 1.0f);
+
+    int   maxDifference;
+    float meanDifference;
+    CompareWithReference(*buffer, expected, maxDifference, meanDifference);
+    tet_printf("Blur radius %.1f : max difference %d, mean difference %.3f\n", blurRadius, maxDifference, meanDifference);
+
+    DALI_TEST_CHECK(maxDifference <= 10);
+    DALI_TEST_CHECK(meanDifference <= 1.25f);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliGaussianBlurBoxApproximationRadius(void)
+{
+  tet_infoline("Check that the blurs with a radius under the approximation radius are exact");
+
+  const float blurRadius = 10.0f;
+
+  // Never approximated, or from a larger radius.
+  for(const float boxApproximationRadius : {0.0f, 10.5f})
+  {
+    PixelBufferPtr             buffer   = CreateImage();
+    const std::vector<uint8_t> expected = ReferenceGaussianBlur(buffer->GetBuffer(), blurRadius);
+
+    PerformGaussianBlurRGBA(*buffer, blurRadius, boxApproximationRadius);
+
+    int   maxDifference;
+    float meanDifference;
+    CompareWithReference(*buffer, expected, maxDifference, meanDifference);
+    DALI_TEST_CHECK(maxDifference <= 1);
+  }
+
+  // Approximated from the blur radius.
+  PixelBufferPtr             buffer   = CreateImage();
+  const std::vector<uint8_t> expected = ReferenceGaussianBlur(buffer->GetBuffer(), blurRadius);
+
+  PerformGaussianBlurRGBA(*buffer, blurRadius, blurRadius);
+
+  int   maxDifference;
+  float meanDifference;
+  CompareWithReference(*buffer, expected, maxDifference, meanDifference);
+  DALI_TEST_CHECK(maxDifference > 1);
+
+  END_TEST;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -64,3 +64,13 @@ int UtcDaliGifLoaderTransparency(void)
   TestImageLoading(transparency, GifLoaders);
   END_TEST;
 }
+
+int UtcDaliGifLoaderFromMemory(void)
+{
+  ImageDetails interlaced(TEST_IMAGE_DIR "/interlaced.gif", 365u, 227u);
+  TestImageLoadingFromMemory(interlaced, GifLoaders);
+
+  ImageDetails pattern(TEST_IMAGE_DIR "/pattern.gif", 600u, 600u);
+  TestImageLoadingFromMemory(pattern, GifLoaders);
+  END_TEST;
+}
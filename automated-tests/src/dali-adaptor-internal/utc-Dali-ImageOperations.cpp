@@ -17,10 +17,13 @@
 
 #include <dali-test-suite-utils.h>
 #include <dali/devel-api/common/ref-counted-dali-vector.h>
+#include <dali/internal/imaging/common/image-operations-simd.h>
 #include <dali/internal/imaging/common/image-operations.h>
 
 #include <sys/mman.h>
 #include <unistd.h>
+#include <chrono>
+#include <cstring>
 
 using namespace Dali::Internal::Platform;
 
@@ -1597,3 +1600,124 @@ int UtcDaliImageOperationsBilinearFilter1BPP(void)
 
   END_TEST;
 }
+
+namespace
+{
+const SamplingMode::Type SAMPLING_MODES[] = {SamplingMode::BOX, SamplingMode::NEAREST, SamplingMode::LINEAR, SamplingMode::BOX_THEN_NEAREST, SamplingMode::BOX_THEN_LINEAR, SamplingMode::NO_FILTER, SamplingMode::DONT_CARE, SamplingMode::LANCZOS, SamplingMode::BOX_THEN_LANCZOS};
+const Pixel::Format      SIMD_FORMATS[]   = {Pixel::RGBA8888, Pixel::RGB888, Pixel::L8};
+
+void FillRandomBytes(uint8_t* buffer, uint32_t size)
+{
+  for(uint32_t i = 0; i < size; ++i)
+  {
+    buffer[i] = RandomComponent8();
+  }
+}
+
+/**
+ * @brief Downscale a copy of the source, since the input of DownscaleBitmap() is used as scratch space.
+ */
+Dali::Devel::PixelBuffer DownscaleCopy(Dali::Devel::PixelBuffer source, ImageDimensions desired, SamplingMode::Type samplingMode)
+{
+  Dali::Devel::PixelBuffer copy = Dali::Devel::PixelBuffer::New(source.GetWidth(), source.GetHeight(), source.GetPixelFormat());
+  memcpy(copy.GetBuffer(), source.GetBuffer(), source.GetBufferSize());
+  return DownscaleBitmap(copy, desired, FittingMode::SHRINK_TO_FIT, samplingMode);
+}
+
+} // namespace
+
+/**
+ * @brief Test the SIMD kernels give exactly the same pixels as the scalar code.
+ */
+int UtcDaliImageOperationsSimdMatchesScalar(void)
+{
+  if(!GetImageOperationsSimdKernels())
+  {
+    tet_printf("No SIMD kernels on this CPU\n");
+    DALI_TEST_CHECK(true);
+    END_TEST;
+  }
+
+  // Odd sizes leave pixels for the scalar remainder loops.
+  const uint32_t sourceSizes[][2]  = {{256, 256}, {333, 129}, {1021, 67}, {7, 5}};
+  const uint32_t desiredSizes[][2] = {{64, 64}, {100, 31}, {17, 13}, {3, 2}};
+
+  for(auto format : SIMD_FORMATS)
+  {
+    for(uint32_t i = 0; i < sizeof(sourceSizes) / sizeof(sourceSizes[0]); ++i)
+    {
+      Dali::Devel::PixelBuffer source = Dali::Devel::PixelBuffer::New(sourceSizes[i][0], sourceSizes[i][1], format);
+      FillRandomBytes(source.GetBuffer(), source.GetBufferSize());
+
+      for(auto samplingMode : SAMPLING_MODES)
+      {
+        const ImageDimensions desired(desiredSizes[i][0], desiredSizes[i][1]);
+
+        SetImageOperationsSimdEnabled(false);
+        Dali::Devel::PixelBuffer scalar = DownscaleCopy(source, desired, samplingMode);
+        SetImageOperationsSimdEnabled(true);
+        Dali::Devel::PixelBuffer simd = DownscaleCopy(source, desired, samplingMode);
+
+        DALI_TEST_EQUALS(simd.GetWidth(), scalar.GetWidth(), TEST_LOCATION);
+        DALI_TEST_EQUALS(simd.GetHeight(), scalar.GetHeight(), TEST_LOCATION);
+        DALI_TEST_EQUALS(memcmp(simd.GetBuffer(), scalar.GetBuffer(), scalar.GetBufferSize()), 0, TEST_LOCATION);
+      }
+    }
+  }
+
+  // Upscaling makes the linear sampling kernels clamp at the right and bottom edges.
+  for(auto format : SIMD_FORMATS)
+  {
+    const uint32_t       bytesPerPixel = Pixel::GetBytesPerPixel(format);
+    Dali::Vector<uint8_t> input;
+    input.Resize(37 * 23 * bytesPerPixel);
+    FillRandomBytes(input.Begin(), input.Count());
+
+    Dali::Vector<uint8_t> scalar, simd;
+    scalar.Resize(101 * 77 * bytesPerPixel);
+    simd.Resize(101 * 77 * bytesPerPixel);
+
+    SetImageOperationsSimdEnabled(false);
+    LinearSample(input.Begin(), ImageDimensions(37, 23), 37, format, scalar.Begin(), ImageDimensions(101, 77));
+    SetImageOperationsSimdEnabled(true);
+    LinearSample(input.Begin(), ImageDimensions(37, 23), 37, format, simd.Begin(), ImageDimensions(101, 77));
+
+    DALI_TEST_EQUALS(memcmp(simd.Begin(), scalar.Begin(), scalar.Count()), 0, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+/**
+ * @brief Print the time of downscaling large images with each sampling mode, with and without the SIMD kernels.
+ */
+int UtcDaliImageOperationsSimdBenchmark(void)
+{
+  const uint32_t benchmarks[][3] = {{3840, 2160, 512}, {1920, 1080, 256}};
+
+  for(auto format : SIMD_FORMATS)
+  {
+    for(auto benchmark : benchmarks)
+    {
+      Dali::Devel::PixelBuffer source = Dali::Devel::PixelBuffer::New(benchmark[0], benchmark[1], format);
+      FillRandomBytes(source.GetBuffer(), source.GetBufferSize());
+
+      for(auto samplingMode : SAMPLING_MODES)
+      {
+        double milliseconds[2];
+        for(int simdEnabled = 0; simdEnabled < 2; ++simdEnabled)
+        {
+          SetImageOperationsSimdEnabled(simdEnabled);
+          const auto start = std::chrono::steady_clock::now();
+          DownscaleCopy(source, ImageDimensions(benchmark[2], benchmark[2]), samplingMode);
+          milliseconds[simdEnabled] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+        tet_printf("format %d %ux%u -> %u sampling mode %d : scalar %.2f ms, simd %.2f ms\n", format, benchmark[0], benchmark[1], benchmark[2], samplingMode, milliseconds[0], milliseconds[1]);
+      }
+    }
+  }
+  SetImageOperationsSimdEnabled(true);
+
+  DALI_TEST_CHECK(true);
+  END_TEST;
+}
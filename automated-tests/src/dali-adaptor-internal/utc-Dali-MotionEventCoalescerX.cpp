@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/window-system/x11/motion-event-coalescer-x.h>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor::WindowSystem;
+
+void utc_dali_motion_event_coalescer_x_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_motion_event_coalescer_x_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+XEvent CreateMotionEvent(::Window window, unsigned long time, int x, int y, unsigned int state)
+{
+  XEvent event{};
+  event.xmotion.type   = MotionNotify;
+  event.xmotion.window = window;
+  event.xmotion.time   = time;
+  event.xmotion.x      = x;
+  event.xmotion.y      = y;
+  event.xmotion.state  = state;
+  return event;
+}
+
+struct DeliveredMotion
+{
+  ::Window                         window;
+  int                              x;
+  int                              y;
+  MotionEventCoalescerX::History history;
+};
+
+std::vector<DeliveredMotion> Flush(MotionEventCoalescerX& coalescer)
+{
+  std::vector<DeliveredMotion> delivered;
+  coalescer.Flush([&delivered](const XEvent& event, MotionEventCoalescerX::History& history) { delivered.push_back(DeliveredMotion{event.xmotion.window, event.xmotion.x, event.xmotion.y, history}); });
+  return delivered;
+}
+
+} // namespace
+
+int UtcDaliMotionEventCoalescerXLatestPerWindow(void)
+{
+  tet_infoline("Check that only the latest motion of each window is delivered, in the order the windows were seen");
+
+  MotionEventCoalescerX coalescer(true);
+  DALI_TEST_CHECK(coalescer.IsEnabled());
+
+  for(int i = 0; i < 10; ++i)
+  {
+    DALI_TEST_CHECK(coalescer.AddEvent(CreateMotionEvent(2u, i, i, 100 + i, 0u)));
+    DALI_TEST_CHECK(coalescer.AddEvent(CreateMotionEvent(1u, i, 50 + i, i, 0u)));
+  }
+
+  // Other events are not kept.
+  XEvent buttonEvent{};
+  buttonEvent.xbutton.type = ButtonPress;
+  DALI_TEST_CHECK(!coalescer.AddEvent(buttonEvent));
+
+  std::vector<DeliveredMotion> delivered = Flush(coalescer);
+  DALI_TEST_EQUALS(delivered.size(), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(delivered[0].window, static_cast<::Window>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(delivered[0].x, 9, TEST_LOCATION);
+  DALI_TEST_EQUALS(delivered[0].y, 109, TEST_LOCATION);
+  DALI_TEST_EQUALS(delivered[1].window, static_cast<::Window>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(delivered[1].x, 59, TEST_LOCATION);
+
+  // Without a button held there is no history.
+  DALI_TEST_CHECK(delivered[0].history.empty());
+  DALI_TEST_CHECK(delivered[1].history.empty());
+
+  DALI_TEST_EQUALS(coalescer.GetReceivedCount(), 20u, TEST_LOCATION);
+  DALI_TEST_EQUALS(coalescer.GetDeliveredCount(), 2u, TEST_LOCATION);
+  coalescer.ResetCounts();
+  DALI_TEST_EQUALS(coalescer.GetReceivedCount(), 0u, TEST_LOCATION);
+
+  // Nothing left.
+  DALI_TEST_CHECK(Flush(coalescer).empty());
+
+  END_TEST;
+}
+
+int UtcDaliMotionEventCoalescerXHistory(void)
+{
+  tet_infoline("Check that the motions replaced while a button is held are kept as history, oldest first");
+
+  MotionEventCoalescerX coalescer(true);
+
+  coalescer.AddEvent(CreateMotionEvent(1u, 100u, 0, 0, 0u));
+  for(int i = 1; i <= 5; ++i)
+  {
+    coalescer.AddEvent(CreateMotionEvent(1u, 100u + i, i * 3, i * 2, Button1Mask));
+  }
+
+  std::vector<DeliveredMotion> delivered = Flush(coalescer);
+  DALI_TEST_EQUALS(delivered.size(), static_cast<size_t>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(delivered[0].x, 15, TEST_LOCATION);
+  DALI_TEST_EQUALS(delivered[0].y, 10, TEST_LOCATION);
+
+  // The first motion was a hover, the others were dragged.
+  const MotionEventCoalescerX::History& history = delivered[0].history;
+  DALI_TEST_EQUALS(history.size(), static_cast<size_t>(4u), TEST_LOCATION);
+  for(uint32_t i = 0; i < history.size(); ++i)
+  {
+    DALI_TEST_EQUALS(history[i].timestamp, static_cast<unsigned long>(101u + i), TEST_LOCATION);
+    DALI_TEST_EQUALS(history[i].x, static_cast<int>(i + 1u) * 3, TEST_LOCATION);
+    DALI_TEST_EQUALS(history[i].y, static_cast<int>(i + 1u) * 2, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliMotionEventCoalescerXDisabled(void)
+{
+  tet_infoline("Check that no motion is kept when the coalescing is disabled");
+
+  MotionEventCoalescerX coalescer(false);
+  DALI_TEST_CHECK(!coalescer.IsEnabled());
+  DALI_TEST_CHECK(!coalescer.AddEvent(CreateMotionEvent(1u, 0u, 0, 0, 0u)));
+  DALI_TEST_CHECK(Flush(coalescer).empty());
+
+  END_TEST;
+}
+
+int UtcDaliMotionEventCoalescerXEventsPerPass(void)
+{
+  tet_infoline("Count the core events processings and the touch events per pass over the queue, for a 1000Hz pointer");
+
+  // The event thread is behind, so each pass reads the motions of a 60Hz frame.
+  const uint32_t passCount      = 60u;
+  const uint32_t motionsPerPass = 1000u / 60u;
+
+  for(const bool enabled : {false, true})
+  {
+    MotionEventCoalescerX coalescer(enabled);
+    uint32_t              processings = 0u; ///< A delivered motion is fed as a touch point, which processes the core events
+    uint32_t              touchEvents = 0u; ///< A delivered motion or a history sample is a touch event, hit-tested by the core
+    unsigned long         time        = 0u;
+    for(uint32_t pass = 0u; pass < passCount; ++pass)
+    {
+      for(uint32_t i = 0u; i < motionsPerPass; ++i, ++time)
+      {
+        XEvent event = CreateMotionEvent(1u, time, static_cast<int>(time), static_cast<int>(time / 2u), Button1Mask);
+        if(!coalescer.AddEvent(event))
+        {
+          // Delivered as read.
+          ++processings;
+          ++touchEvents;
+        }
+      }
+      for(const auto& motion : Flush(coalescer))
+      {
+        ++processings;
+        touchEvents += 1u + motion.history.size();
+      }
+    }
+
+    tet_printf("coalescing %s : %.1f core events processings and %.1f touch events per pass\n", enabled ? "enabled" : "disabled", static_cast<float>(processings) / passCount, static_cast<float>(touchEvents) / passCount);
+    DALI_TEST_EQUALS(processings, enabled ? passCount : passCount * motionsPerPass, TEST_LOCATION);
+
+    // Only the processings are saved, the core still gets a touch event per sample for the gestures.
+    DALI_TEST_EQUALS(touchEvents, passCount * motionsPerPass, TEST_LOCATION);
+    DALI_TEST_EQUALS(coalescer.GetHistoryCount(), enabled ? passCount * (motionsPerPass - 1u) : 0u, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliMotionEventCoalescerXServerEvents(void)
+{
+  tet_infoline("Check the coalescing of motions read from a X server. Skipped unless a server (e.g. Xvfb) is reachable");
+
+  ::Display* display = XOpenDisplay(nullptr);
+  if(!display)
+  {
+    tet_infoline("No X server, skipped");
+    DALI_TEST_CHECK(true);
+    END_TEST;
+  }
+
+  const int screen = DefaultScreen(display);
+  ::Window  window = XCreateSimpleWindow(display, RootWindow(display, screen), 0, 0, 64, 64, 0, 0, 0);
+  XSelectInput(display, window, PointerMotionMask);
+  XSync(display, True);
+
+  // Synthetic input: a drag of 200 motions, read in one pass.
+  const int motionCount = 200;
+  for(int i = 0; i < motionCount; ++i)
+  {
+    XEvent event          = CreateMotionEvent(window, 1000u + i, i % 64, i / 4, Button1Mask);
+    event.xmotion.display = display;
+    event.xmotion.root    = RootWindow(display, screen);
+    XSendEvent(display, window, False, PointerMotionMask, &event);
+  }
+  XSync(display, False);
+
+  MotionEventCoalescerX        coalescer(true);
+  std::vector<DeliveredMotion> delivered;
+  uint32_t                     eventCount = 0u;
+  while(XPending(display))
+  {
+    XEvent event;
+    XNextEvent(display, &event);
+    ++eventCount;
+    if(!coalescer.AddEvent(event))
+    {
+      for(auto& motion : Flush(coalescer))
+      {
+        delivered.push_back(motion);
+      }
+    }
+  }
+  for(auto& motion : Flush(coalescer))
+  {
+    delivered.push_back(motion);
+  }
+
+  tet_printf("%u events read, %u motions delivered\n", eventCount, static_cast<uint32_t>(delivered.size()));
+  DALI_TEST_EQUALS(coalescer.GetReceivedCount(), static_cast<uint32_t>(motionCount), TEST_LOCATION);
+  DALI_TEST_EQUALS(delivered.size(), static_cast<size_t>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(delivered[0].x, (motionCount - 1) % 64, TEST_LOCATION);
+  DALI_TEST_EQUALS(delivered[0].history.size(), static_cast<size_t>(motionCount - 1), TEST_LOCATION);
+
+  XDestroyWindow(display, window);
+  XCloseDisplay(display);
+
+  END_TEST;
+}
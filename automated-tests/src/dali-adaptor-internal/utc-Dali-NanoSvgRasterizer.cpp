@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <third-party/nanosvg/nanosvg.h>
+#include <third-party/nanosvg/nanosvgrast.h>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Dali;
+
+void utc_dali_nano_svg_rasterizer_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_nano_svg_rasterizer_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+constexpr int IMAGE_SIZE = 1024;
+
+/**
+ * @brief Build an image with many overlapping shapes: fills, strokes, gradients, even-odd rules,
+ * abutting rectangles, and shapes crossing the borders of the image and of the bands.
+ */
+std::string CreateSvg()
+{
+  std::string svg =
+    "<svg xmlns='http://www.w3.org/2000/svg' width='256' height='256'>"
+    "<defs>"
+    "<linearGradient id='linear' x1='0' y1='0' x2='1' y2='1'><stop offset='0' stop-color='#ff0000'/><stop offset='1' stop-color='#0000ff' stop-opacity='0.5'/></linearGradient>"
+    "<radialGradient id='radial' cx='0.5' cy='0.5' r='0.5'><stop offset='0' stop-color='#00ff00'/><stop offset='1' stop-color='#ffff00' stop-opacity='0.2'/></radialGradient>"
+    "</defs>"
+    "<rect x='-20' y='-40' width='120' height='80' fill='url(#linear)'/>"
+    "<path d='M 10 10 L 250 30 L 40 250 Z M 60 60 L 200 60 L 60 200 Z' fill='#804020' fill-rule='evenodd' stroke='#102030' stroke-width='3'/>"
+    "<circle cx='128' cy='128' r='100' fill='url(#radial)' stroke='url(#linear)' stroke-width='7' stroke-dasharray='11 5'/>";
+
+  // Abutting rectangles, with edges on the same x.
+  for(int i = 0; i < 16; ++i)
+  {
+    svg += "<rect x='" + std::to_string(i * 16) + "' y='" + std::to_string(200 + (i % 3)) + "' width='16' height='17.3' fill='#" + (i % 2 ? "3060a0" : "a06030") + "' fill-opacity='0.7'/>";
+  }
+
+  // Curves and thin strokes everywhere, crossing the rows between the bands.
+  for(int i = 0; i < 40; ++i)
+  {
+    const int x = (i * 37) % 256;
+    const int y = (i * 53) % 256 - 16;
+    svg += "<path d='M " + std::to_string(x) + " " + std::to_string(y) + " C " + std::to_string(x + 40) + " " + std::to_string(y - 30) + " " + std::to_string(x - 30) + " " + std::to_string(y + 90) + " " + std::to_string(x + 20) + " " + std::to_string(y + 60) + " Z' fill='#" + (i % 2 ? "20c040" : "c02040") + "' fill-opacity='0.4' stroke='#000000' stroke-width='" + std::to_string(0.5f + (i % 4)) + "' stroke-linejoin='round' stroke-linecap='round'/>";
+  }
+
+  svg += "<polyline points='0,255.5 64,128.25 128,255.5 192,0.75 256,255.5' fill='none' stroke='#ff00ff' stroke-width='1.5'/>";
+  svg += "</svg>";
+  return svg;
+}
+
+std::vector<unsigned char> Rasterize(NSVGimage* image, float scale)
+{
+  std::vector<unsigned char> pixels(IMAGE_SIZE * IMAGE_SIZE * 4, 0xffu);
+  NSVGrasterizer*            rasterizer = nsvgCreateRasterizer();
+  nsvgRasterize(rasterizer, image, 0.0f, 0.0f, scale, pixels.data(), IMAGE_SIZE, IMAGE_SIZE, IMAGE_SIZE * 4);
+  nsvgDeleteRasterizer(rasterizer);
+  return pixels;
+}
+
+std::vector<unsigned char> RasterizeBands(NSVGimage* image, float scale, int rowsPerBand, bool threaded)
+{
+  std::vector<unsigned char> pixels(IMAGE_SIZE * IMAGE_SIZE * 4, 0xffu);
+
+  NSVGrasterizer*     flattener = nsvgCreateRasterizer();
+  NSVGflattenedImage* flattened = nsvgFlattenImage(flattener, image, 0.0f, 0.0f, scale);
+  DALI_TEST_CHECK(flattened);
+
+  std::vector<std::thread> threads;
+  for(int y = 0; y < IMAGE_SIZE; y += rowsPerBand)
+  {
+    auto rasterizeBand = [&pixels, flattened, y, rowsPerBand]() {
+      NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+      nsvgRasterizeFlattened(rasterizer, flattened, pixels.data(), IMAGE_SIZE, IMAGE_SIZE, IMAGE_SIZE * 4, y, y + rowsPerBand);
+      nsvgDeleteRasterizer(rasterizer);
+    };
+    if(threaded)
+    {
+      threads.emplace_back(rasterizeBand);
+    }
+    else
+    {
+      rasterizeBand();
+    }
+  }
+  for(auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  nsvgDeleteFlattenedImage(flattened);
+  nsvgDeleteRasterizer(flattener);
+  return pixels;
+}
+
+} // namespace
+
+int UtcDaliNanoSvgRasterizerBands(void)
+{
+  tet_infoline("Check that an image rasterized by bands is identical to the image rasterized at once");
+
+  std::string svg   = CreateSvg();
+  NSVGimage*  image = nsvgParse(&svg[0], "px", 96.0f);
+  DALI_TEST_CHECK(image);
+
+  const float                      scale    = static_cast<float>(IMAGE_SIZE) / 256.0f;
+  const std::vector<unsigned char> expected = Rasterize(image, scale);
+
+  // The image is not empty.
+  uint32_t coloredPixels = 0u;
+  for(int i = 3; i < IMAGE_SIZE * IMAGE_SIZE * 4; i += 4)
+  {
+    coloredPixels += expected[i] != 0u ? 1u : 0u;
+  }
+  DALI_TEST_CHECK(coloredPixels > IMAGE_SIZE * IMAGE_SIZE / 2);
+
+  for(const int rowsPerBand : {IMAGE_SIZE, 256, 100, 37, 1})
+  {
+    const std::vector<unsigned char> bands = RasterizeBands(image, scale, rowsPerBand, false);
+    tet_printf("%d rows per band\n", rowsPerBand);
+    DALI_TEST_CHECK(memcmp(bands.data(), expected.data(), expected.size()) == 0);
+  }
+
+  // The bands share the flattened image on several threads.
+  const std::vector<unsigned char> bands = RasterizeBands(image, scale, 171, true);
+  DALI_TEST_CHECK(memcmp(bands.data(), expected.data(), expected.size()) == 0);
+
+  nsvgDelete(image);
+
+  END_TEST;
+}
+
+int UtcDaliNanoSvgRasterizerEmptyBand(void)
+{
+  tet_infoline("Check that the bands out of the image, and the bands without shapes, are cleared");
+
+  std::string svg   = "<svg width='100' height='100'><rect x='10' y='60' width='50' height='20' fill='#ff0000'/></svg>";
+  NSVGimage*  image = nsvgParse(&svg[0], "px", 96.0f);
+  DALI_TEST_CHECK(image);
+
+  NSVGrasterizer*     rasterizer = nsvgCreateRasterizer();
+  NSVGflattenedImage* flattened  = nsvgFlattenImage(rasterizer, image, 0.0f, 0.0f, 1.0f);
+  DALI_TEST_CHECK(flattened);
+
+  std::vector<unsigned char> pixels(100 * 100 * 4, 0xffu);
+
+  // Nothing is written out of the image.
+  nsvgRasterizeFlattened(rasterizer, flattened, pixels.data(), 100, 100, 400, 100, 200);
+  nsvgRasterizeFlattened(rasterizer, flattened, pixels.data(), 100, 100, 400, 50, 20);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(pixels[0]), 0xffu, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(pixels[99 * 400]), 0xffu, TEST_LOCATION);
+
+  // The band above the rectangle is cleared.
+  nsvgRasterizeFlattened(rasterizer, flattened, pixels.data(), 100, 100, 400, 0, 50);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(pixels[49 * 400 + 20 * 4 + 3]), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(pixels[50 * 400]), 0xffu, TEST_LOCATION);
+
+  // The band with the rectangle is filled, from its first row.
+  nsvgRasterizeFlattened(rasterizer, flattened, pixels.data(), 100, 100, 400, 50, 100);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(pixels[59 * 400 + 20 * 4 + 3]), 0u, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(pixels[60 * 400 + 20 * 4 + 3]), 0xffu, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(pixels[79 * 400 + 20 * 4 + 0]), 0xffu, TEST_LOCATION);
+  DALI_TEST_EQUALS(static_cast<uint32_t>(pixels[80 * 400 + 20 * 4 + 3]), 0u, TEST_LOCATION);
+
+  nsvgDeleteFlattenedImage(flattened);
+  nsvgDeleteRasterizer(rasterizer);
+  nsvgDelete(image);
+
+  END_TEST;
+}
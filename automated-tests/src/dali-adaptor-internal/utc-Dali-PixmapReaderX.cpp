@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/imaging/x11/pixmap-reader-x.h>
+#include <X11/Xatom.h>
+#include <X11/Xutil.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_pixmap_reader_x_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_pixmap_reader_x_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+std::vector<uint8_t> CreateRandomBytes(std::mt19937& random, uint32_t count)
+{
+  std::vector<uint8_t>                    bytes(count);
+  std::uniform_int_distribution<uint32_t> distribution(0u, 255u);
+  for(auto& byte : bytes)
+  {
+    byte = static_cast<uint8_t>(distribution(random));
+  }
+  return bytes;
+}
+
+} // namespace
+
+int UtcDaliPixmapReaderXConvertScanline(void)
+{
+  tet_infoline("Check that BGRX8888 scanlines of every width are converted to RGB888");
+
+  std::mt19937 random(1234u);
+  uint32_t     errors = 0u;
+  for(uint32_t width = 0u; width < 100u; ++width)
+  {
+    // Unaligned input, and a guard after the output.
+    const std::vector<uint8_t> input = CreateRandomBytes(random, width * 4u + 1u);
+    std::vector<uint8_t>       output(width * 3u + 16u, 0xa5);
+    std::vector<uint8_t>       expected(output);
+    for(uint32_t x = 0u; x < width; ++x)
+    {
+      expected[x * 3u]      = input[1u + x * 4u + 2u];
+      expected[x * 3u + 1u] = input[1u + x * 4u + 1u];
+      expected[x * 3u + 2u] = input[1u + x * 4u];
+    }
+
+    ConvertScanlineBGRX8888ToRGB888(input.data() + 1u, output.data(), width);
+    errors += (output != expected) ? 1u : 0u;
+  }
+  DALI_TEST_EQUALS(errors, 0u, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliPixmapReaderXConvertScanlineBenchmark(void)
+{
+  tet_infoline("Compare the scanline conversion with XGetPixel(), for a 1920x1080 image");
+
+  const uint32_t       width  = 1920u;
+  const uint32_t       height = 1080u;
+  std::mt19937         random(1234u);
+  std::vector<uint8_t> data = CreateRandomBytes(random, width * height * 4u);
+
+  // A client side image, as received from the server.
+  XImage image{};
+  image.width            = width;
+  image.height           = height;
+  image.format           = ZPixmap;
+  image.data             = reinterpret_cast<char*>(data.data());
+  image.byte_order       = LSBFirst;
+  image.bitmap_unit      = 32;
+  image.bitmap_bit_order = LSBFirst;
+  image.bitmap_pad       = 32;
+  image.depth            = 24;
+  image.bytes_per_line   = width * 4u;
+  image.bits_per_pixel   = 32;
+  image.red_mask         = 0xFF0000UL;
+  image.green_mask       = 0xFF00UL;
+  image.blue_mask        = 0xFFUL;
+  DALI_TEST_CHECK(XInitImage(&image));
+
+  std::vector<uint8_t> getPixelOutput(width * height * 3u);
+  std::vector<uint8_t> scanlineOutput(width * height * 3u);
+
+  auto start = std::chrono::steady_clock::now();
+  for(uint32_t y = 0u; y < height; ++y)
+  {
+    for(uint32_t x = 0u; x < width; ++x)
+    {
+      const unsigned long pixel  = XGetPixel(&image, x, y);
+      uint8_t*            outPtr = &getPixelOutput[(y * width + x) * 3u];
+      outPtr[0]                  = (pixel >> 16) & 0xFFU;
+      outPtr[1]                  = (pixel >> 8) & 0xFFU;
+      outPtr[2]                  = pixel & 0xFFU;
+    }
+  }
+  const double getPixelTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  for(uint32_t y = 0u; y < height; ++y)
+  {
+    ConvertScanlineBGRX8888ToRGB888(data.data() + y * width * 4u, scanlineOutput.data() + y * width * 3u, width);
+  }
+  const double scanlineTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  tet_printf("XGetPixel() %.2f ms, by scanline %.2f ms\n", getPixelTime, scanlineTime);
+  DALI_TEST_CHECK(getPixelOutput == scanlineOutput);
+
+  END_TEST;
+}
+
+int UtcDaliPixmapReaderXReadPixmapPixels(void)
+{
+  tet_infoline("Check that the pixels put into a pixmap are read back, when a X server is available (e.g. Xvfb)");
+
+  ::Display* display = XOpenDisplay(nullptr);
+  if(!display)
+  {
+    tet_infoline("No X server, skipped");
+    DALI_TEST_CHECK(true);
+    END_TEST;
+  }
+
+  const int      screen = DefaultScreen(display);
+  const int      depth  = DefaultDepth(display, screen);
+  const uint32_t width  = 67u;
+  const uint32_t height = 45u;
+  ::Pixmap       pixmap = XCreatePixmap(display, RootWindow(display, screen), width, height, depth);
+  GC             gc     = XCreateGC(display, pixmap, 0, nullptr);
+
+  // Put known pixels, through the server.
+  XImage*      image = XCreateImage(display, DefaultVisual(display, screen), depth, ZPixmap, 0, nullptr, width, height, 32, 0);
+  image->data        = static_cast<char*>(malloc(image->bytes_per_line * height));
+  std::mt19937 random(1234u);
+  for(uint32_t y = 0u; y < height; ++y)
+  {
+    for(uint32_t x = 0u; x < width; ++x)
+    {
+      XPutPixel(image, x, y, random() & 0xFFFFFFUL);
+    }
+  }
+  XPutImage(display, pixmap, gc, image, 0, 0, 0, 0, width, height);
+
+  // The pixmap is read on another connection, which the server may serve first if the image is not put yet.
+  XSync(display, False);
+
+  std::vector<uint8_t> pixels;
+  Pixel::Format        pixelFormat = Pixel::INVALID;
+  const bool           read        = ReadPixmapPixels(display, pixmap, width, height, pixels, pixelFormat);
+
+  if(depth == 24)
+  {
+    DALI_TEST_CHECK(read);
+    DALI_TEST_EQUALS(pixelFormat, Pixel::RGB888, TEST_LOCATION);
+    DALI_TEST_EQUALS(pixels.size(), static_cast<size_t>(width * height * 3u), TEST_LOCATION);
+
+    uint32_t errors = 0u;
+    for(uint32_t y = 0u; y < height && read; ++y)
+    {
+      for(uint32_t x = 0u; x < width; ++x)
+      {
+        const unsigned long pixel = XGetPixel(image, x, y);
+        const uint8_t*      rgb   = &pixels[(y * width + x) * 3u];
+        errors += (rgb[0] != ((pixel >> 16) & 0xFFU) || rgb[1] != ((pixel >> 8) & 0xFFU) || rgb[2] != (pixel & 0xFFU)) ? 1u : 0u;
+      }
+    }
+    DALI_TEST_EQUALS(errors, 0u, TEST_LOCATION);
+
+    // Again, with the MIT-SHM segment of the first read.
+    std::vector<uint8_t> pixels2;
+    DALI_TEST_CHECK(ReadPixmapPixels(display, pixmap, width, height, pixels2, pixelFormat));
+    DALI_TEST_CHECK(pixels == pixels2);
+
+    // A part of the pixmap, with another segment.
+    std::vector<uint8_t> pixels3;
+    DALI_TEST_CHECK(ReadPixmapPixels(display, pixmap, width, height - 1u, pixels3, pixelFormat));
+    DALI_TEST_CHECK(std::equal(pixels3.begin(), pixels3.end(), pixels.begin()));
+  }
+  else
+  {
+    tet_printf("Default depth %d, only checked that it doesn't crash\n", depth);
+    DALI_TEST_CHECK(true);
+  }
+
+  // Nothing to read.
+  DALI_TEST_CHECK(!ReadPixmapPixels(display, 0, width, height, pixels, pixelFormat));
+
+  XDestroyImage(image);
+  XFreeGC(display, gc);
+  XFreePixmap(display, pixmap);
+  XCloseDisplay(display);
+
+  END_TEST;
+}
+
+int UtcDaliPixmapReaderXEventsNotQueued(void)
+{
+  tet_infoline("Check that reading a pixmap doesn't read the events of the connection, when a X server is available (e.g. Xvfb)");
+
+  ::Display* display = XOpenDisplay(nullptr);
+  if(!display)
+  {
+    tet_infoline("No X server, skipped");
+    DALI_TEST_CHECK(true);
+    END_TEST;
+  }
+
+  const int      screen = DefaultScreen(display);
+  const uint32_t width  = 16u;
+  const uint32_t height = 16u;
+  ::Window       window = XCreateSimpleWindow(display, RootWindow(display, screen), 0, 0, width, height, 0, 0, 0);
+  ::Pixmap       pixmap = XCreatePixmap(display, window, width, height, DefaultDepth(display, screen));
+  XSelectInput(display, window, PropertyChangeMask);
+  XSync(display, False);
+
+  // An event sent while the pixmap is read, as the event thread would find on the socket.
+  const Atom    property = XInternAtom(display, "DALI_PIXMAP_READER_TEST", False);
+  unsigned char value    = 1u;
+  XChangeProperty(display, window, property, XA_INTEGER, 8, PropModeReplace, &value, 1);
+  XFlush(display);
+
+  std::vector<uint8_t> pixels;
+  Pixel::Format        pixelFormat = Pixel::INVALID;
+  ReadPixmapPixels(display, pixmap, width, height, pixels, pixelFormat);
+
+  // The event is still on the socket, so the event thread is woken up for it.
+  DALI_TEST_EQUALS(XEventsQueued(display, QueuedAlready), 0, TEST_LOCATION);
+  XSync(display, False);
+  DALI_TEST_CHECK(XPending(display) > 0);
+
+  XFreePixmap(display, pixmap);
+  XDestroyWindow(display, window);
+  XCloseDisplay(display);
+
+  END_TEST;
+}
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <adaptor-test-application.h>
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/system/common/texture-upload-manager-impl.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+using namespace Dali;
+
+void utc_dali_texture_upload_manager_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_texture_upload_manager_cleanup(void)
+{
+  unsetenv(DALI_ENV_TEXTURE_UPLOAD_BUDGET);
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+using TextureUploadManagerPtr = IntrusivePtr<Internal::Adaptor::TextureUploadManager>;
+using ResourceId              = Internal::Adaptor::TextureUploadManager::ResourceId;
+
+// 64x64 RGBA, 16KB per image.
+constexpr uint32_t IMAGE_SIZE  = 64u;
+constexpr uint32_t IMAGE_BYTES = IMAGE_SIZE * IMAGE_SIZE * 4u;
+
+TextureUploadManagerPtr CreateTextureUploadManager(AdaptorTestApplication& application, uint32_t budget)
+{
+  setenv(DALI_ENV_TEXTURE_UPLOAD_BUDGET, std::to_string(budget).c_str(), 1);
+  TextureUploadManagerPtr manager(new Internal::Adaptor::TextureUploadManager());
+  manager->InitalizeGraphicsController(application.GetGraphicsController());
+  return manager;
+}
+
+PixelData CreatePixelData()
+{
+  uint8_t* buffer = reinterpret_cast<uint8_t*>(malloc(IMAGE_BYTES));
+  return PixelData::New(buffer, IMAGE_BYTES, IMAGE_SIZE, IMAGE_SIZE, Pixel::RGBA8888, PixelData::FREE);
+}
+
+int GetCreationIndex(TestGraphicsController& controller, ResourceId resourceId)
+{
+  TraceCallStack::NamedParams params;
+  params["resourceId"] << resourceId;
+  return controller.mCallStack.FindIndexFromMethodAndParams("CreateTextureByResourceId", params);
+}
+
+} // namespace
+
+int UtcDaliTextureUploadManagerBudgetPerFrame(void)
+{
+  tet_infoline("Check that the uploads over the budget of a frame are deferred to the next frames");
+
+  AdaptorTestApplication  application;
+  TestGraphicsController& controller = application.GetGraphicsController();
+  TextureUploadManagerPtr manager    = CreateTextureUploadManager(application, IMAGE_BYTES * 3u);
+
+  controller.mCallStack.Enable(true);
+  controller.mCallStack.Reset();
+
+  for(ResourceId resourceId = 1u; resourceId <= 5u; ++resourceId)
+  {
+    manager->RequestUpload(resourceId, CreatePixelData());
+  }
+
+  // First frame : 3 images, in one call of the controller.
+  DALI_TEST_CHECK(manager->ResourceUpload());
+  DALI_TEST_EQUALS(controller.mCallStack.CountMethod("CreateTextureByResourceId"), 3, TEST_LOCATION);
+  DALI_TEST_EQUALS(controller.mCallStack.CountMethod("UpdateTextures"), 1, TEST_LOCATION);
+
+  // The second call of the same frame shares the budget, even for a new request.
+  manager->RequestUpload(6u, CreatePixelData());
+  DALI_TEST_CHECK(!manager->ContinueResourceUpload());
+  DALI_TEST_EQUALS(controller.mCallStack.CountMethod("CreateTextureByResourceId"), 3, TEST_LOCATION);
+
+  // Second frame : the 3 remaining images.
+  DALI_TEST_CHECK(manager->ResourceUpload());
+  DALI_TEST_EQUALS(controller.mCallStack.CountMethod("CreateTextureByResourceId"), 6, TEST_LOCATION);
+  DALI_TEST_EQUALS(controller.mCallStack.CountMethod("UpdateTextures"), 2, TEST_LOCATION);
+
+  // Nothing left.
+  DALI_TEST_CHECK(!manager->ResourceUpload());
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadManagerBudgetLargeImage(void)
+{
+  tet_infoline("Check that one image per frame is uploaded, even if it is larger than the budget");
+
+  AdaptorTestApplication  application;
+  TestGraphicsController& controller = application.GetGraphicsController();
+  TextureUploadManagerPtr manager    = CreateTextureUploadManager(application, IMAGE_BYTES / 2u);
+
+  controller.mCallStack.Enable(true);
+  controller.mCallStack.Reset();
+
+  manager->RequestUpload(1u, CreatePixelData());
+  manager->RequestUpload(2u, CreatePixelData());
+
+  DALI_TEST_CHECK(manager->ResourceUpload());
+  DALI_TEST_CHECK(!manager->ContinueResourceUpload());
+  DALI_TEST_EQUALS(controller.mCallStack.CountMethod("CreateTextureByResourceId"), 1, TEST_LOCATION);
+
+  DALI_TEST_CHECK(manager->ResourceUpload());
+  DALI_TEST_EQUALS(controller.mCallStack.CountMethod("CreateTextureByResourceId"), 2, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadManagerDeferredOrder(void)
+{
+  tet_infoline("Check that the deferred uploads are done oldest resource id first, across the wrap-around of the ids");
+
+  AdaptorTestApplication  application;
+  TestGraphicsController& controller = application.GetGraphicsController();
+  TextureUploadManagerPtr manager    = CreateTextureUploadManager(application, IMAGE_BYTES * 2u);
+
+  controller.mCallStack.Enable(true);
+  controller.mCallStack.Reset();
+
+  // The ids were generated in this order, and the worker threads complete in any order.
+  const std::vector<ResourceId> generatedOrder{0xfffffffdu, 0xfffffffeu, 0xffffffffu, 1u, 2u, 3u};
+  for(const uint32_t index : {4u, 0u, 3u, 5u, 2u})
+  {
+    manager->RequestUpload(generatedOrder[index], CreatePixelData());
+  }
+
+  manager->ResourceUpload();
+
+  // The oldest one arrives while the others are deferred.
+  manager->RequestUpload(generatedOrder[1], CreatePixelData());
+
+  for(uint32_t frame = 0u; frame < 3u; ++frame)
+  {
+    manager->ResourceUpload();
+  }
+  DALI_TEST_EQUALS(controller.mCallStack.CountMethod("CreateTextureByResourceId"), 6, TEST_LOCATION);
+
+  // The first frame took the 2 oldest of its requests, then the others are uploaded by id.
+  const std::vector<ResourceId> expectedOrder{0xfffffffdu, 0xffffffffu, 0xfffffffeu, 1u, 2u, 3u};
+  for(uint32_t i = 1u; i < expectedOrder.size(); ++i)
+  {
+    DALI_TEST_CHECK(GetCreationIndex(controller, expectedOrder[i - 1u]) >= 0);
+    DALI_TEST_CHECK(GetCreationIndex(controller, expectedOrder[i - 1u]) < GetCreationIndex(controller, expectedOrder[i]));
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTextureUploadManagerResourceUploadPastBudget(void)
+{
+  tet_infoline("Check that each ResourceUpload() call starts a new budget, so the uploads go on past the budget of one frame");
+
+  AdaptorTestApplication  application;
+  TestGraphicsController& controller = application.GetGraphicsController();
+  TextureUploadManagerPtr manager    = CreateTextureUploadManager(application, IMAGE_BYTES * 2u);
+
+  controller.mCallStack.Enable(true);
+  controller.mCallStack.Reset();
+
+  // Far more than the budget of a frame, uploaded by the devel api only.
+  for(int frame = 1; frame <= 10; ++frame)
+  {
+    manager->RequestUpload(static_cast<ResourceId>(frame * 2 - 1), CreatePixelData());
+    manager->RequestUpload(static_cast<ResourceId>(frame * 2), CreatePixelData());
+
+    DALI_TEST_CHECK(manager->ResourceUpload());
+    DALI_TEST_EQUALS(controller.mCallStack.CountMethod("CreateTextureByResourceId"), frame * 2, TEST_LOCATION);
+  }
+
+  // Nothing left.
+  DALI_TEST_CHECK(!manager->ResourceUpload());
+
+  END_TEST;
+}
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/trace/common/trace-recorder.h>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::TraceRecorder;
+
+namespace
+{
+size_t CountOccurrences(const std::string& string, const std::string& pattern)
+{
+  size_t count    = 0u;
+  size_t position = 0u;
+  while((position = string.find(pattern, position)) != std::string::npos)
+  {
+    ++count;
+    position += pattern.size();
+  }
+  return count;
+}
+
+} // namespace
+
+void utc_dali_internal_trace_recorder_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_trace_recorder_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliTraceRecorderChromeJson(void)
+{
+  tet_infoline("Record events on two threads, and write them as Chrome trace event JSON.");
+
+  TraceRecorder recorder(1024u);
+
+  recorder.Begin("DALI_TEST_RENDER");
+  recorder.Counter("DALI_TEST_COUNTER", 42);
+  recorder.End("DALI_TEST_RENDER");
+
+  std::thread thread([&recorder]() {
+    recorder.Begin("DALI_TEST_\"QUOTED\"");
+    recorder.End("DALI_TEST_\"QUOTED\"");
+  });
+  thread.join();
+
+  std::ostringstream output;
+  recorder.WriteChromeJson(output);
+  const std::string json = output.str();
+
+  DALI_TEST_CHECK(json.find("{\"traceEvents\":[") == 0u);
+  DALI_TEST_CHECK(json.find("\"displayTimeUnit\":\"ms\"}") != std::string::npos);
+  DALI_TEST_EQUALS(CountOccurrences(json, "\"ph\":\"B\""), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(CountOccurrences(json, "\"ph\":\"E\""), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(CountOccurrences(json, "\"ph\":\"C\""), static_cast<size_t>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(CountOccurrences(json, "\"name\":\"DALI_TEST_RENDER\""), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_CHECK(json.find("\"name\":\"DALI_TEST_COUNTER\",\"args\":{\"value\":42}") != std::string::npos);
+
+  tet_infoline("The tags are escaped.");
+  DALI_TEST_EQUALS(CountOccurrences(json, "\"name\":\"DALI_TEST_\\\"QUOTED\\\"\""), static_cast<size_t>(2u), TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliTraceRecorderRingBuffer(void)
+{
+  tet_infoline("Only the latest events are kept when the ring buffer of a thread is full.");
+
+  const uint32_t capacity = 16u;
+  TraceRecorder  recorder(capacity);
+
+  for(int64_t i = 0; i < 100; ++i)
+  {
+    recorder.Counter("DALI_TEST_COUNTER", i);
+  }
+
+  std::ostringstream output;
+  recorder.WriteChromeJson(output);
+  const std::string json = output.str();
+
+  // The slot which may be written during the dump is not read.
+  DALI_TEST_EQUALS(CountOccurrences(json, "\"ph\":\"C\""), static_cast<size_t>(capacity - 1u), TEST_LOCATION);
+  DALI_TEST_CHECK(json.find("{\"value\":99}") != std::string::npos);
+  DALI_TEST_CHECK(json.find("{\"value\":85}") != std::string::npos);
+  DALI_TEST_CHECK(json.find("{\"value\":84}") == std::string::npos);
+
+  END_TEST;
+}
+
+int UtcDaliTraceRecorderDumpWhileRecording(void)
+{
+  tet_infoline("Write the events while another thread records, and measure the cost of an event.");
+
+  TraceRecorder     recorder(256u);
+  std::atomic<bool> running{true};
+  std::atomic<bool> started{false};
+
+  std::thread thread([&]() {
+    while(running)
+    {
+      recorder.Begin("DALI_TEST_WRITER");
+      recorder.End("DALI_TEST_WRITER");
+      started = true;
+    }
+  });
+
+  while(!started)
+  {
+    std::this_thread::yield();
+  }
+
+  for(uint32_t i = 0u; i < 100u; ++i)
+  {
+    std::ostringstream output;
+    recorder.WriteChromeJson(output);
+    const std::string json = output.str();
+
+    // Never more events than the capacity, and never an event with an unknown tag.
+    // The events overwritten while they are read are dropped, so there may be fewer.
+    DALI_TEST_CHECK(CountOccurrences(json, "\"name\":\"DALI_TEST_WRITER\"") < 256u);
+    DALI_TEST_CHECK(json.find("\n],\"displayTimeUnit\":\"ms\"}\n") != std::string::npos);
+    DALI_TEST_EQUALS(CountOccurrences(json, "(unknown)"), static_cast<size_t>(0u), TEST_LOCATION);
+  }
+
+  running = false;
+  thread.join();
+
+  const uint32_t numberOfEvents = 1000000u;
+  const auto     start          = std::chrono::steady_clock::now();
+  for(uint32_t i = 0u; i < numberOfEvents / 2u; ++i)
+  {
+    recorder.Begin("DALI_TEST_BENCHMARK");
+    recorder.End("DALI_TEST_BENCHMARK");
+  }
+  const double nanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  tet_printf("Trace recorder : %f ns per event\n", nanoseconds / numberOfEvents);
+
+  END_TEST;
+}
+
+int UtcDaliTraceRecorderExitedThreads(void)
+{
+  tet_infoline("The buffers of the exited threads are reused, and their events are still written.");
+
+  const uint32_t capacity = 64u;
+  TraceRecorder  recorder(capacity);
+
+  for(int64_t i = 0; i < 10; ++i)
+  {
+    std::thread thread([&recorder, i]() {
+      recorder.Counter("DALI_TEST_EXITED", i);
+    });
+    thread.join();
+  }
+
+  // One buffer for all the threads, as they didn't run at once.
+  DALI_TEST_EQUALS(recorder.GetThreadBufferCount(), 1u, TEST_LOCATION);
+
+  std::ostringstream output;
+  recorder.WriteChromeJson(output);
+  std::string json = output.str();
+  DALI_TEST_EQUALS(CountOccurrences(json, "\"name\":\"DALI_TEST_EXITED\""), static_cast<size_t>(10u), TEST_LOCATION);
+  DALI_TEST_CHECK(json.find("{\"value\":0}") != std::string::npos);
+  DALI_TEST_CHECK(json.find("{\"value\":9}") != std::string::npos);
+
+  tet_infoline("The events of the exited threads are bounded by the capacity, the oldest are dropped.");
+
+  for(int64_t i = 0; i < 20; ++i)
+  {
+    std::thread thread([&recorder, i]() {
+      for(int64_t j = 0; j < 10; ++j)
+      {
+        recorder.Counter("DALI_TEST_BOUNDED", 1000 + i * 10 + j);
+      }
+    });
+    thread.join();
+  }
+
+  // Two threads alive at once.
+  std::thread first([&recorder]() { recorder.Counter("DALI_TEST_ALIVE", 1); std::this_thread::sleep_for(std::chrono::milliseconds(50)); });
+  std::thread second([&recorder]() { recorder.Counter("DALI_TEST_ALIVE", 2); std::this_thread::sleep_for(std::chrono::milliseconds(50)); });
+  first.join();
+  second.join();
+  DALI_TEST_EQUALS(recorder.GetThreadBufferCount(), 2u, TEST_LOCATION);
+
+  output.str("");
+  recorder.WriteChromeJson(output);
+  json = output.str();
+  DALI_TEST_EQUALS(CountOccurrences(json, "\"ph\":\"C\""), static_cast<size_t>(capacity), TEST_LOCATION);
+  DALI_TEST_EQUALS(CountOccurrences(json, "\"name\":\"DALI_TEST_EXITED\""), static_cast<size_t>(0u), TEST_LOCATION);
+  DALI_TEST_EQUALS(CountOccurrences(json, "\"name\":\"DALI_TEST_ALIVE\""), static_cast<size_t>(2u), TEST_LOCATION);
+  DALI_TEST_CHECK(json.find("{\"value\":1199}") != std::string::npos);
+
+  END_TEST;
+}
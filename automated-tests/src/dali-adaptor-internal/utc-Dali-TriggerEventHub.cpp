@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <poll.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/trigger-event-hub.h>
+
+using namespace Dali;
+using Dali::Internal::Adaptor::TriggerEventHub;
+
+namespace
+{
+struct TestTrigger
+{
+  void Triggered()
+  {
+    ++callCount;
+    lastSequence = sequence.load();
+    if(unregisterSlot >= 0)
+    {
+      hub->Unregister(static_cast<uint32_t>(unregisterSlot));
+      unregisterSlot = -1;
+    }
+  }
+
+  TriggerEventHub*      hub{nullptr};
+  uint32_t              slot{0u};
+  uint32_t              callCount{0u};
+  int                   unregisterSlot{-1}; ///< a slot to unregister from the callback
+  std::atomic<uint32_t> sequence{0u};       ///< written by the thread triggering
+  std::atomic<uint32_t> lastSequence{0u};   ///< the sequence seen by the callback, read by the test
+};
+
+/**
+ * Wait for the file descriptor as the main loop would, and dispatch.
+ * @return false if there was no wakeup before the timeout
+ */
+bool WaitAndDispatch(TriggerEventHub& hub, int timeoutMilliseconds)
+{
+  pollfd fileDescriptor{hub.GetFileDescriptor(), POLLIN, 0};
+  if(poll(&fileDescriptor, 1, timeoutMilliseconds) != 1)
+  {
+    return false;
+  }
+  uint64_t data;
+  if(read(hub.GetFileDescriptor(), &data, sizeof(data)) != sizeof(data))
+  {
+    return false;
+  }
+  hub.Dispatch();
+  return true;
+}
+
+} // namespace
+
+void utc_dali_internal_trigger_event_hub_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_internal_trigger_event_hub_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+int UtcDaliTriggerEventHubCoalesce(void)
+{
+  tet_infoline("Many triggers before the main loop wakes up make one wakeup, and each callback is called once.");
+
+  TriggerEventHub hub(false);
+
+  std::vector<TestTrigger> triggers(100u);
+  for(TestTrigger& trigger : triggers)
+  {
+    trigger.hub  = &hub;
+    trigger.slot = hub.Register(MakeCallback(&trigger, &TestTrigger::Triggered));
+  }
+
+  for(uint32_t i = 0u; i < 3u; ++i)
+  {
+    for(TestTrigger& trigger : triggers)
+    {
+      hub.Trigger(trigger.slot);
+    }
+  }
+
+  DALI_TEST_CHECK(WaitAndDispatch(hub, 1000));
+  for(TestTrigger& trigger : triggers)
+  {
+    DALI_TEST_EQUALS(trigger.callCount, 1u, TEST_LOCATION);
+  }
+
+  TriggerEventHub::Statistics statistics = hub.GetStatistics();
+  DALI_TEST_EQUALS(statistics.triggerCount, static_cast<uint64_t>(300u), TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.wakeupCount, static_cast<uint64_t>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.dispatchCount, static_cast<uint64_t>(1u), TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.callbackCount, static_cast<uint64_t>(100u), TEST_LOCATION);
+
+  tet_infoline("Nothing is pending after the dispatch.");
+  DALI_TEST_CHECK(!WaitAndDispatch(hub, 0));
+
+  for(TestTrigger& trigger : triggers)
+  {
+    hub.Unregister(trigger.slot);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliTriggerEventHubUnregisterWhileDispatching(void)
+{
+  tet_infoline("A callback can unregister a pending trigger, which isn't called, and its slot isn't reused in the same dispatch.");
+
+  TriggerEventHub hub(false);
+
+  TestTrigger first;
+  TestTrigger second;
+  first.hub    = &hub;
+  second.hub   = &hub;
+  first.slot   = hub.Register(MakeCallback(&first, &TestTrigger::Triggered));
+  second.slot  = hub.Register(MakeCallback(&second, &TestTrigger::Triggered));
+  DALI_TEST_CHECK(first.slot < second.slot);
+
+  first.unregisterSlot = static_cast<int>(second.slot);
+  hub.Trigger(first.slot);
+  hub.Trigger(second.slot);
+
+  DALI_TEST_CHECK(WaitAndDispatch(hub, 1000));
+  DALI_TEST_EQUALS(first.callCount, 1u, TEST_LOCATION);
+  DALI_TEST_EQUALS(second.callCount, 0u, TEST_LOCATION);
+
+  tet_infoline("The slot is reused after the dispatch, and a new trigger isn't pending.");
+  TestTrigger third;
+  third.hub  = &hub;
+  third.slot = hub.Register(MakeCallback(&third, &TestTrigger::Triggered));
+  DALI_TEST_EQUALS(third.slot, second.slot, TEST_LOCATION);
+  DALI_TEST_CHECK(!WaitAndDispatch(hub, 0));
+
+  tet_infoline("A trigger from a callback wakes up the main loop again.");
+  hub.Trigger(third.slot);
+  DALI_TEST_CHECK(WaitAndDispatch(hub, 1000));
+  DALI_TEST_EQUALS(third.callCount, 1u, TEST_LOCATION);
+
+  hub.Unregister(first.slot);
+  hub.Unregister(third.slot);
+
+  END_TEST;
+}
+
+int UtcDaliTriggerEventHubBenchmark(void)
+{
+  tet_infoline("Triggers from several threads are never lost, and measure the wakeups and syscalls per frame.");
+
+  TriggerEventHub hub(false);
+
+  const uint32_t numberOfTriggers = 32u;
+  const uint32_t numberOfThreads  = 4u;
+  const uint32_t numberOfFrames   = 2000u;
+
+  std::vector<TestTrigger> triggers(numberOfTriggers);
+  for(TestTrigger& trigger : triggers)
+  {
+    trigger.hub  = &hub;
+    trigger.slot = hub.Register(MakeCallback(&trigger, &TestTrigger::Triggered));
+  }
+
+  // Each thread triggers its share of the triggers once per frame, as async loaders and event thread callbacks would.
+  std::atomic<bool> running{true};
+  std::vector<std::thread> threads;
+  for(uint32_t threadIndex = 0u; threadIndex < numberOfThreads; ++threadIndex)
+  {
+    threads.emplace_back([&, threadIndex]() {
+      for(uint32_t frame = 1u; frame <= numberOfFrames; ++frame)
+      {
+        for(uint32_t i = threadIndex; i < numberOfTriggers; i += numberOfThreads)
+        {
+          triggers[i].sequence.store(frame);
+          hub.Trigger(triggers[i].slot);
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+      }
+    });
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  std::thread dispatcher([&]() {
+    while(running)
+    {
+      WaitAndDispatch(hub, 10);
+    }
+  });
+
+  for(std::thread& thread : threads)
+  {
+    thread.join();
+  }
+
+  // Every trigger must be dispatched after its last sequence, or a wakeup has been lost.
+  const auto timeout  = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  bool       complete = false;
+  while(!complete && std::chrono::steady_clock::now() < timeout)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    complete = true;
+    for(TestTrigger& trigger : triggers)
+    {
+      complete &= (trigger.lastSequence.load() == numberOfFrames);
+    }
+  }
+  running = false;
+  dispatcher.join();
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  DALI_TEST_CHECK(complete);
+
+  const TriggerEventHub::Statistics statistics = hub.GetStatistics();
+  DALI_TEST_EQUALS(statistics.triggerCount, static_cast<uint64_t>(numberOfTriggers * numberOfFrames), TEST_LOCATION);
+  DALI_TEST_CHECK(statistics.wakeupCount <= statistics.triggerCount);
+  DALI_TEST_CHECK(statistics.dispatchCount >= 1u);
+
+  // With an event file descriptor per trigger, each trigger is a write, and each callback a read and a poll wakeup.
+  const double hubSyscalls = static_cast<double>(statistics.wakeupCount * 2u);
+  const double fdSyscalls  = static_cast<double>(statistics.triggerCount + statistics.callbackCount);
+  tet_printf("Trigger event hub : %u triggers, %u threads, %u frames in %f s\n", numberOfTriggers, numberOfThreads, numberOfFrames, seconds);
+  tet_printf("Trigger event hub : %f wakeups/s, %f syscalls per frame (%f with a file descriptor per trigger)\n",
+             statistics.wakeupCount / seconds,
+             hubSyscalls / numberOfFrames,
+             fdSyscalls / numberOfFrames);
+
+  for(TestTrigger& trigger : triggers)
+  {
+    hub.Unregister(trigger.slot);
+  }
+
+  END_TEST;
+}
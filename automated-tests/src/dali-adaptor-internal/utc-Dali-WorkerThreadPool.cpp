@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/internal/system/common/worker-thread-pool.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::Internal::Adaptor;
+
+void utc_dali_worker_thread_pool_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_worker_thread_pool_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+constexpr uint32_t PART_COUNT = 64u;
+
+/**
+ * @brief Run the parts of a job, and record each part and the threads which ran them.
+ */
+struct PartRecord
+{
+  std::vector<std::atomic<uint32_t>> runCounts;
+  std::mutex                         mutex;
+  std::set<std::thread::id>          threads;
+
+  explicit PartRecord(uint32_t partCount)
+  : runCounts(partCount)
+  {
+  }
+
+  void RunPart(uint32_t index)
+  {
+    ++runCounts[index];
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+    std::lock_guard<std::mutex> lock(mutex);
+    threads.insert(std::this_thread::get_id());
+  }
+
+  bool IsEachPartRunOnce() const
+  {
+    for(const auto& runCount : runCounts)
+    {
+      if(runCount != 1u)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+} // namespace
+
+int UtcDaliWorkerThreadPoolRun(void)
+{
+  tet_infoline("Check that each part of a job is run once, by the workers and the calling thread");
+
+  setenv("DALI_WORKER_THREAD_POOL_SIZE", "3", 1);
+  WorkerThreadPool& pool = WorkerThreadPool::Get();
+  DALI_TEST_EQUALS(pool.GetWorkerCount(), 3u, TEST_LOCATION);
+
+  PartRecord record(PART_COUNT);
+  pool.Run(PART_COUNT, [&record](uint32_t index) { record.RunPart(index); });
+
+  DALI_TEST_CHECK(record.IsEachPartRunOnce());
+  DALI_TEST_CHECK(record.threads.count(std::this_thread::get_id()) == 1u);
+  DALI_TEST_CHECK(record.threads.size() > 1u);
+  tet_printf("%u parts run by %u threads\n", PART_COUNT, static_cast<uint32_t>(record.threads.size()));
+
+  END_TEST;
+}
+
+int UtcDaliWorkerThreadPoolSubmit(void)
+{
+  tet_infoline("Check that a submitted job is run by the workers only, and Wait() returns once it is done");
+
+  setenv("DALI_WORKER_THREAD_POOL_SIZE", "2", 1);
+  WorkerThreadPool& pool = WorkerThreadPool::Get();
+
+  auto record = std::make_shared<PartRecord>(PART_COUNT);
+  auto job    = pool.Submit(PART_COUNT, [record](uint32_t index) { record->RunPart(index); });
+  pool.Wait(job);
+
+  DALI_TEST_CHECK(record->IsEachPartRunOnce());
+  DALI_TEST_CHECK(record->threads.count(std::this_thread::get_id()) == 0u);
+  DALI_TEST_CHECK(record->threads.size() <= 2u);
+
+  // Waiting again, or for nothing, returns at once.
+  pool.Wait(job);
+  pool.Wait(WorkerThreadPool::JobPtr());
+
+  END_TEST;
+}
+
+int UtcDaliWorkerThreadPoolConcurrentCallers(void)
+{
+  tet_infoline("Check that concurrent and nested jobs share the bounded pool without deadlock");
+
+  setenv("DALI_WORKER_THREAD_POOL_SIZE", "2", 1);
+  WorkerThreadPool& pool = WorkerThreadPool::Get();
+
+  const uint32_t           callerCount = 6u;
+  std::vector<PartRecord*> records;
+  std::vector<std::thread> callers;
+  for(uint32_t i = 0u; i < callerCount; ++i)
+  {
+    records.push_back(new PartRecord(PART_COUNT));
+  }
+  for(uint32_t i = 0u; i < callerCount; ++i)
+  {
+    PartRecord* record = records[i];
+    callers.emplace_back([&pool, record]() {
+      // Each part runs a nested job, as a blur called from a rasterizing band would.
+      pool.Run(PART_COUNT / 8u, [&pool, record](uint32_t outer) {
+        pool.Run(8u, [record, outer](uint32_t inner) { record->RunPart(outer * 8u + inner); });
+      });
+    });
+  }
+  for(auto& caller : callers)
+  {
+    caller.join();
+  }
+
+  std::set<std::thread::id> threads;
+  for(auto* record : records)
+  {
+    DALI_TEST_CHECK(record->IsEachPartRunOnce());
+    threads.insert(record->threads.begin(), record->threads.end());
+    delete record;
+  }
+
+  // The callers and at most 2 workers.
+  DALI_TEST_CHECK(threads.size() <= callerCount + 2u);
+
+  END_TEST;
+}
+
+int UtcDaliWorkerThreadPoolNoWorker(void)
+{
+  tet_infoline("Check that the jobs are run by the calling thread when the pool has no worker");
+
+  setenv("DALI_WORKER_THREAD_POOL_SIZE", "0", 1);
+  WorkerThreadPool& pool = WorkerThreadPool::Get();
+  DALI_TEST_EQUALS(pool.GetWorkerCount(), 0u, TEST_LOCATION);
+
+  PartRecord record(PART_COUNT);
+  pool.Run(PART_COUNT, [&record](uint32_t index) { record.RunPart(index); });
+  DALI_TEST_CHECK(record.IsEachPartRunOnce());
+
+  PartRecord submitRecord(PART_COUNT);
+  auto       job = pool.Submit(PART_COUNT, [&submitRecord](uint32_t index) { submitRecord.RunPart(index); });
+  pool.Wait(job);
+  DALI_TEST_CHECK(submitRecord.IsEachPartRunOnce());
+
+  std::set<std::thread::id> threads(record.threads);
+  threads.insert(submitRecord.threads.begin(), submitRecord.threads.end());
+  DALI_TEST_EQUALS(threads.size(), static_cast<size_t>(1u), TEST_LOCATION);
+
+  END_TEST;
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/devel-api/adaptor-framework/bitmap-saver.h>
+#include <dali/devel-api/adaptor-framework/image-loading.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace Dali;
+
+void utc_dali_bitmap_saver_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_bitmap_saver_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+const char* PNG_FILENAME = "utc-dali-bitmap-saver.png";
+const char* JPG_FILENAME = "utc-dali-bitmap-saver.jpg";
+const char* BMP_FILENAME = "utc-dali-bitmap-saver.bmp";
+
+std::vector<uint8_t> CreatePixels(uint32_t width, uint32_t height, uint32_t bytesPerPixel)
+{
+  std::vector<uint8_t> pixels(width * height * bytesPerPixel);
+  for(uint32_t y = 0; y < height; ++y)
+  {
+    for(uint32_t x = 0; x < width; ++x)
+    {
+      uint8_t* pixel = &pixels[(y * width + x) * bytesPerPixel];
+      for(uint32_t channel = 0; channel < bytesPerPixel; ++channel)
+      {
+        // Smooth gradients, which jpeg keeps well.
+        pixel[channel] = static_cast<uint8_t>((x * 4u + y * 2u + channel * 60u) & 0xff);
+      }
+    }
+  }
+  return pixels;
+}
+
+bool FileExists(const char* filename)
+{
+  FILE* file = fopen(filename, "rb");
+  if(file)
+  {
+    fclose(file);
+    return true;
+  }
+  return false;
+}
+
+} // namespace
+
+int UtcDaliBitmapSaverEncodeRowsToFilePng(void)
+{
+  tet_infoline("Check that the rows encoded into a png file are loaded back");
+
+  const uint32_t             width  = 37u;
+  const uint32_t             height = 21u;
+  const std::vector<uint8_t> pixels = CreatePixels(width, height, 4u);
+
+  std::vector<uint32_t> requestedRows;
+  auto                  getRow = [&](uint32_t row) {
+    requestedRows.push_back(row);
+    return pixels.data() + row * width * 4u;
+  };
+  DALI_TEST_CHECK(EncodeRowsToFile(getRow, PNG_FILENAME, Pixel::RGBA8888, width, height, DEFAULT_JPG_QUALITY));
+
+  // The rows are read once each, from the top.
+  DALI_TEST_EQUALS(requestedRows.size(), static_cast<size_t>(height), TEST_LOCATION);
+  for(uint32_t row = 0; row < requestedRows.size(); ++row)
+  {
+    DALI_TEST_EQUALS(requestedRows[row], row, TEST_LOCATION);
+  }
+
+  Devel::PixelBuffer pixelBuffer = LoadImageFromFile(PNG_FILENAME);
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(pixelBuffer.GetWidth(), width, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetHeight(), height, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetPixelFormat(), Pixel::RGBA8888, TEST_LOCATION);
+  DALI_TEST_CHECK(std::equal(pixels.begin(), pixels.end(), pixelBuffer.GetBuffer()));
+
+  std::remove(PNG_FILENAME);
+
+  END_TEST;
+}
+
+int UtcDaliBitmapSaverEncodeRowsToFileJpeg(void)
+{
+  tet_infoline("Check that the rows encoded into a jpeg file are loaded back, within the jpeg loss");
+
+  const uint32_t             width  = 40u;
+  const uint32_t             height = 24u;
+  const std::vector<uint8_t> pixels = CreatePixels(width, height, 3u);
+
+  auto getRow = [&](uint32_t row) { return pixels.data() + row * width * 3u; };
+  DALI_TEST_CHECK(EncodeRowsToFile(getRow, JPG_FILENAME, Pixel::RGB888, width, height, DEFAULT_JPG_QUALITY));
+
+  Devel::PixelBuffer pixelBuffer = LoadImageFromFile(JPG_FILENAME);
+  DALI_TEST_CHECK(pixelBuffer);
+  DALI_TEST_EQUALS(pixelBuffer.GetWidth(), width, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetHeight(), height, TEST_LOCATION);
+  DALI_TEST_EQUALS(pixelBuffer.GetPixelFormat(), Pixel::RGB888, TEST_LOCATION);
+
+  int32_t        maximumError = 0;
+  const uint8_t* loaded       = pixelBuffer.GetBuffer();
+  for(uint32_t i = 0; i < pixels.size(); ++i)
+  {
+    maximumError = std::max(maximumError, std::abs(static_cast<int32_t>(loaded[i]) - static_cast<int32_t>(pixels[i])));
+  }
+  tet_printf("maximum error : %d\n", maximumError);
+  DALI_TEST_CHECK(maximumError <= 8);
+
+  // The buffer version writes the same rows.
+  DALI_TEST_CHECK(EncodeToFile(pixels.data(), JPG_FILENAME, Pixel::RGB888, width, height, DEFAULT_JPG_QUALITY));
+  Devel::PixelBuffer pixelBuffer2 = LoadImageFromFile(JPG_FILENAME);
+  DALI_TEST_CHECK(pixelBuffer2);
+  DALI_TEST_CHECK(std::equal(loaded, loaded + pixels.size(), pixelBuffer2.GetBuffer()));
+
+  std::remove(JPG_FILENAME);
+
+  END_TEST;
+}
+
+int UtcDaliBitmapSaverEncodeRowsToFileNegative(void)
+{
+  tet_infoline("Check that no file is left when the rows cannot be encoded");
+
+  const uint32_t             width  = 16u;
+  const uint32_t             height = 16u;
+  const std::vector<uint8_t> pixels = CreatePixels(width, height, 4u);
+
+  // A row cannot be read.
+  auto getRow = [&](uint32_t row) -> const uint8_t* { return row < height / 2u ? pixels.data() + row * width * 4u : nullptr; };
+  DALI_TEST_CHECK(!EncodeRowsToFile(getRow, PNG_FILENAME, Pixel::RGBA8888, width, height, DEFAULT_JPG_QUALITY));
+  DALI_TEST_CHECK(!FileExists(PNG_FILENAME));
+  DALI_TEST_CHECK(!EncodeRowsToFile(getRow, JPG_FILENAME, Pixel::RGBA8888, width, height, DEFAULT_JPG_QUALITY));
+  DALI_TEST_CHECK(!FileExists(JPG_FILENAME));
+
+  // The format is not supported.
+  auto getAllRows = [&](uint32_t row) { return pixels.data() + row * width * 4u; };
+  DALI_TEST_CHECK(!EncodeRowsToFile(getAllRows, BMP_FILENAME, Pixel::RGBA8888, width, height, DEFAULT_JPG_QUALITY));
+  DALI_TEST_CHECK(!FileExists(BMP_FILENAME));
+
+  END_TEST;
+}
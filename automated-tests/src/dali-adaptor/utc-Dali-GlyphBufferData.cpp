@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <dali-test-suite-utils.h>
+#include <dali/dali.h>
+#include <dali/devel-api/text-abstraction/glyph-buffer-data.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace Dali;
+using namespace Dali::TextAbstraction;
+
+void utc_dali_glyph_buffer_data_startup(void)
+{
+  test_return_value = TET_UNDEF;
+}
+
+void utc_dali_glyph_buffer_data_cleanup(void)
+{
+  test_return_value = TET_PASS;
+}
+
+namespace
+{
+using CompressionType = GlyphBufferData::CompressionType;
+
+const CompressionType COMPRESSION_TYPES[] = {CompressionType::NO_COMPRESSION, CompressionType::BPP_4, CompressionType::RLE_4};
+
+const char* GetCompressionTypeName(CompressionType compressionType)
+{
+  switch(compressionType)
+  {
+    case CompressionType::NO_COMPRESSION:
+    {
+      return "NO_COMPRESSION";
+    }
+    case CompressionType::BPP_4:
+    {
+      return "BPP_4";
+    }
+    case CompressionType::RLE_4:
+    {
+      return "RLE_4";
+    }
+  }
+  return "";
+}
+
+/**
+ * Create an anti-aliased ring, with long runs of the same value as a rendered glyph.
+ */
+std::vector<uint8_t> CreateGlyphPixels(uint32_t width, uint32_t height)
+{
+  std::vector<uint8_t> pixels(width * height);
+
+  const float centerX = 0.5f * width;
+  const float centerY = 0.5f * height;
+  const float radius  = 0.35f * std::min(width, height);
+  for(uint32_t y = 0; y < height; ++y)
+  {
+    for(uint32_t x = 0; x < width; ++x)
+    {
+      const float distance  = std::abs(std::hypot(x - centerX, y - centerY) - radius);
+      const float coverage  = std::max(0.0f, std::min(1.0f, 3.0f - distance));
+      pixels[y * width + x] = static_cast<uint8_t>(coverage * 255.0f);
+    }
+  }
+  return pixels;
+}
+
+std::vector<uint8_t> CreateRandomPixels(std::mt19937& random, uint32_t width, uint32_t height)
+{
+  std::vector<uint8_t> pixels(width * height);
+
+  // Mix noise with runs, to get every kind of RLE4 run.
+  std::uniform_int_distribution<uint32_t> distribution(0u, 255u);
+  uint8_t                                 value = 0u;
+  for(auto& pixel : pixels)
+  {
+    const uint32_t choice = distribution(random);
+    if(choice < 64u)
+    {
+      value = static_cast<uint8_t>(distribution(random));
+    }
+    pixel = (choice & 1u) ? value : static_cast<uint8_t>(distribution(random));
+  }
+  return pixels;
+}
+
+/**
+ * @return The pixels as decompressed: 4 bit compression rounds each value to a multiple of 17.
+ */
+std::vector<uint8_t> GetExpectedPixels(const std::vector<uint8_t>& pixels, CompressionType compressionType)
+{
+  if(compressionType == CompressionType::NO_COMPRESSION)
+  {
+    return pixels;
+  }
+
+  std::vector<uint8_t> expected(pixels.size());
+  for(uint32_t i = 0; i < pixels.size(); ++i)
+  {
+    expected[i] = ((pixels[i] + 8u) / 17u) * 17u;
+  }
+  return expected;
+}
+
+size_t CompressPixels(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height, CompressionType compressionType, GlyphBufferData& data)
+{
+  data.width           = width;
+  data.height          = height;
+  data.format          = Pixel::L8;
+  data.compressionType = compressionType;
+  return GlyphBufferData::Compress(pixels.data(), data);
+}
+
+/**
+ * Check that the three decompression functions give back the pixels.
+ * @return The number of wrong pixels.
+ */
+uint32_t CheckRoundTrip(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height, CompressionType compressionType)
+{
+  GlyphBufferData data;
+  const size_t    compressedSize = CompressPixels(pixels, width, height, compressionType, data);
+  if(compressedSize == 0u)
+  {
+    return width * height;
+  }
+
+  const std::vector<uint8_t> expected = GetExpectedPixels(pixels, compressionType);
+  uint32_t                   errors   = 0u;
+
+  // Decompress into a buffer of the size of the glyph.
+  std::vector<uint8_t> outBuffer(width * height);
+  GlyphBufferData::Decompress(data, outBuffer.data());
+  errors += (outBuffer != expected) ? 1u : 0u;
+
+  // Decompress into a region of a larger buffer. The other pixels must not change.
+  const uint32_t       atlasWidth = width + 7u;
+  const uint32_t       xOffset    = 5u;
+  const uint32_t       yOffset    = 3u;
+  const uint8_t        background = 0x5a;
+  std::vector<uint8_t> atlas(atlasWidth * (height + 5u), background);
+  GlyphBufferData::Decompress(data, atlas.data(), atlasWidth, xOffset, yOffset);
+  for(uint32_t y = 0; y < height + 5u; ++y)
+  {
+    for(uint32_t x = 0; x < atlasWidth; ++x)
+    {
+      const bool    inside        = x >= xOffset && x < xOffset + width && y >= yOffset && y < yOffset + height;
+      const uint8_t expectedValue = inside ? expected[(y - yOffset) * width + (x - xOffset)] : background;
+      errors += (atlas[y * atlasWidth + x] != expectedValue) ? 1u : 0u;
+    }
+  }
+
+  // Decompress scanline by scanline, the output keeps the previous scanline.
+  std::vector<uint8_t> scanline(width, background);
+  uint32_t             offset = 0u;
+  for(uint32_t y = 0; y < height; ++y)
+  {
+    GlyphBufferData::DecompressScanline(data, scanline.data(), offset);
+    errors += std::equal(scanline.begin(), scanline.end(), expected.begin() + y * width) ? 0u : 1u;
+  }
+  errors += (offset != compressedSize) ? 1u : 0u;
+
+  return errors;
+}
+
+} // namespace
+
+int UtcDaliGlyphBufferDataCompressRoundTrip(void)
+{
+  tet_infoline("Check that random bitmaps are given back by Decompress and DecompressScanline after Compress");
+
+  std::mt19937                            random(1234u);
+  std::uniform_int_distribution<uint32_t> sizeDistribution(1u, 80u);
+
+  for(const auto compressionType : COMPRESSION_TYPES)
+  {
+    uint32_t errors = 0u;
+    for(uint32_t iteration = 0; iteration < 300u; ++iteration)
+    {
+      const uint32_t width  = sizeDistribution(random);
+      const uint32_t height = sizeDistribution(random);
+      errors += CheckRoundTrip(CreateRandomPixels(random, width, height), width, height, compressionType);
+      errors += CheckRoundTrip(CreateGlyphPixels(width, height), width, height, compressionType);
+    }
+
+    // Uniform and wide bitmaps. Scanlines wider than 1024 pixels are decoded into the heap by DecompressScanline.
+    for(const uint32_t width : {1u, 2u, 15u, 16u, 17u, 31u, 32u, 33u, 1023u, 1024u, 1025u, 1500u})
+    {
+      errors += CheckRoundTrip(std::vector<uint8_t>(width * 4u, 0u), width, 4u, compressionType);
+      errors += CheckRoundTrip(std::vector<uint8_t>(width * 4u, 255u), width, 4u, compressionType);
+      errors += CheckRoundTrip(CreateRandomPixels(random, width, 4u), width, 4u, compressionType);
+      errors += CheckRoundTrip(CreateGlyphPixels(width, 9u), width, 9u, compressionType);
+    }
+
+    tet_printf("%s : %u errors\n", GetCompressionTypeName(compressionType), errors);
+    DALI_TEST_EQUALS(errors, 0u, TEST_LOCATION);
+  }
+
+  END_TEST;
+}
+
+int UtcDaliGlyphBufferDataDecompressNullBuffer(void)
+{
+  tet_infoline("Check that Decompress does nothing without output buffer");
+
+  const std::vector<uint8_t> pixels = CreateGlyphPixels(20u, 20u);
+  for(const auto compressionType : COMPRESSION_TYPES)
+  {
+    GlyphBufferData data;
+    CompressPixels(pixels, 20u, 20u, compressionType, data);
+
+    GlyphBufferData::Decompress(data, nullptr);
+    GlyphBufferData::Decompress(data, nullptr, 64u, 10u, 10u);
+  }
+  DALI_TEST_CHECK(true);
+
+  END_TEST;
+}
+
+int UtcDaliGlyphBufferDataDecompressBenchmark(void)
+{
+  tet_infoline("Measure the decompression throughput of each compression type");
+
+  // Glyphs of a 48 pixels font, blitted into a 1024 pixels wide atlas.
+  const uint32_t       width        = 48u;
+  const uint32_t       height       = 60u;
+  const uint32_t       atlasWidth   = 1024u;
+  const uint32_t       glyphsPerRow = atlasWidth / width;
+  const uint32_t       iterations   = 20000u;
+  std::vector<uint8_t> pixels       = CreateGlyphPixels(width, height);
+  std::vector<uint8_t> atlas(atlasWidth * height);
+  std::vector<uint8_t> outBuffer(width * height);
+
+  for(const auto compressionType : COMPRESSION_TYPES)
+  {
+    GlyphBufferData data;
+    CompressPixels(pixels, width, height, compressionType, data);
+
+    // Through a buffer of the size of the glyph, then copied into the atlas.
+    auto start = std::chrono::steady_clock::now();
+    for(uint32_t i = 0; i < iterations; ++i)
+    {
+      GlyphBufferData::Decompress(data, outBuffer.data());
+      uint8_t* destination = atlas.data() + (i % glyphsPerRow) * width;
+      for(uint32_t y = 0; y < height; ++y)
+      {
+        memcpy(destination + y * atlasWidth, outBuffer.data() + y * width, width);
+      }
+    }
+    const double copyTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Scanline by scanline, copied into the atlas.
+    start = std::chrono::steady_clock::now();
+    for(uint32_t i = 0; i < iterations; ++i)
+    {
+      uint8_t* destination = atlas.data() + (i % glyphsPerRow) * width;
+      uint32_t offset      = 0u;
+      for(uint32_t y = 0; y < height; ++y)
+      {
+        GlyphBufferData::DecompressScanline(data, outBuffer.data(), offset);
+        memcpy(destination + y * atlasWidth, outBuffer.data(), width);
+      }
+    }
+    const double scanlineTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Directly into the atlas.
+    start = std::chrono::steady_clock::now();
+    for(uint32_t i = 0; i < iterations; ++i)
+    {
+      GlyphBufferData::Decompress(data, atlas.data(), atlasWidth, (i % glyphsPerRow) * width, 0u);
+    }
+    const double directTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const double megaBytes = static_cast<double>(width) * height * iterations / (1024.0 * 1024.0);
+    tet_printf("%s : through glyph buffer %.0f MB/s, by scanline %.0f MB/s, into atlas %.0f MB/s\n", GetCompressionTypeName(compressionType), megaBytes / copyTime, megaBytes / scanlineTime, megaBytes / directTime);
+  }
+
+  // The last glyph written must be right.
+  std::vector<uint8_t> expected = GetExpectedPixels(pixels, CompressionType::RLE_4);
+  const uint32_t       lastX    = ((iterations - 1u) % glyphsPerRow) * width;
+  bool                 equal    = true;
+  for(uint32_t y = 0; y < height; ++y)
+  {
+    equal = equal && std::equal(expected.begin() + y * width, expected.begin() + (y + 1u) * width, atlas.begin() + y * atlasWidth + lastX);
+  }
+  DALI_TEST_CHECK(equal);
+
+  END_TEST;
+}
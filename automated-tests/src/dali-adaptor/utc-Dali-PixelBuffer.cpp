@@ -17,6 +17,10 @@
 #include <dali-test-suite-utils.h>
 #include <dali/dali.h>
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
 #include "mesh-builder.h"
 using namespace Dali;
 
@@ -833,3 +837,88 @@ int UtcDaliPixelBufferGaussianBlur(void)
 
   END_TEST;
 }
+
+namespace
+{
+/**
+ * The float implementation of one Gaussian blur pass, used as reference.
+ */
+void ReferenceConvoluteAndTranspose(const unsigned char* inBuffer, unsigned char* outBuffer, int width, int height, float blurRadius)
+{
+  int   radius          = static_cast<int>(std::ceil(blurRadius));
+  float sigma           = blurRadius * 0.4f + 0.6f;
+  float sigma22         = 2.0f * sigma * sigma;
+  float normalizeFactor = 0.0f;
+
+  std::vector<float> weights;
+  for(int i = -radius; i <= radius; ++i)
+  {
+    weights.push_back(std::exp(-static_cast<float>(i * i) / sigma22));
+    normalizeFactor += weights.back();
+  }
+
+  for(int y = 0; y < height; ++y)
+  {
+    for(int x = 0; x < width; ++x)
+    {
+      for(int channel = 0; channel < 4; ++channel)
+      {
+        float value = 0.0f;
+        for(int i = -radius; i <= radius; ++i)
+        {
+          int ix = std::max(0, std::min(x + i, width - 1));
+          value += weights[i + radius] / normalizeFactor * inBuffer[(y * width + ix) * 4 + channel];
+        }
+        outBuffer[(x * height + y) * 4 + channel] = static_cast<unsigned char>(std::max(0, std::min(static_cast<int>(value + 0.5f), 255)));
+      }
+    }
+  }
+}
+} // namespace
+
+int UtcDaliPixelBufferGaussianBlurMatchesReference(void)
+{
+  TestApplication application;
+
+  const int width  = 320;
+  const int height = 300;
+
+  for(float blurRadius : {1.0f, 4.5f, 16.0f})
+  {
+    Devel::PixelBuffer imageData = Devel::PixelBuffer::New(width, height, Pixel::RGBA8888);
+    unsigned char*     buffer    = imageData.GetBuffer();
+
+    srand(1);
+    for(int i = 0; i < width * height * 4; ++i)
+    {
+      buffer[i] = static_cast<unsigned char>(rand() & 0xff);
+    }
+
+    std::vector<unsigned char> expected(buffer, buffer + width * height * 4);
+    std::vector<unsigned char> transposed(width * height * 4);
+
+    auto referenceStart = std::chrono::steady_clock::now();
+    ReferenceConvoluteAndTranspose(expected.data(), transposed.data(), width, height, blurRadius);
+    ReferenceConvoluteAndTranspose(transposed.data(), expected.data(), height, width, blurRadius);
+    auto referenceEnd = std::chrono::steady_clock::now();
+
+    imageData.ApplyGaussianBlur(blurRadius);
+    auto blurEnd = std::chrono::steady_clock::now();
+
+    int maxDifference = 0;
+    for(int i = 0; i < width * height * 4; ++i)
+    {
+      maxDifference = std::max(maxDifference, std::abs(static_cast<int>(buffer[i]) - static_cast<int>(expected[i])));
+    }
+
+    tet_printf("Gaussian blur radius %.1f : reference %lld us, ApplyGaussianBlur %lld us, max difference %d\n",
+               blurRadius,
+               static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(referenceEnd - referenceStart).count()),
+               static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(blurEnd - referenceEnd).count()),
+               maxDifference);
+
+    DALI_TEST_CHECK(maxDifference <= 1);
+  }
+
+  END_TEST;
+}
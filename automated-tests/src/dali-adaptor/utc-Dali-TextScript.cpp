@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,8 @@
 #include <dali-test-suite-utils.h>
 #include <dali/dali.h>
 #include <dali/devel-api/text-abstraction/script.h>
+#include <chrono>
+#include <vector>
 
 using namespace Dali;
 using namespace Dali::TextAbstraction;
@@ -230,3 +232,82 @@ int UtcDaliGetCharacterScript(void)
 
   END_TEST;
 }
+
+int UtcDaliGetCharacterScripts(void)
+{
+  tet_infoline("The scripts of a batch of characters are the ones of each character, in every plane.");
+
+  std::vector<Character> characters;
+  for(Character character = 0u; character < 0x110000; ++character)
+  {
+    characters.push_back(character);
+  }
+  std::vector<Script> scripts(characters.size());
+  GetCharacterScripts(characters.data(), characters.size(), scripts.data());
+
+  uint32_t numberOfDifferences = 0u;
+  for(Character character = 0u; character < 0x110000; ++character)
+  {
+    const Script script = GetCharacterScript(character);
+    if(scripts[character] != script || (script == COMMON) != IsCommonScript(character))
+    {
+      ++numberOfDifferences;
+    }
+  }
+  DALI_TEST_EQUALS(numberOfDifferences, 0u, TEST_LOCATION);
+
+  DALI_TEST_EQUALS(GetCharacterScript(0xFE0E), EMOJI_TEXT, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetCharacterScript(0xFE0F), EMOJI_COLOR, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetCharacterScript(0x1F3FB), EMOJI, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetCharacterScript(0xE0020), EMOJI, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetCharacterScript(0xE007F), EMOJI, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetCharacterScript(0xE0080), UNKNOWN, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetCharacterScript(0x2B820), UNKNOWN, TEST_LOCATION);
+  DALI_TEST_EQUALS(GetCharacterScript(0x10FFFF), UNKNOWN, TEST_LOCATION);
+
+  END_TEST;
+}
+
+int UtcDaliGetCharacterScriptsBenchmark(void)
+{
+  tet_infoline("Measure the scripts of mixed-script texts, a character at a time and in a batch.");
+
+  const std::vector<Character> corpora[] =
+    {
+      {'H', 'e', 'l', 'l', 'o', ' ', 'w', 'o', 'r', 'l', 'd', '!', ' ', 0x00E9, 't', 0x00E9, ' ', '2', '0', '2', '4'},
+      {'H', 'i', ' ', 0x4F60, 0x597D, 0x3001, 0x4E16, 0x754C, ' ', 0x3053, 0x3093, 0x306B, 0x3061, 0x306F, ' ', 0xC548, 0xB155},
+      {0x0645, 0x0631, 0x062D, 0x0628, 0x0627, ' ', 0x05E9, 0x05DC, 0x05D5, 0x05DD, ' ', 0x041F, 0x0440, 0x0438, 0x0432, 0x0435, 0x0442},
+      {0x0928, 0x092E, 0x0938, 0x094D, 0x0924, 0x0947, ' ', 0x0E2A, 0x0E27, 0x0E31, 0x0E2A, ' ', 0x1F600, 0x1F44D, 0x1F3FD, 0x200D, 0x2764, 0xFE0F},
+    };
+  const uint32_t numberOfRepetitions = 20000u;
+
+  for(const auto& corpus : corpora)
+  {
+    std::vector<Character> text;
+    for(uint32_t i = 0u; i < numberOfRepetitions; ++i)
+    {
+      text.insert(text.end(), corpus.begin(), corpus.end());
+    }
+
+    std::vector<Script> expectedScripts(text.size());
+    auto                start = std::chrono::steady_clock::now();
+    for(std::size_t index = 0u; index < text.size(); ++index)
+    {
+      expectedScripts[index] = GetCharacterScript(text[index]);
+    }
+    const double characterSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<Script> scripts(text.size());
+    start = std::chrono::steady_clock::now();
+    GetCharacterScripts(text.data(), text.size(), scripts.data());
+    const double batchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    DALI_TEST_CHECK(scripts == expectedScripts);
+    tet_printf("Character scripts : %u characters, %f ns per character (%f ns a character at a time)\n",
+               static_cast<uint32_t>(text.size()),
+               batchSeconds * 1e9 / text.size(),
+               characterSeconds * 1e9 / text.size());
+  }
+
+  END_TEST;
+}
@@ -22,6 +22,8 @@
 #include <test-graphics-application.h>
 #include <test-graphics-sampler.h>
 
+#include <chrono>
+
 using namespace Dali;
 
 void utc_dali_program_startup(void)
@@ -287,3 +289,154 @@ int UtcDaliGraphicsShaderFlush(void)
 #endif
   END_TEST;
 }
+
+int UtcDaliGraphicsPipelineCacheLookup(void)
+{
+  tet_infoline("UtcDaliProgram - check that cached pipelines are found with many pipelines in the cache");
+
+  for(uint32_t pipelineCount : {10u, 100u, 1000u})
+  {
+    TestGraphicsApplication app;
+
+    Texture diffuse = CreateTexture(TextureType::TEXTURE_2D, Pixel::RGBA8888, 16u, 16u);
+
+    // Each actor has an unique program, so each one needs a different pipeline
+    std::vector<Actor> actors;
+    actors.reserve(pipelineCount);
+    for(uint32_t i = 0u; i < pipelineCount; ++i)
+    {
+      Actor actor = CreateRenderableActor(diffuse, VERT_SHADER_SOURCE + std::to_string(i), FRAG_SHADER_SOURCE);
+      app.GetScene().Add(actor);
+      actors.push_back(actor);
+    }
+
+    auto& gl            = app.GetGlAbstraction();
+    auto& glShaderTrace = gl.GetShaderTrace();
+    glShaderTrace.Enable(true);
+
+    app.SendNotification();
+    app.Render(16);
+
+    DALI_TEST_EQUALS(glShaderTrace.CountMethod("CreateProgram"), int(pipelineCount), TEST_LOCATION);
+    glShaderTrace.Reset();
+
+    // Force the renderers to query the pipeline cache again
+    for(auto& actor : actors)
+    {
+      actor.GetRendererAt(0).SetProperty(Renderer::Property::BLEND_MODE, BlendMode::ON);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    app.SendNotification();
+    app.Render(16);
+    auto end = std::chrono::steady_clock::now();
+
+    // No new program should be created
+    DALI_TEST_EQUALS(glShaderTrace.CountMethod("CreateProgram"), 0, TEST_LOCATION);
+
+    tet_printf("%u pipelines : frame time %lld us\n", pipelineCount, static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()));
+  }
+
+  END_TEST;
+}
+
+int UtcDaliGraphicsProgramBinaryCache(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("UtcDaliProgram - check that the program binary cache doesn't break program creation");
+
+  auto& gl            = app.GetGlAbstraction();
+  auto& glShaderTrace = gl.GetShaderTrace();
+  glShaderTrace.Enable(true);
+
+  Texture diffuse = CreateTexture(TextureType::TEXTURE_2D, Pixel::RGBA8888, 16u, 16u);
+
+  // No binary formats supported, so the cache must not touch the program
+  Actor actor1 = CreateRenderableActor(diffuse, VERT_SHADER_SOURCE, FRAG_SHADER_SOURCE);
+  app.GetScene().Add(actor1);
+
+  app.SendNotification();
+  app.Render(16);
+
+  DALI_TEST_EQUALS(glShaderTrace.CountMethod("CreateProgram"), 1, TEST_LOCATION);
+  DALI_TEST_EQUALS(glShaderTrace.CountMethod("LinkProgram"), 1, TEST_LOCATION);
+  DALI_TEST_CHECK(!gl.GetProgramBinaryCalled());
+
+  END_TEST;
+}
+
+int UtcDaliGraphicsProgramStandaloneUniformBenchmark(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("UtcDaliProgram - check that unchanged standalone uniform arrays are skipped, and measure 1000 draws per frame");
+
+  const uint32_t drawCount  = 1000u;
+  const uint32_t frameCount = 10u;
+  const uint32_t arraySize  = 64u;
+
+  auto& gl             = app.GetGlAbstraction();
+  auto& glUniformTrace = gl.GetSetUniformTrace();
+  glUniformTrace.Enable(true);
+
+  // A large array shared by all the draws, and a matrix changing from one draw to the next
+  std::vector<ActiveUniform> activeUniforms{
+    {"uArray[0]", GL_FLOAT_VEC4, int(arraySize)},
+    {"uModelMatrix", GL_FLOAT_MAT4, 1}};
+  gl.SetActiveUniforms(activeUniforms);
+
+  Texture  diffuse  = CreateTexture(TextureType::TEXTURE_2D, Pixel::RGBA8888, 16u, 16u);
+  Actor    first    = CreateRenderableActor(diffuse, VERT_SHADER_SOURCE, FRAG_SHADER_SOURCE);
+  Renderer renderer = first.GetRendererAt(0);
+  Shader   shader   = renderer.GetShader();
+  for(uint32_t i = 0u; i < arraySize; ++i)
+  {
+    shader.RegisterProperty("uArray[" + std::to_string(i) + "]", Vector4(float(i), 0.0f, 0.0f, 1.0f));
+  }
+
+  std::vector<Actor> actors{first};
+  actors.reserve(drawCount);
+  for(uint32_t i = 1u; i < drawCount; ++i)
+  {
+    Actor actor = Actor::New();
+    actor.AddRenderer(renderer);
+    actors.push_back(actor);
+  }
+  for(uint32_t i = 0u; i < drawCount; ++i)
+  {
+    actors[i][Actor::Property::SIZE]     = Vector2(10.0f, 10.0f);
+    actors[i][Actor::Property::POSITION] = Vector2(float(12u * (i % 40u)), float(30u * (i / 40u)));
+    app.GetScene().Add(actors[i]);
+  }
+
+  app.SendNotification();
+  app.Render(16);
+  DALI_TEST_CHECK(glUniformTrace.CountMethod("uArray[0]") >= 1);
+
+  glUniformTrace.Reset();
+  auto start = std::chrono::steady_clock::now();
+  for(uint32_t frame = 0u; frame < frameCount; ++frame)
+  {
+    app.SendNotification();
+    app.Render(16);
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  // The array never changed, it's not set again
+  DALI_TEST_EQUALS(glUniformTrace.CountMethod("uArray[0]"), 0, TEST_LOCATION);
+
+  tet_printf("%u draws per frame, %u uniform vectors : frame time %lld us\n", drawCount, arraySize, static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() / frameCount));
+
+  // A change of one element sets the array once, for the first draw
+  glUniformTrace.Reset();
+  shader.SetProperty(shader.GetPropertyIndex("uArray[5]"), Vector4(1.0f, 2.0f, 3.0f, 4.0f));
+  app.SendNotification();
+  app.Render(16);
+  DALI_TEST_EQUALS(glUniformTrace.CountMethod("uArray[0]"), 1, TEST_LOCATION);
+
+  glUniformTrace.Reset();
+  app.SendNotification();
+  app.Render(16);
+  DALI_TEST_EQUALS(glUniformTrace.CountMethod("uArray[0]"), 0, TEST_LOCATION);
+
+  END_TEST;
+}
@@ -83,3 +83,71 @@ int UtcDaliTextureConvertUpload(void)
   DALI_TEST_EQUALS(namedParams["format"].str(), s.str(), TEST_LOCATION);
   END_TEST;
 }
+
+int UtcDaliTextureUploadPixelUnpackBuffer(void)
+{
+  TestGraphicsApplication app;
+  tet_infoline("UtcDaliTextureUploadPixelUnpackBuffer - Test that the uploads are staged in a pixel unpack buffer on GLES3");
+
+  auto& controller = static_cast<Graphics::EglGraphicsController&>(app.GetGraphicsController());
+  controller.SetGLESVersion(Graphics::GLES::GLESVersion::GLES_30);
+
+  auto& gl = app.GetGlAbstraction();
+  gl.EnableTextureCallTrace(true);
+  gl.GetBufferTrace().Enable(true);
+
+  int size = 200;
+
+  // An RGB image converted to RGBA in the buffer, and a part of an RGBA image.
+  Texture   rgbTexture   = Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, size, size);
+  int       rgbSize      = size * size * 3;
+  uint8_t*  rgbBuffer    = reinterpret_cast<uint8_t*>(malloc(rgbSize));
+  PixelData rgbPixelData = PixelData::New(rgbBuffer, rgbSize, size, size, Pixel::RGB888, PixelData::FREE);
+  rgbTexture.Upload(rgbPixelData, 0u, 0u, 0u, 0u, size, size);
+
+  Texture   rgbaTexture   = Texture::New(TextureType::TEXTURE_2D, Pixel::RGBA8888, size, size);
+  int       rgbaSize      = (size / 2) * (size / 2) * 4;
+  uint8_t*  rgbaBuffer    = reinterpret_cast<uint8_t*>(malloc(rgbaSize));
+  PixelData rgbaPixelData = PixelData::New(rgbaBuffer, rgbaSize, size / 2, size / 2, Pixel::RGBA8888, PixelData::FREE);
+  rgbaTexture.Upload(rgbaPixelData, 0u, 0u, size / 4, size / 4, size / 2, size / 2);
+
+  TextureSet textureSet = TextureSet::New();
+  textureSet.SetTexture(0u, rgbTexture);
+  textureSet.SetTexture(1u, rgbaTexture);
+
+  Actor dummyActor = CreateRenderableActor2(textureSet, "", "");
+  app.GetScene().Add(dummyActor);
+
+  app.SendNotification();
+  app.Render(16);
+
+  const auto& statistics = controller.GetPixelUnpackBufferRing().GetStatistics();
+  DALI_TEST_EQUALS(statistics.stagedUploads, static_cast<uint64_t>(2u), TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.stagedBytes, static_cast<uint64_t>(size * size * 4 + rgbaSize), TEST_LOCATION);
+  DALI_TEST_EQUALS(statistics.fallbackUploads, static_cast<uint64_t>(0u), TEST_LOCATION);
+  tet_printf("Staged %llu uploads, %llu bytes in %llu batches\n",
+             static_cast<unsigned long long>(statistics.stagedUploads),
+             static_cast<unsigned long long>(statistics.stagedBytes),
+             static_cast<unsigned long long>(statistics.batches));
+
+  // The buffer is allocated, and unbound after the uploads.
+  TraceCallStack::NamedParams namedParams;
+  DALI_TEST_CHECK(gl.GetBufferTrace().FindMethodAndGetParameters("BufferData", namedParams));
+  std::stringstream target;
+  target << std::hex << GL_PIXEL_UNPACK_BUFFER;
+  DALI_TEST_EQUALS(namedParams["target"].str(), target.str(), TEST_LOCATION);
+
+  std::stringstream unbind;
+  unbind << std::hex << GL_PIXEL_UNPACK_BUFFER << ", " << 0;
+  DALI_TEST_CHECK(gl.GetBufferTrace().FindMethodAndParams("BindBuffer", unbind.str()));
+
+  // The converted image is uploaded as RGBA.
+  auto& textureTrace = gl.GetTextureTrace();
+  DALI_TEST_CHECK(textureTrace.FindMethodAndGetParameters("TexImage2D", namedParams));
+  std::stringstream format;
+  format << std::hex << GL_RGBA;
+  DALI_TEST_EQUALS(namedParams["format"].str(), format.str(), TEST_LOCATION);
+  DALI_TEST_CHECK(textureTrace.FindMethod("TexSubImage2D"));
+
+  END_TEST;
+}
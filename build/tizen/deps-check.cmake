@@ -127,6 +127,7 @@ CHECK_MODULE_AND_SET( XDAMAGE xdamage [] )
 CHECK_MODULE_AND_SET( XFIXES xfixes [] )
 CHECK_MODULE_AND_SET( XINPUT xi [] )
 CHECK_MODULE_AND_SET( XRENDER xrender [] )
+CHECK_MODULE_AND_SET( XEXT xext [] )
 
 CHECK_MODULE_AND_SET( CAPI_SYSTEM_INFO capi-system-info [] )
 CHECK_MODULE_AND_SET( CAPI_SYSTEM_SENSOR capi-system-sensor capi_system_sensor_support )
@@ -399,6 +400,7 @@ IF(X11_REQUIRED)
     ${XFIXES_CFLAGS}
     ${XINPUT_CFLAGS}
     ${XRENDER_CFLAGS}
+    ${XEXT_CFLAGS}
     )
 
   SET( DALI_LDFLAGS ${DALI_LDFLAGS}
@@ -407,6 +409,7 @@ IF(X11_REQUIRED)
     ${XFIXES_LDFLAGS}
     ${XINPUT_LDFLAGS}
     ${XRENDER_LDFLAGS}
+    ${XEXT_LDFLAGS}
     )
 
 ELSE()
@@ -125,6 +125,7 @@ SET( PROFILE_INCLUDE_DIRECTORIES
         ${ELEMENTARY_INCLUDE_DIRS}
         ${ECORE_X_INCLUDE_DIRS}
         ${X11_INCLUDE_DIRS}
+        ${XEXT_INCLUDE_DIRS}
         ${DALICORE_INCLUDE_DIRS}
         )
 
@@ -172,6 +173,7 @@ SET(REQUIRED_LIBS ${ECORE_LDFLAGS}
   ${ELEMENTARY_LDFLAGS}
   ${ECORE_X_LDFLAGS}
   ${X11_LDFLAGS}
+  ${XEXT_LDFLAGS}
   ${DALICORE_LDFLAGS}
   ${OPENGLES20_LDFLAGS}
   ${EGL_LDFLAGS}
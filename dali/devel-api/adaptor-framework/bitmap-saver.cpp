@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,12 +19,11 @@
 
 // EXTERNAL INCLUDES
 #include <dali/integration-api/debug.h>
-#include <dali/public-api/common/dali-vector.h>
+#include <cstdio>
 
 // INTERNAL INCLUDES
 #include <dali/internal/imaging/common/loader-jpeg.h>
 #include <dali/internal/imaging/common/loader-png.h>
-#include <dali/internal/legacy/common/tizen-platform-abstraction.h>
 #include <dali/internal/legacy/tizen/image-encoder.h>
 
 namespace Dali
@@ -79,34 +78,6 @@ FileFormat GetFormatFromFileName(const std::string& filename)
   return format;
 }
 
-bool EncodeToFormat(const unsigned char*   pixelBuffer,
-                    Vector<unsigned char>& encodedPixels,
-                    FileFormat             formatEncoding,
-                    std::size_t            width,
-                    std::size_t            height,
-                    Pixel::Format          pixelFormat,
-                    const uint32_t         quality)
-{
-  switch(formatEncoding)
-  {
-    case JPG_FORMAT:
-    {
-      return TizenPlatform::EncodeToJpeg(pixelBuffer, encodedPixels, width, height, pixelFormat, quality);
-      break;
-    }
-    case PNG_FORMAT:
-    {
-      return TizenPlatform::EncodeToPng(pixelBuffer, encodedPixels, width, height, pixelFormat);
-      break;
-    }
-    default:
-    {
-      DALI_LOG_ERROR("Format not supported for image encoding (supported formats are PNG and JPEG)\n");
-      break;
-    }
-  }
-  return false;
-}
 } // anonymous namespace
 
 bool EncodeToFile(const unsigned char* const pixelBuffer,
@@ -126,15 +97,47 @@ bool EncodeToFile(const unsigned char* const pixelBuffer,
                   const uint32_t             quality)
 {
   DALI_ASSERT_DEBUG(pixelBuffer != 0 && filename.size() > 4 && width > 0 && height > 0);
-  Vector<unsigned char> pixbufEncoded;
-  const FileFormat      format       = GetFormatFromFileName(filename);
-  const bool            encodeResult = EncodeToFormat(pixelBuffer, pixbufEncoded, format, width, height, pixelFormat, quality);
+  const std::size_t rowStride = width * Pixel::GetBytesPerPixel(pixelFormat);
+  return EncodeRowsToFile([pixelBuffer, rowStride](uint32_t row) { return pixelBuffer + row * rowStride; }, filename, pixelFormat, width, height, quality);
+}
+
+bool EncodeRowsToFile(const std::function<const uint8_t*(uint32_t row)>& getRow,
+                      const std::string&                                 filename,
+                      const Pixel::Format                                pixelFormat,
+                      const std::size_t                                  width,
+                      const std::size_t                                  height,
+                      const uint32_t                                     quality)
+{
+  DALI_ASSERT_DEBUG(getRow && filename.size() > 4 && width > 0 && height > 0);
+  const FileFormat format = GetFormatFromFileName(filename);
+  if(format != JPG_FORMAT && format != PNG_FORMAT)
+  {
+    DALI_LOG_ERROR("Format not supported for image encoding (supported formats are PNG and JPEG)\n");
+    return false;
+  }
+
+  FILE* file = fopen(filename.c_str(), "wb");
+  if(DALI_UNLIKELY(!file))
+  {
+    DALI_LOG_ERROR("Fail to open file to save [%s]\n", filename.c_str());
+    return false;
+  }
+
+  // The pixels are encoded straight into the file.
+  bool encodeResult = (format == JPG_FORMAT) ? TizenPlatform::EncodeToJpeg(getRow, file, width, height, pixelFormat, quality)
+                                             : TizenPlatform::EncodeToPng(getRow, file, width, height, pixelFormat);
+  if(fclose(file) != 0)
+  {
+    encodeResult = false;
+  }
+
   if(!encodeResult)
   {
     DALI_LOG_ERROR("Encoding pixels failed\n");
-    return false;
+    // Don't leave a partial file.
+    std::remove(filename.c_str());
   }
-  return TizenPlatform::SaveFile(filename, pixbufEncoded.Begin(), pixbufEncoded.Count());
+  return encodeResult;
 }
 
 } // namespace Dali
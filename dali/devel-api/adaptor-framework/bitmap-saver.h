@@ -2,7 +2,7 @@
 #define DALI_ADAPTOR_BITMAP_SAVER_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,8 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/images/pixel.h>
+#include <cstdint>
+#include <functional>
 #include <string>
 
 // INTERNAL INCLUDES
@@ -68,6 +70,31 @@ DALI_ADAPTOR_API bool EncodeToFile(const unsigned char* const pixelBuffer,
                                    const std::size_t          height,
                                    const uint32_t             quality);
 
+/**
+ * Store the given pixel rows to a file.
+ * The suffix of the filename determines what type of file will be stored,
+ * currently only jpeg and png formats are supported.
+ *
+ * The rows are read one by one and encoded straight into the file, so the image
+ * doesn't need to be in a single buffer, and is not encoded in memory.
+ *
+ * @param[in] getRow      Gives the pixels of each row, from the top. The pixels must stay valid until the next call.
+ *                        It returns nullptr if the row cannot be read, and the encoding fails.
+ * @param[in] filename    Filename to save
+ * @param[in] pixelFormat The format of the rows' pixels
+ * @param[in] width       The width of the image in pixels
+ * @param[in] height      The height of the image in pixels
+ * @param[in] quality     The value to control image quality for jpeg file format in the range [1, 100]
+ *
+ * @return true if the file was saved. No file is left if it fails.
+ */
+DALI_ADAPTOR_API bool EncodeRowsToFile(const std::function<const uint8_t*(uint32_t row)>& getRow,
+                                       const std::string&                                 filename,
+                                       const Pixel::Format                                pixelFormat,
+                                       const std::size_t                                  width,
+                                       const std::size_t                                  height,
+                                       const uint32_t                                     quality);
+
 } // namespace Dali
 
 #endif // DALI_ADAPTOR_BITMAP_SAVER_H
@@ -2,7 +2,7 @@
 #define DALI_TIZEN_PLATFORM_IMAGE_LOADER_INPUT_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,8 @@
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/integration-api/bitmap.h>
 #include <dali/public-api/images/image-operations.h>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 
 // INTERNAL INCLUDES
@@ -51,15 +53,19 @@ public:
    */
 struct Input
 {
-  Input(FILE* file, ScalingParameters scalingParameters = ScalingParameters(), bool reorientationRequested = true)
+  Input(FILE* file, ScalingParameters scalingParameters = ScalingParameters(), bool reorientationRequested = true, const uint8_t* encodedData = nullptr, size_t encodedDataSize = 0u)
   : file(file),
     scalingParameters(scalingParameters),
-    reorientationRequested(reorientationRequested)
+    reorientationRequested(reorientationRequested),
+    encodedData(encodedData),
+    encodedDataSize(encodedDataSize)
   {
   }
   FILE*             file;
   ScalingParameters scalingParameters;
   bool              reorientationRequested;
+  const uint8_t*    encodedData;     ///< The whole file mapped in memory, or nullptr. Loaders may decode it instead of reading the file.
+  size_t            encodedDataSize; ///< The size of encodedData in bytes
 };
 
 using LoadBitmapFunction       = bool (*)(const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& pixelData);
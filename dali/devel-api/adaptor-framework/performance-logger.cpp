@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -72,6 +72,11 @@ void PerformanceLogger::EnableLogging(bool enable)
   Internal::Adaptor::GetImplementation(*this).EnableLogging(enable);
 }
 
+float PerformanceLogger::GetPercentile(float percentile) const
+{
+  return Internal::Adaptor::GetImplementation(*this).GetPercentile(percentile);
+}
+
 PerformanceLogger::PerformanceLogger(Internal::Adaptor::PerformanceLogger* PerformanceLogger)
 : BaseHandle(PerformanceLogger)
 {
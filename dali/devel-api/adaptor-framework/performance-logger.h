@@ -2,7 +2,7 @@
 #define DALI_PERFORMANCE_LOGGER_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -119,6 +119,17 @@ public:
    */
   void EnableLogging(bool enable);
 
+  /**
+   * @brief Get a percentile of all the times measured by this logger, since it has been created.
+   *
+   * The times are kept in a fixed size histogram, so the percentiles are accurate to about 3%,
+   * and the memory used doesn't grow with the run time.
+   *
+   * @param[in] percentile The percentage of the times, e.g. 50, 90, 99 or 99.9
+   * @return The time in seconds, below which the percentage of the times fall. Zero if performance logging is disabled
+   */
+  float GetPercentile(float percentile) const;
+
   // Not intended for application developers
 
   /**
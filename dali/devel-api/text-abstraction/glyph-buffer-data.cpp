@@ -18,6 +18,18 @@
 // CLASS HEADER
 #include <dali/devel-api/text-abstraction/glyph-buffer-data.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#define DALI_GLYPH_BUFFER_DATA_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DALI_GLYPH_BUFFER_DATA_NEON
+#include <arm_neon.h>
+#endif
+
 // INTERNAL INCLUDES
 #include <dali/internal/imaging/common/image-operations.h>
 
@@ -25,6 +37,199 @@ namespace Dali
 {
 namespace TextAbstraction
 {
+namespace
+{
+constexpr uint32_t MAXIMUM_STACK_SCANLINE_SIZE = 1024u; ///< Wider RLE4 scanlines decoded by DecompressScanline() use the heap.
+
+/**
+ * @brief Expand a scanline of 4 bit values to 8 bit values. Each value becomes value * 17.
+ *
+ * Each input byte holds two values, the high nibble first. If widthByte is odd, the low nibble of the last byte holds the last value.
+ * SSE2 and NEON expand 32 values at once, then 16.
+ *
+ * @param[in] inBuffer The BPP4 compressed scanline.
+ * @param[out] outBuffer The decompressed scanline.
+ * @param[in] widthByte The number of values.
+ */
+inline void ExpandBitPerPixel4Scanline(const uint8_t* __restrict__ inBuffer, uint8_t* __restrict__ outBuffer, uint32_t widthByte)
+{
+  const uint32_t componentCount = (widthByte >> 1);
+
+  uint32_t x = 0u;
+#if defined(DALI_GLYPH_BUFFER_DATA_SSE2)
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  for(; x + 16u <= componentCount; x += 16u)
+  {
+    const __m128i v    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(inBuffer + x));
+    const __m128i high = _mm_and_si128(_mm_srli_epi16(v, 4), mask);
+    const __m128i low  = _mm_and_si128(v, mask);
+
+    // Interleave the nibbles, then value | (value << 4). The values are less than 16, the shift stays in the byte.
+    const __m128i first  = _mm_unpacklo_epi8(high, low);
+    const __m128i second = _mm_unpackhi_epi8(high, low);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outBuffer + 2u * x), _mm_or_si128(first, _mm_slli_epi16(first, 4)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outBuffer + 2u * x + 16u), _mm_or_si128(second, _mm_slli_epi16(second, 4)));
+  }
+  if(x + 8u <= componentCount)
+  {
+    const __m128i v     = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(inBuffer + x));
+    const __m128i first = _mm_unpacklo_epi8(_mm_and_si128(_mm_srli_epi16(v, 4), mask), _mm_and_si128(v, mask));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outBuffer + 2u * x), _mm_or_si128(first, _mm_slli_epi16(first, 4)));
+    x += 8u;
+  }
+#elif defined(DALI_GLYPH_BUFFER_DATA_NEON)
+  const uint8x16_t mask = vdupq_n_u8(0x0f);
+  for(; x + 16u <= componentCount; x += 16u)
+  {
+    const uint8x16_t v    = vld1q_u8(inBuffer + x);
+    const uint8x16_t high = vshrq_n_u8(v, 4);
+    const uint8x16_t low  = vandq_u8(v, mask);
+
+    // vst2 interleaves the nibbles.
+    uint8x16x2_t expanded;
+    expanded.val[0] = vorrq_u8(high, vshlq_n_u8(high, 4));
+    expanded.val[1] = vorrq_u8(low, vshlq_n_u8(low, 4));
+    vst2q_u8(outBuffer + 2u * x, expanded);
+  }
+  if(x + 8u <= componentCount)
+  {
+    const uint8x8_t v    = vld1_u8(inBuffer + x);
+    const uint8x8_t high = vshr_n_u8(v, 4);
+    const uint8x8_t low  = vand_u8(v, vdup_n_u8(0x0f));
+
+    uint8x8x2_t expanded;
+    expanded.val[0] = vorr_u8(high, vshl_n_u8(high, 4));
+    expanded.val[1] = vorr_u8(low, vshl_n_u8(low, 4));
+    vst2_u8(outBuffer + 2u * x, expanded);
+    x += 8u;
+  }
+#endif
+
+  for(; x < componentCount; ++x)
+  {
+    const uint8_t v  = inBuffer[x];
+    const uint8_t v0 = (v >> 4) & 0x0f;
+    const uint8_t v1 = v & 0x0f;
+
+    outBuffer[2u * x]      = (v0 << 4) | v0;
+    outBuffer[2u * x + 1u] = (v1 << 4) | v1;
+  }
+  if(widthByte & 1)
+  {
+    const uint8_t v   = inBuffer[componentCount];
+    outBuffer[2u * x] = (v << 4) | v;
+  }
+}
+
+/**
+ * @brief Decode the runs of a RLE4 compressed scanline into 4 bit differences with the previous scanline, one per byte.
+ *
+ * See GlyphBufferData::Compress() for the rules of the runs.
+ *
+ * @param[in] inBuffer The RLE4 compressed scanline.
+ * @param[out] differences The differences, widthByte bytes.
+ * @param[in] widthByte The number of values.
+ * @return The next compressed scanline.
+ */
+inline const uint8_t* DecodeRunLength4Scanline(const uint8_t* __restrict__ inBuffer, uint8_t* __restrict__ differences, uint32_t widthByte)
+{
+  uint32_t decodedByte = 0;
+  while(decodedByte < widthByte)
+  {
+    const uint8_t v = *(inBuffer++);
+    // Compress by RLE
+    if(v & 0x80)
+    {
+      const uint32_t runLength   = std::min<uint32_t>(((v >> 4) & 0x07) + 2u, widthByte - decodedByte);
+      const uint8_t  repeatValue = v & 0x0f;
+      if(DALI_LIKELY(decodedByte + 16u <= widthByte))
+      {
+        // Runs are at most 9 values. Fill 16 bytes, the next runs overwrite the rest.
+        const uint64_t pattern = repeatValue * 0x0101010101010101ull;
+        memcpy(differences + decodedByte, &pattern, sizeof(pattern));
+        memcpy(differences + decodedByte + 8u, &pattern, sizeof(pattern));
+      }
+      else
+      {
+        memset(differences + decodedByte, repeatValue, runLength);
+      }
+      decodedByte += runLength;
+    }
+    // Not compress by RLE
+    else
+    {
+      // First value is in the header, the next ones are packed two per byte.
+      // If the scanline ends, the low nibble of the last byte is ignored.
+      const uint32_t nonRunLength = (((v >> 4) & 0x07) << 1u) + 1u;
+      const uint32_t valueCount   = std::min(nonRunLength - 1u, widthByte - decodedByte - 1u);
+
+      differences[decodedByte++] = v & 0x0f;
+      for(uint32_t iter = 0; iter + 1u < valueCount; iter += 2u)
+      {
+        const uint8_t w                      = inBuffer[iter >> 1u];
+        differences[decodedByte + iter]      = (w >> 4) & 0x0f;
+        differences[decodedByte + iter + 1u] = w & 0x0f;
+      }
+      if(valueCount & 1u)
+      {
+        differences[decodedByte + valueCount - 1u] = (inBuffer[valueCount >> 1u] >> 4) & 0x0f;
+      }
+
+      inBuffer += (nonRunLength - 1u) >> 1u;
+      decodedByte += valueCount;
+    }
+  }
+  return inBuffer;
+}
+
+/**
+ * @brief Add the 4 bit differences of a RLE4 scanline to the previous scanline, and expand the sums to 8 bit.
+ *
+ * The buffers may be the same. SSE2 and NEON add 16 values at once.
+ *
+ * @param[in] previous The previous decompressed scanline, or nullptr for the first scanline.
+ * @param[in] differences The differences, one per byte.
+ * @param[out] outBuffer The decompressed scanline.
+ * @param[in] widthByte The number of values.
+ */
+inline void AddRunLength4Differences(const uint8_t* previous, const uint8_t* differences, uint8_t* outBuffer, uint32_t widthByte)
+{
+  uint32_t x = 0u;
+#if defined(DALI_GLYPH_BUFFER_DATA_SSE2)
+  const __m128i mask = _mm_set1_epi8(0x0f);
+  for(; x + 16u <= widthByte; x += 16u)
+  {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(differences + x));
+    if(previous)
+    {
+      const __m128i p = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(previous + x)), mask);
+      v               = _mm_and_si128(_mm_add_epi8(p, v), mask);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(outBuffer + x), _mm_or_si128(v, _mm_slli_epi16(v, 4)));
+  }
+#elif defined(DALI_GLYPH_BUFFER_DATA_NEON)
+  const uint8x16_t mask = vdupq_n_u8(0x0f);
+  for(; x + 16u <= widthByte; x += 16u)
+  {
+    uint8x16_t v = vld1q_u8(differences + x);
+    if(previous)
+    {
+      v = vandq_u8(vaddq_u8(vandq_u8(vld1q_u8(previous + x), mask), v), mask);
+    }
+    vst1q_u8(outBuffer + x, vorrq_u8(v, vshlq_n_u8(v, 4)));
+  }
+#endif
+
+  for(; x < widthByte; ++x)
+  {
+    const uint8_t prev0 = previous ? previous[x] & 0x0f : 0;
+    const uint8_t v0    = (prev0 + differences[x]) & 0x0f;
+    outBuffer[x]        = (v0 << 4) | v0;
+  }
+}
+
+} // namespace
+
 GlyphBufferData::GlyphBufferData()
 : buffer{nullptr},
   width{0u},
@@ -318,132 +523,63 @@ size_t GlyphBufferData::Compress(const uint8_t* const __restrict__ inBuffer, Gly
 }
 
 void GlyphBufferData::Decompress(const GlyphBufferData& __restrict__ inBufferData, uint8_t* __restrict__ outBuffer)
+{
+  Decompress(inBufferData, outBuffer, inBufferData.width * Pixel::GetBytesPerPixel(inBufferData.format), 0u, 0u);
+}
+
+void GlyphBufferData::Decompress(const GlyphBufferData& __restrict__ inBufferData, uint8_t* __restrict__ outBuffer, uint32_t outStride, uint32_t xOffset, uint32_t yOffset)
 {
   if(DALI_UNLIKELY(outBuffer == nullptr))
   {
     return;
   }
 
+  const uint32_t bytesPerPixel = Pixel::GetBytesPerPixel(inBufferData.format);
+  const uint32_t widthByte     = inBufferData.width * bytesPerPixel;
+
+  uint8_t* __restrict__ outBufferPtr      = outBuffer + static_cast<size_t>(yOffset) * outStride + static_cast<size_t>(xOffset) * bytesPerPixel;
+  const uint8_t* __restrict__ inBufferPtr = inBufferData.buffer;
+
   switch(inBufferData.compressionType)
   {
     case TextAbstraction::GlyphBufferData::CompressionType::NO_COMPRESSION:
     {
-      const auto bufferSize = inBufferData.width * inBufferData.height * Pixel::GetBytesPerPixel(inBufferData.format);
+      if(outStride == widthByte)
+      {
+        // Copy buffer without compress
+        memcpy(outBufferPtr, inBufferPtr, static_cast<size_t>(widthByte) * inBufferData.height);
+        break;
+      }
 
-      // Copy buffer without compress
-      memcpy(outBuffer, inBufferData.buffer, bufferSize);
+      for(uint32_t y = 0; y < inBufferData.height; ++y)
+      {
+        memcpy(outBufferPtr, inBufferPtr, widthByte);
+        inBufferPtr += widthByte;
+        outBufferPtr += outStride;
+      }
       break;
     }
     case TextAbstraction::GlyphBufferData::CompressionType::BPP_4:
     {
-      const uint32_t widthByte       = inBufferData.width * Pixel::GetBytesPerPixel(inBufferData.format);
-      const uint32_t componentCount  = (widthByte >> 1);
-      const bool     considerPadding = (widthByte & 1) ? true : false;
-
-      uint8_t* __restrict__ outBufferPtr      = outBuffer;
-      const uint8_t* __restrict__ inBufferPtr = inBufferData.buffer;
-
-      // Compress for each line
+      // Decompress for each line
       for(uint32_t y = 0; y < inBufferData.height; ++y)
       {
-        for(uint32_t x = 0; x < componentCount; ++x)
-        {
-          const uint8_t v  = *(inBufferPtr++);
-          const uint8_t v0 = (v >> 4) & 0x0f;
-          const uint8_t v1 = v & 0x0f;
-
-          *(outBufferPtr++) = (v0 << 4) | v0;
-          *(outBufferPtr++) = (v1 << 4) | v1;
-        }
-        if(considerPadding)
-        {
-          const uint8_t v   = *(inBufferPtr++);
-          *(outBufferPtr++) = (v << 4) | v;
-        }
+        ExpandBitPerPixel4Scanline(inBufferPtr, outBufferPtr, widthByte);
+        inBufferPtr += (widthByte + 1u) >> 1u;
+        outBufferPtr += outStride;
       }
       break;
     }
     case TextAbstraction::GlyphBufferData::CompressionType::RLE_4:
     {
-      const uint32_t widthByte = inBufferData.width * Pixel::GetBytesPerPixel(inBufferData.format);
-
-      uint8_t* __restrict__ outBufferPtr      = outBuffer;
-      const uint8_t* __restrict__ inBufferPtr = inBufferData.buffer;
-      // Compress for each line
+      // Decompress for each line. The differences are decoded into the output line, then added to the previous line.
+      const uint8_t* previousPtr = nullptr;
       for(uint32_t y = 0; y < inBufferData.height; ++y)
       {
-        uint32_t x           = 0;
-        uint32_t decodedByte = 0;
-        while(decodedByte < widthByte)
-        {
-          const uint8_t v = *(inBufferPtr++);
-          ++x;
-          // Compress by RLE
-          if(v & 0x80)
-          {
-            const uint8_t runLength = ((v >> 4) & 0x07) + 2u;
-            decodedByte += runLength;
-            const uint8_t repeatValue = v & 0x0f;
-            for(uint8_t iter = 0; iter < runLength; ++iter)
-            {
-              const uint8_t prev0 = DALI_UNLIKELY(y == 0) ? 0 : (*(outBufferPtr - widthByte)) & 0x0f;
-              const uint8_t v0    = (prev0 + repeatValue) & 0x0f;
-              *(outBufferPtr++)   = (v0 << 4) | v0;
-            }
-          }
-          // Not compress by RLE
-          else
-          {
-            const uint8_t nonRunLength = (((v >> 4) & 0x07) << 1u) + 1u;
-            decodedByte += nonRunLength;
-            // First value.
-            const uint8_t prev0 = DALI_UNLIKELY(y == 0) ? 0 : (*(outBufferPtr - widthByte)) & 0x0f;
-            const uint8_t v0    = (prev0 + (v & 0x0f)) & 0x0f;
-            *(outBufferPtr++)   = (v0 << 4) | v0;
-
-            const bool ignoreLastValue = decodedByte > widthByte ? true : false;
-            if(DALI_UNLIKELY(ignoreLastValue))
-            {
-              --decodedByte;
-              for(uint8_t iter = 1; iter + 2 < nonRunLength; iter += 2)
-              {
-                const uint8_t w     = *(inBufferPtr++);
-                const uint8_t prew0 = DALI_UNLIKELY(y == 0) ? 0 : (*(outBufferPtr - widthByte)) & 0x0f;
-                const uint8_t w0    = (prew0 + ((w >> 4) & 0x0f)) & 0x0f;
-                const uint8_t prew1 = DALI_UNLIKELY(y == 0) ? 0 : (*(outBufferPtr - widthByte + 1)) & 0x0f;
-                const uint8_t w1    = (prew1 + (w & 0x0f)) & 0x0f;
-                ++x;
-
-                *(outBufferPtr++) = (w0 << 4) | w0;
-                *(outBufferPtr++) = (w1 << 4) | w1;
-              }
-              // Last value.
-              {
-                const uint8_t w     = ((*(inBufferPtr++)) >> 4) & 0x0f;
-                const uint8_t prew0 = DALI_UNLIKELY(y == 0) ? 0 : (*(outBufferPtr - widthByte)) & 0x0f;
-                const uint8_t w0    = (prew0 + w) & 0x0f;
-                ++x;
-
-                *(outBufferPtr++) = (w0 << 4) | w0;
-              }
-            }
-            else
-            {
-              for(uint8_t iter = 1; iter < nonRunLength; iter += 2)
-              {
-                const uint8_t w     = *(inBufferPtr++);
-                const uint8_t prew0 = DALI_UNLIKELY(y == 0) ? 0 : (*(outBufferPtr - widthByte)) & 0x0f;
-                const uint8_t w0    = (prew0 + ((w >> 4) & 0x0f)) & 0x0f;
-                const uint8_t prew1 = DALI_UNLIKELY(y == 0) ? 0 : (*(outBufferPtr - widthByte + 1)) & 0x0f;
-                const uint8_t w1    = (prew1 + (w & 0x0f)) & 0x0f;
-                ++x;
-
-                *(outBufferPtr++) = (w0 << 4) | w0;
-                *(outBufferPtr++) = (w1 << 4) | w1;
-              }
-            }
-          }
-        }
+        inBufferPtr = DecodeRunLength4Scanline(inBufferPtr, outBufferPtr, widthByte);
+        AddRunLength4Differences(previousPtr, outBufferPtr, outBufferPtr, widthByte);
+        previousPtr = outBufferPtr;
+        outBufferPtr += outStride;
       }
       break;
     }
@@ -471,28 +607,10 @@ void GlyphBufferData::DecompressScanline(const GlyphBufferData& __restrict__ inB
     }
     case TextAbstraction::GlyphBufferData::CompressionType::BPP_4:
     {
-      const uint32_t widthByte       = inBufferData.width * Pixel::GetBytesPerPixel(inBufferData.format);
-      const uint32_t componentCount  = (widthByte >> 1);
-      const bool     considerPadding = (widthByte & 1) ? true : false;
-
-      uint8_t* __restrict__ outBufferPtr      = outBuffer;
-      const uint8_t* __restrict__ inBufferPtr = inBufferData.buffer + offset;
+      const uint32_t widthByte = inBufferData.width * Pixel::GetBytesPerPixel(inBufferData.format);
 
       // Decompress scanline
-      for(uint32_t x = 0; x < componentCount; ++x)
-      {
-        const uint8_t v  = *(inBufferPtr++);
-        const uint8_t v0 = (v >> 4) & 0x0f;
-        const uint8_t v1 = v & 0x0f;
-
-        *(outBufferPtr++) = (v0 << 4) | v0;
-        *(outBufferPtr++) = (v1 << 4) | v1;
-      }
-      if(considerPadding)
-      {
-        const uint8_t v   = *(inBufferPtr++);
-        *(outBufferPtr++) = (v << 4) | v;
-      }
+      ExpandBitPerPixel4Scanline(inBufferData.buffer + offset, outBuffer, widthByte);
 
       // Update offset
       offset += (widthByte + 1u) >> 1u;
@@ -502,86 +620,32 @@ void GlyphBufferData::DecompressScanline(const GlyphBufferData& __restrict__ inB
     {
       const uint32_t widthByte = inBufferData.width * Pixel::GetBytesPerPixel(inBufferData.format);
 
-      uint8_t* __restrict__ outBufferPtr      = outBuffer;
-      const uint8_t* __restrict__ inBufferPtr = inBufferData.buffer + offset;
-
-      // If offset is zero, fill outBuffer as 0 first.
-      if(DALI_UNLIKELY(offset == 0))
+      // outBuffer keeps the previous scanline, so the differences are decoded into another buffer.
+      uint8_t  stackBuffer[MAXIMUM_STACK_SCANLINE_SIZE];
+      uint8_t* differences = stackBuffer;
+      if(DALI_UNLIKELY(widthByte > MAXIMUM_STACK_SCANLINE_SIZE))
       {
-        memset(outBufferPtr, 0, widthByte);
-      }
-
-      // Decompress scanline
-      uint32_t decodedByte = 0;
-      while(decodedByte < widthByte)
-      {
-        const uint8_t v = *(inBufferPtr++);
-        ++offset;
-        // Compress by RLE
-        if(v & 0x80)
+        differences = (uint8_t*)malloc(widthByte);
+        if(DALI_UNLIKELY(differences == nullptr))
         {
-          const uint8_t runLength = ((v >> 4) & 0x07) + 2u;
-          decodedByte += runLength;
-          const uint8_t repeatValue = (v & 0x0f);
-          for(uint8_t iter = 0; iter < runLength; ++iter)
-          {
-            const uint8_t prev0 = (*(outBufferPtr)) & 0x0f;
-            const uint8_t v0    = (prev0 + repeatValue) & 0x0f;
-            *(outBufferPtr++)   = (v0 << 4) | v0;
-          }
+          DALI_LOG_ERROR("malloc is failed. request malloc size : %u\n", widthByte);
+          return;
         }
-        // Not compress by RLE
-        else
-        {
-          const uint8_t nonRunLength = (((v >> 4) & 0x07) << 1u) + 1u;
-          decodedByte += nonRunLength;
-          // First value.
-          const uint8_t prev0 = (*(outBufferPtr)) & 0x0f;
-          const uint8_t v0    = (prev0 + (v & 0x0f)) & 0x0f;
-          *(outBufferPtr++)   = (v0 << 4) | v0;
-
-          const bool ignoreLastValue = decodedByte > widthByte ? true : false;
-          if(DALI_UNLIKELY(ignoreLastValue))
-          {
-            --decodedByte;
-            for(uint8_t iter = 1; iter + 2 < nonRunLength; iter += 2)
-            {
-              const uint8_t w     = *(inBufferPtr++);
-              const uint8_t prew0 = (*(outBufferPtr)) & 0x0f;
-              const uint8_t w0    = (prew0 + ((w >> 4) & 0x0f)) & 0x0f;
-              const uint8_t prew1 = (*(outBufferPtr + 1)) & 0x0f;
-              const uint8_t w1    = (prew1 + (w & 0x0f)) & 0x0f;
-              ++offset;
-
-              *(outBufferPtr++) = (w0 << 4) | w0;
-              *(outBufferPtr++) = (w1 << 4) | w1;
-            }
-            // Last value.
-            {
-              const uint8_t w     = ((*(inBufferPtr++)) >> 4) & 0x0f;
-              const uint8_t prew0 = (*(outBufferPtr)) & 0x0f;
-              const uint8_t w0    = (prew0 + w) & 0x0f;
-              ++offset;
+      }
 
-              *(outBufferPtr++) = (w0 << 4) | w0;
-            }
-          }
-          else
-          {
-            for(uint8_t iter = 1; iter < nonRunLength; iter += 2)
-            {
-              const uint8_t w     = *(inBufferPtr++);
-              const uint8_t prew0 = (*(outBufferPtr)) & 0x0f;
-              const uint8_t w0    = (prew0 + ((w >> 4) & 0x0f)) & 0x0f;
-              const uint8_t prew1 = (*(outBufferPtr + 1)) & 0x0f;
-              const uint8_t w1    = (prew1 + (w & 0x0f)) & 0x0f;
-              ++offset;
-
-              *(outBufferPtr++) = (w0 << 4) | w0;
-              *(outBufferPtr++) = (w1 << 4) | w1;
-            }
-          }
-        }
+      const uint8_t* inBufferPtr   = inBufferData.buffer + offset;
+      const uint8_t* nextScanline  = DecodeRunLength4Scanline(inBufferPtr, differences, widthByte);
+      const bool     firstScanline = (offset == 0);
+
+      // If offset is zero, there is no previous scanline.
+      AddRunLength4Differences(firstScanline ? nullptr : outBuffer, differences, outBuffer, widthByte);
+
+      // Update offset
+      offset += static_cast<uint32_t>(nextScanline - inBufferPtr);
+
+      if(DALI_UNLIKELY(differences != stackBuffer))
+      {
+        free(differences);
       }
       break;
     }
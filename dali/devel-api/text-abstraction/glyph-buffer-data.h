@@ -2,7 +2,7 @@
 #define DALI_TEXT_ABSTRACTION_GLYPH_BUFFER_DATA_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -93,6 +93,19 @@ struct DALI_ADAPTOR_API GlyphBufferData
     */
   static void Decompress(const GlyphBufferData& inBufferData, uint8_t* outBuffer);
 
+  /**
+    * @brief Helper static function to decompress raw buffer from inBuffer into a region of a larger buffer, e.g. a text atlas.
+    * The glyph is written directly, without intermediate buffer. If outBuffer is nullptr, Do nothing.
+    *
+    * @pre outBuffer memory should be allocated, and have the same pixel format as inBufferData.
+    * @param[in] inBufferData The input glyph buffer data.
+    * @param[in, out] outBuffer The output pointer of raw buffer data.
+    * @param[in] outStride The number of bytes of a scanline of outBuffer.
+    * @param[in] xOffset The horizontal position of the glyph in outBuffer, in pixels.
+    * @param[in] yOffset The vertical position of the glyph in outBuffer, in pixels.
+    */
+  static void Decompress(const GlyphBufferData& inBufferData, uint8_t* outBuffer, uint32_t outStride, uint32_t xOffset, uint32_t yOffset);
+
   /**
     * @brief Special Helper static function to decompress raw buffer from inBuffer to outBuffer one scanline.
     * After decompress one scanline successed, offset will be changed.
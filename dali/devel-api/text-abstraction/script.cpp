@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,6 +18,10 @@
 // FILE HEADER
 #include <dali/devel-api/text-abstraction/script.h>
 
+// EXTERNAL INCLUDES
+#include <array>
+#include <cstdint>
+
 namespace Dali
 {
 namespace TextAbstraction
@@ -262,673 +266,330 @@ constexpr unsigned int CHAR_TS   = 0x2009; ///< Thin Space.
 // 0x25aa
 // 0x262a
 
-/// character <= 0x077f
-inline Script GetScriptTillArabicSupplement(Character character)
-{
-  Script script = UNKNOWN;
+// Emoji variation selectors.
+// 0xfe0e Text presentation selector
+// 0xfe0f Emoji presentation selector
 
-  if((0x0030 <= character) && (character <= 0x0039))
-  {
-    script = ASCII_DIGITS;
-  }
-  else if(character <= 0x007E)
-  {
-    if((0x0020 <= character) && (character <= 0x002F))
-    {
-      script = ASCII_PS;
-    }
-    else if((0x003A <= character) && (character <= 0x0040))
-    {
-      script = ASCII_PS;
-    }
-    else if((0x005B <= character) && (character <= 0x0060))
-    {
-      script = ASCII_PS;
-    }
-    else if((0x007B <= character) && (character <= 0x007E))
-    {
-      script = ASCII_PS;
-    }
-    else
-    {
-      script = LATIN;
-    }
-  }
-  else if((0x007F <= character) && (character <= 0x009F))
-  {
-    // 0x007F is actually part of C0 Controls and Basic Latin. However, is the last and only control character of its block
-    // and the following characters of the next block are consecutive.
-    script = C1_CONTROLS;
-  }
-  else if((0x00A0 <= character) && (character <= 0x00BF))
-  {
-    if(character == 0x00A9)
-    {
-      script = EMOJI; // 5. Uncategorized: copyright sign
-    }
-    else if(character == 0x00AE)
-    {
-      script = EMOJI; // 5. Uncategorized: registered sign
-    }
-    else
-    {
-      script = C1_PS;
-    }
-  }
-  else if(character == 0x00D7)
-  {
-    script = C1_MATH;
-  }
-  else if(character == 0x00F7)
-  {
-    script = C1_MATH;
-  }
-  else if((0x00C0 <= character) && (character <= 0x02ff))
-  {
-    if((0x02B9 <= character) && (character <= 0x02BF))
-    {
-      script = SML_P;
-    }
-    else
-    {
-      script = LATIN;
-    }
-  }
-  else if((0x0370 <= character) && (character <= 0x03ff))
-  {
-    script = GREEK;
-  }
-  else if((0x0400 <= character) && (character <= 0x04ff))
-  {
-    script = CYRILLIC;
-  }
-  else if((0x0500 <= character) && (character <= 0x052f))
-  {
-    script = CYRILLIC;
-  }
-  else if((0x0530 <= character) && (character <= 0x058f))
-  {
-    script = ARMENIAN;
-  }
-  else if((0x0591 <= character) && (character <= 0x05f4))
-  {
-    script = HEBREW;
-  }
-  else if((0x0600 <= character) && (character <= 0x06ff))
-  {
-    script = ARABIC;
-  }
-  else if((0x0750 <= character) && (character <= 0x077f))
-  {
-    script = ARABIC;
-  }
+// Negative squared latin capital letters.
+// 0x1f170 - 0x1f189
 
-  return script;
-}
+// The white spaces, the new paragraph characters, the zero width characters, the left to right and
+// right to left marks and the thin space are common to all scripts.
 
-/// character <= 0x09ff
-inline Script GetScriptTillBengali(Character character)
+/**
+ * @brief A range of characters of the same script.
+ */
+struct ScriptRange
 {
-  Script script = UNKNOWN;
-
-  if(character <= 0x077f)
-  {
-    script = GetScriptTillArabicSupplement(character);
-  }
-  else // > 0x077f
-  {
-    if((0x08A0 <= character) && (character <= 0x08ff))
-    {
-      script = ARABIC;
-    }
-    else if((0x0900 <= character) && (character <= 0x097f))
-    {
-      script = DEVANAGARI;
-    }
-    else if((0x0980 <= character) && (character <= 0x09ff))
-    {
-      script = BENGALI;
-    }
-  }
-
-  return script;
-}
+  Character first;
+  Character last;
+  Script    script;
+};
 
-/// 0x09ff < character <= 0x0cff
-inline Script GetScriptBetweenBengaliAndKannada(Character character)
+/**
+ * @brief The scripts of the characters, in increasing order. The characters out of the ranges have the UNKNOWN script.
+ *
+ * The common characters, the emoji items and the symbols are set here too, over the scripts of their unicode block.
+ */
+constexpr ScriptRange SCRIPT_RANGES[] =
+  {
+    {0x0000, 0x0020, COMMON}, // White spaces
+    {0x0021, 0x002F, ASCII_PS},
+    {0x0030, 0x0039, ASCII_DIGITS},
+    {0x003A, 0x0040, ASCII_PS},
+    {0x0041, 0x005A, LATIN},
+    {0x005B, 0x0060, ASCII_PS},
+    {0x0061, 0x007A, LATIN},
+    {0x007B, 0x007E, ASCII_PS},
+    {0x007F, 0x0084, C1_CONTROLS},
+    {0x0085, 0x0085, COMMON}, // Next line
+    {0x0086, 0x009F, C1_CONTROLS},
+    {0x00A0, 0x00A8, C1_PS},
+    {0x00A9, 0x00A9, EMOJI}, // Copyright sign
+    {0x00AA, 0x00AD, C1_PS},
+    {0x00AE, 0x00AE, EMOJI}, // Registered sign
+    {0x00AF, 0x00BF, C1_PS},
+    {0x00C0, 0x00D6, LATIN},
+    {0x00D7, 0x00D7, C1_MATH},
+    {0x00D8, 0x00F6, LATIN},
+    {0x00F7, 0x00F7, C1_MATH},
+    {0x00F8, 0x02B8, LATIN},
+    {0x02B9, 0x02BF, SML_P},
+    {0x02C0, 0x02FF, LATIN},
+    {0x0370, 0x03FF, GREEK},
+    {0x0400, 0x052F, CYRILLIC},
+    {0x0530, 0x058F, ARMENIAN},
+    {0x0591, 0x05F4, HEBREW},
+    {0x0600, 0x06FF, ARABIC},
+    {0x0750, 0x077F, ARABIC},
+    {0x08A0, 0x08FF, ARABIC},
+    {0x0900, 0x097F, DEVANAGARI},
+    {0x0980, 0x09FF, BENGALI},
+    {0x0A00, 0x0A7F, GURMUKHI},
+    {0x0A80, 0x0AFF, GUJARATI},
+    {0x0B00, 0x0B7F, ORIYA},
+    {0x0B80, 0x0BFF, TAMIL},
+    {0x0C00, 0x0C7F, TELUGU},
+    {0x0C80, 0x0CFF, KANNADA},
+    {0x0D00, 0x0D7F, MALAYALAM},
+    {0x0D80, 0x0DFF, SINHALA},
+    {0x0E00, 0x0E7F, THAI},
+    {0x0E80, 0x0EFF, LAO},
+    {0x1000, 0x109F, BURMESE},
+    {0x10A0, 0x10FF, GEORGIAN},
+    {0x1100, 0x11FF, HANGUL},
+    {0x1200, 0x139F, GEEZ},
+    {0x1700, 0x171F, BAYBAYIN},
+    {0x1780, 0x17FF, KHMER},
+    {0x19E0, 0x19FF, KHMER},
+    {0x1B80, 0x1BBF, SUNDANESE},
+    {0x1C50, 0x1C7F, OL_CHIKI},
+    {0x1CC0, 0x1CCF, SUNDANESE},
+    {0x1D00, 0x1D25, LATIN},
+    {0x1D26, 0x1D2B, PHONETIC_U},
+    {0x1D2C, 0x1D5C, LATIN},
+    {0x1D5D, 0x1D61, PHONETIC_SS},
+    {0x1D62, 0x1D65, LATIN},
+    {0x1D66, 0x1D6A, PHONETIC_SS},
+    {0x1D6B, 0x1D77, LATIN},
+    {0x1D78, 0x1D78, PHONETIC_SS},
+    {0x1D79, 0x1DBE, LATIN},
+    {0x1DBF, 0x1DBF, PHONETIC_SS},
+    {0x1DC0, 0x1EFF, LATIN},
+    {0x1F00, 0x1FFF, GREEK},
+    {0x2009, 0x2009, COMMON}, // Thin space
+    {0x200B, 0x200F, COMMON}, // Zero width space, non joiner and joiner, left to right and right to left marks
+    {0x2028, 0x2029, COMMON}, // Line and paragraph separators
+    {0x203C, 0x203C, EMOJI},  // Double exclamation mark
+    {0x2049, 0x2049, EMOJI},  // Exclamation question mark
+    {0x2070, 0x2070, NUMERIC_SS},
+    {0x2071, 0x2073, LATIN},
+    {0x2074, 0x207E, NUMERIC_SS},
+    {0x207F, 0x209F, LATIN},
+    {0x20E3, 0x20E3, EMOJI}, // Combining enclosing keycap
+    {0x2100, 0x2121, LETTER_LIKE},
+    {0x2122, 0x2122, EMOJI}, // Trade mark sign
+    {0x2123, 0x2129, LETTER_LIKE},
+    {0x212A, 0x212B, LATIN},
+    {0x212C, 0x2131, LETTER_LIKE},
+    {0x2132, 0x2132, LATIN},
+    {0x2133, 0x2138, LETTER_LIKE},
+    {0x2139, 0x2139, EMOJI}, // Information source
+    {0x213A, 0x214D, LETTER_LIKE},
+    {0x214E, 0x214E, LATIN},
+    {0x214F, 0x214F, LETTER_LIKE},
+    {0x2150, 0x215F, FRACTIONS_NF},
+    {0x2160, 0x2188, LATIN},
+    {0x2189, 0x2189, FRACTIONS_NF},
+    {0x2194, 0x259F, EMOJI},
+    {0x25A0, 0x25A0, SYMBOLS2},
+    {0x25A1, 0x25A1, SYMBOLS1},
+    {0x25A2, 0x25A9, EMOJI},
+    {0x25AA, 0x25AA, SYMBOLS4},
+    {0x25AB, 0x25CA, EMOJI},
+    {0x25CB, 0x25CB, SYMBOLS1},
+    {0x25CC, 0x25CE, EMOJI},
+    {0x25CF, 0x25CF, SYMBOLS1},
+    {0x25D0, 0x2605, EMOJI},
+    {0x2606, 0x2606, SYMBOLS4},
+    {0x2607, 0x2629, EMOJI},
+    {0x262A, 0x262A, SYMBOLS5},
+    {0x262B, 0x2660, EMOJI},
+    {0x2661, 0x2662, SYMBOLS3},
+    {0x2663, 0x2663, EMOJI},
+    {0x2664, 0x2664, SYMBOLS3},
+    {0x2665, 0x2666, EMOJI},
+    {0x2667, 0x2667, SYMBOLS3},
+    {0x2668, 0x2B55, EMOJI},
+    {0x2C60, 0x2C7F, LATIN},
+    {0x2D00, 0x2D2F, GEORGIAN},
+    {0x2D80, 0x2DDF, GEEZ},
+    {0x2DE0, 0x2DFF, CYRILLIC},
+    {0x2E80, 0x2FDF, CJK},
+    {0x3000, 0x303F, CJK},
+    {0x3040, 0x309F, HIRAGANA},
+    {0x30A0, 0x30FF, KATAKANA},
+    {0x3100, 0x312F, BOPOMOFO},
+    {0x3130, 0x318F, HANGUL},
+    {0x31A0, 0x31BF, BOPOMOFO},
+    {0x3200, 0x32FF, CJK},
+    {0x3400, 0x4DBF, CJK},
+    {0x4E00, 0x9FFF, CJK},
+    {0xA640, 0xA69F, CYRILLIC},
+    {0xA720, 0xA721, PHONETIC_U},
+    {0xA722, 0xA787, LATIN},
+    {0xA788, 0xA78A, NON_LATIN_LED},
+    {0xA78B, 0xA7FF, LATIN},
+    {0xA960, 0xA97F, HANGUL},
+    {0xA980, 0xA9FD, JAVANESE},
+    {0xAAE0, 0xAAFF, MEITEI},
+    {0xAB00, 0xAB2F, GEEZ},
+    {0xAB30, 0xAB6F, LATIN},
+    {0xABC0, 0xABFF, MEITEI},
+    {0xAC00, 0xD7FF, HANGUL},
+    {0xFB00, 0xFB06, LATIN},
+    {0xFB13, 0xFB17, ARMENIAN},
+    {0xFB1D, 0xFB4F, HEBREW},
+    {0xFB50, 0xFDFF, ARABIC},
+    {0xFE0E, 0xFE0E, EMOJI_TEXT},
+    {0xFE0F, 0xFE0F, EMOJI_COLOR},
+    {0xFE70, 0xFEFF, ARABIC},
+    {0xFF00, 0xFF20, HWFW_S},
+    {0xFF21, 0xFF3A, LATIN},
+    {0xFF3B, 0xFF40, HWFW_S},
+    {0xFF41, 0xFF5A, LATIN},
+    {0xFF5B, 0xFFEF, HWFW_S},
+    {0x1EE00, 0x1EEFF, ARABIC},
+    {0x1F170, 0x1F189, SYMBOLS_NSLCL},
+    {0x1F18A, 0x1F6FF, EMOJI}, // Includes the emoji modifiers
+    {0x1F900, 0x1F9FF, EMOJI}, // Includes the emoji components
+    {0x20000, 0x2A6DF, CJK},
+    {0x2A700, 0x2B81F, CJK},
+    {0xE0020, 0xE007F, EMOJI}, // Tags
+};
+
+constexpr uint32_t NUMBER_OF_SCRIPT_RANGES = sizeof(SCRIPT_RANGES) / sizeof(SCRIPT_RANGES[0]);
+
+// The scripts of the characters below SCRIPT_TABLE_LIMIT are read from a two-stage table: the index of the
+// block of a character is read from the first stage, and its script from the block in the second stage.
+// The blocks are generated from SCRIPT_RANGES at compile time. The blocks with a single script are shared.
+constexpr Character SCRIPT_TABLE_LIMIT      = 0x30000; ///< Above, only the tags have a script
+constexpr uint32_t  SCRIPT_BLOCK_SHIFT      = 6u;
+constexpr uint32_t  SCRIPT_BLOCK_SIZE       = 1u << SCRIPT_BLOCK_SHIFT;
+constexpr uint32_t  NUMBER_OF_SCRIPT_BLOCKS = SCRIPT_TABLE_LIMIT >> SCRIPT_BLOCK_SHIFT;
+constexpr uint32_t  NUMBER_OF_SCRIPTS       = SYMBOLS_NSLCL + 1u;
+constexpr uint8_t   NO_BLOCK                = 0xFF;
+
+constexpr Character LATIN_1_LIMIT = 0x0100; ///< The scripts of the ASCII and Latin-1 characters are read directly
+
+template<uint32_t NUMBER_OF_BLOCKS>
+struct ScriptTable
 {
-  Script script = UNKNOWN;
+  std::array<uint8_t, NUMBER_OF_SCRIPT_BLOCKS>              blockIndices{};
+  std::array<uint8_t, NUMBER_OF_BLOCKS * SCRIPT_BLOCK_SIZE> scripts{};
+  uint32_t                                                  numberOfBlocks{0u}; ///< The number of blocks needed, may be more than NUMBER_OF_BLOCKS
+};
 
-  if(character <= 0x0b7f)
-  {
-    if((0x0a00 <= character) && (character <= 0x0a7f))
-    {
-      script = GURMUKHI;
-    }
-    else if((0x0a80 <= character) && (character <= 0x0aff))
-    {
-      script = GUJARATI;
-    }
-    else if((0x0b00 <= character) && (character <= 0x0b7f))
-    {
-      script = ORIYA;
-    }
-  }
-  else // > 0x0b7f
-  {
-    if((0x0b80 <= character) && (character <= 0x0bff))
-    {
-      script = TAMIL;
-    }
-    else if((0x0c00 <= character) && (character <= 0x0c7f))
-    {
-      script = TELUGU;
-    }
-    else if((0x0c80 <= character) && (character <= 0x0cff))
-    {
-      script = KANNADA;
-    }
-  }
-
-  return script;
-}
-
-/// 0x0cff < character <= 0x1eff
-inline Script GetScriptBetweenKannadaAndLatinExtendedAdditional(Character character)
+/**
+ * @brief Generates the two-stage table.
+ *
+ * The blocks beyond NUMBER_OF_BLOCKS are counted, but not written, so the table can be generated with no block to count them.
+ * @return The table
+ */
+template<uint32_t NUMBER_OF_BLOCKS>
+constexpr ScriptTable<NUMBER_OF_BLOCKS> GenerateScriptTable()
 {
-  Script script = UNKNOWN;
+  ScriptTable<NUMBER_OF_BLOCKS> table{};
 
-  if((0x0d00 <= character) && (character <= 0x0d7f))
-  {
-    script = MALAYALAM;
-  }
-  else if((0x0d80 <= character) && (character <= 0x0dff))
-  {
-    script = SINHALA;
-  }
-  else if((0x0e00 <= character) && (character <= 0x0e7f))
-  {
-    script = THAI;
-  }
-  else if((0x0e80 <= character) && (character <= 0x0eff))
-  {
-    script = LAO;
-  }
-  else if((0x1000 <= character) && (character <= 0x109f))
-  {
-    script = BURMESE;
-  }
-  else if((0x10a0 <= character) && (character <= 0x10ff))
-  {
-    script = GEORGIAN;
-  }
-  else if((0x1100 <= character) && (character <= 0x11ff))
-  {
-    script = HANGUL;
-  }
-  else if((0x1200 <= character) && (character <= 0x137f))
-  {
-    script = GEEZ;
-  }
-  else if((0x1380 <= character) && (character <= 0x139f))
-  {
-    script = GEEZ;
-  }
-  else if((0x1700 <= character) && (character <= 0x171f))
-  {
-    script = BAYBAYIN;
-  }
-  else if((0x1780 <= character) && (character <= 0x17ff))
-  {
-    script = KHMER;
-  }
-  else if((0x19e0 <= character) && (character <= 0x19ff))
-  {
-    script = KHMER;
-  }
-  else if((0x1b80 <= character) && (character <= 0x1bbf))
-  {
-    script = SUNDANESE;
-  }
-  else if((0x1c50 <= character) && (character <= 0x1c7f))
+  std::array<uint8_t, NUMBER_OF_SCRIPTS> uniformBlockIndices{}; ///< The block shared by the characters of each script
+  for(auto& index : uniformBlockIndices)
   {
-    script = OL_CHIKI;
-  }
-  else if((0x1cc0 <= character) && (character <= 0x1ccf))
-  {
-    script = SUNDANESE;
-  }
-  else if((0x1d00 <= character) && (character <= 0x1eff))
-  {
-    if((0x1D26 <= character) && (character <= 0x1D2B))
-    {
-      script = PHONETIC_U;
-    }
-    else if((0x1D5D <= character) && (character <= 0x1D61))
-    {
-      script = PHONETIC_SS;
-    }
-    else if((0x1D66 <= character) && (character <= 0x1D6A))
-    {
-      script = PHONETIC_SS;
-    }
-    else if(character == 0x1D78)
-    {
-      script = PHONETIC_SS;
-    }
-    else if(character == 0x1DBF)
-    {
-      script = PHONETIC_SS;
-    }
-    else
-    {
-      script = LATIN;
-    }
+    index = NO_BLOCK;
   }
 
-  return script;
-}
-
-/// 0x1eff < character <= 0x2c7f
-inline Script GetScriptBetweenLatinExtendedAdditionalAndLatinExtendedC(Character character)
-{
-  Script script = UNKNOWN;
-
-  if((0x1f00 <= character) && (character <= 0x1fff))
+  uint32_t rangeIndex = 0u;
+  for(uint32_t block = 0u; block < NUMBER_OF_SCRIPT_BLOCKS; ++block)
   {
-    script = GREEK;
-  }
-  else if(character == 0x203c)
-  {
-    script = EMOJI; // 5. Uncategorized: double exclamation mark
-  }
-  else if(character == 0x2049)
-  {
-    script = EMOJI; // 5. Uncategorized: exclamation question mark
-  }
-  else if((0x2070 <= character) && (character <= 0x209f))
-  {
-    if(character == 0x2070)
-    {
-      script = NUMERIC_SS;
-    }
-    else if((0x2074 <= character) && (character <= 0x207E))
-    {
-      script = NUMERIC_SS;
-    }
-    else
+    const Character first = block << SCRIPT_BLOCK_SHIFT;
+    const Character last  = first + SCRIPT_BLOCK_SIZE - 1u;
+
+    // The first range ending after the start of the block
+    while(rangeIndex < NUMBER_OF_SCRIPT_RANGES && SCRIPT_RANGES[rangeIndex].last < first)
     {
-      script = LATIN;
+      ++rangeIndex;
     }
-  }
-  else if(character == 0x20e3)
-  {
-    script = EMOJI; // 5. Uncategorized: combining enclosing keycap
-  }
-  else if(character == 0x2122)
-  {
-    script = EMOJI; // 5. Uncategorized: trade mark sign
-  }
-  else if(character == 0x2139)
-  {
-    script = EMOJI; // 5. Uncategorized: information source
-  }
-  else if((0x2100 <= character) && (character <= 0x2189))
-  {
-    if((0x2100 <= character) && (character <= 0x214f))
+
+    const bool inRange   = rangeIndex < NUMBER_OF_SCRIPT_RANGES && SCRIPT_RANGES[rangeIndex].first <= first && last <= SCRIPT_RANGES[rangeIndex].last;
+    const bool noRange   = rangeIndex == NUMBER_OF_SCRIPT_RANGES || last < SCRIPT_RANGES[rangeIndex].first;
+    uint32_t   blockIndex = table.numberOfBlocks;
+    if(inRange || noRange)
     {
-      if((0x212A <= character) && (character <= 0x212B))
+      const Script script = inRange ? SCRIPT_RANGES[rangeIndex].script : UNKNOWN;
+      if(uniformBlockIndices[script] != NO_BLOCK)
       {
-        script = LATIN;
+        table.blockIndices[block] = uniformBlockIndices[script];
+        continue;
       }
-      else if(character == 0x2132)
-      {
-        script = LATIN;
-      }
-      else if(character == 0x214E)
-      {
-        script = LATIN;
-      }
-      else
+
+      uniformBlockIndices[script] = static_cast<uint8_t>(blockIndex);
+      if(blockIndex < NUMBER_OF_BLOCKS)
       {
-        script = LETTER_LIKE;
+        for(uint32_t offset = 0u; offset < SCRIPT_BLOCK_SIZE; ++offset)
+        {
+          table.scripts[(blockIndex << SCRIPT_BLOCK_SHIFT) + offset] = static_cast<uint8_t>(script);
+        }
       }
     }
-    else if((0x2150 <= character) && (character <= 0x215F))
-    {
-      script = FRACTIONS_NF;
-    }
-    else if(character == 0x2189)
-    {
-      script = FRACTIONS_NF;
-    }
-    else
+    else if(blockIndex < NUMBER_OF_BLOCKS)
     {
-      script = LATIN;
-    }
-  }
-  // Symbols
-  else if((0x25cb == character) ||
-          (0x25cf == character) ||
-          (0x25a1 == character))
-  {
-    script = SYMBOLS1;
-  }
-  else if(0x25a0 == character)
-  {
-    script = SYMBOLS2;
-  }
-  else if((0x2664 == character) ||
-          (0x2661 == character) ||
-          (0x2662 == character) ||
-          (0x2667 == character))
-  {
-    script = SYMBOLS3;
-  }
-  else if((0x2606 == character) ||
-          (0x25aa == character))
-  {
-    script = SYMBOLS4;
-  }
-  else if(0x262a == character)
-  {
-    script = SYMBOLS5;
-  }
-  // U+2194 5. Uncategorized: left right arrow
-  // U+2B55 5. Uncategorized: heavy large circle
-  else if((0x2194 <= character) && (character <= 0x2B55))
-  {
-    script = EMOJI;
-  }
-  else if((0x2c60 <= character) && (character <= 0x2c7f))
-  {
-    script = LATIN;
-  }
+      uint32_t characterRangeIndex = rangeIndex;
+      for(uint32_t offset = 0u; offset < SCRIPT_BLOCK_SIZE; ++offset)
+      {
+        const Character character = first + offset;
+        while(characterRangeIndex < NUMBER_OF_SCRIPT_RANGES && SCRIPT_RANGES[characterRangeIndex].last < character)
+        {
+          ++characterRangeIndex;
+        }
 
-  return script;
-}
+        const bool   found  = characterRangeIndex < NUMBER_OF_SCRIPT_RANGES && SCRIPT_RANGES[characterRangeIndex].first <= character;
+        const Script script = found ? SCRIPT_RANGES[characterRangeIndex].script : UNKNOWN;
 
-/// 0x0cff < character <= 0x2c7f
-inline Script GetScriptBetweenKannadaAndLatinExtendedC(Character character)
-{
-  Script script = UNKNOWN;
+        table.scripts[(blockIndex << SCRIPT_BLOCK_SHIFT) + offset] = static_cast<uint8_t>(script);
+      }
+    }
 
-  if(character <= 0x1eff)
-  {
-    script = GetScriptBetweenKannadaAndLatinExtendedAdditional(character);
-  }
-  else // > 0x1eff
-  {
-    script = GetScriptBetweenLatinExtendedAdditionalAndLatinExtendedC(character);
+    table.blockIndices[block] = static_cast<uint8_t>(blockIndex);
+    ++table.numberOfBlocks;
   }
 
-  return script;
+  return table;
 }
 
-/// 0x2c7f < character <= 0xa7ff
-inline Script GetScriptBetweenLatinExtendedCAndLatinExtendedD(Character character)
-{
-  Script script = UNKNOWN;
-
-  if((0x2d00 <= character) && (character <= 0x2d2f))
-  {
-    script = GEORGIAN;
-  }
-  else if((0x2d80 <= character) && (character <= 0x2ddf))
-  {
-    script = GEEZ;
-  }
-  else if((0x2de0 <= character) && (character <= 0x2dff))
-  {
-    script = CYRILLIC;
-  }
-  else if((0x2e80 <= character) && (character <= 0x2eff))
-  {
-    script = CJK;
-  }
-  else if((0x2f00 <= character) && (character <= 0x2fdf))
-  {
-    script = CJK;
-  }
-  else if((0x3000 <= character) && (character <= 0x303f))
-  {
-    script = CJK;
-  }
-  else if((0x3040 <= character) && (character <= 0x309f))
-  {
-    script = HIRAGANA;
-  }
-  else if((0x30a0 <= character) && (character <= 0x30ff))
-  {
-    script = KATAKANA;
-  }
-  else if((0x3100 <= character) && (character <= 0x312f))
-  {
-    script = BOPOMOFO;
-  }
-  else if((0x3130 <= character) && (character <= 0x318f))
-  {
-    script = HANGUL;
-  }
-  else if((0x31a0 <= character) && (character <= 0x31bf))
-  {
-    script = BOPOMOFO;
-  }
-  else if((0x3200 <= character) && (character <= 0x32ff))
-  {
-    script = CJK;
-  }
-  else if((0x3400 <= character) && (character <= 0x4dbf))
-  {
-    script = CJK;
-  }
-  else if((0x4e00 <= character) && (character <= 0x62ff))
-  {
-    script = CJK;
-  }
-  else if((0x6300 <= character) && (character <= 0x77ff))
-  {
-    script = CJK;
-  }
-  else if((0x7800 <= character) && (character <= 0x8cff))
-  {
-    script = CJK;
-  }
-  else if((0x8d00 <= character) && (character <= 0x9fff))
-  {
-    script = CJK;
-  }
-  else if((0xa640 <= character) && (character <= 0xa69f))
-  {
-    script = CYRILLIC;
-  }
-  else if((0xa720 <= character) && (character <= 0xa7ff))
-  {
-    if(character == 0xA720)
-    {
-      script = PHONETIC_U;
-    }
-    else if(character == 0xA721)
-    {
-      script = PHONETIC_U;
-    }
-    else if(character == 0xA788)
-    {
-      script = NON_LATIN_LED;
-    }
-    else if(character == 0xA789)
-    {
-      script = NON_LATIN_LED;
-    }
-    else if(character == 0xA78A)
-    {
-      script = NON_LATIN_LED;
-    }
-    else
-    {
-      script = LATIN;
-    }
-  }
+constexpr uint32_t NUMBER_OF_UNIQUE_SCRIPT_BLOCKS = GenerateScriptTable<0u>().numberOfBlocks;
+static_assert(NUMBER_OF_UNIQUE_SCRIPT_BLOCKS < NO_BLOCK, "The block indices of the script table must fit in a byte");
 
-  return script;
-}
+constexpr ScriptTable<NUMBER_OF_UNIQUE_SCRIPT_BLOCKS> SCRIPT_TABLE = GenerateScriptTable<NUMBER_OF_UNIQUE_SCRIPT_BLOCKS>();
 
-/// 0x2c7f < character <= 0xfdff
-inline Script GetScriptBetweenLatinExtendedCAndArabicPresentationFormsA(Character character)
+/**
+ * @brief Generates the scripts of the ASCII and Latin-1 characters from the two-stage table.
+ * @return The scripts
+ */
+constexpr std::array<uint8_t, LATIN_1_LIMIT> GenerateLatin1Scripts()
 {
-  Script script = GetScriptBetweenLatinExtendedCAndLatinExtendedD(character);
-
-  if((0xa960 <= character) && (character <= 0xa97f))
-  {
-    script = HANGUL;
-  }
-  else if((0xa980 <= character) && (character <= 0xa9fd))
-  {
-    script = JAVANESE;
-  }
-  else if((0xab00 <= character) && (character <= 0xab2f))
+  std::array<uint8_t, LATIN_1_LIMIT> scripts{};
+  for(Character character = 0u; character < LATIN_1_LIMIT; ++character)
   {
-    script = GEEZ;
+    scripts[character] = SCRIPT_TABLE.scripts[(SCRIPT_TABLE.blockIndices[character >> SCRIPT_BLOCK_SHIFT] << SCRIPT_BLOCK_SHIFT) + (character & (SCRIPT_BLOCK_SIZE - 1u))];
   }
-  else if((0xab30 <= character) && (character <= 0xab6f))
-  {
-    script = LATIN;
-  }
-  else if((0xaae0 <= character) && (character <= 0xaaff))
-  {
-    script = MEITEI;
-  }
-  else if((0xabc0 <= character) && (character <= 0xabff))
-  {
-    script = MEITEI;
-  }
-  else if((0xac00 <= character) && (character <= 0xd7af))
-  {
-    script = HANGUL;
-  }
-  else if((0xd7b0 <= character) && (character <= 0xd7ff))
-  {
-    script = HANGUL;
-  }
-  else if((0xfb00 <= character) && (character <= 0xfb06))
-  {
-    script = LATIN;
-  }
-  else if((0xfb13 <= character) && (character <= 0xfb17))
-  {
-    script = ARMENIAN;
-  }
-  else if((0xfb1d <= character) && (character <= 0xfb4f))
-  {
-    script = HEBREW;
-  }
-  else if((0xfb50 <= character) && (character <= 0xfdff))
-  {
-    script = ARABIC;
-  }
-
-  return script;
+  return scripts;
 }
 
-/// character > 0xfdff
-inline Script GetScriptAboveArabicPresentationFormsA(Character character)
-{
-  Script script = UNKNOWN;
+constexpr std::array<uint8_t, LATIN_1_LIMIT> LATIN_1_SCRIPTS = GenerateLatin1Scripts();
 
-  if((0xfe70 <= character) && (character <= 0xfeff))
-  {
-    script = ARABIC;
-  }
-  else if((0xff00 <= character) && (character <= 0xffef))
+/**
+ * @brief Finds the script of a character in the ranges.
+ *
+ * @param[in] character The character.
+ *
+ * @return The chraracter's script.
+ */
+Script FindScriptInRanges(Character character)
+{
+  uint32_t begin = 0u;
+  uint32_t end   = NUMBER_OF_SCRIPT_RANGES;
+  while(begin < end)
   {
-    if((0xFF00 <= character) && (character <= 0xFF20))
+    const uint32_t middle = (begin + end) / 2u;
+    if(SCRIPT_RANGES[middle].last < character)
     {
-      script = HWFW_S;
-    }
-    else if((0xFF3B <= character) && (character <= 0xFF40))
-    {
-      script = HWFW_S;
-    }
-    else if((0xFF5B <= character) && (character <= 0xFFEF))
-    {
-      script = HWFW_S;
+      begin = middle + 1u;
     }
     else
     {
-      script = LATIN;
+      end = middle;
     }
   }
-  else if((0x1ee00 <= character) && (character <= 0x1eeff))
-  {
-    script = ARABIC;
-  }
-  // U+1f170 4. Enclosed characters: negative squared latin capital letter A
-  // U+1f6ff 6b. Additional transport and map symbols
-  // Exclude U+1f170 ~ U+1f189. They are SYMBOLS_NSLCL (negative squared latin capital letter)
-  else if((0x1f170 <= character) && (character <= 0x1f6ff))
-  {
-    script = EMOJI;
-  }
-  // 7. Supplemental Symbols and Pictographs
-  else if((0x1f900 <= character) && (character <= 0x1f9ff))
-  {
-    script = EMOJI;
-  }
-  else if((0x20000 <= character) && (character <= 0x215ff))
-  {
-    script = CJK;
-  }
-  else if((0x21600 <= character) && (character <= 0x230ff))
-  {
-    script = CJK;
-  }
-  else if((0x23100 <= character) && (character <= 0x245ff))
-  {
-    script = CJK;
-  }
-  else if((0x24600 <= character) && (character <= 0x260ff))
-  {
-    script = CJK;
-  }
-  else if((0x26100 <= character) && (character <= 0x275ff))
-  {
-    script = CJK;
-  }
-  else if((0x27600 <= character) && (character <= 0x290ff))
-  {
-    script = CJK;
-  }
-  else if((0x29100 <= character) && (character <= 0x2a6df))
-  {
-    script = CJK;
-  }
-  else if((0x2a700 <= character) && (character <= 0x2b73f))
-  {
-    script = CJK;
-  }
-  else if((0x2b740 <= character) && (character <= 0x2b81f))
-  {
-    script = CJK;
-  }
-
-  return script;
-}
-
-/// character > 0x2c7f
-inline Script GetScriptAboveLatinExtendedC(Character character)
-{
-  Script script = UNKNOWN;
-
-  if(character <= 0xfdff)
-  {
-    script = GetScriptBetweenLatinExtendedCAndArabicPresentationFormsA(character);
-  }
-  else // > 0xfdff
-  {
-    script = GetScriptAboveArabicPresentationFormsA(character);
-  }
-
-  return script;
+  return (begin < NUMBER_OF_SCRIPT_RANGES && SCRIPT_RANGES[begin].first <= character) ? SCRIPT_RANGES[begin].script : UNKNOWN;
 }
 
 } // namespace
@@ -941,52 +602,28 @@ bool IsRightToLeftScript(Script script)
 
 Script GetCharacterScript(Character character)
 {
-  Script script = UNKNOWN;
-
-  if(IsTextPresentationSelector(character))
-  {
-    script = EMOJI_TEXT;
-  }
-  else if(IsEmojiPresentationSelector(character))
-  {
-    script = EMOJI_COLOR;
-  }
-  else if(IsEmojiItem(character))
+  if(character < SCRIPT_TABLE_LIMIT)
   {
-    script = EMOJI;
+    const uint32_t blockIndex = SCRIPT_TABLE.blockIndices[character >> SCRIPT_BLOCK_SHIFT];
+    return static_cast<Script>(SCRIPT_TABLE.scripts[(blockIndex << SCRIPT_BLOCK_SHIFT) + (character & (SCRIPT_BLOCK_SIZE - 1u))]);
   }
-  else if(IsNegativeSquaredLatinCapitalLetter(character))
-  {
-    script = SYMBOLS_NSLCL;
-  }
-  else if(IsCommonScript(character))
-  {
-    script = COMMON;
-  }
-  else if(character <= 0x0cff)
-  {
-    if(character <= 0x09ff)
-    {
-      script = GetScriptTillBengali(character);
-    }
-    else // > 0x09ff
-    {
-      script = GetScriptBetweenBengaliAndKannada(character);
-    }
-  }
-  else // > 0x0cff
+  return FindScriptInRanges(character);
+}
+
+void GetCharacterScripts(const Character* const characters, Length numberOfCharacters, Script* scripts)
+{
+  for(Length index = 0u; index < numberOfCharacters; ++index)
   {
-    if(character <= 0x2c7f)
+    const Character character = characters[index];
+    if(character < LATIN_1_LIMIT)
     {
-      script = GetScriptBetweenKannadaAndLatinExtendedC(character);
+      scripts[index] = static_cast<Script>(LATIN_1_SCRIPTS[character]);
     }
-    else // > 0x2c7f
+    else
     {
-      script = GetScriptAboveLatinExtendedC(character);
+      scripts[index] = GetCharacterScript(character);
     }
   }
-
-  return script;
 }
 
 bool IsWhiteSpace(Character character)
@@ -2,7 +2,7 @@
 #define DALI_TOOLKIT_TEXT_ABSTRACTION_SCRIPT_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -204,6 +204,17 @@ DALI_ADAPTOR_API bool IsRightToLeftScript(Script script);
  */
 DALI_ADAPTOR_API Script GetCharacterScript(Character character);
 
+/**
+ * @brief Retrieves the scripts of the given characters.
+ *
+ * Each script is the one returned by GetCharacterScript(). It's faster for text of many characters.
+ *
+ * @param[in] characters The characters.
+ * @param[in] numberOfCharacters The number of characters.
+ * @param[out] scripts The characters' scripts. It must have room for @p numberOfCharacters scripts.
+ */
+DALI_ADAPTOR_API void GetCharacterScripts(const Character* const characters, Length numberOfCharacters, Script* scripts);
+
 /**
  * @brief Whether the character is a white space.
  *
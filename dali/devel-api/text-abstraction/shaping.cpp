@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -61,6 +61,31 @@ void Shaping::GetGlyphs(GlyphInfo*      glyphInfo,
                                      glyphToCharacterMap);
 }
 
+void Shaping::SetCacheMaximumSize(std::size_t maximumSize)
+{
+  GetImplementation(*this).SetCacheMaximumSize(maximumSize);
+}
+
+std::size_t Shaping::GetCacheMaximumSize()
+{
+  return GetImplementation(*this).GetCacheMaximumSize();
+}
+
+uint32_t Shaping::GetCacheHitCount()
+{
+  return GetImplementation(*this).GetCacheHitCount();
+}
+
+uint32_t Shaping::GetCacheMissCount()
+{
+  return GetImplementation(*this).GetCacheMissCount();
+}
+
+void Shaping::ClearCache()
+{
+  GetImplementation(*this).ClearCache();
+}
+
 } // namespace TextAbstraction
 
 } // namespace Dali
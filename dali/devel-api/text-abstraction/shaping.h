@@ -2,7 +2,7 @@
 #define DALI_PLATFORM_TEXT_ABSTRACTION_SHAPING_H
 
 /*
- * Copyright (c) 2020 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -116,6 +116,45 @@ public:
    */
   void GetGlyphs(GlyphInfo*      glyphInfo,
                  CharacterIndex* glyphToCharacterMap);
+
+  /**
+   * @brief Sets the maximum memory size of the shaping results cache.
+   *
+   * Shape() returns the cached result if the same text has already been shaped with the same font and script.
+   * The least recently used results are removed when the cache is full.
+   * The default size can be set with the DALI_SHAPING_CACHE_MAX_SIZE environment variable.
+   *
+   * @param[in] maximumSize The maximum memory size in bytes. Zero disables the cache.
+   */
+  void SetCacheMaximumSize(std::size_t maximumSize);
+
+  /**
+   * @brief Retrieves the maximum memory size of the shaping results cache.
+   *
+   * @return The maximum memory size in bytes.
+   */
+  std::size_t GetCacheMaximumSize();
+
+  /**
+   * @brief Retrieves the number of Shape() calls which found the result in the cache.
+   *
+   * @return The number of cache hits.
+   */
+  uint32_t GetCacheHitCount();
+
+  /**
+   * @brief Retrieves the number of Shape() calls which didn't find the result in the cache.
+   *
+   * @return The number of cache misses.
+   */
+  uint32_t GetCacheMissCount();
+
+  /**
+   * @brief Removes all the cached shaping results.
+   *
+   * @note The cache is also cleared when the font client's cache is cleared or the locale changes.
+   */
+  void ClearCache();
 };
 
 } // namespace TextAbstraction
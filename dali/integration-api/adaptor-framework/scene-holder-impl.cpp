@@ -96,6 +96,7 @@ SceneHolder::SceneHolder()
   mAdaptorStarted(false),
   mVisible(true),
   mHandledMultiTouch(false),
+  mTouchHistoryQueued(false),
   mPreviousTouchEvent(),
   mPreviousHoverEvent(),
   mPreviousType(Integration::TouchEventCombiner::DISPATCH_NONE)
@@ -377,9 +378,45 @@ void SceneHolder::FeedTouchPoint(Dali::Integration::Point& point, int timeStamp)
       {
         mScene.QueueEvent(hoverEvent);
       }
+      mTouchHistoryQueued = false;
       mAdaptor->ProcessCoreEvents();
     }
   }
+  else if(mTouchHistoryQueued)
+  {
+    // The point was filtered out by the combiner, the history must not wait for the next one.
+    Dali::BaseHandle sceneHolder(this);
+    mTouchHistoryQueued = false;
+    mAdaptor->ProcessCoreEvents();
+  }
+}
+
+void SceneHolder::FeedTouchHistoryPoint(Dali::Integration::Point& point, int timeStamp)
+{
+  if(DALI_UNLIKELY(!mAdaptorStarted))
+  {
+    DALI_LOG_ERROR("Adaptor is stopped, or not be started yet. Ignore this feed.\n");
+    return;
+  }
+
+  if(timeStamp < 1)
+  {
+    timeStamp = TimeService::GetMilliSeconds();
+  }
+  Vector2 convertedPosition = RecalculatePosition(point.GetScreenPosition());
+  point.SetScreenPosition(convertedPosition);
+
+  Integration::TouchEvent                            touchEvent;
+  Integration::HoverEvent                            hoverEvent;
+  Integration::TouchEventCombiner::EventDispatchType type = mCombiner.GetNextTouchEvent(point, timeStamp, touchEvent, hoverEvent, mHandledMultiTouch);
+  if((type == Integration::TouchEventCombiner::DISPATCH_TOUCH || type == Integration::TouchEventCombiner::DISPATCH_BOTH) && touchEvent.GetPointCount() <= MAX_PRESSED_POINT_COUNT)
+  {
+    DALI_LOG_INFO(gSceneHolderLogFilter, Debug::Verbose, "%d: Device %d: History (%.2f, %.2f)\n", timeStamp, point.GetDeviceId(), point.GetScreenPosition().x, point.GetScreenPosition().y);
+
+    // Only queued, the core events are processed by the next touch point.
+    mScene.QueueEvent(touchEvent);
+    mTouchHistoryQueued = true;
+  }
 }
 
 void SceneHolder::FeedMouseFrameEvent()
@@ -182,6 +182,18 @@ public:
    */
   void FeedTouchPoint(Dali::Integration::Point& point, int timeStamp);
 
+  /**
+   * @brief Queues a touch point which was coalesced into the next one, without processing the core events.
+   *
+   * The touch event is processed with the events of the next FeedTouchPoint(), so that the gestures
+   * (e.g. the pan prediction) see every sample. Hover points are dropped, the next point hovers anyway.
+   * @note Only the core events processing is saved: the core still hit-tests the point and emits
+   * the touch signals, as the gestures are only fed by the touch events.
+   * @param[in] point The touch point
+   * @param[in] timeStamp The time stamp
+   */
+  void FeedTouchHistoryPoint(Dali::Integration::Point& point, int timeStamp);
+
   /**
    * @copydoc Dali::Integration::SceneHolder::FeedMouseFrameEvent
    */
@@ -421,6 +433,7 @@ protected:
   bool                                               mAdaptorStarted; ///< Whether the adaptor has started or not
   bool                                               mVisible : 1;    ///< Whether the scene is visible or not
   bool                                               mHandledMultiTouch : 1;
+  bool                                               mTouchHistoryQueued : 1; ///< Whether touch history points are waiting for the core events processing
   Integration::TouchEvent                            mPreviousTouchEvent;
   Integration::HoverEvent                            mPreviousHoverEvent;
   Integration::TouchEventCombiner::EventDispatchType mPreviousType;
@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/accessibility/bridge/accessible-spatial-index.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/math/math-utils.h>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+using namespace Dali::Accessibility;
+
+namespace
+{
+const uint32_t MAXIMUM_NODES = 256u * 1024u; ///< Larger trees, or trees with cycles, are not indexed
+
+inline bool ContainsPoint(const Dali::Rect<>& extents, Point point)
+{
+  // The same test as Component::IsAccessibleContainingPoint()
+  return point.x >= extents.x && point.y >= extents.y && point.x <= extents.x + extents.width && point.y <= extents.y + extents.height;
+}
+
+inline bool HasArea(const Dali::Rect<>& extents)
+{
+  return !Dali::EqualsZero(extents.height) && !Dali::EqualsZero(extents.width);
+}
+
+} // namespace
+
+AccessibleSpatialIndex::AccessibleSpatialIndex(RegisterFunction registerFunction)
+: mRegisterFunction(std::move(registerFunction))
+{
+}
+
+void AccessibleSpatialIndex::Invalidate()
+{
+  mGrids.clear();
+  mChildren.clear();
+  mObjects.clear();
+  mExpired = false;
+}
+
+void AccessibleSpatialIndex::Remove(const Accessible* object)
+{
+  // The index may be in use by the caller of a query, it is forgotten before the next query
+  if(mObjects.find(object) != mObjects.end())
+  {
+    mExpired = true;
+  }
+}
+
+void AccessibleSpatialIndex::AddObject(const Accessible* object)
+{
+  if(mObjects.insert(object).second && mRegisterFunction)
+  {
+    mRegisterFunction(object);
+  }
+}
+
+void AccessibleSpatialIndex::CheckAge()
+{
+  const auto now = std::chrono::steady_clock::now();
+  if(mExpired || now - mBuildTime > MAXIMUM_AGE)
+  {
+    Invalidate();
+    mBuildTime = now;
+  }
+}
+
+bool AccessibleSpatialIndex::FindComponentsAtPoint(Accessible* root, Point point, CoordinateType type, uint32_t maximumDepth, std::vector<Component*>& components)
+{
+  components.clear();
+  if(!root)
+  {
+    return true;
+  }
+
+  ++mStatistics.pointQueries;
+  CheckAge();
+
+  Grid& grid = mGrids[GridKey(root, type)];
+  if(!grid.built || grid.maximumDepth != maximumDepth)
+  {
+    Build(grid, root, type, maximumDepth);
+  }
+  if(!grid.complete)
+  {
+    return false;
+  }
+
+  // The components are found in the cell of the point, and in the large components
+  mFoundIndices.clear();
+  const float column = std::floor((point.x - grid.originX) / grid.cellSize);
+  const float row    = std::floor((point.y - grid.originY) / grid.cellSize);
+  if(column >= 0.0f && row >= 0.0f && column < grid.columns && row < grid.rows)
+  {
+    const auto& cell = grid.cells[static_cast<uint32_t>(row) * grid.columns + static_cast<uint32_t>(column)];
+    mFoundIndices.insert(mFoundIndices.end(), cell.begin(), cell.end());
+  }
+  mFoundIndices.insert(mFoundIndices.end(), grid.largeNodes.begin(), grid.largeNodes.end());
+
+  // The last node in depth-first order is the first one the recursive hit-test would find
+  std::sort(mFoundIndices.begin(), mFoundIndices.end(), std::greater<uint32_t>());
+
+  for(uint32_t index : mFoundIndices)
+  {
+    const Node& node = grid.nodes[index];
+    if(!ContainsPoint(node.extents, point))
+    {
+      continue;
+    }
+
+    // The recursive hit-test doesn't look into the components not containing the point
+    bool ancestorsContainPoint = true;
+    for(int32_t parent = node.parent; parent >= 0 && ancestorsContainPoint; parent = grid.nodes[parent].parent)
+    {
+      ancestorsContainPoint = ContainsPoint(grid.nodes[parent].extents, point);
+    }
+    if(ancestorsContainPoint)
+    {
+      components.push_back(node.component);
+    }
+  }
+  return true;
+}
+
+void AccessibleSpatialIndex::Build(Grid& grid, Accessible* root, CoordinateType type, uint32_t maximumDepth)
+{
+  ++mStatistics.builds;
+
+  grid.nodes.clear();
+  grid.cells.clear();
+  grid.largeNodes.clear();
+  grid.columns      = 0u;
+  grid.rows         = 0u;
+  grid.maximumDepth = maximumDepth;
+  grid.built        = true;
+  grid.complete     = true;
+  AddObject(root);
+
+  struct StackEntry
+  {
+    Accessible* accessible;
+    int32_t     parent;
+    uint32_t    depth;
+  };
+
+  // Iterative depth-first search, a node before its children, the children in their order
+  std::vector<StackEntry> stack;
+  stack.push_back(StackEntry{root, -1, 0u});
+  uint32_t visitedCount = 0u;
+
+  float minimumX = 0.0f;
+  float minimumY = 0.0f;
+  float maximumX = 0.0f;
+  float maximumY = 0.0f;
+
+  while(!stack.empty())
+  {
+    const StackEntry entry = stack.back();
+    stack.pop_back();
+
+    if(++visitedCount > MAXIMUM_NODES)
+    {
+      DALI_LOG_ERROR("The accessible tree is too large to be indexed\n");
+      grid.nodes.clear();
+      grid.complete = false;
+      return;
+    }
+
+    int32_t parent    = entry.parent;
+    auto*   component = dynamic_cast<Component*>(entry.accessible);
+    if(component)
+    {
+      Node node;
+      node.component = component;
+      node.parent    = entry.parent;
+      node.extents   = component->GetExtents(type);
+      AddObject(entry.accessible);
+
+      if(node.extents.width >= 0.0f && node.extents.height >= 0.0f)
+      {
+        if(grid.nodes.empty())
+        {
+          minimumX = node.extents.x;
+          minimumY = node.extents.y;
+          maximumX = node.extents.x + node.extents.width;
+          maximumY = node.extents.y + node.extents.height;
+        }
+        minimumX = std::min(minimumX, node.extents.x);
+        minimumY = std::min(minimumY, node.extents.y);
+        maximumX = std::max(maximumX, node.extents.x + node.extents.width);
+        maximumY = std::max(maximumY, node.extents.y + node.extents.height);
+      }
+
+      parent = static_cast<int32_t>(grid.nodes.size());
+      grid.nodes.push_back(std::move(node));
+    }
+
+    if(entry.depth + 1u < maximumDepth)
+    {
+      auto children = entry.accessible->GetChildren();
+      for(auto childIt = children.rbegin(); childIt != children.rend(); ++childIt)
+      {
+        if(*childIt)
+        {
+          stack.push_back(StackEntry{*childIt, parent, entry.depth + 1u});
+        }
+      }
+    }
+  }
+
+  if(grid.nodes.empty())
+  {
+    return;
+  }
+
+  // The cells are larger for large roots, so the grid has a bounded size
+  const float width  = maximumX - minimumX;
+  const float height = maximumY - minimumY;
+  grid.originX       = minimumX;
+  grid.originY       = minimumY;
+  grid.cellSize      = std::max(static_cast<float>(CELL_SIZE), std::ceil(std::max(width, height) / MAXIMUM_GRID_SIZE));
+  grid.columns       = static_cast<uint32_t>(width / grid.cellSize) + 1u;
+  grid.rows          = static_cast<uint32_t>(height / grid.cellSize) + 1u;
+  grid.cells.resize(grid.columns * grid.rows);
+
+  for(uint32_t index = 0u; index < grid.nodes.size(); ++index)
+  {
+    const Dali::Rect<>& extents = grid.nodes[index].extents;
+    if(extents.width < 0.0f || extents.height < 0.0f)
+    {
+      // Contains no point
+      continue;
+    }
+
+    const uint32_t firstColumn = static_cast<uint32_t>((extents.x - grid.originX) / grid.cellSize);
+    const uint32_t firstRow    = static_cast<uint32_t>((extents.y - grid.originY) / grid.cellSize);
+    const uint32_t lastColumn  = std::min(static_cast<uint32_t>((extents.x + extents.width - grid.originX) / grid.cellSize), grid.columns - 1u);
+    const uint32_t lastRow     = std::min(static_cast<uint32_t>((extents.y + extents.height - grid.originY) / grid.cellSize), grid.rows - 1u);
+
+    if((lastColumn - firstColumn + 1u) * (lastRow - firstRow + 1u) > MAXIMUM_CELLS_PER_NODE)
+    {
+      grid.largeNodes.push_back(index);
+      continue;
+    }
+
+    for(uint32_t row = firstRow; row <= lastRow; ++row)
+    {
+      for(uint32_t column = firstColumn; column <= lastColumn; ++column)
+      {
+        grid.cells[row * grid.columns + column].push_back(index);
+      }
+    }
+  }
+}
+
+const AccessibleSpatialIndex::Children& AccessibleSpatialIndex::GetChildren(Accessible* node)
+{
+  CheckAge();
+
+  auto iter = mChildren.find(node);
+  if(iter != mChildren.end())
+  {
+    ++mStatistics.childrenHits;
+    return iter->second;
+  }
+
+  ++mStatistics.childrenMisses;
+
+  Children& entry = mChildren[node];
+  AddObject(node);
+
+  auto children    = node->GetChildren();
+  entry.firstChild = children.empty() ? nullptr : children.front();
+  for(auto child : children)
+  {
+    auto* component = dynamic_cast<Component*>(child);
+    if(component)
+    {
+      entry.components.push_back(component);
+      entry.extents.push_back(component->GetExtents(CoordinateType::WINDOW));
+    }
+    if(child)
+    {
+      AddObject(child);
+    }
+  }
+  entry.sortedComponents = SortFromTopLeft(entry.components, entry.extents);
+
+  return entry;
+}
+
+std::vector<Component*> AccessibleSpatialIndex::SortFromTopLeft(const std::vector<Component*>& components, const std::vector<Dali::Rect<>>& extents)
+{
+  std::vector<uint32_t> order(components.size());
+  for(uint32_t index = 0u; index < order.size(); ++index)
+  {
+    order[index] = index;
+  }
+
+  std::sort(order.begin(), order.end(), [&extents](uint32_t lhs, uint32_t rhs) { return extents[lhs].y < extents[rhs].y; });
+
+  // Find first with non-zero area
+  auto first = std::find_if(order.begin(), order.end(), [&extents](uint32_t index) { return HasArea(extents[index]); });
+  if(first == order.end())
+  {
+    return {};
+  }
+
+  std::vector<Component*> sortedComponents;
+  sortedComponents.reserve(components.size());
+
+  // Split into lines, and sort each line horizontally
+  auto sortLine = [&](std::vector<uint32_t>& line) {
+    std::sort(line.begin(), line.end(), [&extents](uint32_t lhs, uint32_t rhs) { return extents[lhs].x < extents[rhs].x; });
+    for(uint32_t index : line)
+    {
+      sortedComponents.push_back(components[index]);
+    }
+  };
+
+  std::vector<uint32_t> line;
+  Dali::Rect<>          lineRect = extents[*first];
+  for(auto it = first; it != order.end(); ++it)
+  {
+    const Dali::Rect<>& rect = extents[*it];
+    if(!HasArea(rect))
+    {
+      // Zero area, ignore
+      continue;
+    }
+
+    if(!(lineRect.y + (0.5 * lineRect.height) >= rect.y + (0.5 * rect.height)))
+    {
+      // Start a new line
+      sortLine(line);
+      line.clear();
+      lineRect = rect;
+    }
+    line.push_back(*it);
+  }
+  sortLine(line);
+
+  return sortedComponents;
+}
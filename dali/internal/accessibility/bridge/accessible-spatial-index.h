@@ -0,0 +1,198 @@
+#ifndef DALI_INTERNAL_ACCESSIBILITY_BRIDGE_ACCESSIBLE_SPATIAL_INDEX_H
+#define DALI_INTERNAL_ACCESSIBILITY_BRIDGE_ACCESSIBLE_SPATIAL_INDEX_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/devel-api/atspi-interfaces/accessible.h>
+#include <dali/devel-api/atspi-interfaces/component.h>
+
+/**
+ * @brief The AccessibleSpatialIndex class caches the extents of the accessible tree, for hit-testing and navigation.
+ *
+ * For hit-testing, the components below a root are put in a uniform grid, with their extents and their
+ * depth-first order, so the components at a point are found without walking the tree. Navigation gets the
+ * component children of a node, with their extents, without calling GetChildren() and GetExtents() again.
+ *
+ * The bridge doesn't get events for every change of the tree, so the index is rebuilt after any event which
+ * may move or hide objects (bounds-changed, state-changed, window events...), and after MAXIMUM_AGE anyway.
+ * The objects are held by raw pointers. Each one is given to the register function once indexed, so the bridge
+ * reports its destruction by Remove(), and the index is forgotten before its next query.
+ */
+class AccessibleSpatialIndex
+{
+public:
+  static constexpr int32_t                   CELL_SIZE              = 64;   ///< The size of a cell of the grid, in pixels
+  static constexpr uint32_t                  MAXIMUM_GRID_SIZE      = 128u; ///< The maximum number of columns and rows, the cells are larger for larger roots
+  static constexpr uint32_t                  MAXIMUM_CELLS_PER_NODE = 64u;  ///< Larger components are checked for every point instead
+  static constexpr std::chrono::milliseconds MAXIMUM_AGE{100};           ///< Changes without events are seen after this delay
+
+  /**
+   * @brief Counters, to measure how often the index is rebuilt.
+   */
+  struct Statistics
+  {
+    uint64_t builds{0u};         ///< The number of grids built
+    uint64_t pointQueries{0u};   ///< The number of calls to FindComponentsAtPoint()
+    uint64_t childrenHits{0u};   ///< The number of children found in the index
+    uint64_t childrenMisses{0u}; ///< The number of children read from the tree
+  };
+
+  /**
+   * @brief Component children of a node, with their extents in window coordinates.
+   */
+  struct Children
+  {
+    Dali::Accessibility::Accessible*             firstChild{nullptr}; ///< The first child, may not be a Component
+    std::vector<Dali::Accessibility::Component*> components;
+    std::vector<Dali::Rect<>>                    extents;
+    std::vector<Dali::Accessibility::Component*> sortedComponents; ///< The components sorted from top left
+  };
+
+  /**
+   * @brief Registers an object held by the index, so its destruction is reported by Remove().
+   * @param[in] object The object
+   */
+  using RegisterFunction = std::function<void(const Dali::Accessibility::Accessible* object)>;
+
+  /**
+   * @brief Constructor.
+   * @param[in] registerFunction Called for each object held by the index
+   */
+  explicit AccessibleSpatialIndex(RegisterFunction registerFunction = RegisterFunction());
+
+  /**
+   * @brief Forgets everything, the index is rebuilt on the next query.
+   */
+  void Invalidate();
+
+  /**
+   * @brief Forgets everything on the next query if the object is held by the index.
+   *
+   * It must be called when a registered object is destroyed, before its address can be reused by another object.
+   * @param[in] object The object
+   */
+  void Remove(const Dali::Accessibility::Accessible* object);
+
+  /**
+   * @brief Finds the components containing a point, whose component ancestors contain it too.
+   *
+   * The components are in the order the tree is hit-tested in: a depth-first search visiting the last child
+   * first, and a node after its children.
+   * @param[in] root The root of the tree
+   * @param[in] point The point
+   * @param[in] type The coordinate type of the point
+   * @param[in] maximumDepth The components at this depth below the root, and deeper, are ignored
+   * @param[out] components The components
+   * @return false if the tree cannot be indexed, and must be walked instead
+   */
+  bool FindComponentsAtPoint(Dali::Accessibility::Accessible* root, Dali::Accessibility::Point point, Dali::Accessibility::CoordinateType type, uint32_t maximumDepth, std::vector<Dali::Accessibility::Component*>& components);
+
+  /**
+   * @brief Gets the component children of a node.
+   * @param[in] node The node
+   * @return The children, valid until the next call
+   */
+  const Children& GetChildren(Dali::Accessibility::Accessible* node);
+
+  /**
+   * @brief Sorts components from top left to bottom right, line by line.
+   *
+   * The lines are made of the components overlapping the vertical center of the first one. The components with
+   * no area are ignored.
+   * @param[in] components The components
+   * @param[in] extents The extents of the components in window coordinates
+   * @return The sorted components
+   */
+  static std::vector<Dali::Accessibility::Component*> SortFromTopLeft(const std::vector<Dali::Accessibility::Component*>& components, const std::vector<Dali::Rect<>>& extents);
+
+  /**
+   * @return The counters since the index has been created
+   */
+  const Statistics& GetStatistics() const
+  {
+    return mStatistics;
+  }
+
+private:
+  struct Node
+  {
+    Dali::Accessibility::Component* component{nullptr};
+    int32_t                         parent{-1}; ///< The index of the nearest component ancestor, -1 for none
+    Dali::Rect<>                    extents;
+  };
+
+  struct Grid
+  {
+    std::vector<Node>                  nodes;      ///< In depth-first order, a node before its children
+    std::vector<std::vector<uint32_t>> cells;      ///< The indices of the nodes overlapping each cell, in increasing order
+    std::vector<uint32_t>              largeNodes; ///< Checked for every point
+    float                              originX{0.0f};
+    float                              originY{0.0f};
+    float                              cellSize{static_cast<float>(CELL_SIZE)};
+    uint32_t                           columns{0u};
+    uint32_t                           rows{0u};
+    uint32_t                           maximumDepth{0u};
+    bool                               built{false};
+    bool                               complete{false}; ///< false if the tree was too large
+  };
+
+  /**
+   * @brief Forgets everything if the index is older than MAXIMUM_AGE, or holds a destroyed object.
+   */
+  void CheckAge();
+
+  /**
+   * @brief Builds the grid of a root.
+   */
+  void Build(Grid& grid, Dali::Accessibility::Accessible* root, Dali::Accessibility::CoordinateType type, uint32_t maximumDepth);
+
+  /**
+   * @brief Holds an object, and registers it the first time.
+   */
+  void AddObject(const Dali::Accessibility::Accessible* object);
+
+  using GridKey = std::pair<Dali::Accessibility::Accessible*, Dali::Accessibility::CoordinateType>;
+
+  struct GridKeyHash
+  {
+    std::size_t operator()(const GridKey& key) const
+    {
+      return std::hash<Dali::Accessibility::Accessible*>()(key.first) ^ static_cast<std::size_t>(key.second);
+    }
+  };
+
+  RegisterFunction                                               mRegisterFunction;
+  std::unordered_map<GridKey, Grid, GridKeyHash>                 mGrids;
+  std::unordered_map<Dali::Accessibility::Accessible*, Children> mChildren;
+  std::unordered_set<const Dali::Accessibility::Accessible*>     mObjects; ///< The roots, nodes and children held by the index
+  std::vector<uint32_t>                                          mFoundIndices;
+  std::chrono::steady_clock::time_point                          mBuildTime;
+  Statistics                                                     mStatistics;
+  bool                                                           mExpired{false}; ///< Whether an object held by the index has been destroyed
+};
+
+#endif // DALI_INTERNAL_ACCESSIBILITY_BRIDGE_ACCESSIBLE_SPATIAL_INDEX_H
@@ -22,6 +22,7 @@
 #include <dali/devel-api/atspi-interfaces/accessible.h>
 #include <dali/devel-api/atspi-interfaces/socket.h>
 #include <dali/internal/accessibility/bridge/accessibility-common.h>
+#include <dali/internal/accessibility/bridge/bridge-base.h>
 
 using namespace Dali::Accessibility;
 
@@ -35,6 +36,12 @@ Accessible::~Accessible() noexcept
   if(handle)
   {
     handle->mKnownObjects.erase(this);
+
+    // Only BridgeBase registers objects, the other bridges have nothing to forget.
+    if(auto bridge = dynamic_cast<BridgeBase*>(handle->mBridge))
+    {
+      bridge->AccessibleDestroyed(this);
+    }
   }
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -41,68 +41,6 @@ using namespace Dali::Accessibility;
 
 namespace
 {
-bool SortVertically(Component* lhs, Component* rhs)
-{
-  auto leftRect  = lhs->GetExtents(CoordinateType::WINDOW);
-  auto rightRect = rhs->GetExtents(CoordinateType::WINDOW);
-
-  return leftRect.y < rightRect.y;
-}
-
-bool SortHorizontally(Component* lhs, Component* rhs)
-{
-  auto leftRect  = lhs->GetExtents(CoordinateType::WINDOW);
-  auto rightRect = rhs->GetExtents(CoordinateType::WINDOW);
-
-  return leftRect.x < rightRect.x;
-}
-
-std::vector<std::vector<Component*>> SplitLines(const std::vector<Component*>& children)
-{
-  // Find first with non-zero area
-  auto first = std::find_if(children.begin(), children.end(), [](Component* child) -> bool {
-    auto extents = child->GetExtents(CoordinateType::WINDOW);
-    return !Dali::EqualsZero(extents.height) && !Dali::EqualsZero(extents.width);
-  });
-
-  if(first == children.end())
-  {
-    return {};
-  }
-
-  std::vector<std::vector<Component*>> lines(1);
-  Dali::Rect<>                         lineRect = (*first)->GetExtents(CoordinateType::WINDOW);
-  Dali::Rect<>                         rect;
-
-  // Split into lines
-  for(auto it = first; it != children.end(); ++it)
-  {
-    auto child = *it;
-
-    rect = child->GetExtents(CoordinateType::WINDOW);
-    if(Dali::EqualsZero(rect.height) || Dali::EqualsZero(rect.width))
-    {
-      // Zero area, ignore
-      continue;
-    }
-
-    if(lineRect.y + (0.5 * lineRect.height) >= rect.y + (0.5 * rect.height))
-    {
-      // Same line
-      lines.back().push_back(child);
-    }
-    else
-    {
-      // Start a new line
-      lineRect = rect;
-      lines.emplace_back();
-      lines.back().push_back(child);
-    }
-  }
-
-  return lines;
-}
-
 static bool AcceptObjectCheckRelations(Component* obj)
 {
   auto relations = obj->GetRelationSet();
@@ -427,6 +365,37 @@ Component* BridgeAccessible::GetObjectInRelation(Accessible* obj, RelationType r
   return nullptr;
 }
 
+Component* BridgeAccessible::FindNavigableAccessibleAtPoint(Accessible* root, Point point, CoordinateType type, unsigned int maxRecursionDepth)
+{
+  std::vector<Component*> components;
+  if(!mSpatialIndex.FindComponentsAtPoint(root, point, type, maxRecursionDepth, components))
+  {
+    return CalculateNavigableAccessibleAtPoint(root, point, type, maxRecursionDepth);
+  }
+
+  for(auto component : components)
+  {
+    // The component may have moved since the index has been built
+    if(!component->IsAccessibleContainingPoint(point, type))
+    {
+      continue;
+    }
+
+    auto controledBy = GetObjectInRelation(component, RelationType::CONTROLLED_BY);
+    if(!controledBy)
+    {
+      controledBy = component;
+    }
+
+    if(controledBy->IsProxy() || IsObjectAcceptable(controledBy))
+    {
+      LOG() << "FindNavigableAccessibleAtPoint: found: " << GetComponentInfo(component);
+      return controledBy;
+    }
+  }
+  return nullptr;
+}
+
 Component* BridgeAccessible::CalculateNavigableAccessibleAtPoint(Accessible* root, Point point, CoordinateType type, unsigned int maxRecursionDepth)
 {
   if(!root || maxRecursionDepth == 0)
@@ -661,7 +630,7 @@ DBus::ValueOrError<Accessible*, uint8_t, Accessible*> BridgeAccessible::GetNavig
   y -= mData->mExtentsOffset.second;
 
   LOG() << "GetNavigableAtPoint: " << x << ", " << y << " type: " << coordinateType;
-  auto component = CalculateNavigableAccessibleAtPoint(accessible, {x, y}, cType, GET_NAVIGABLE_AT_POINT_MAX_RECURSION_DEPTH);
+  auto component = FindNavigableAccessibleAtPoint(accessible, {x, y}, cType, GET_NAVIGABLE_AT_POINT_MAX_RECURSION_DEPTH);
   bool recurse   = false;
   if(component)
   {
@@ -677,55 +646,38 @@ Accessible* BridgeAccessible::GetCurrentlyHighlighted()
   return nullptr;
 }
 
-std::vector<Component*> BridgeAccessible::GetValidChildren(const std::vector<Accessible*>& children, Accessible* start)
+std::vector<Component*> BridgeAccessible::GetSortedValidChildren(Accessible* node, Accessible* start)
 {
-  if(children.empty())
+  const auto& children = mSpatialIndex.GetChildren(node);
+  if(!children.firstChild)
   {
     return {};
   }
 
-  std::vector<Component*> vec;
-
-  Dali::Rect<> scrollableParentExtents;
-  auto         nonDuplicatedScrollableParents = GetNonDuplicatedScrollableParents(children.front(), start);
-  if(!nonDuplicatedScrollableParents.empty())
+  auto nonDuplicatedScrollableParents = GetNonDuplicatedScrollableParents(children.firstChild, start);
+  if(nonDuplicatedScrollableParents.empty())
   {
-    scrollableParentExtents = nonDuplicatedScrollableParents.front()->GetExtents(CoordinateType::WINDOW);
+    return children.sortedComponents;
   }
 
-  for(auto child : children)
+  // Only the children visible in the scrollable parent are valid
+  Dali::Rect<>              scrollableParentExtents = nonDuplicatedScrollableParents.front()->GetExtents(CoordinateType::WINDOW);
+  std::vector<Component*>   components;
+  std::vector<Dali::Rect<>> extents;
+  for(std::size_t index = 0u; index < children.components.size(); ++index)
   {
-    auto* component = dynamic_cast<Component*>(child);
-    if(component)
+    if(scrollableParentExtents.Intersects(children.extents[index]))
     {
-      if(nonDuplicatedScrollableParents.empty() || scrollableParentExtents.Intersects(component->GetExtents(CoordinateType::WINDOW)))
-      {
-        vec.push_back(component);
-      }
+      components.push_back(children.components[index]);
+      extents.push_back(children.extents[index]);
     }
   }
 
-  return vec;
-}
-
-void BridgeAccessible::SortChildrenFromTopLeft(std::vector<Dali::Accessibility::Component*>& children)
-{
-  if(children.empty())
+  if(components.size() == children.components.size())
   {
-    return;
+    return children.sortedComponents;
   }
-
-  std::vector<Component*> sortedChildren;
-
-  std::sort(children.begin(), children.end(), &SortVertically);
-
-  for(auto& line : SplitLines(children))
-  {
-    std::sort(line.begin(), line.end(), &SortHorizontally);
-    sortedChildren.insert(sortedChildren.end(), line.begin(), line.end());
-  }
-
-  children = sortedChildren;
+  return AccessibleSpatialIndex::SortFromTopLeft(components, extents);
 }
 
 template<class T>
@@ -780,8 +732,7 @@ Accessible* BridgeAccessible::GetNextNonDefunctSibling(Accessible* obj, Accessib
     return parent;
   }
 
-  auto children = GetValidChildren(parent->GetChildren(), start);
-  SortChildrenFromTopLeft(children);
+  auto children = GetSortedValidChildren(parent, start);
 
   unsigned int childrenCount = children.size();
   if(childrenCount == 0)
@@ -892,8 +843,7 @@ Accessible* BridgeAccessible::CalculateNeighbor(Accessible* root, Accessible* st
       return node;
     }
 
-    auto children = GetValidChildren(node->GetChildren(), start);
-    SortChildrenFromTopLeft(children);
+    auto children = GetSortedValidChildren(node, start);
 
     // do accept:
     // 1. not start node
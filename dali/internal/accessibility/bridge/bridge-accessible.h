@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ACCESSIBILITY_BRIDGE_ACCESSIBLE_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -247,21 +247,14 @@ private:
   Dali::Accessibility::Accessible* CalculateNeighbor(Dali::Accessibility::Accessible* root, Dali::Accessibility::Accessible* start, unsigned char forward, NeighborSearchMode searchMode);
 
   /**
-   * @brief Gets valid children accessible.
+   * @brief Gets the valid children of a node, sorted from top-left to bottom-right.
    *
-   * @param[in] children Children accessible objects
-   * @param start The start node
+   * The children and their extents are read from the spatial index.
+   * @param[in] node The node
+   * @param[in] start The start node
    * @return The valid children
    */
-  std::vector<Dali::Accessibility::Component*> GetValidChildren(const std::vector<Dali::Accessibility::Accessible*>& children, Dali::Accessibility::Accessible* start);
-
-  /**
-   * @brief Sorts children accessible based on the coordinates from top-left to bottom-right.
-   *
-   * @param[in,out] children Children accessible objects
-   * @return The sorted children
-   */
-  void SortChildrenFromTopLeft(std::vector<Dali::Accessibility::Component*>& children);
+  std::vector<Dali::Accessibility::Component*> GetSortedValidChildren(Dali::Accessibility::Accessible* node, Dali::Accessibility::Accessible* start);
 
   /**
    * @brief Gets the currently highlighted accessible.
@@ -303,6 +296,18 @@ private:
    */
   Dali::Accessibility::Component* GetObjectInRelation(Dali::Accessibility::Accessible* obj, Dali::Accessibility::RelationType relationType);
 
+  /**
+   * @brief Finds the Component object that can be navigable at given coordinates, using the spatial index.
+   *
+   * It gives the same result as CalculateNavigableAccessibleAtPoint(), which is used if the tree cannot be indexed.
+   * @param root The root node
+   * @param point The coordinate of a point
+   * @param type This type says if the coordinates of a point refer to the device screen or current window.
+   * @param maxRecursionDepth The maximum recursion depth count
+   * @return The Component object
+   */
+  Dali::Accessibility::Component* FindNavigableAccessibleAtPoint(Dali::Accessibility::Accessible* root, Dali::Accessibility::Point point, Dali::Accessibility::CoordinateType type, unsigned int maxRecursionDepth);
+
   /**
    * @brief Calculates and gets Component object that can be navigable at given coordinates.
    *
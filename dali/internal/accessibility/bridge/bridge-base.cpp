@@ -33,6 +33,13 @@ using namespace Dali::Accessibility;
 static Dali::Timer tickTimer;
 
 BridgeBase::BridgeBase()
+: mSpatialIndex([this](const Accessible* object) {
+    // So the destruction of the object is reported to the index
+    if(IsUp())
+    {
+      RegisterOnBridge(object);
+    }
+  })
 {
 }
 
@@ -176,6 +183,7 @@ void BridgeBase::ForceDown()
   Bridge::ForceDown();
   tickTimer.Reset();
   mCoalescableMessages.clear();
+  mSpatialIndex.Invalidate();
   mRegistry      = {};
   mDbusServer    = {};
   mConnectionPtr = {};
@@ -216,6 +224,7 @@ void BridgeBase::AddTopLevelWindow(Accessible* windowAccessible)
   // Adds Window to a list of Windows.
   mApplication.mChildren.push_back(windowAccessible);
   SetIsOnRootLevel(windowAccessible);
+  mSpatialIndex.Invalidate();
 }
 
 void BridgeBase::RemoveTopLevelWindow(Accessible* windowAccessible)
@@ -225,11 +234,17 @@ void BridgeBase::RemoveTopLevelWindow(Accessible* windowAccessible)
     if(mApplication.mChildren[i] == windowAccessible)
     {
       mApplication.mChildren.erase(mApplication.mChildren.begin() + i);
+      mSpatialIndex.Invalidate();
       break;
     }
   }
 }
 
+void BridgeBase::AccessibleDestroyed(const Accessible* object)
+{
+  mSpatialIndex.Remove(object);
+}
+
 void BridgeBase::CompressDefaultLabels()
 {
   // Remove entries for objects which no longer exist
@@ -34,6 +34,7 @@
 #include <dali/devel-api/atspi-interfaces/collection.h>
 #include <dali/devel-api/atspi-interfaces/socket.h>
 #include <dali/internal/accessibility/bridge/accessibility-common.h>
+#include <dali/internal/accessibility/bridge/accessible-spatial-index.h>
 
 /**
  * @brief The ApplicationAccessible class is to define Accessibility Application.
@@ -361,6 +362,16 @@ public:
    */
   void RemoveTopLevelWindow(Dali::Accessibility::Accessible* windowAccessible) override;
 
+  /**
+   * @brief Notifies that an accessible object registered on the bridge is being destroyed.
+   *
+   * The bridge must forget the pointer before another object may get the same address.
+   * It is not part of Bridge, so the exported vtable doesn't change.
+   *
+   * @param[in] object The accessible object
+   */
+  void AccessibleDestroyed(const Dali::Accessibility::Accessible* object);
+
   /**
    * @copydoc Dali::Accessibility::Bridge::RegisterDefaultLabel()
    */
@@ -621,6 +632,7 @@ protected:
   using DefaultLabelType  = std::pair<Dali::WeakHandle<Dali::Window>, std::weak_ptr<Dali::Accessibility::Accessible>>;
   using DefaultLabelsType = std::list<DefaultLabelType>;
 
+  AccessibleSpatialIndex        mSpatialIndex; ///< Invalidated by the events which may move objects, and by the destruction of its objects. Destroyed after the objects of the bridge.
   mutable ApplicationAccessible mApplication;
   DefaultLabelsType             mDefaultLabels;
   bool                          mIsScreenReaderSuppressed = false;
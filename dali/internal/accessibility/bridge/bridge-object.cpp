@@ -33,6 +33,46 @@ inline std::string GetAccessiblePath(Accessible* accessible)
   auto address = accessible->GetAddress();
   return address ? ATSPI_PREFIX_PATH + address.GetPath() : ATSPI_NULL_PATH;
 }
+
+/**
+ * @brief Whether the window event changes the geometry of the window or the objects in it, so the spatial index is out of date.
+ *
+ * Focus, stacking and rendering events don't, and POST_RENDER comes every frame.
+ */
+bool IsGeometryChanged(WindowEvent event)
+{
+  switch(event)
+  {
+    case WindowEvent::MINIMIZE:
+    case WindowEvent::MAXIMIZE:
+    case WindowEvent::RESTORE:
+    case WindowEvent::CLOSE:
+    case WindowEvent::CREATE:
+    case WindowEvent::REPARENT:
+    case WindowEvent::DESTROY:
+    case WindowEvent::MOVE:
+    case WindowEvent::RESIZE:
+    case WindowEvent::SHADE:
+    case WindowEvent::UU_SHADE:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief Whether the state changes which objects can be found at a point, so the spatial index is out of date.
+ *
+ * HIGHLIGHTED, FOCUSED and SELECTED change on every navigation step, and don't.
+ */
+bool IsGeometryChanged(State state)
+{
+  return state == State::SHOWING || state == State::VISIBLE || state == State::DEFUNCT;
+}
 } // namespace
 
 BridgeObject::BridgeObject()
@@ -76,6 +116,12 @@ void BridgeObject::Emit(std::shared_ptr<Accessible> obj, ObjectPropertyChangeEve
     {ObjectPropertyChangeEvent::ROLE, "accessible-role"},
   };
 
+  // The tree has changed, even if the event isn't sent
+  if(event == ObjectPropertyChangeEvent::PARENT)
+  {
+    mSpatialIndex.Invalidate();
+  }
+
   if(!IsUp() || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::PROPERTY_CHANGED])
   {
     return;
@@ -127,6 +173,11 @@ void BridgeObject::Emit(Accessible* obj, WindowEvent event, unsigned int detail)
     {WindowEvent::POST_RENDER, "PostRender"},
   };
 
+  if(IsGeometryChanged(event))
+  {
+    mSpatialIndex.Invalidate();
+  }
+
   if(!IsUp() || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::WINDOW_CHANGED])
   {
     return;
@@ -199,6 +250,11 @@ void BridgeObject::EmitStateChanged(std::shared_ptr<Accessible> obj, State state
     {State::HIGHLIGHTABLE, "highlightable"},
   };
 
+  if(IsGeometryChanged(state))
+  {
+    mSpatialIndex.Invalidate();
+  }
+
   if(!IsUp() || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::STATE_CHANGED]) // separate ?
   {
     return;
@@ -227,6 +283,8 @@ void BridgeObject::EmitStateChanged(std::shared_ptr<Accessible> obj, State state
 
 void BridgeObject::EmitBoundsChanged(std::shared_ptr<Accessible> obj, Dali::Rect<> rect)
 {
+  mSpatialIndex.Invalidate();
+
   if(!IsUp() || !IsBoundsChangedEventAllowed || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::BOUNDS_CHANGED])
   {
     return;
@@ -314,6 +372,8 @@ void BridgeObject::EmitTextChanged(Accessible* obj, TextChangedState state, unsi
 
 void BridgeObject::EmitMovedOutOfScreen(Accessible* obj, ScreenRelativeMoveType type)
 {
+  mSpatialIndex.Invalidate();
+
   if(!IsUp() || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::MOVED_OUT])
   {
     return;
@@ -347,6 +407,8 @@ void BridgeObject::EmitSocketAvailable(Accessible* obj)
 
 void BridgeObject::EmitScrollStarted(Accessible* obj)
 {
+  mSpatialIndex.Invalidate();
+
   if(!IsUp() || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::SCROLL_STARTED])
   {
     return;
@@ -365,6 +427,8 @@ void BridgeObject::EmitScrollStarted(Accessible* obj)
 
 void BridgeObject::EmitScrollFinished(Accessible* obj)
 {
+  mSpatialIndex.Invalidate();
+
   if(!IsUp() || obj->IsHidden() || obj->GetSuppressedEvents()[AtspiEvent::SCROLL_FINISHED])
   {
     return;
@@ -675,6 +675,7 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     // Upload requested resources after resource context activated.
     graphics.ActivateResourceContext();
 
+    // Start the upload budget of the frame.
     const bool textureUploaded = mTextureUploadManager.ResourceUpload();
 
     // Update & Render forcely if there exist some uploaded texture.
@@ -762,7 +763,8 @@ void CombinedUpdateRenderController::UpdateRenderThread()
     graphics.ActivateResourceContext();
 
     // Since uploadOnly value used at Update side, we should not change uploadOnly value now even some textures are uploaded.
-    mTextureUploadManager.ResourceUpload();
+    // Share the upload budget of the phase #1.
+    GetImplementation(mTextureUploadManager).ContinueResourceUpload();
 
     if(mFirstFrameAfterResume)
     {
@@ -133,8 +133,10 @@ DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_EGL, false);
 } // namespace
 
 EglGraphicsController::EglGraphicsController()
-: mTextureDependencyChecker(*this),
-  mSyncPool(*this)
+: mProgramBinaryCache(*this),
+  mTextureDependencyChecker(*this),
+  mSyncPool(*this),
+  mPixelUnpackBufferRing(*this)
 {
 }
 
@@ -232,6 +234,7 @@ void EglGraphicsController::ResolvePresentRenderTarget(GLES::RenderTarget* rende
 void EglGraphicsController::PostRender()
 {
   mTextureDependencyChecker.Reset();
+  mPixelUnpackBufferRing.Recycle();
   mSyncPool.AgeSyncObjects();
 }
 
@@ -752,162 +755,291 @@ void EglGraphicsController::ProcessTextureUpdateQueue()
     return;
   }
   DALI_TRACE_SCOPE(gTraceFilter, "DALI_EGL_CONTROLLER_TEXTURE_UPDATE");
-  while(!mTextureUpdateRequests.empty())
+
+  // The source of each upload, and where it is staged
+  struct TextureUpload
+  {
+    GLES::Texture* texture{nullptr};
+    uint8_t*       sourceBuffer{nullptr};
+    uint32_t       sourceSize{0u};
+    uint32_t       stagingOffset{0u};
+    uint32_t       stagingWriteIndex{0u};
+    bool           sourceBufferReleaseRequired{false};
+    bool           isSubImage{false};
+    bool           requiresConverting{false};
+    bool           staged{false};
+    bool           stagedConverted{false}; ///< Whether the staged pixels are converted to the texture format
+  };
+  std::vector<TextureUpload> uploads(mTextureUpdateRequests.size());
+
+  std::vector<GLES::PixelUnpackBufferRing::Write> stagingWrites;
+  uint32_t                                        stagingSize     = 0u;
+  uint32_t                                        unstagedUploads = 0u;
+  const bool                                      stagingEnabled  = GetGLESVersion() >= GLES::GLESVersion::GLES_30;
+
+  for(uint32_t index = 0u; index < mTextureUpdateRequests.size(); ++index)
   {
-    TextureUpdateRequest& request = mTextureUpdateRequests.front();
+    auto& info   = mTextureUpdateRequests[index].first;
+    auto& source = mTextureUpdateRequests[index].second;
+    auto& upload = uploads[index];
+
+    if(source.sourceType != Graphics::TextureUpdateSourceInfo::Type::MEMORY &&
+       source.sourceType != Graphics::TextureUpdateSourceInfo::Type::PIXEL_DATA)
+    {
+      // TODO: other sources
+      continue;
+    }
+
+    // GPU memory must be already allocated.
+    upload.texture         = static_cast<GLES::Texture*>(info.dstTexture);
+    const auto& createInfo = upload.texture->GetCreateInfo();
 
-    auto& info   = request.first;
-    auto& source = request.second;
+    // From render-texture.cpp
+    upload.isSubImage = (info.dstOffset2D.x != 0 || info.dstOffset2D.y != 0 ||
+                         info.srcExtent2D.width != (createInfo.size.width / (1 << info.level)) ||
+                         info.srcExtent2D.height != (createInfo.size.height / (1 << info.level)));
 
-    switch(source.sourceType)
+    if(source.sourceType == Graphics::TextureUpdateSourceInfo::Type::MEMORY)
     {
-      case Graphics::TextureUpdateSourceInfo::Type::MEMORY:
-      case Graphics::TextureUpdateSourceInfo::Type::PIXEL_DATA:
+      upload.sourceBuffer                = reinterpret_cast<uint8_t*>(source.memorySource.memory);
+      upload.sourceSize                  = info.srcSize;
+      upload.sourceBufferReleaseRequired = true;
+    }
+    else
+    {
+      Dali::Integration::PixelDataBuffer pixelBufferData = Dali::Integration::GetPixelDataBuffer(source.pixelDataSource.pixelData);
+
+      upload.sourceBuffer                = pixelBufferData.buffer + info.srcOffset;
+      upload.sourceSize                  = std::min(info.srcSize, pixelBufferData.bufferSize - std::min(info.srcOffset, pixelBufferData.bufferSize));
+      upload.sourceBufferReleaseRequired = Dali::Integration::IsPixelDataReleaseAfterUpload(source.pixelDataSource.pixelData) && info.srcOffset == 0u;
+    }
+
+    // Skip texture upload if given texture is already discarded for this render loop.
+    if(upload.sourceBuffer == nullptr || mDiscardTextureSet.find(upload.texture) != mDiscardTextureSet.end())
+    {
+      upload.texture = nullptr;
+      continue;
+    }
+
+    // Check if it needs conversion
+    upload.requiresConverting = mGlAbstraction->TextureRequiresConverting(GLES::GLTextureFormatType(info.srcFormat).format,
+                                                                          GLES::GLTextureFormatType(createInfo.format).format,
+                                                                          upload.isSubImage);
+
+    if(stagingEnabled && !upload.texture->IsCompressed())
+    {
+      GLES::PixelUnpackBufferRing::Write write;
+      write.source     = upload.sourceBuffer;
+      write.sourceSize = upload.sourceSize;
+      write.size       = upload.sourceSize;
+      if(upload.requiresConverting)
       {
-        // GPU memory must be already allocated.
-
-        // Check if it needs conversion
-        auto*       texture            = static_cast<GLES::Texture*>(info.dstTexture);
-        const auto& createInfo         = texture->GetCreateInfo();
-        auto        srcFormat          = GLES::GLTextureFormatType(info.srcFormat).format;
-        auto        srcType            = GLES::GLTextureFormatType(info.srcFormat).type;
-        auto        destInternalFormat = GLES::GLTextureFormatType(createInfo.format).internalFormat;
-        auto        destFormat         = GLES::GLTextureFormatType(createInfo.format).format;
-
-        // From render-texture.cpp
-        const bool isSubImage(info.dstOffset2D.x != 0 || info.dstOffset2D.y != 0 ||
-                              info.srcExtent2D.width != (createInfo.size.width / (1 << info.level)) ||
-                              info.srcExtent2D.height != (createInfo.size.height / (1 << info.level)));
-
-        uint8_t* sourceBuffer                = nullptr;
-        bool     sourceBufferReleaseRequired = false;
-        if(source.sourceType == Graphics::TextureUpdateSourceInfo::Type::MEMORY)
+        const uint32_t convertedSize = upload.texture->GetConvertedPixelDataSize(info.srcFormat, createInfo.format, info.srcExtent2D.width, info.srcExtent2D.height);
+        if(convertedSize > 0u)
         {
-          sourceBuffer                = reinterpret_cast<uint8_t*>(source.memorySource.memory);
-          sourceBufferReleaseRequired = true;
+          write.size         = convertedSize;
+          write.texture      = upload.texture;
+          write.sourceFormat = info.srcFormat;
+          write.destFormat   = createInfo.format;
+          write.sourceStride = info.srcStride;
+          write.width        = info.srcExtent2D.width;
+          write.height       = info.srcExtent2D.height;
+        }
+      }
+
+      // Larger batches than a buffer are partly uploaded from CPU memory.
+      const uint32_t alignedSize = (write.size + GLES::PixelUnpackBufferRing::ALIGNMENT - 1u) & ~(GLES::PixelUnpackBufferRing::ALIGNMENT - 1u);
+      if(write.size > 0u && alignedSize <= GLES::PixelUnpackBufferRing::MAXIMUM_BUFFER_SIZE - stagingSize)
+      {
+        write.offset             = stagingSize;
+        upload.stagingOffset     = stagingSize;
+        upload.stagingWriteIndex = static_cast<uint32_t>(stagingWrites.size());
+        upload.staged            = true;
+        upload.stagedConverted   = (write.texture != nullptr);
+        stagingSize += alignedSize;
+        stagingWrites.push_back(write);
+      }
+      else
+      {
+        ++unstagedUploads;
+      }
+    }
+  }
+
+  // On GLES3 the pixels are written into a pixel unpack buffer first, by the worker threads,
+  // so the uploads below only read GPU memory.
+  bool     staging       = false;
+  uint32_t stagedUploads = 0u;
+  if(!stagingWrites.empty())
+  {
+    uint8_t* stagingMemory = mPixelUnpackBufferRing.Map(stagingSize);
+    if(stagingMemory)
+    {
+      mPixelUnpackBufferRing.Fill(stagingMemory, stagingWrites);
+      staging = mPixelUnpackBufferRing.Unmap();
+    }
+    if(staging)
+    {
+      // The pixels which couldn't be converted are uploaded from CPU memory.
+      for(uint32_t index = 0u; index < stagingWrites.size(); ++index)
+      {
+        if(mPixelUnpackBufferRing.IsWritten(index))
+        {
+          ++stagedUploads;
         }
         else
         {
-          Dali::Integration::PixelDataBuffer pixelBufferData = Dali::Integration::GetPixelDataBuffer(source.pixelDataSource.pixelData);
-
-          sourceBuffer                = pixelBufferData.buffer + info.srcOffset;
-          sourceBufferReleaseRequired = Dali::Integration::IsPixelDataReleaseAfterUpload(source.pixelDataSource.pixelData) && info.srcOffset == 0u;
+          ++unstagedUploads;
         }
+      }
+    }
+    else
+    {
+      unstagedUploads += stagingWrites.size();
+    }
+  }
+  mPixelUnpackBufferRing.AddFallbackUploads(unstagedUploads);
 
-        // Skip texture upload if given texture is already discarded for this render loop.
-        if(mDiscardTextureSet.find(texture) == mDiscardTextureSet.end())
-        {
-          auto                 sourceStride = info.srcStride;
-          std::vector<uint8_t> tempBuffer;
+  for(uint32_t index = 0u; index < mTextureUpdateRequests.size(); ++index)
+  {
+    auto& info   = mTextureUpdateRequests[index].first;
+    auto& source = mTextureUpdateRequests[index].second;
+    auto& upload = uploads[index];
+
+    if(upload.texture)
+    {
+      auto*       texture            = upload.texture;
+      const auto& createInfo         = texture->GetCreateInfo();
+      auto        srcFormat          = GLES::GLTextureFormatType(info.srcFormat).format;
+      auto        srcType            = GLES::GLTextureFormatType(info.srcFormat).type;
+      auto        destInternalFormat = GLES::GLTextureFormatType(createInfo.format).internalFormat;
+      auto        destFormat         = GLES::GLTextureFormatType(createInfo.format).format;
 
-          uint8_t* srcBuffer = sourceBuffer;
+      auto                 sourceStride = info.srcStride;
+      std::vector<uint8_t> tempBuffer;
 
-          if(mGlAbstraction->TextureRequiresConverting(srcFormat, destFormat, isSubImage))
+      uint8_t* srcBuffer = upload.sourceBuffer;
+
+      if(staging && upload.staged && mPixelUnpackBufferRing.IsWritten(upload.stagingWriteIndex))
+      {
+        // Read from the pixel unpack buffer, the pointer is an offset.
+        mPixelUnpackBufferRing.Bind();
+        srcBuffer = reinterpret_cast<uint8_t*>(static_cast<uintptr_t>(upload.stagingOffset));
+        if(upload.stagedConverted)
+        {
+          sourceStride = 0u; // Converted buffer compacted. make stride as 0.
+          srcFormat    = destFormat;
+          srcType      = GLES::GLTextureFormatType(createInfo.format).type;
+        }
+      }
+      else
+      {
+        mPixelUnpackBufferRing.Unbind();
+        if(upload.requiresConverting)
+        {
+          // Convert RGB to RGBA if necessary.
+          if(texture->TryConvertPixelData(upload.sourceBuffer, info.srcFormat, createInfo.format, info.srcSize, info.srcStride, info.srcExtent2D.width, info.srcExtent2D.height, tempBuffer))
           {
-            // Convert RGB to RGBA if necessary.
-            if(texture->TryConvertPixelData(sourceBuffer, info.srcFormat, createInfo.format, info.srcSize, info.srcStride, info.srcExtent2D.width, info.srcExtent2D.height, tempBuffer))
-            {
-              srcBuffer    = &tempBuffer[0];
-              sourceStride = 0u; // Converted buffer compacted. make stride as 0.
-              srcFormat    = destFormat;
-              srcType      = GLES::GLTextureFormatType(createInfo.format).type;
-            }
+            srcBuffer    = &tempBuffer[0];
+            sourceStride = 0u; // Converted buffer compacted. make stride as 0.
+            srcFormat    = destFormat;
+            srcType      = GLES::GLTextureFormatType(createInfo.format).type;
           }
+        }
+      }
 
-          // Calculate the maximum mipmap level for the texture
-          texture->SetMaxMipMapLevel(std::max(texture->GetMaxMipMapLevel(), info.level));
+      // Calculate the maximum mipmap level for the texture
+      texture->SetMaxMipMapLevel(std::max(texture->GetMaxMipMapLevel(), info.level));
 
-          GLenum bindTarget{GL_TEXTURE_2D};
-          GLenum target{GL_TEXTURE_2D};
+      GLenum bindTarget{GL_TEXTURE_2D};
+      GLenum target{GL_TEXTURE_2D};
 
-          if(createInfo.textureType == Graphics::TextureType::TEXTURE_CUBEMAP)
-          {
-            bindTarget = GL_TEXTURE_CUBE_MAP;
-            target     = GL_TEXTURE_CUBE_MAP_POSITIVE_X + info.layer;
-          }
+      if(createInfo.textureType == Graphics::TextureType::TEXTURE_CUBEMAP)
+      {
+        bindTarget = GL_TEXTURE_CUBE_MAP;
+        target     = GL_TEXTURE_CUBE_MAP_POSITIVE_X + info.layer;
+      }
 
-          mGlAbstraction->PixelStorei(GL_UNPACK_ALIGNMENT, 1);
-          mGlAbstraction->PixelStorei(GL_UNPACK_ROW_LENGTH, sourceStride);
+      mGlAbstraction->PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+      mGlAbstraction->PixelStorei(GL_UNPACK_ROW_LENGTH, sourceStride);
 
-          mCurrentContext->BindTexture(bindTarget, texture->GetTextureTypeId(), texture->GetGLTexture());
+      mCurrentContext->BindTexture(bindTarget, texture->GetTextureTypeId(), texture->GetGLTexture());
 
-          if(!isSubImage)
-          {
-            if(!texture->IsCompressed())
-            {
-              mGlAbstraction->TexImage2D(target,
-                                         info.level,
-                                         destInternalFormat,
-                                         info.srcExtent2D.width,
-                                         info.srcExtent2D.height,
-                                         0,
-                                         srcFormat,
-                                         srcType,
-                                         srcBuffer);
-            }
-            else
-            {
-              mGlAbstraction->CompressedTexImage2D(target,
-                                                   info.level,
-                                                   destInternalFormat,
-                                                   info.srcExtent2D.width,
-                                                   info.srcExtent2D.height,
-                                                   0,
-                                                   info.srcSize,
-                                                   srcBuffer);
-            }
-          }
-          else
-          {
-            if(!texture->IsCompressed())
-            {
-              mGlAbstraction->TexSubImage2D(target,
-                                            info.level,
-                                            info.dstOffset2D.x,
-                                            info.dstOffset2D.y,
-                                            info.srcExtent2D.width,
-                                            info.srcExtent2D.height,
-                                            srcFormat,
-                                            srcType,
-                                            srcBuffer);
-            }
-            else
-            {
-              mGlAbstraction->CompressedTexSubImage2D(target,
-                                                      info.level,
-                                                      info.dstOffset2D.x,
-                                                      info.dstOffset2D.y,
-                                                      info.srcExtent2D.width,
-                                                      info.srcExtent2D.height,
-                                                      srcFormat,
-                                                      info.srcSize,
-                                                      srcBuffer);
-            }
-          }
+      if(!upload.isSubImage)
+      {
+        if(!texture->IsCompressed())
+        {
+          mGlAbstraction->TexImage2D(target,
+                                     info.level,
+                                     destInternalFormat,
+                                     info.srcExtent2D.width,
+                                     info.srcExtent2D.height,
+                                     0,
+                                     srcFormat,
+                                     srcType,
+                                     srcBuffer);
         }
-
-        if(sourceBufferReleaseRequired && sourceBuffer != nullptr)
+        else
         {
-          if(source.sourceType == Graphics::TextureUpdateSourceInfo::Type::MEMORY)
-          {
-            free(reinterpret_cast<void*>(sourceBuffer));
-          }
-          else
-          {
-            Dali::Integration::ReleasePixelDataBuffer(source.pixelDataSource.pixelData);
-          }
+          mGlAbstraction->CompressedTexImage2D(target,
+                                               info.level,
+                                               destInternalFormat,
+                                               info.srcExtent2D.width,
+                                               info.srcExtent2D.height,
+                                               0,
+                                               info.srcSize,
+                                               srcBuffer);
         }
-        break;
       }
-      default:
+      else
       {
-        // TODO: other sources
-        break;
+        if(!texture->IsCompressed())
+        {
+          mGlAbstraction->TexSubImage2D(target,
+                                        info.level,
+                                        info.dstOffset2D.x,
+                                        info.dstOffset2D.y,
+                                        info.srcExtent2D.width,
+                                        info.srcExtent2D.height,
+                                        srcFormat,
+                                        srcType,
+                                        srcBuffer);
+        }
+        else
+        {
+          mGlAbstraction->CompressedTexSubImage2D(target,
+                                                  info.level,
+                                                  info.dstOffset2D.x,
+                                                  info.dstOffset2D.y,
+                                                  info.srcExtent2D.width,
+                                                  info.srcExtent2D.height,
+                                                  srcFormat,
+                                                  info.srcSize,
+                                                  srcBuffer);
+        }
       }
     }
 
-    mTextureUpdateRequests.pop();
+    if(upload.sourceBufferReleaseRequired && upload.sourceBuffer != nullptr)
+    {
+      if(source.sourceType == Graphics::TextureUpdateSourceInfo::Type::MEMORY)
+      {
+        free(reinterpret_cast<void*>(upload.sourceBuffer));
+      }
+      else
+      {
+        Dali::Integration::ReleasePixelDataBuffer(source.pixelDataSource.pixelData);
+      }
+    }
   }
+
+  if(staging)
+  {
+    // The buffer is reused once the GPU has read it.
+    mPixelUnpackBufferRing.Submit(mCurrentContext, stagedUploads, stagingSize);
+  }
+
+  mTextureUpdateRequests.clear();
 }
 
 void EglGraphicsController::UpdateTextures(const std::vector<TextureUpdateInfo>&       updateInfoList,
@@ -916,7 +1048,7 @@ void EglGraphicsController::UpdateTextures(const std::vector<TextureUpdateInfo>&
   // Store updates
   for(auto& info : updateInfoList)
   {
-    mTextureUpdateRequests.push(std::make_pair(info, sourceList[info.srcReference]));
+    mTextureUpdateRequests.push_back(std::make_pair(info, sourceList[info.srcReference]));
     auto& pair = mTextureUpdateRequests.back();
     switch(pair.second.sourceType)
     {
@@ -926,8 +1058,7 @@ void EglGraphicsController::UpdateTextures(const std::vector<TextureUpdateInfo>&
         auto& source = pair.second;
 
         // allocate staging memory and copy the data
-        // TODO: using PBO with GLES3, this is just naive
-        // oldschool way
+        // On GLES3, it's written into a pixel unpack buffer when the queue is processed
 
         uint8_t* stagingBuffer = reinterpret_cast<uint8_t*>(malloc(info.srcSize));
 
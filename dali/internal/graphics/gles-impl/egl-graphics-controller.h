@@ -38,6 +38,8 @@
 #include <dali/internal/graphics/gles-impl/gles-graphics-shader.h>
 #include <dali/internal/graphics/gles-impl/gles-graphics-texture.h>
 #include <dali/internal/graphics/gles-impl/gles-graphics-types.h>
+#include <dali/internal/graphics/gles-impl/gles-pixel-unpack-buffer-ring.h>
+#include <dali/internal/graphics/gles-impl/gles-program-binary-cache.h>
 #include <dali/internal/graphics/gles-impl/gles-sync-pool.h>
 #include <dali/internal/graphics/gles-impl/gles-texture-dependency-checker.h>
 #include <dali/internal/graphics/gles-impl/gles2-graphics-memory.h>
@@ -719,6 +721,16 @@ public:
    */
   [[nodiscard]] GLES::PipelineCache& GetPipelineCache() const;
 
+  /**
+   * @brief Returns program binary cache object
+   *
+   * @return Valid program binary cache object
+   */
+  GLES::ProgramBinaryCache& GetProgramBinaryCache()
+  {
+    return mProgramBinaryCache;
+  }
+
   /**
    * @brief Returns runtime supported GLES version
    *
@@ -843,6 +855,14 @@ public:
     return mSyncPool;
   }
 
+  /**
+   * @brief Returns the ring of buffers staging the texture uploads
+   */
+  const GLES::PixelUnpackBufferRing& GetPixelUnpackBufferRing() const
+  {
+    return mPixelUnpackBufferRing;
+  }
+
   std::size_t GetCapacity() const
   {
     return mCapacity;
@@ -874,7 +894,7 @@ private:
   std::queue<GLES::CommandBuffer*> mCommandQueue; ///< we may have more in the future
 
   using TextureUpdateRequest = std::pair<TextureUpdateInfo, TextureUpdateSourceInfo>;
-  std::queue<TextureUpdateRequest> mTextureUpdateRequests;
+  std::vector<TextureUpdateRequest> mTextureUpdateRequests; ///< Processed in order, in a batch
 
   std::unordered_map<uint32_t, Graphics::UniquePtr<Graphics::Texture>> mExternalTextureResources; ///< Used for ResourceId.
 
@@ -886,6 +906,7 @@ private:
   std::vector<SurfaceContextPair> mSurfaceContexts; ///< Vector of surface context objects handling command buffers execution
 
   std::unique_ptr<GLES::PipelineCache> mPipelineCache{nullptr}; ///< Internal pipeline cache
+  GLES::ProgramBinaryCache             mProgramBinaryCache;      ///< On-disk cache of linked program binaries
 
   GLES::GLESVersion mGLESVersion{GLES::GLESVersion::GLES_20}; ///< Runtime supported GLES version
   uint32_t          mTextureUploadTotalCPUMemoryUsed{0u};
@@ -898,7 +919,8 @@ private:
 
   GLES::TextureDependencyChecker mTextureDependencyChecker; // Checks if FBO textures need syncing
   GLES::SyncPool                 mSyncPool;
-  std::size_t                    mCapacity{0u}; ///< Memory Usage (of command buffers)
+  GLES::PixelUnpackBufferRing    mPixelUnpackBufferRing; ///< Stages the texture uploads on GLES3, must be destroyed before the sync pool
+  std::size_t                    mCapacity{0u};          ///< Memory Usage (of command buffers)
 };
 
 } // namespace Graphics
@@ -789,9 +789,10 @@ void Context::ResolveStandaloneUniforms()
 
   if(program)
   {
-    const auto ptr = reinterpret_cast<const char*>(mImpl->mCurrentStandaloneUBOBinding.buffer->GetCPUAllocatedAddress()) + mImpl->mCurrentStandaloneUBOBinding.offset;
+    const auto buffer = mImpl->mCurrentStandaloneUBOBinding.buffer;
+    const auto ptr    = reinterpret_cast<const char*>(buffer->GetCPUAllocatedAddress()) + mImpl->mCurrentStandaloneUBOBinding.offset;
     // Update program uniforms
-    program->GetImplementation()->UpdateStandaloneUniformBlock(ptr);
+    program->GetImplementation()->UpdateStandaloneUniformBlock(ptr, buffer->GetWriteGeneration());
   }
 }
 
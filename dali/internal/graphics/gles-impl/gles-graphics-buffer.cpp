@@ -21,12 +21,18 @@
 // EXTERNAL INCLUDES
 #include <dali/integration-api/gl-abstraction.h>
 #include <dali/integration-api/gl-defines.h>
+#include <atomic>
 
 // INTERNAL INCLUDES
 #include "egl-graphics-controller.h"
 
 namespace Dali::Graphics::GLES
 {
+namespace
+{
+std::atomic<uint64_t> gWriteGeneration{0u}; ///< Shared by all the buffers, so memory reused by another buffer never looks unchanged
+} // namespace
+
 Buffer::Buffer(const Graphics::BufferCreateInfo& createInfo, Graphics::EglGraphicsController& controller)
 : BufferResource(createInfo, controller)
 {
@@ -121,6 +127,12 @@ void Buffer::InitializeCPUBuffer()
       DALI_LOG_ERROR("malloc is failed. request malloc size : %u\n", mCreateInfo.size);
     }
   }
+  MarkWritten();
+}
+
+void Buffer::MarkWritten()
+{
+  mWriteGeneration = gWriteGeneration.fetch_add(1u, std::memory_order_relaxed) + 1u;
 }
 
 void Buffer::InitializeGPUBuffer()
@@ -78,6 +78,22 @@ public:
     return mCpuAllocated;
   }
 
+  /**
+   * @brief Gives a new write generation to the CPU allocated memory.
+   *
+   * Called whenever the memory is mapped or unmapped, so the standalone
+   * uniforms read from a block not written since they were applied can be skipped.
+   */
+  void MarkWritten();
+
+  /**
+   * @return The write generation, unique among all the buffers
+   */
+  [[nodiscard]] uint64_t GetWriteGeneration() const
+  {
+    return mWriteGeneration;
+  }
+
 private:
   void InitializeCPUBuffer();
 
@@ -85,6 +101,7 @@ private:
 
   uint32_t mBufferId{};
   void*    mBufferPtr{nullptr}; // CPU allocated memory
+  uint64_t mWriteGeneration{0u};
   bool     mCpuAllocated{false};
   bool     mTransient{false};
 
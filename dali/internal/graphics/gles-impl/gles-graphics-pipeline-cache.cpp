@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -17,6 +17,8 @@
 
 #include "gles-graphics-pipeline-cache.h"
 #include <algorithm>
+#include <functional>
+#include <unordered_map>
 #include "egl-graphics-controller.h"
 #include "gles-graphics-pipeline.h"
 #include "gles-graphics-program.h"
@@ -242,6 +244,113 @@ inline uint32_t GetStateBitmask(const PipelineCreateInfo& info)
   return mask;
 }
 
+/**
+ * @brief Helper function mixing a value into the hash seed
+ */
+template<typename T>
+inline void HashCombine(std::size_t& seed, const T& value)
+{
+  seed ^= std::hash<T>{}(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/**
+ * @brief Helper function calculating the hash of the pipeline create info
+ *
+ * Only the program identity and the discrete fields of the set states are hashed.
+ * Floating point fields (viewport, scissor and blend constants) are compared with
+ * an epsilon so they can't contribute to the hash; they are still checked by the
+ * full state compare when the hash matches.
+ *
+ * @param[in] info Valid PipelineCreateInfo structure
+ * @param[in] bitmask bitmask of set states
+ * @return hash value of the create info
+ */
+std::size_t CalculatePipelineHash(const PipelineCreateInfo& info, uint32_t bitmask)
+{
+  std::size_t seed{0u};
+
+  const GLES::ProgramImpl* programImpl = nullptr;
+  if(info.programState && info.programState->program)
+  {
+    programImpl = static_cast<const GLES::Program*>(info.programState->program)->GetImplementation();
+  }
+  HashCombine(seed, static_cast<const void*>(programImpl));
+  HashCombine(seed, bitmask);
+
+  if(info.colorBlendState)
+  {
+    const auto& cb = *info.colorBlendState;
+    HashCombine(seed, cb.logicOpEnable);
+    HashCombine(seed, uint32_t(cb.logicOp));
+    HashCombine(seed, cb.blendEnable);
+    HashCombine(seed, uint32_t(cb.srcColorBlendFactor));
+    HashCombine(seed, uint32_t(cb.dstColorBlendFactor));
+    HashCombine(seed, uint32_t(cb.colorBlendOp));
+    HashCombine(seed, uint32_t(cb.srcAlphaBlendFactor));
+    HashCombine(seed, uint32_t(cb.dstAlphaBlendFactor));
+    HashCombine(seed, uint32_t(cb.alphaBlendOp));
+    HashCombine(seed, uint32_t(cb.colorComponentWriteBits));
+  }
+  if(info.viewportState)
+  {
+    HashCombine(seed, info.viewportState->scissorTestEnable);
+  }
+  if(info.basePipeline)
+  {
+    HashCombine(seed, static_cast<const void*>(info.basePipeline));
+  }
+  if(info.depthStencilState)
+  {
+    const auto& ds = *info.depthStencilState;
+    HashCombine(seed, ds.depthTestEnable);
+    HashCombine(seed, ds.depthWriteEnable);
+    HashCombine(seed, uint32_t(ds.depthCompareOp));
+    HashCombine(seed, ds.stencilTestEnable);
+    for(const auto* op : {&ds.front, &ds.back})
+    {
+      HashCombine(seed, uint32_t(op->failOp));
+      HashCombine(seed, uint32_t(op->passOp));
+      HashCombine(seed, uint32_t(op->depthFailOp));
+      HashCombine(seed, uint32_t(op->compareOp));
+      HashCombine(seed, uint32_t(op->compareMask));
+      HashCombine(seed, uint32_t(op->writeMask));
+      HashCombine(seed, uint32_t(op->reference));
+    }
+  }
+  if(info.rasterizationState)
+  {
+    const auto& rs = *info.rasterizationState;
+    HashCombine(seed, uint32_t(rs.cullMode));
+    HashCombine(seed, uint32_t(rs.polygonMode));
+    HashCombine(seed, uint32_t(rs.frontFace));
+  }
+  if(info.vertexInputState)
+  {
+    const auto& vi = *info.vertexInputState;
+    HashCombine(seed, vi.bufferBindings.size());
+    for(const auto& binding : vi.bufferBindings)
+    {
+      HashCombine(seed, uint32_t(binding.stride));
+      HashCombine(seed, uint32_t(binding.inputRate));
+    }
+    HashCombine(seed, vi.attributes.size());
+    for(const auto& attribute : vi.attributes)
+    {
+      HashCombine(seed, uint32_t(attribute.location));
+      HashCombine(seed, uint32_t(attribute.binding));
+      HashCombine(seed, uint32_t(attribute.offset));
+      HashCombine(seed, uint32_t(attribute.format));
+    }
+  }
+  if(info.inputAssemblyState)
+  {
+    const auto& ia = *info.inputAssemblyState;
+    HashCombine(seed, uint32_t(ia.topology));
+    HashCombine(seed, ia.primitiveRestartEnable);
+  }
+  return seed;
+}
+
 /**
  * @brief Implementation of cache
  */
@@ -267,6 +376,7 @@ struct PipelineCache::Impl
   ~Impl()
   {
     // First destroy pipelines
+    pipelineIndex.clear();
     entries.clear();
 
     // Now programs
@@ -280,9 +390,10 @@ struct PipelineCache::Impl
   {
     CacheEntry() = default;
 
-    CacheEntry(UniquePtr<PipelineImpl>&& _pipeline, uint32_t _bitmask)
+    CacheEntry(UniquePtr<PipelineImpl>&& _pipeline, uint32_t _bitmask, std::size_t _hash)
     : pipeline(std::move(_pipeline)),
-      stateBitmask(_bitmask)
+      stateBitmask(_bitmask),
+      hash(_hash)
     {
     }
 
@@ -293,8 +404,22 @@ struct PipelineCache::Impl
 
     UniquePtr<PipelineImpl> pipeline{nullptr};
     uint32_t                stateBitmask{0u};
+    std::size_t             hash{0u};
   };
 
+  /**
+   * @brief Rebuilds the hash index from the pipeline entries
+   */
+  void RebuildPipelineIndex()
+  {
+    pipelineIndex.clear();
+    pipelineIndex.reserve(entries.size());
+    for(auto& entry : entries)
+    {
+      pipelineIndex.emplace(entry.hash, &entry);
+    }
+  }
+
   /**
    * @brief Sorted array of shaders used to create program
    */
@@ -321,6 +446,8 @@ struct PipelineCache::Impl
   std::vector<ProgramCacheEntry> programEntries;
   std::vector<ShaderCacheEntry>  shaderEntries;
 
+  std::unordered_multimap<std::size_t, CacheEntry*> pipelineIndex; ///< Pipeline entries indexed by the create info hash
+
   bool flushEnabled : 1;
   bool pipelineEntriesFlushRequired : 1;
   bool programEntriesFlushRequired : 1;
@@ -334,55 +461,55 @@ PipelineCache::PipelineCache(EglGraphicsController& controller)
 
 PipelineCache::~PipelineCache() = default;
 
-PipelineImpl* PipelineCache::FindPipelineImpl(const PipelineCreateInfo& info)
+PipelineImpl* PipelineCache::FindPipelineImpl(const PipelineCreateInfo& info, uint32_t bitmask, std::size_t hash)
 {
-  auto bitmask = GetStateBitmask(info);
+  if(!info.programState || !info.programState->program)
+  {
+    return nullptr;
+  }
 
-  for(auto& entry : mImpl->entries)
+  const auto& lhsProgram = *static_cast<const GLES::Program*>(info.programState->program);
+
+  // Only entries with the same hash are candidates, the full compare guards against collisions
+  auto range = mImpl->pipelineIndex.equal_range(hash);
+  for(auto iter = range.first; iter != range.second; ++iter)
   {
+    auto& entry     = *iter->second;
     auto& pipeline  = entry.pipeline;
     auto& cacheInfo = pipeline->GetCreateInfo();
-    if(!info.programState)
+
+    // Check whether the program is the same
+    const auto& rhsProgram = *static_cast<const GLES::Program*>(cacheInfo.programState->program);
+    if(lhsProgram != rhsProgram)
     {
       continue;
     }
 
-    // Check whether the program is the same
-    if(info.programState->program)
+    // Test whether set states bitmask matches
+    if(entry.stateBitmask != bitmask)
     {
-      const auto& lhsProgram = *static_cast<const GLES::Program*>(info.programState->program);
-      const auto& rhsProgram = *static_cast<const GLES::Program*>(cacheInfo.programState->program);
-      if(lhsProgram != rhsProgram)
-      {
-        continue;
-      }
-
-      // Test whether set states bitmask matches
-      if(entry.stateBitmask != bitmask)
-      {
-        continue;
-      }
+      continue;
+    }
 
-      // Now test only for states that are set
-      auto i = 0;
-      for(i = 0; i < int(StateLookupIndex::MAX_STATE); ++i)
+    // Now test only for states that are set
+    auto i = 0;
+    for(i = 0; i < int(StateLookupIndex::MAX_STATE); ++i)
+    {
+      // Test only set states
+      if((entry.stateBitmask & (1 << i)))
       {
-        // Test only set states
-        if((entry.stateBitmask & (1 << i)))
+        if(!(GetStateCompareFuncTable()[i](&info, &cacheInfo)))
         {
-          if(!(GetStateCompareFuncTable()[i](&info, &cacheInfo)))
-          {
-            break;
-          }
+          break;
         }
       }
+    }
 
-      // TODO: For now ignoring dynamic state mask and allocator
-      // Getting as far as here, we have found our pipeline impl
-      if(i == int(StateLookupIndex::MAX_STATE))
-      {
-        return pipeline.get();
-      }
+    // TODO: For now ignoring dynamic state mask and allocator
+    // Getting as far as here, we have found our pipeline impl
+    if(i == int(StateLookupIndex::MAX_STATE))
+    {
+      return pipeline.get();
     }
   }
   return nullptr;
@@ -433,7 +560,9 @@ ProgramImpl* PipelineCache::FindProgramImpl(const ProgramCreateInfo& info)
 Graphics::UniquePtr<Graphics::Pipeline> PipelineCache::GetPipeline(const PipelineCreateInfo&                 pipelineCreateInfo,
                                                                    Graphics::UniquePtr<Graphics::Pipeline>&& oldPipeline)
 {
-  auto cachedPipeline = FindPipelineImpl(pipelineCreateInfo);
+  const auto bitmask        = GetStateBitmask(pipelineCreateInfo);
+  const auto hash           = CalculatePipelineHash(pipelineCreateInfo, bitmask);
+  auto       cachedPipeline = FindPipelineImpl(pipelineCreateInfo, bitmask, hash);
 
   // Return same pointer if nothing changed
   if(oldPipeline && *static_cast<GLES::Pipeline*>(oldPipeline.get()) == cachedPipeline)
@@ -448,8 +577,17 @@ Graphics::UniquePtr<Graphics::Pipeline> PipelineCache::GetPipeline(const Pipelin
 
     cachedPipeline = pipeline.get();
 
-    // add it to cache
-    mImpl->entries.emplace_back(std::move(pipeline), GetStateBitmask(pipelineCreateInfo));
+    // add it to cache. Rebuild the index if the entries storage got reallocated
+    const auto capacity = mImpl->entries.capacity();
+    mImpl->entries.emplace_back(std::move(pipeline), bitmask, hash);
+    if(capacity != mImpl->entries.capacity())
+    {
+      mImpl->RebuildPipelineIndex();
+    }
+    else
+    {
+      mImpl->pipelineIndex.emplace(hash, &mImpl->entries.back());
+    }
   }
 
   auto wrapper = MakeUnique<GLES::Pipeline, CachedObjectDeleter<GLES::Pipeline>>(*cachedPipeline);
@@ -563,6 +701,7 @@ void PipelineCache::FlushCache()
     // Move temporary array in place of stored cache
     // Unused pipelines will be deleted automatically
     mImpl->entries = std::move(newEntries);
+    mImpl->RebuildPipelineIndex();
   }
 
   if(mImpl->programEntriesFlushRequired)
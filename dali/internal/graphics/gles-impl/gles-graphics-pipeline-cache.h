@@ -2,7 +2,7 @@
 #define DALI_GRAPHICS_GLES_PIPELINE_CACHE_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -130,10 +130,15 @@ public:
 private:
   /**
    * @brief Finds pipeline implementation based on the spec
+   *
+   * Only the cached pipelines with matching hash are compared.
+   *
    * @param[in] info Valid create info structure
+   * @param[in] bitmask The bitmask of states set in the create info
+   * @param[in] hash The hash of the create info
    * @return Returns pointer to pipeline or nullptr
    */
-  PipelineImpl* FindPipelineImpl(const PipelineCreateInfo& info);
+  PipelineImpl* FindPipelineImpl(const PipelineCreateInfo& info, uint32_t bitmask, std::size_t hash);
 
   /**
    * @brief Finds program implementation based on the spec
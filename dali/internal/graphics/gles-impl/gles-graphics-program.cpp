@@ -24,8 +24,12 @@
 #include "gles-graphics-shader.h"
 
 // EXTERNAL HEADERS
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 
+#include <GLES3/gl3.h>
+
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gGraphicsProgramLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_GRAPHICS_PROGRAM");
 #endif
@@ -49,6 +53,37 @@ inline bool memcmp4(A* a, B* b, uint32_t size)
   return (-1u == size);
 };
 
+/**
+ * Finds the range of 4-byte words which differ between two blocks.
+ * @param[out] begin The offset of the first differing word
+ * @param[out] end The offset after the last differing word
+ * @return false if the blocks are equal
+ */
+inline bool FindDirtyRange(const char* cache, const char* ptr, uint32_t size, uint32_t& begin, uint32_t& end)
+{
+  size &= ~3u;
+  if(memcmp(cache, ptr, size) == 0)
+  {
+    return false;
+  }
+
+  auto* pa    = reinterpret_cast<const uint32_t*>(cache);
+  auto* pb    = reinterpret_cast<const uint32_t*>(ptr);
+  auto  first = 0u;
+  auto  last  = size >> 2;
+  while(pa[first] == pb[first])
+  {
+    ++first;
+  }
+  while(pa[last - 1] == pb[last - 1])
+  {
+    --last;
+  }
+  begin = first << 2;
+  end   = last << 2;
+  return true;
+}
+
 /**
  * Structure stores pointer to the function
  * which will set the uniform of particular type
@@ -107,6 +142,13 @@ struct ProgramImpl::Impl
 
   // List of standalone uniform setters
   std::vector<UniformSetter> uniformSetters;
+
+  // Indices of the standalone uniforms, sorted by offset
+  std::vector<uint32_t> uniformOrder;
+
+  // The block applied last, skipped while its buffer isn't written to
+  const char* uniformSource{nullptr};
+  uint64_t    uniformGeneration{0u};
 };
 
 ProgramImpl::ProgramImpl(const Graphics::ProgramCreateInfo& createInfo, Graphics::EglGraphicsController& controller)
@@ -225,36 +267,61 @@ bool ProgramImpl::Create()
 
   const auto& info = mImpl->createInfo;
 
-  Preprocess();
+  // Try to link from the stored binary first, so shader compilation is skipped
+  auto&       binaryCache       = mImpl->controller.GetProgramBinaryCache();
+  const bool  binaryCacheUsable = binaryCache.IsEnabled();
+  std::string sources;
+  bool        linked{false};
+  if(binaryCacheUsable)
+  {
+    sources = GetSources();
+    linked  = binaryCache.LoadProgramBinary(program, sources);
+    DALI_LOG_DEBUG_INFO("Program[%s] program binary cache %s\n", mImpl->name.c_str(), linked ? "hit" : "miss");
+  }
 
-  for(const auto& state : *info.shaderState)
+  if(!linked)
   {
-    const auto* shader = static_cast<const GLES::Shader*>(state.shader);
+    Preprocess();
 
-    // Compile shader first (ignored when compiled)
-    if(shader->GetImplementation()->Compile())
+    for(const auto& state : *info.shaderState)
     {
-      auto shaderId = shader->GetImplementation()->GetGLShader();
-      DALI_LOG_DEBUG_INFO("Program[%s] attach shader : %u\n", mImpl->name.c_str(), shaderId);
-      gl->AttachShader(program, shaderId);
+      const auto* shader = static_cast<const GLES::Shader*>(state.shader);
+
+      // Compile shader first (ignored when compiled)
+      if(shader->GetImplementation()->Compile())
+      {
+        auto shaderId = shader->GetImplementation()->GetGLShader();
+        DALI_LOG_DEBUG_INFO("Program[%s] attach shader : %u\n", mImpl->name.c_str(), shaderId);
+        gl->AttachShader(program, shaderId);
+      }
+    }
+
+    if(binaryCacheUsable && mImpl->controller.GetGLESVersion() >= GLES::GLESVersion::GLES_30)
+    {
+      gl->ProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     }
-  }
 
-  DALI_LOG_DEBUG_INFO("Program[%s] call glLinkProgram\n", mImpl->name.c_str());
-  gl->LinkProgram(program);
+    DALI_LOG_DEBUG_INFO("Program[%s] call glLinkProgram\n", mImpl->name.c_str());
+    gl->LinkProgram(program);
 
-  GLint status{0};
-  gl->GetProgramiv(program, GL_LINK_STATUS, &status);
-  if(status != GL_TRUE)
-  {
-    char    output[4096];
-    GLsizei size{0u};
-    gl->GetProgramInfoLog(program, 4096, &size, output);
+    GLint status{0};
+    gl->GetProgramiv(program, GL_LINK_STATUS, &status);
+    if(status != GL_TRUE)
+    {
+      char    output[4096];
+      GLsizei size{0u};
+      gl->GetProgramInfoLog(program, 4096, &size, output);
 
-    // log on error
-    DALI_LOG_ERROR("glLinkProgram[%s] failed:\n%s\n", mImpl->name.c_str(), output);
-    gl->DeleteProgram(program);
-    return false;
+      // log on error
+      DALI_LOG_ERROR("glLinkProgram[%s] failed:\n%s\n", mImpl->name.c_str(), output);
+      gl->DeleteProgram(program);
+      return false;
+    }
+
+    if(binaryCacheUsable)
+    {
+      binaryCache.StoreProgramBinary(program, sources);
+    }
   }
 
   mImpl->glProgram = program;
@@ -294,6 +361,20 @@ bool ProgramImpl::Create()
   return true;
 }
 
+std::string ProgramImpl::GetSources() const
+{
+  // Sources of all the stages, in the order given by the create info
+  std::string key;
+  for(const auto& state : *mImpl->createInfo.shaderState)
+  {
+    const auto* shader     = static_cast<const GLES::Shader*>(state.shader);
+    const auto& shaderInfo = shader->GetCreateInfo();
+    key += std::to_string(uint32_t(state.pipelineStage)) + ':' + std::to_string(shader->GetGLSLVersion()) + ':';
+    key.append(reinterpret_cast<const char*>(shaderInfo.sourceData), shaderInfo.sourceSize);
+  }
+  return key;
+}
+
 uint32_t ProgramImpl::GetGlProgram() const
 {
   return mImpl->glProgram;
@@ -339,8 +420,14 @@ const ProgramCreateInfo& ProgramImpl::GetCreateInfo() const
   return mImpl->createInfo;
 }
 
-void ProgramImpl::UpdateStandaloneUniformBlock(const char* ptr)
+void ProgramImpl::UpdateStandaloneUniformBlock(const char* ptr, uint64_t writeGeneration)
 {
+  // Same memory as last time, not written since, the GL program already has these values
+  if(ptr == mImpl->uniformSource && writeGeneration == mImpl->uniformGeneration)
+  {
+    return;
+  }
+
   const auto& reflection = GetReflection();
 
   const auto& extraInfos = reflection.GetStandaloneUniformExtraInfo();
@@ -351,14 +438,30 @@ void ProgramImpl::UpdateStandaloneUniformBlock(const char* ptr)
     return; // Early out if no GL found
   }
 
-  // Set uniforms
-  int  index    = 0;
-  auto cachePtr = reinterpret_cast<char*>(mImpl->uniformData.data());
-  for(const auto& info : extraInfos)
+  mImpl->uniformSource     = ptr;
+  mImpl->uniformGeneration = writeGeneration;
+
+  auto     cachePtr = reinterpret_cast<char*>(mImpl->uniformData.data());
+  uint32_t dirtyBegin;
+  uint32_t dirtyEnd;
+  if(!FindDirtyRange(cachePtr, ptr, uint32_t(mImpl->uniformData.size()), dirtyBegin, dirtyEnd))
   {
-    auto& setter = mImpl->uniformSetters[index++];
-    auto  offset = info.offset;
-    if(!memcmp4(&cachePtr[offset], &ptr[offset], info.size * info.arraySize))
+    return;
+  }
+
+  // Set uniforms overlapping the dirty range, starting from the first one ending after its beginning
+  const auto& order = mImpl->uniformOrder;
+  auto        it    = std::lower_bound(order.begin(), order.end(), dirtyBegin, [&extraInfos](uint32_t index, uint32_t offset) {
+    const auto& info = extraInfos[index];
+    return info.offset + info.size * info.arraySize <= offset;
+  });
+  for(; it != order.end() && extraInfos[*it].offset < dirtyEnd; ++it)
+  {
+    const auto& info   = extraInfos[*it];
+    auto&       setter = mImpl->uniformSetters[*it];
+    auto        offset = info.offset;
+    auto        size   = info.size * info.arraySize;
+    if(!memcmp4(&cachePtr[offset], &ptr[offset], size))
     {
       switch(setter.type)
       {
@@ -383,8 +486,8 @@ void ProgramImpl::UpdateStandaloneUniformBlock(const char* ptr)
       }
     }
   }
-  // Update caches
-  memmove(mImpl->uniformData.data(), ptr, mImpl->uniformData.size());
+  // Update cache
+  memmove(&cachePtr[dirtyBegin], &ptr[dirtyBegin], dirtyEnd - dirtyBegin);
 }
 
 void ProgramImpl::BuildStandaloneUniformCache()
@@ -392,6 +495,18 @@ void ProgramImpl::BuildStandaloneUniformCache()
   const auto& reflection = GetReflection();
   const auto& extraInfos = reflection.GetStandaloneUniformExtraInfo();
 
+  // Sort the uniforms by offset, so only the ones within a dirty range are visited
+  mImpl->uniformOrder.resize(extraInfos.size());
+  for(uint32_t i = 0u; i < extraInfos.size(); ++i)
+  {
+    mImpl->uniformOrder[i] = i;
+  }
+  std::sort(mImpl->uniformOrder.begin(), mImpl->uniformOrder.end(), [&extraInfos](uint32_t lhs, uint32_t rhs) {
+    return extraInfos[lhs].offset < extraInfos[rhs].offset;
+  });
+  mImpl->uniformSource     = nullptr;
+  mImpl->uniformGeneration = 0u;
+
   // Prepare pointers to the uniform setter calls
   mImpl->uniformSetters.resize(extraInfos.size());
   int index = 0;
@@ -20,6 +20,7 @@
 // EXTERNAL INCLUDES
 #include <dali/graphics-api/graphics-program-create-info.h>
 #include <dali/graphics-api/graphics-program.h>
+#include <string>
 
 // INTERNAL INCLUDES
 #include "gles-graphics-resource.h"
@@ -70,6 +71,15 @@ public:
    */
   void Preprocess();
 
+  /**
+   * @brief Returns the sources of all the shader stages
+   *
+   * Used as the key of the program binary cache.
+   *
+   * @return The sources, each prefixed by its stage and GLSL version
+   */
+  [[nodiscard]] std::string GetSources() const;
+
   /**
    * @brief Returns GL program id
    *
@@ -137,9 +147,14 @@ public:
    * Updates standalone uniforms (issues the GL calls) and
    * updates internal uniform cache
    *
+   * The block is skipped if it's the memory applied last time and it hasn't been
+   * written since. Otherwise only the uniforms within the range of bytes which
+   * differ from the cache are compared, set and copied into the cache.
+   *
    * @param[in] ptr Valid pointer to the uniform block memory
+   * @param[in] writeGeneration The write generation of the buffer holding the block
    */
-  void UpdateStandaloneUniformBlock(const char* ptr);
+  void UpdateStandaloneUniformBlock(const char* ptr, uint64_t writeGeneration);
 
   /**
    * @brief Builds standalone uniform cache
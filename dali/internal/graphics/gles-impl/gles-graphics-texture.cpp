@@ -45,8 +45,9 @@ namespace Dali::Graphics::GLES
 {
 struct ColorConversion
 {
-  Format srcFormat;
-  Format destFormat;
+  Format   srcFormat;
+  Format   destFormat;
+  uint32_t destBytesPerPixel;
   std::vector<uint8_t> (*pConversionFunc)(const void*, uint32_t, uint32_t, uint32_t, uint32_t);
   void (*pConversionWriteFunc)(const void*, uint32_t, uint32_t, uint32_t, uint32_t, void*);
 };
@@ -94,7 +95,7 @@ inline std::vector<uint8_t> ConvertRGB32ToRGBA32(const void* pData, uint32_t siz
 const std::vector<ColorConversion>& GetColorConversionTable()
 {
   static const std::vector<ColorConversion> COLOR_CONVERSION_TABLE = {
-    {Format::R8G8B8_UNORM, Format::R8G8B8A8_UNORM, ConvertRGB32ToRGBA32, WriteRGB32ToRGBA32}};
+    {Format::R8G8B8_UNORM, Format::R8G8B8A8_UNORM, 4u, ConvertRGB32ToRGBA32, WriteRGB32ToRGBA32}};
   return COLOR_CONVERSION_TABLE;
 }
 
@@ -422,6 +423,46 @@ bool Texture::TryConvertPixelData(const void* pData, Graphics::Format srcFormat,
   return !outputBuffer.empty();
 }
 
+bool Texture::TryConvertPixelData(const void* pData, Graphics::Format srcFormat, Graphics::Format destFormat, uint32_t sizeInBytes, uint32_t inStride, uint32_t width, uint32_t height, uint8_t* outputBuffer)
+{
+  // No need to convert
+  if(srcFormat == destFormat)
+  {
+    return false;
+  }
+
+  auto it = std::find_if(GetColorConversionTable().begin(), GetColorConversionTable().end(), [&](auto& item) {
+    return item.srcFormat == srcFormat && item.destFormat == destFormat;
+  });
+
+  // No suitable format
+  if(it == GetColorConversionTable().end())
+  {
+    return false;
+  }
+
+  it->pConversionWriteFunc(pData, sizeInBytes, width, height, inStride, outputBuffer);
+  return true;
+}
+
+uint32_t Texture::GetConvertedPixelDataSize(Graphics::Format srcFormat, Graphics::Format destFormat, uint32_t width, uint32_t height) const
+{
+  if(srcFormat == destFormat)
+  {
+    return 0u;
+  }
+
+  auto it = std::find_if(GetColorConversionTable().begin(), GetColorConversionTable().end(), [&](auto& item) {
+    return item.srcFormat == srcFormat && item.destFormat == destFormat;
+  });
+
+  if(it == GetColorConversionTable().end())
+  {
+    return 0u;
+  }
+  return width * height * it->destBytesPerPixel;
+}
+
 void Texture::SetSamplerParameter(uint32_t param, uint32_t& cacheValue, uint32_t value) const
 {
   auto gl = mController.GetGL();
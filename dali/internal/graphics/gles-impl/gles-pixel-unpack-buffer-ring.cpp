@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/graphics/gles-impl/gles-pixel-unpack-buffer-ring.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <dali/integration-api/gl-defines.h>
+#include <dali/integration-api/trace.h>
+#include <algorithm>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali/internal/graphics/gles-impl/egl-graphics-controller.h>
+#include <dali/internal/graphics/gles-impl/gles-graphics-texture.h>
+#include <dali/internal/graphics/gles-impl/gles-sync-pool.h>
+#include <dali/internal/trace/common/trace-recorder.h>
+
+namespace Dali::Graphics::GLES
+{
+namespace
+{
+const uint32_t MINIMUM_BUFFER_SIZE       = 256u * 1024u;       ///< Small batches share the same allocation
+const uint32_t KEPT_BUFFER_SIZE          = 4u * 1024u * 1024u; ///< Larger buffers are released when they are not used
+const uint32_t MAXIMUM_IDLE_FRAMES       = 60u;
+const uint32_t MINIMUM_BYTES_FOR_WORKERS = 64u * 1024u;        ///< Smaller batches are written faster than a worker wakes up
+const uint32_t COPY_CHUNK_SIZE           = 256u * 1024u;       ///< Copies are split, so a large image is written by several threads
+
+const char* TRACE_STAGED_BYTES_COUNTER      = "DALI_EGL_TEXTURE_STAGED_BYTES";
+const char* TRACE_STAGED_UPLOADS_COUNTER    = "DALI_EGL_TEXTURE_STAGED_UPLOADS";
+const char* TRACE_FALLBACK_UPLOADS_COUNTER  = "DALI_EGL_TEXTURE_FALLBACK_UPLOADS";
+const char* TRACE_BUFFERS_IN_FLIGHT_COUNTER = "DALI_EGL_TEXTURE_STAGING_BUFFERS_IN_FLIGHT";
+
+DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_EGL, false);
+
+/**
+ * A part of a write done by one thread: a range of a copy, or a whole conversion.
+ */
+struct Piece
+{
+  uint32_t writeIndex;
+  uint32_t begin;
+  uint32_t end;
+};
+
+/**
+ * @return false if the pixels couldn't be converted
+ */
+bool WritePiece(uint8_t* memory, const PixelUnpackBufferRing::Write& write, const Piece& piece)
+{
+  if(write.texture)
+  {
+    return write.texture->TryConvertPixelData(write.source, write.sourceFormat, write.destFormat, write.sourceSize, write.sourceStride, write.width, write.height, memory + write.offset);
+  }
+
+  memcpy(memory + write.offset + piece.begin, write.source + piece.begin, piece.end - piece.begin);
+  return true;
+}
+
+uint32_t NextPowerOfTwo(uint32_t value)
+{
+  uint32_t result = MINIMUM_BUFFER_SIZE;
+  while(result < value)
+  {
+    result <<= 1u;
+  }
+  return result;
+}
+
+} // namespace
+
+PixelUnpackBufferRing::PixelUnpackBufferRing(EglGraphicsController& controller)
+: mController(controller)
+{
+}
+
+PixelUnpackBufferRing::~PixelUnpackBufferRing()
+{
+  // The workers may still write a mapped buffer.
+  Internal::Adaptor::WorkerThreadPool::Get().Wait(mFillJob);
+
+  // The fences are owned by the SyncPool. The buffers are deleted with the context on shutdown.
+  auto gl = mController.GetGL();
+  if(gl)
+  {
+    for(auto& buffer : mBuffers)
+    {
+      if(buffer.id)
+      {
+        gl->DeleteBuffers(1, &buffer.id);
+      }
+    }
+  }
+}
+
+uint8_t* PixelUnpackBufferRing::Map(uint32_t size)
+{
+  auto gl = mController.GetGL();
+  if(!gl || size == 0u || size > MAXIMUM_BUFFER_SIZE)
+  {
+    return nullptr;
+  }
+
+  Buffer& buffer = mBuffers[mCurrent];
+  if(buffer.fence)
+  {
+    // The GPU may still read the buffer, don't wait for it.
+    if(!mController.GetSyncPool().IsSignaled(buffer.fence))
+    {
+      return nullptr;
+    }
+    mController.GetSyncPool().FreeSyncObject(buffer.fence);
+    buffer.fence = nullptr;
+  }
+
+  if(!buffer.id)
+  {
+    gl->GenBuffers(1, &buffer.id);
+  }
+  gl->BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer.id);
+  mBound = true;
+
+  if(buffer.capacity < size)
+  {
+    buffer.capacity = NextPowerOfTwo(size);
+    gl->BufferData(GL_PIXEL_UNPACK_BUFFER, buffer.capacity, nullptr, GL_STREAM_DRAW);
+  }
+  buffer.idleFrames = 0u;
+
+  auto memory = reinterpret_cast<uint8_t*>(gl->MapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+  if(!memory)
+  {
+    DALI_LOG_ERROR("Unable to map the pixel unpack buffer, size : %u\n", size);
+    Unbind();
+    return nullptr;
+  }
+  mMapped = true;
+  return memory;
+}
+
+void PixelUnpackBufferRing::Fill(uint8_t* memory, const std::vector<Write>& writes)
+{
+  DALI_TRACE_SCOPE(gTraceFilter, "DALI_EGL_CONTROLLER_TEXTURE_STAGING");
+
+  mWrites = writes;
+  mWriteFailed.assign(writes.size(), 0u);
+
+  uint32_t totalSize = 0u;
+  for(const auto& write : writes)
+  {
+    totalSize += write.size;
+  }
+
+  auto& workerThreadPool = Internal::Adaptor::WorkerThreadPool::Get();
+  if(totalSize < MINIMUM_BYTES_FOR_WORKERS || workerThreadPool.GetWorkerCount() == 0u)
+  {
+    for(uint32_t index = 0u; index < mWrites.size(); ++index)
+    {
+      mWriteFailed[index] = !WritePiece(memory, mWrites[index], Piece{index, 0u, mWrites[index].sourceSize});
+    }
+    return;
+  }
+
+  // Copies are split into chunks, conversions are written by a single thread each.
+  std::vector<Piece> pieces;
+  for(uint32_t index = 0u; index < mWrites.size(); ++index)
+  {
+    const auto& write = mWrites[index];
+    if(write.texture)
+    {
+      pieces.push_back(Piece{index, 0u, write.sourceSize});
+      continue;
+    }
+    for(uint32_t begin = 0u; begin < write.sourceSize; begin += COPY_CHUNK_SIZE)
+    {
+      pieces.push_back(Piece{index, begin, std::min(begin + COPY_CHUNK_SIZE, write.sourceSize)});
+    }
+  }
+
+  // The render thread is free until Unmap(). Each write is converted by a single piece, so the flags are set by one thread each.
+  const uint32_t pieceCount = static_cast<uint32_t>(pieces.size());
+
+  mFillJob = workerThreadPool.Submit(pieceCount, [this, memory, pieces = std::move(pieces)](uint32_t index) {
+    const Piece& piece = pieces[index];
+    if(!WritePiece(memory, mWrites[piece.writeIndex], piece))
+    {
+      mWriteFailed[piece.writeIndex] = 1u;
+    }
+  });
+}
+
+bool PixelUnpackBufferRing::Unmap()
+{
+  // The CPU side of the buffer is done once the workers have written it. The GPU side is fenced in Submit().
+  Internal::Adaptor::WorkerThreadPool::Get().Wait(mFillJob);
+  mFillJob.reset();
+
+  auto gl = mController.GetGL();
+  if(!gl || !mMapped)
+  {
+    return false;
+  }
+
+  mMapped = false;
+  if(gl->UnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_FALSE)
+  {
+    DALI_LOG_ERROR("The content of the pixel unpack buffer has been lost\n");
+    Unbind();
+    return false;
+  }
+  return true;
+}
+
+void PixelUnpackBufferRing::Bind()
+{
+  auto gl = mController.GetGL();
+  if(gl && !mBound)
+  {
+    gl->BindBuffer(GL_PIXEL_UNPACK_BUFFER, mBuffers[mCurrent].id);
+    mBound = true;
+  }
+}
+
+void PixelUnpackBufferRing::Unbind()
+{
+  auto gl = mController.GetGL();
+  if(gl && mBound)
+  {
+    gl->BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0u);
+    mBound = false;
+  }
+}
+
+void PixelUnpackBufferRing::Submit(const Context* context, uint32_t uploadCount, uint32_t size)
+{
+  Unbind();
+
+  Buffer& buffer = mBuffers[mCurrent];
+  buffer.fence   = mController.GetSyncPool().AllocateSyncObject(context, SyncPool::SyncContext::GL);
+  mCurrent       = (mCurrent + 1u) % BUFFER_COUNT;
+
+  mStatistics.stagedUploads += uploadCount;
+  mStatistics.stagedBytes += size;
+  ++mStatistics.batches;
+
+  auto* traceRecorder = Internal::Adaptor::TraceRecorder::Get();
+  if(traceRecorder)
+  {
+    traceRecorder->Counter(TRACE_STAGED_BYTES_COUNTER, size);
+    traceRecorder->Counter(TRACE_STAGED_UPLOADS_COUNTER, uploadCount);
+  }
+}
+
+void PixelUnpackBufferRing::Recycle()
+{
+  auto     gl            = mController.GetGL();
+  uint32_t inFlightCount = 0u;
+  for(auto& buffer : mBuffers)
+  {
+    if(buffer.fence)
+    {
+      if(mController.GetSyncPool().IsSignaled(buffer.fence))
+      {
+        mController.GetSyncPool().FreeSyncObject(buffer.fence);
+        buffer.fence = nullptr;
+      }
+      else
+      {
+        ++inFlightCount;
+      }
+    }
+    else if(buffer.capacity > KEPT_BUFFER_SIZE && ++buffer.idleFrames > MAXIMUM_IDLE_FRAMES && gl)
+    {
+      // Give back the memory of a burst of large uploads.
+      gl->DeleteBuffers(1, &buffer.id);
+      buffer.id         = 0u;
+      buffer.capacity   = 0u;
+      buffer.idleFrames = 0u;
+    }
+  }
+
+  auto* traceRecorder = Internal::Adaptor::TraceRecorder::Get();
+  if(traceRecorder)
+  {
+    traceRecorder->Counter(TRACE_BUFFERS_IN_FLIGHT_COUNTER, inFlightCount);
+    traceRecorder->Counter(TRACE_FALLBACK_UPLOADS_COUNTER, static_cast<int64_t>(mStatistics.fallbackUploads));
+  }
+}
+
+} // namespace Dali::Graphics::GLES
@@ -0,0 +1,184 @@
+#ifndef DALI_GRAPHICS_GLES_PIXEL_UNPACK_BUFFER_RING_H
+#define DALI_GRAPHICS_GLES_PIXEL_UNPACK_BUFFER_RING_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/graphics-api/graphics-types.h>
+#include <dali/integration-api/gl-abstraction.h>
+#include <cstdint>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/worker-thread-pool.h>
+#include <dali/public-api/common/vector-wrapper.h>
+
+namespace Dali::Graphics
+{
+class EglGraphicsController;
+
+namespace GLES
+{
+class Context;
+class Texture;
+struct AgingSyncObject;
+
+/**
+ * A ring of pixel unpack buffers, used to stage the texture uploads on GLES3.
+ *
+ * The pixels of a batch of uploads are written into a mapped buffer by the threads of the
+ * WorkerThreadPool, then the uploads read from the buffer with offsets instead of CPU
+ * pointers, so the driver doesn't copy or wait for the CPU memory during the calls.
+ * The render thread only maps the buffer, and issues the uploads once the workers are done.
+ *
+ * A buffer is reused once the fence inserted after its uploads has been signaled.
+ * The fences are allocated from the SyncPool.
+ */
+class PixelUnpackBufferRing
+{
+public:
+  /**
+   * A region of the mapped buffer to write.
+   */
+  struct Write
+  {
+    const uint8_t*   source{nullptr};  ///< The pixels to copy or convert
+    uint32_t         sourceSize{0u};   ///< The size of the pixels in bytes
+    uint32_t         offset{0u};       ///< The offset of the region in the buffer
+    uint32_t         size{0u};         ///< The size of the region in bytes
+    Texture*         texture{nullptr}; ///< Set if the pixels are converted to the format of the texture
+    Graphics::Format sourceFormat{Graphics::Format::UNDEFINED};
+    Graphics::Format destFormat{Graphics::Format::UNDEFINED};
+    uint32_t         sourceStride{0u};
+    uint32_t         width{0u};
+    uint32_t         height{0u};
+  };
+
+  /**
+   * Counters, to measure how much of the uploads is staged.
+   */
+  struct Statistics
+  {
+    uint64_t stagedUploads{0u};   ///< The number of uploads read from a pixel unpack buffer
+    uint64_t stagedBytes{0u};     ///< The bytes written into the pixel unpack buffers
+    uint64_t fallbackUploads{0u}; ///< The number of uploads read from CPU memory, as no buffer was available
+    uint64_t batches{0u};         ///< The number of buffers filled
+  };
+
+  static constexpr uint32_t ALIGNMENT           = 16u;               ///< Alignment of the regions, enough for any pixel type
+  static constexpr uint32_t MAXIMUM_BUFFER_SIZE = 32u * 1024u * 1024u; ///< Larger batches are partly uploaded from CPU memory
+
+  explicit PixelUnpackBufferRing(EglGraphicsController& controller);
+
+  ~PixelUnpackBufferRing();
+
+  /**
+   * Map a free buffer of at least the given size, and leave it bound to GL_PIXEL_UNPACK_BUFFER.
+   * @param[in] size The size of the batch in bytes
+   * @return The mapped memory, or nullptr if there is no free buffer
+   */
+  uint8_t* Map(uint32_t size);
+
+  /**
+   * Start filling the mapped buffer on the worker threads. Small batches are written by the calling thread.
+   * @param[in] memory The memory returned by Map()
+   * @param[in] writes The regions to write. The sources must be kept until Unmap().
+   */
+  void Fill(uint8_t* memory, const std::vector<Write>& writes);
+
+  /**
+   * Wait until the buffer is filled, and unmap it. It stays bound, the uploads can read it.
+   * @return false if the content has been lost, and the uploads must read CPU memory
+   */
+  bool Unmap();
+
+  /**
+   * Whether a region has been written, after Unmap().
+   * @param[in] writeIndex The index of the region in the writes given to Fill()
+   * @return false if the pixels couldn't be converted, and the upload must read CPU memory
+   */
+  bool IsWritten(uint32_t writeIndex) const
+  {
+    return writeIndex < mWriteFailed.size() && !mWriteFailed[writeIndex];
+  }
+
+  /**
+   * Bind the mapped buffer, before an upload reading it.
+   */
+  void Bind();
+
+  /**
+   * Unbind the buffer, before an upload reading CPU memory.
+   */
+  void Unbind();
+
+  /**
+   * Insert the fence after the uploads reading the buffer, unbind it, and move to the next buffer.
+   * @param[in] context The context of the uploads
+   * @param[in] uploadCount The number of uploads read from the buffer
+   * @param[in] size The bytes written into the buffer
+   */
+  void Submit(const Context* context, uint32_t uploadCount, uint32_t size);
+
+  /**
+   * Count the uploads read from CPU memory because no buffer was available.
+   * @param[in] uploadCount The number of uploads
+   */
+  void AddFallbackUploads(uint32_t uploadCount)
+  {
+    mStatistics.fallbackUploads += uploadCount;
+  }
+
+  /**
+   * Release the buffers whose fence has been signaled, and shrink the ones left unused.
+   * Call at the end of each frame, before the SyncPool ages its objects.
+   */
+  void Recycle();
+
+  /**
+   * @return The counters since the ring has been created
+   */
+  const Statistics& GetStatistics() const
+  {
+    return mStatistics;
+  }
+
+private:
+  struct Buffer
+  {
+    GLuint           id{0u};
+    uint32_t         capacity{0u};
+    uint32_t         idleFrames{0u};
+    AgingSyncObject* fence{nullptr}; ///< Set while the GPU may read the buffer
+  };
+
+  static constexpr uint32_t BUFFER_COUNT = 3u;
+
+  EglGraphicsController&                      mController;
+  Buffer                                      mBuffers[BUFFER_COUNT];
+  Statistics                                  mStatistics;
+  std::vector<Write>                          mWrites;        ///< The regions of the current batch, read by the workers
+  std::vector<uint8_t>                        mWriteFailed;   ///< Set by the workers for the regions which couldn't be written
+  Internal::Adaptor::WorkerThreadPool::JobPtr mFillJob;       ///< Set while the workers fill the mapped buffer
+  uint32_t                                    mCurrent{0u};   ///< The next buffer to use
+  bool                                        mMapped{false}; ///< Whether the current buffer is mapped
+  bool                                        mBound{false};  ///< Whether the current buffer is bound to GL_PIXEL_UNPACK_BUFFER
+};
+
+} // namespace GLES
+} // namespace Dali::Graphics
+
+#endif // DALI_GRAPHICS_GLES_PIXEL_UNPACK_BUFFER_RING_H
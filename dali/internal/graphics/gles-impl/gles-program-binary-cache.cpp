@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/graphics/gles-impl/gles-program-binary-cache.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/common/hash.h>
+#include <dali/integration-api/debug.h>
+#include <dali/integration-api/gl-abstraction.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <GLES3/gl3.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/graphics/gles-impl/egl-graphics-controller.h>
+#include <dali/internal/system/common/environment-variables.h>
+
+extern std::string GetSystemCachePath();
+
+namespace Dali::Graphics::GLES
+{
+namespace
+{
+constexpr const char* PROGRAM_BINARY_DIRECTORY = "program-binaries/";
+constexpr const char* PROGRAM_BINARY_EXTENSION = ".bin";
+constexpr const char* DRIVER_STAMP_FILE        = "driver";
+constexpr uint32_t    PROGRAM_BINARY_MAGIC     = 0x44414c50; // 'DALP'
+constexpr uint32_t    PROGRAM_BINARY_VERSION   = 2u;
+
+/**
+ * @brief Header written in front of each stored binary
+ *
+ * The header is followed by the program sources, then the binary. The file name is only
+ * the hash of the sources, so the sources are compared before the binary is used.
+ */
+struct ProgramBinaryHeader
+{
+  uint32_t magic{PROGRAM_BINARY_MAGIC};
+  uint32_t version{PROGRAM_BINARY_VERSION};
+  uint64_t driverHash{0u};
+  uint64_t sourceLength{0u};
+  uint32_t binaryFormat{0u};
+  uint32_t binaryLength{0u};
+};
+
+std::string GetGLString(Integration::GlAbstraction& gl, GLenum name)
+{
+  auto* string = gl.GetString(name);
+  return string ? std::string(reinterpret_cast<const char*>(string)) : std::string();
+}
+
+/**
+ * @brief Removes all the stored binaries from the directory
+ */
+void RemoveProgramBinaries(const std::string& directory)
+{
+  DIR* dir = opendir(directory.c_str());
+  if(!dir)
+  {
+    return;
+  }
+
+  const auto extensionLength = strlen(PROGRAM_BINARY_EXTENSION);
+  while(auto* entry = readdir(dir))
+  {
+    const auto nameLength = strlen(entry->d_name);
+    if(nameLength > extensionLength && strcmp(entry->d_name + nameLength - extensionLength, PROGRAM_BINARY_EXTENSION) == 0)
+    {
+      unlink((directory + entry->d_name).c_str());
+    }
+  }
+  closedir(dir);
+}
+
+} // namespace
+
+ProgramBinaryCache::ProgramBinaryCache(EglGraphicsController& controller)
+: mController(controller)
+{
+}
+
+ProgramBinaryCache::~ProgramBinaryCache() = default;
+
+bool ProgramBinaryCache::IsEnabled()
+{
+  if(!mInitialized)
+  {
+    Initialize();
+  }
+  return mEnabled;
+}
+
+void ProgramBinaryCache::Initialize()
+{
+  mInitialized = true;
+
+  auto* gl = mController.GetGL();
+  if(!gl)
+  {
+    // Try again when GL is available
+    mInitialized = false;
+    return;
+  }
+
+  auto disableString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_DISABLE_PROGRAM_BINARY_CACHE);
+  if(disableString && std::atoi(disableString) != 0)
+  {
+    DALI_LOG_RELEASE_INFO("Program binary cache disabled\n");
+    return;
+  }
+
+  GLint formatCount{0};
+  gl->GetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+  if(formatCount <= 0)
+  {
+    return;
+  }
+
+  const auto systemCachePath = GetSystemCachePath();
+  if(systemCachePath.empty())
+  {
+    return;
+  }
+
+  mCacheDirectory = systemCachePath + PROGRAM_BINARY_DIRECTORY;
+  if((mkdir(systemCachePath.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH) != 0 && errno != EEXIST) ||
+     (mkdir(mCacheDirectory.c_str(), S_IRWXU) != 0 && errno != EEXIST))
+  {
+    DALI_LOG_ERROR("Error creating program binary cache directory: %s!\n", mCacheDirectory.c_str());
+    return;
+  }
+
+  mDriverHash = Dali::CalculateHash(GetGLString(*gl, GL_VENDOR) + GetGLString(*gl, GL_RENDERER) + GetGLString(*gl, GL_VERSION));
+
+  // Drop all the stored binaries if the driver has changed since they were written
+  const auto  stampPath = mCacheDirectory + DRIVER_STAMP_FILE;
+  std::size_t storedDriverHash{0u};
+  {
+    std::ifstream stamp(stampPath);
+    stamp >> storedDriverHash;
+  }
+  if(storedDriverHash != mDriverHash)
+  {
+    DALI_LOG_RELEASE_INFO("GL driver changed, invalidating program binary cache\n");
+    RemoveProgramBinaries(mCacheDirectory);
+
+    std::ofstream stamp(stampPath, std::ios::trunc);
+    stamp << mDriverHash;
+  }
+
+  mEnabled = true;
+}
+
+std::string ProgramBinaryCache::GetFilePath(const std::string& sources) const
+{
+  return mCacheDirectory + std::to_string(Dali::CalculateHash(sources)) + PROGRAM_BINARY_EXTENSION;
+}
+
+bool ProgramBinaryCache::LoadProgramBinary(uint32_t program, const std::string& sources)
+{
+  auto* gl = mController.GetGL();
+  if(!gl || !IsEnabled())
+  {
+    return false;
+  }
+
+  const auto    filePath = GetFilePath(sources);
+  std::ifstream file(filePath, std::ios::binary);
+  if(!file.is_open())
+  {
+    return false;
+  }
+
+  ProgramBinaryHeader header;
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if(!file ||
+     header.magic != PROGRAM_BINARY_MAGIC ||
+     header.version != PROGRAM_BINARY_VERSION ||
+     header.driverHash != mDriverHash ||
+     header.binaryLength == 0u)
+  {
+    unlink(filePath.c_str());
+    return false;
+  }
+
+  // Another program with the same hash may own the entry. Keep it, it's replaced if this program is stored.
+  if(header.sourceLength != sources.size())
+  {
+    DALI_LOG_DEBUG_INFO("Program binary sources differ : %s\n", filePath.c_str());
+    return false;
+  }
+
+  std::string storedSources(sources.size(), '\0');
+  file.read(&storedSources[0], storedSources.size());
+  if(!file)
+  {
+    unlink(filePath.c_str());
+    return false;
+  }
+  if(storedSources != sources)
+  {
+    DALI_LOG_DEBUG_INFO("Program binary sources differ : %s\n", filePath.c_str());
+    return false;
+  }
+
+  std::vector<uint8_t> binary(header.binaryLength);
+  file.read(reinterpret_cast<char*>(binary.data()), binary.size());
+  if(!file)
+  {
+    unlink(filePath.c_str());
+    return false;
+  }
+
+  gl->ProgramBinary(program, header.binaryFormat, binary.data(), GLsizei(binary.size()));
+
+  GLint status{0};
+  gl->GetProgramiv(program, GL_LINK_STATUS, &status);
+  if(status != GL_TRUE)
+  {
+    // The driver doesn't accept this binary anymore
+    DALI_LOG_DEBUG_INFO("Program binary rejected : %s\n", filePath.c_str());
+    unlink(filePath.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+void ProgramBinaryCache::StoreProgramBinary(uint32_t program, const std::string& sources)
+{
+  auto* gl = mController.GetGL();
+  if(!gl || !IsEnabled())
+  {
+    return;
+  }
+
+  GLint binaryLength{0};
+  gl->GetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+  if(binaryLength <= 0)
+  {
+    return;
+  }
+
+  std::vector<uint8_t> binary(binaryLength);
+  GLsizei              writtenLength{0};
+  GLenum               binaryFormat{0u};
+  gl->GetProgramBinary(program, binaryLength, &writtenLength, &binaryFormat, binary.data());
+  if(writtenLength <= 0)
+  {
+    return;
+  }
+
+  ProgramBinaryHeader header;
+  header.driverHash   = mDriverHash;
+  header.sourceLength = sources.size();
+  header.binaryFormat = binaryFormat;
+  header.binaryLength = uint32_t(writtenLength);
+
+  // Write into a temporary file first, so other processes never read a partially written binary
+  const auto filePath = GetFilePath(sources);
+  const auto tempPath = filePath + "." + std::to_string(getpid());
+  {
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if(!file.is_open())
+    {
+      DALI_LOG_ERROR("Fail to open file : %s\n", tempPath.c_str());
+      return;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(sources.data(), sources.size());
+    file.write(reinterpret_cast<const char*>(binary.data()), writtenLength);
+    if(!file)
+    {
+      file.close();
+      unlink(tempPath.c_str());
+      return;
+    }
+  }
+
+  if(rename(tempPath.c_str(), filePath.c_str()) != 0)
+  {
+    unlink(tempPath.c_str());
+  }
+}
+
+} // namespace Dali::Graphics::GLES
@@ -0,0 +1,113 @@
+#ifndef DALI_GRAPHICS_GLES_PROGRAM_BINARY_CACHE_H
+#define DALI_GRAPHICS_GLES_PROGRAM_BINARY_CACHE_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Dali::Graphics
+{
+class EglGraphicsController;
+
+namespace GLES
+{
+/**
+ * @brief ProgramBinaryCache stores linked GL program binaries on disk.
+ *
+ * Binaries are stored under the system cache path, in files named by the
+ * hash of the shader sources. Each entry keeps the sources, which are
+ * compared before the binary is given to the driver, so programs with the
+ * same hash never share a binary. Each entry is also tagged with the hash
+ * of the GL vendor, renderer and version strings, so a driver update
+ * invalidates all the stored binaries.
+ *
+ * The cache is enabled when the driver supports at least one program binary
+ * format, unless DALI_DISABLE_PROGRAM_BINARY_CACHE is set.
+ */
+class ProgramBinaryCache
+{
+public:
+  /**
+   * @brief Constructor
+   *
+   * @param[in] controller Reference to the controller
+   */
+  explicit ProgramBinaryCache(EglGraphicsController& controller);
+
+  /**
+   * @brief Destructor
+   */
+  ~ProgramBinaryCache();
+
+  /**
+   * @brief Checks whether program binaries can be loaded and stored
+   *
+   * The cache is initialised on the first call, so it must be called
+   * on the thread owning the GL context.
+   *
+   * @return True if the cache is usable
+   */
+  bool IsEnabled();
+
+  /**
+   * @brief Loads the stored binary into the given program
+   *
+   * The stored entry is removed if the driver rejects the binary.
+   *
+   * @param[in] program The GL program name
+   * @param[in] sources The sources of all the program stages
+   * @return True if the program is linked from the stored binary
+   */
+  bool LoadProgramBinary(uint32_t program, const std::string& sources);
+
+  /**
+   * @brief Stores the binary of a successfully linked program
+   *
+   * @param[in] program The GL program name
+   * @param[in] sources The sources of all the program stages
+   */
+  void StoreProgramBinary(uint32_t program, const std::string& sources);
+
+private:
+  /**
+   * @brief Initialises the cache directory and the driver hash
+   */
+  void Initialize();
+
+  /**
+   * @brief Returns the path of the file storing the binary
+   *
+   * @param[in] sources The sources of all the program stages
+   * @return The file path
+   */
+  std::string GetFilePath(const std::string& sources) const;
+
+private:
+  EglGraphicsController& mController;
+  std::string            mCacheDirectory;  ///< Directory containing the binaries
+  std::size_t            mDriverHash{0u};  ///< Hash of the GL driver strings
+  bool                   mInitialized{false};
+  bool                   mEnabled{false};
+};
+
+} // namespace GLES
+} // namespace Dali::Graphics
+
+#endif // DALI_GRAPHICS_GLES_PROGRAM_BINARY_CACHE_H
@@ -98,6 +98,30 @@ bool AgingSyncObject::ClientWait()
   return synced;
 }
 
+bool AgingSyncObject::IsSignaled()
+{
+  bool signaled = true;
+  if(egl)
+  {
+    if(eglSyncObject)
+    {
+      signaled = eglSyncObject->IsSynced();
+    }
+  }
+  else
+  {
+    auto gl = controller.GetGL();
+    if(gl && glSyncObject)
+    {
+      GLenum result = gl->ClientWaitSync(glSyncObject, GL_SYNC_FLUSH_COMMANDS_BIT, 0ull);
+
+      signaled = (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED);
+    }
+  }
+  DALI_LOG_INFO(gLogSyncFilter, Debug::Verbose, "AgingSyncObject::IsSignaled(); Result: %s\n", signaled ? "Signaled" : "NOT SIGNALED");
+  return signaled;
+}
+
 void AgingSyncObject::Wait()
 {
   if(egl)
@@ -146,6 +170,20 @@ bool SyncPool::ClientWait(AgingSyncObject* syncPoolObject)
   return false;
 }
 
+bool SyncPool::IsSignaled(AgingSyncObject* syncPoolObject)
+{
+  if(syncPoolObject)
+  {
+    if(syncPoolObject->IsSignaled())
+    {
+      return true;
+    }
+    // Still in use, don't let it age out.
+    syncPoolObject->age = 2;
+  }
+  return false;
+}
+
 void SyncPool::FreeSyncObject(AgingSyncObject* agingSyncObject)
 {
   auto iter = std::find_if(mSyncObjects.begin(), mSyncObjects.end(), [&agingSyncObject](AgingSyncPtrRef agingSyncPtr) { return agingSyncPtr.get() == agingSyncObject; });
@@ -54,6 +54,7 @@ struct AgingSyncObject
 
   void Wait();
   bool ClientWait();
+  bool IsSignaled();
 };
 using AgingSyncPtrRef = std::unique_ptr<AgingSyncObject>&;
 
@@ -99,6 +100,14 @@ public:
    */
   bool ClientWait(AgingSyncObject* syncPoolObject);
 
+  /**
+   * Check whether a sync object has been signaled, without waiting.
+   * A sync object not signaled yet is kept for 2 more frames.
+   * @param syncPoolObject The object to check.
+   * @return true if the sync object was signaled
+   */
+  bool IsSignaled(AgingSyncObject* syncPoolObject);
+
   /**
    * Delete the sync object if it's not needed.
    * @param syncPoolObject The object to delete.
@@ -59,6 +59,7 @@ void* Memory2::LockRegion(uint32_t offset, uint32_t size)
     {
       using Ptr           = char*;
       mMappedPointer      = Ptr(buffer->GetCPUAllocatedAddress()) + offset;
+      buffer->MarkWritten();
       mIsAllocatedLocally = false;
     }
     else
@@ -84,7 +85,11 @@ void Memory2::Unlock(bool flush)
     if(mMapObjectType == MapObjectType::BUFFER && mMappedPointer)
     {
       auto buffer = static_cast<GLES::Buffer*>(mMapBufferInfo.buffer);
-      if(!buffer->IsCPUAllocated())
+      if(buffer->IsCPUAllocated())
+      {
+        buffer->MarkWritten();
+      }
+      else
       {
         buffer->Bind(BufferUsage::VERTEX_BUFFER);
         gl->BufferSubData(GL_ARRAY_BUFFER, GLintptr(mMapBufferInfo.offset), GLsizeiptr(mMapBufferInfo.size), mMappedPointer);
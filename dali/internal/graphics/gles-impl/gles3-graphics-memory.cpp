@@ -59,6 +59,7 @@ void* Memory3::LockRegion(uint32_t offset, uint32_t size)
       {
         using Ptr      = char*;
         mMappedPointer = Ptr(buffer->GetCPUAllocatedAddress()) + offset;
+        buffer->MarkWritten();
       }
       else
       {
@@ -80,7 +81,11 @@ void Memory3::Unlock(bool flush)
     if(mMapObjectType == MapObjectType::BUFFER && mMappedPointer)
     {
       auto buffer = static_cast<GLES::Buffer*>(mMapBufferInfo.buffer);
-      if(!buffer->IsCPUAllocated())
+      if(buffer->IsCPUAllocated())
+      {
+        buffer->MarkWritten();
+      }
+      else
       {
         gl->BindBuffer(GL_COPY_WRITE_BUFFER, buffer->GetGLBuffer());
         gl->UnmapBuffer(GL_COPY_WRITE_BUFFER);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,14 +22,17 @@
 #include <curl/curl.h>
 #include <dali/integration-api/debug.h>
 #include <pthread.h>
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <sstream>
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/internal/imaging/common/http-disk-cache.h>
 #include <dali/internal/system/common/environment-variables.h>
-#include <dali/internal/system/common/file-writer.h>
 #include <dali/public-api/common/dali-common.h>
 
 using namespace Dali::Integration;
@@ -133,11 +136,13 @@ int CurloptVerboseLogTrace(CURL* handle, curl_infotype type, char* data, size_t
 
 const int  CONNECTION_TIMEOUT_SECONDS(30L);
 const int  TIMEOUT_SECONDS(120L);
-const long CLOSE_CONNECTION_ON_ERROR = 1L; // 0 == off, 1 == on
-const long EXCLUDE_HEADER            = 0L;
-const long INCLUDE_HEADER            = 1L;
-const long INCLUDE_BODY              = 0L;
-const long EXCLUDE_BODY              = 1L;
+const long EXCLUDE_HEADER = 0L;
+const long INCLUDE_BODY   = 0L;
+
+const size_t MINIMUM_DOWNLOAD_BUFFER_SIZE = 16u * 1024u; ///< The first buffer size if the content length is unknown.
+
+const long HTTP_RESPONSE_OK           = 200L;
+const long HTTP_RESPONSE_NOT_MODIFIED = 304L;
 
 /**
  * @brief Get the Curlopt Verbose Mode value from environment.
@@ -163,6 +168,103 @@ long GetCurloptVerboseMode()
  */
 static Dali::TizenPlatform::Network::CurlEnvironment gCurlEnvironment;
 
+/**
+ * @brief Share handle of the DNS cache, the TLS sessions and the connections between all the curl handles.
+ *
+ * A new download to a host already visited by any thread doesn't need a DNS lookup nor a TCP / TLS handshake.
+ */
+class CurlShare
+{
+public:
+  CurlShare()
+  : mShareHandle(curl_share_init())
+  {
+    if(mShareHandle)
+    {
+      curl_share_setopt(mShareHandle, CURLSHOPT_LOCKFUNC, Lock);
+      curl_share_setopt(mShareHandle, CURLSHOPT_UNLOCKFUNC, Unlock);
+      curl_share_setopt(mShareHandle, CURLSHOPT_USERDATA, this);
+      curl_share_setopt(mShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+      curl_share_setopt(mShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900 // 7.57.0
+      curl_share_setopt(mShareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+    }
+  }
+
+  ~CurlShare()
+  {
+    if(mShareHandle)
+    {
+      // It fails if some handles still use it, e.g. the handle of a thread still running.
+      curl_share_cleanup(mShareHandle);
+    }
+  }
+
+  CURLSH* GetHandle() const
+  {
+    return mShareHandle;
+  }
+
+private:
+  static void Lock(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr)
+  {
+    static_cast<CurlShare*>(userptr)->mMutexes[data].lock();
+  }
+
+  static void Unlock(CURL* handle, curl_lock_data data, void* userptr)
+  {
+    static_cast<CurlShare*>(userptr)->mMutexes[data].unlock();
+  }
+
+private:
+  CURLSH*    mShareHandle;
+  std::mutex mMutexes[CURL_LOCK_DATA_LAST];
+};
+
+/**
+ * @brief Get the share handle. It is created after the curl environment, so destroyed before it.
+ */
+CURLSH* GetCurlShareHandle()
+{
+  static CurlShare curlShare;
+  return curlShare.GetHandle();
+}
+
+/**
+ * @brief The curl handle of a thread. It keeps its connections alive between the downloads of the thread.
+ */
+struct ThreadCurlHandle
+{
+  ~ThreadCurlHandle()
+  {
+    if(mCurlHandle)
+    {
+      curl_easy_cleanup(mCurlHandle);
+    }
+  }
+
+  CURL* mCurlHandle{nullptr};
+};
+
+/**
+ * @brief Get the curl handle of the current thread, with default options.
+ */
+CURL* GetThreadCurlHandle()
+{
+  thread_local ThreadCurlHandle threadCurlHandle;
+  if(!threadCurlHandle.mCurlHandle)
+  {
+    threadCurlHandle.mCurlHandle = curl_easy_init();
+  }
+  else
+  {
+    // Reset the options only. The connections, the DNS cache and the TLS sessions are kept.
+    curl_easy_reset(threadCurlHandle.mCurlHandle);
+  }
+  return threadCurlHandle.mCurlHandle;
+}
+
 void ConfigureCurlOptions(CURL* curlHandle, const std::string& url)
 {
   auto verboseMode = GetCurloptVerboseMode(); // 0 : off, 1 : on
@@ -174,11 +276,18 @@ void ConfigureCurlOptions(CURL* curlHandle, const std::string& url)
   // Removed CURLOPT_FAILONERROR option
   curl_easy_setopt(curlHandle, CURLOPT_CONNECTTIMEOUT, CONNECTION_TIMEOUT_SECONDS);
   curl_easy_setopt(curlHandle, CURLOPT_TIMEOUT, TIMEOUT_SECONDS);
-  curl_easy_setopt(curlHandle, CURLOPT_HEADER, INCLUDE_HEADER);
-  curl_easy_setopt(curlHandle, CURLOPT_NOBODY, EXCLUDE_BODY);
+  curl_easy_setopt(curlHandle, CURLOPT_HEADER, EXCLUDE_HEADER);
+  curl_easy_setopt(curlHandle, CURLOPT_NOBODY, INCLUDE_BODY);
   curl_easy_setopt(curlHandle, CURLOPT_NOSIGNAL, 1L);
   curl_easy_setopt(curlHandle, CURLOPT_FOLLOWLOCATION, 1L);
   curl_easy_setopt(curlHandle, CURLOPT_MAXREDIRS, 5L);
+  curl_easy_setopt(curlHandle, CURLOPT_TCP_KEEPALIVE, 1L);
+
+  CURLSH* shareHandle = GetCurlShareHandle();
+  if(shareHandle)
+  {
+    curl_easy_setopt(curlHandle, CURLOPT_SHARE, shareHandle);
+  }
 
   if(verboseMode != 0)
   {
@@ -195,171 +304,249 @@ void ConfigureCurlOptions(CURL* curlHandle, const std::string& url)
   }
 }
 
-// Without a write function or a buffer (file descriptor) to write to, curl will pump out
-// header/body contents to stdout
-size_t DummyWrite(char* ptr, size_t size, size_t nmemb, void* userdata)
+/**
+ * @brief The state of a download in the http disk cache.
+ */
+struct CacheContext
 {
-  return size * nmemb;
-}
+  ~CacheContext()
+  {
+    if(requestHeaders)
+    {
+      curl_slist_free_all(requestHeaders);
+    }
+  }
 
-struct ChunkData
-{
-  std::vector<uint8_t> data;
+  Network::HttpDiskCache::Metadata        cachedMetadata;          ///< The metadata of the cached response, if cached
+  Network::HttpDiskCache::ResponseHeaders responseHeaders;         ///< The caching headers received
+  curl_slist*                             requestHeaders{nullptr}; ///< The conditional request headers
+  bool                                    cached{false};           ///< Whether the url is cached
 };
 
-size_t ChunkLoader(char* ptr, size_t size, size_t nmemb, void* userdata)
+/**
+ * @brief The state of a download, written by WriteToBuffer().
+ */
+struct DownloadContext
 {
-  std::vector<ChunkData>* chunks   = static_cast<std::vector<ChunkData>*>(userdata);
-  int                     numBytes = size * nmemb;
-  chunks->push_back(ChunkData());
-  ChunkData& chunkData = (*chunks)[chunks->size() - 1];
-  chunkData.data.reserve(numBytes);
-  memcpy(&chunkData.data[0], ptr, numBytes);
-  return numBytes;
-}
+  DownloadContext(CURL* curlHandle, Dali::Vector<uint8_t>& dataBuffer, size_t maximumAllowedSizeBytes)
+  : curlHandle(curlHandle),
+    dataBuffer(dataBuffer),
+    dataSize(0u),
+    maximumAllowedSizeBytes(maximumAllowedSizeBytes),
+    contentLengthChecked(false),
+    sizeExceeded(false)
+  {
+  }
 
-CURLcode DownloadFileDataWithSize(CURL* curlHandle, Dali::Vector<uint8_t>& dataBuffer, size_t dataSize)
-{
-  CURLcode result(CURLE_OK);
+  CURL*                  curlHandle;
+  Dali::Vector<uint8_t>& dataBuffer;
+  size_t                 dataSize;
+  size_t                 maximumAllowedSizeBytes;
+  bool                   contentLengthChecked;
+  bool                   sizeExceeded;
+  CacheContext           cache;
+};
 
-  // create
-  Dali::Internal::Platform::FileWriter fileWriter(dataBuffer, dataSize);
-  FILE*                                dataBufferFilePointer = fileWriter.GetFile();
+/**
+ * @brief Write the received body into the data buffer, growing it on demand.
+ *
+ * The content length, if known, is used to allocate the buffer once.
+ */
+size_t WriteToBuffer(char* ptr, size_t size, size_t nmemb, void* userdata)
+{
+  DownloadContext& context  = *static_cast<DownloadContext*>(userdata);
+  const size_t     numBytes = size * nmemb;
 
-  if(NULL != dataBufferFilePointer)
+  if(!context.contentLengthChecked)
   {
-    setbuf(dataBufferFilePointer, NULL); // Turn buffering off
+    context.contentLengthChecked = true;
 
-    // we only want the body which contains the file data
-    curl_easy_setopt(curlHandle, CURLOPT_HEADER, EXCLUDE_HEADER);
-    curl_easy_setopt(curlHandle, CURLOPT_NOBODY, INCLUDE_BODY);
+    // get the content length, -1 == size is not known
+    curl_off_t contentLength{-1};
+    curl_easy_getinfo(context.curlHandle, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &contentLength);
+    if(contentLength >= static_cast<curl_off_t>(context.maximumAllowedSizeBytes))
+    {
+      DALI_LOG_ERROR("File content length %" CURL_FORMAT_CURL_OFF_T " > max allowed %zu\n", contentLength, context.maximumAllowedSizeBytes);
+      context.sizeExceeded = true;
+      return 0u; // Abort the download.
+    }
 
-    // disable the write callback, and get curl to write directly into our data buffer
-    curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, NULL);
-    curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, dataBufferFilePointer);
+    context.dataBuffer.Clear();
+    context.dataBuffer.Reserve(contentLength > 0 ? static_cast<size_t>(contentLength) : MINIMUM_DOWNLOAD_BUFFER_SIZE);
+  }
 
-    // synchronous request of the body data
-    result = curl_easy_perform(curlHandle);
+  const size_t requiredSize = context.dataSize + numBytes;
+  if(requiredSize >= context.maximumAllowedSizeBytes)
+  {
+    DALI_LOG_ERROR("File size > max allowed %zu\n", context.maximumAllowedSizeBytes);
+    context.sizeExceeded = true;
+    return 0u; // Abort the download.
   }
-  else
+
+  if(requiredSize > context.dataBuffer.Capacity())
   {
-    DALI_LOG_ERROR("Fail to open buffer writter with size : %zu!\n", dataSize);
-    // @todo : Need to check that is it correct error code?
-    result = CURLE_READ_ERROR;
+    // The content length is unknown or wrong. Grow the buffer geometrically.
+    context.dataBuffer.Reserve(std::min(std::max(requiredSize, 2u * context.dataBuffer.Capacity()), context.maximumAllowedSizeBytes));
   }
-  return result;
-}
 
-CURLcode DownloadFileDataByChunk(CURL* curlHandle, Dali::Vector<uint8_t>& dataBuffer, size_t& dataSize)
-{
-  // create
-  std::vector<ChunkData> chunks;
+  context.dataBuffer.ResizeUninitialized(requiredSize);
+  memcpy(context.dataBuffer.Begin() + context.dataSize, ptr, numBytes);
+  context.dataSize = requiredSize;
 
-  // we only want the body which contains the file data
-  curl_easy_setopt(curlHandle, CURLOPT_HEADER, EXCLUDE_HEADER);
-  curl_easy_setopt(curlHandle, CURLOPT_NOBODY, INCLUDE_BODY);
-
-  // Enable the write callback.
-  curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, ChunkLoader);
-  curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, &chunks);
+  return numBytes;
+}
 
-  // synchronous request of the body data
-  CURLcode result = curl_easy_perform(curlHandle);
+size_t ReadHeader(char* buffer, size_t size, size_t nitems, void* userdata)
+{
+  const size_t numBytes = size * nitems;
+  static_cast<Network::HttpDiskCache::ResponseHeaders*>(userdata)->Parse(buffer, numBytes);
+  return numBytes;
+}
 
-  // chunks should now contain all of the chunked data. Reassemble into a single vector
-  dataSize = 0;
-  for(size_t i = 0; i < chunks.size(); ++i)
+/**
+ * @brief Load the cached content of the url if it is still fresh.
+ *
+ * Otherwise, keep the metadata of the cached response to revalidate it.
+ *
+ * @return True if the content has been loaded, and no download is needed
+ */
+bool LoadFreshCacheEntry(const std::string& url, DownloadContext& context)
+{
+  auto& cache = Network::HttpDiskCache::Get();
+  if(!cache.IsEnabled())
   {
-    dataSize += chunks[i].data.capacity();
+    return false;
   }
-  dataBuffer.ResizeUninitialized(dataSize);
 
-  if(DALI_LIKELY(dataSize > 0))
+  context.cache.cached = cache.LoadMetadata(url, context.cache.cachedMetadata);
+  if(context.cache.cached && context.cache.cachedMetadata.expiryTime > Network::HttpDiskCache::GetCurrentTime())
   {
-    std::uint8_t* dataBufferPtr = dataBuffer.Begin();
-    for(size_t i = 0; i < chunks.size(); ++i)
+    if(cache.LoadData(url, context.dataBuffer, context.dataSize))
     {
-      memcpy(dataBufferPtr, &chunks[i].data[0], chunks[i].data.capacity());
-      dataBufferPtr += chunks[i].data.capacity();
+      return true;
     }
+    context.cache.cached = false;
   }
-
-  return result;
+  return false;
 }
 
-bool DownloadFile(CURL*                  curlHandle,
-                  const std::string&     url,
-                  Dali::Vector<uint8_t>& dataBuffer,
-                  size_t&                dataSize,
-                  size_t                 maximumAllowedSizeBytes,
-                  char*                  errorBuffer)
+/**
+ * @brief Collect the caching headers of the response, and make the request conditional if the url is cached.
+ */
+void ConfigureCacheOptions(CURL* curlHandle, DownloadContext& context)
 {
-  CURLcode result(CURLE_OK);
-
-  // setup curl to download just the header so we can extract the content length
-  ConfigureCurlOptions(curlHandle, url);
-  curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, DummyWrite);
-  if(errorBuffer != nullptr)
+  if(!Network::HttpDiskCache::Get().IsEnabled())
   {
-    errorBuffer[0] = 0;
+    return;
   }
 
-  // perform the request to get the header
-  result = curl_easy_perform(curlHandle);
+  curl_easy_setopt(curlHandle, CURLOPT_HEADERFUNCTION, ReadHeader);
+  curl_easy_setopt(curlHandle, CURLOPT_HEADERDATA, &context.cache.responseHeaders);
 
-  if(result != CURLE_OK)
+  const auto& metadata = context.cache.cachedMetadata;
+  if(context.cache.cached && metadata.HasValidator())
   {
-    if(errorBuffer != nullptr)
+    if(!metadata.etag.empty())
     {
-      DALI_LOG_ERROR("Failed to download http header for \"%s\" with error code %d (%s)\n", url.c_str(), result, &errorBuffer[0]);
+      context.cache.requestHeaders = curl_slist_append(context.cache.requestHeaders, ("If-None-Match: " + metadata.etag).c_str());
     }
-    else
+    if(!metadata.lastModified.empty())
     {
-      DALI_LOG_ERROR("Failed to download http header for \"%s\" with error code %d\n", url.c_str(), result);
+      context.cache.requestHeaders = curl_slist_append(context.cache.requestHeaders, ("If-Modified-Since: " + metadata.lastModified).c_str());
     }
-    return false;
+    curl_easy_setopt(curlHandle, CURLOPT_HTTPHEADER, context.cache.requestHeaders);
   }
+}
 
-  // get the content length, -1 == size is not known
-  curl_off_t size{0};
-  curl_easy_getinfo(curlHandle, CURLINFO_CONTENT_LENGTH_DOWNLOAD_T, &size);
-
-  if(size == -1)
-  {
-    result = DownloadFileDataByChunk(curlHandle, dataBuffer, dataSize);
-  }
-  else if(size >= static_cast<curl_off_t>(maximumAllowedSizeBytes))
+/**
+ * @brief Load the cached content if the server has not modified it, or store the downloaded content.
+ *
+ * @return False if the cached content could not be loaded
+ */
+bool UpdateCache(DownloadContext& context, const std::string& url)
+{
+  auto& cache = Network::HttpDiskCache::Get();
+  if(!cache.IsEnabled())
   {
-    DALI_LOG_ERROR("File content length %" CURL_FORMAT_CURL_OFF_T " > max allowed %zu \"%s\" \n", size, maximumAllowedSizeBytes, url.c_str());
-    return false;
+    return true;
   }
-  else
+
+  long responseCode = 0L;
+  curl_easy_getinfo(context.curlHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+
+  Network::HttpDiskCache::Metadata metadata;
+  const bool                       storable = Network::HttpDiskCache::GetResponseMetadata(context.cache.responseHeaders, Network::HttpDiskCache::GetCurrentTime(), metadata);
+
+  if(responseCode == HTTP_RESPONSE_NOT_MODIFIED && context.cache.cached)
   {
-    // If we know the size up front, allocate once and avoid chunk copies.
-    dataSize = static_cast<size_t>(size);
-    result   = DownloadFileDataWithSize(curlHandle, dataBuffer, dataSize);
-    if(result != CURLE_OK)
+    if(!cache.LoadData(url, context.dataBuffer, context.dataSize))
     {
-      LogCurlResult(result, errorBuffer, url, "Failed to download file, trying to load by chunk");
-      // In the case where the size is wrong (e.g. on a proxy server that rewrites data),
-      // the data buffer will be corrupt. In this case, try again using the chunk writer.
-      result = DownloadFileDataByChunk(curlHandle, dataBuffer, dataSize);
+      DALI_LOG_ERROR("Failed to load the cached file of \"%s\"\n", url.c_str());
+      return false;
     }
+    cache.UpdateExpiryTime(url, metadata.expiryTime);
+  }
+  else if(responseCode == HTTP_RESPONSE_OK && storable)
+  {
+    cache.Store(url, metadata, context.dataBuffer.Begin(), context.dataSize);
   }
+  return true;
+}
 
+/**
+ * @brief Check the result of a finished download, and update the http disk cache.
+ */
+bool CheckDownloadResult(CURLcode result, DownloadContext& context, const std::string& url, char* errorBuffer)
+{
   LogCurlResult(result, errorBuffer, url, "Failed to download image file");
 
-  if(result != CURLE_OK)
+  if(result != CURLE_OK || context.sizeExceeded || !UpdateCache(context, url))
   {
     return false;
   }
-  else if(DALI_UNLIKELY(dataSize == 0u))
+  else if(DALI_UNLIKELY(context.dataSize == 0u))
   {
     DALI_LOG_WARNING("Warning : Download data size is 0! url : %s\n", url.c_str());
   }
   return true;
 }
 
+bool DownloadFile(CURL*                  curlHandle,
+                  const std::string&     url,
+                  Dali::Vector<uint8_t>& dataBuffer,
+                  size_t&                dataSize,
+                  size_t                 maximumAllowedSizeBytes,
+                  char*                  errorBuffer)
+{
+  DownloadContext context(curlHandle, dataBuffer, maximumAllowedSizeBytes);
+  if(LoadFreshCacheEntry(url, context))
+  {
+    dataSize = context.dataSize;
+    return true;
+  }
+
+  // A single request. The body is written into the buffer as it arrives.
+  ConfigureCurlOptions(curlHandle, url);
+  ConfigureCacheOptions(curlHandle, context);
+  curl_easy_setopt(curlHandle, CURLOPT_WRITEFUNCTION, WriteToBuffer);
+  curl_easy_setopt(curlHandle, CURLOPT_WRITEDATA, &context);
+  if(errorBuffer != nullptr)
+  {
+    curl_easy_setopt(curlHandle, CURLOPT_ERRORBUFFER, errorBuffer);
+    errorBuffer[0] = 0;
+  }
+
+  // synchronous request of the body data
+  CURLcode result = curl_easy_perform(curlHandle);
+
+  // The error buffer may be released after this call.
+  curl_easy_setopt(curlHandle, CURLOPT_ERRORBUFFER, nullptr);
+
+  const bool succeeded = CheckDownloadResult(result, context, url, errorBuffer);
+  dataSize             = context.dataSize;
+  return succeeded;
+}
+
 } // unnamed namespace
 
 namespace Network
@@ -389,22 +576,159 @@ bool DownloadRemoteFileIntoMemory(const std::string&     url,
     return false;
   }
 
-  // start a libcurl easy session, this internally calls curl_global_init, if we ever have more than one download
-  // thread we need to explicity call curl_global_init() on startup from a single thread.
-
-  CURL* curlHandle = curl_easy_init();
+  // Reuse the libcurl easy session of this thread, so the connection to the host is reused.
+  // curl_global_init() has been called on startup by the curl environment.
+  CURL* curlHandle = GetThreadCurlHandle();
   if(curlHandle)
   {
-    std::vector<char> errorBuffer(CURL_ERROR_SIZE);
-    curl_easy_setopt(curlHandle, CURLOPT_ERRORBUFFER, &errorBuffer[0]);
-    result = DownloadFile(curlHandle, url, dataBuffer, dataSize, maximumAllowedSizeBytes, &errorBuffer[0]);
-
-    // clean up session
-    curl_easy_cleanup(curlHandle);
+    char errorBuffer[CURL_ERROR_SIZE];
+    result = DownloadFile(curlHandle, url, dataBuffer, dataSize, maximumAllowedSizeBytes, errorBuffer);
   }
   return result;
 }
 
+bool DownloadRemoteFilesIntoMemory(const std::vector<std::string>& urls,
+                                   std::vector<DownloadResult>&    results,
+                                   size_t                          maximumAllowedSizeBytes,
+                                   uint32_t                        maximumConcurrentDownloads)
+{
+  results.clear();
+  results.resize(urls.size());
+
+  CURLM* multiHandle = curl_multi_init();
+  if(!multiHandle)
+  {
+    DALI_LOG_ERROR("Fail to create curl multi handle. Download one by one\n");
+
+    bool succeeded = true;
+    for(size_t i = 0u; i < urls.size(); ++i)
+    {
+      results[i].succeeded = DownloadRemoteFileIntoMemory(urls[i], results[i].dataBuffer, results[i].dataSize, maximumAllowedSizeBytes);
+      succeeded &= results[i].succeeded;
+    }
+    return succeeded;
+  }
+
+  maximumConcurrentDownloads = std::max(1u, std::min(maximumConcurrentDownloads, static_cast<uint32_t>(urls.size())));
+  curl_multi_setopt(multiHandle, CURLMOPT_MAX_TOTAL_CONNECTIONS, static_cast<long>(maximumConcurrentDownloads));
+  curl_multi_setopt(multiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+
+  // The transfers running at the same time. Their curl handles are reused for the next urls.
+  struct Transfer
+  {
+    CURL*                            curlHandle{nullptr};
+    size_t                           urlIndex{0u};
+    std::unique_ptr<DownloadContext> context;
+    char                             errorBuffer[CURL_ERROR_SIZE];
+  };
+  std::vector<Transfer> transfers(maximumConcurrentDownloads);
+
+  size_t nextUrlIndex = 0u;
+  auto   startNextDownload = [&](Transfer& transfer) -> bool {
+    for(; nextUrlIndex < urls.size(); ++nextUrlIndex)
+    {
+      if(urls[nextUrlIndex].empty())
+      {
+        DALI_LOG_WARNING("empty url requested \n");
+        continue;
+      }
+
+      const size_t urlIndex = nextUrlIndex;
+      transfer.context.reset(new DownloadContext(transfer.curlHandle, results[urlIndex].dataBuffer, maximumAllowedSizeBytes));
+      if(LoadFreshCacheEntry(urls[urlIndex], *transfer.context))
+      {
+        results[urlIndex].dataSize  = transfer.context->dataSize;
+        results[urlIndex].succeeded = true;
+        continue;
+      }
+
+      if(!transfer.curlHandle)
+      {
+        transfer.curlHandle = curl_easy_init();
+        if(!transfer.curlHandle)
+        {
+          return false;
+        }
+      }
+      else
+      {
+        curl_easy_reset(transfer.curlHandle);
+      }
+
+      transfer.urlIndex            = nextUrlIndex++;
+      transfer.context->curlHandle = transfer.curlHandle;
+      transfer.errorBuffer[0]      = 0;
+
+      ConfigureCurlOptions(transfer.curlHandle, urls[transfer.urlIndex]);
+      ConfigureCacheOptions(transfer.curlHandle, *transfer.context);
+      curl_easy_setopt(transfer.curlHandle, CURLOPT_WRITEFUNCTION, WriteToBuffer);
+      curl_easy_setopt(transfer.curlHandle, CURLOPT_WRITEDATA, transfer.context.get());
+      curl_easy_setopt(transfer.curlHandle, CURLOPT_ERRORBUFFER, transfer.errorBuffer);
+      curl_easy_setopt(transfer.curlHandle, CURLOPT_PRIVATE, &transfer);
+
+      curl_multi_add_handle(multiHandle, transfer.curlHandle);
+      return true;
+    }
+    return false;
+  };
+
+  for(auto& transfer : transfers)
+  {
+    startNextDownload(transfer);
+  }
+
+  int runningCount = 0;
+  do
+  {
+    CURLMcode multiResult = curl_multi_perform(multiHandle, &runningCount);
+    if(multiResult != CURLM_OK)
+    {
+      DALI_LOG_ERROR("curl_multi_perform failed with error code %d\n", multiResult);
+      break;
+    }
+
+    int      messageCount = 0;
+    CURLMsg* message      = nullptr;
+    while((message = curl_multi_info_read(multiHandle, &messageCount)))
+    {
+      if(message->msg != CURLMSG_DONE)
+      {
+        continue;
+      }
+
+      Transfer* transfer = nullptr;
+      curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, reinterpret_cast<char**>(&transfer));
+      curl_multi_remove_handle(multiHandle, message->easy_handle);
+
+      DownloadResult& result = results[transfer->urlIndex];
+      result.succeeded       = CheckDownloadResult(message->data.result, *transfer->context, urls[transfer->urlIndex], transfer->errorBuffer);
+      result.dataSize        = transfer->context->dataSize;
+
+      if(startNextDownload(*transfer))
+      {
+        ++runningCount;
+      }
+    }
+
+    if(runningCount > 0)
+    {
+      curl_multi_wait(multiHandle, nullptr, 0u, 1000, nullptr);
+    }
+  } while(runningCount > 0);
+
+  for(auto& transfer : transfers)
+  {
+    if(transfer.curlHandle)
+    {
+      curl_multi_remove_handle(multiHandle, transfer.curlHandle);
+      curl_easy_cleanup(transfer.curlHandle);
+    }
+  }
+  curl_multi_cleanup(multiHandle);
+
+  return std::all_of(results.begin(), results.end(), [](const DownloadResult& result) { return result.succeeded; });
+}
+
 } // namespace Network
 
 } // namespace TizenPlatform
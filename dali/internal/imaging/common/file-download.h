@@ -2,7 +2,7 @@
 #define DALI_TIZEN_PLATFORM_NETWORK_FILE_DOWNLOAD_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,6 +23,7 @@
 #include <stdint.h> // uint8
 #include <mutex>    //c++11
 #include <string>
+#include <vector>
 
 namespace Dali
 {
@@ -60,6 +61,10 @@ public:
 /**
  * Download a requested file into a memory buffer.
  *
+ * The file is downloaded with a single request. Each thread reuses its own curl handle,
+ * and all the handles share the DNS cache, the TLS sessions and the connections,
+ * so consecutive downloads from the same host reuse the connection.
+ *
  * @note Threading notes: This function can be called from multiple threads, however
  * we must explicitly call curl_global_init() from a single thread before using curl
  * as the global function calls are not thread safe.
@@ -76,6 +81,32 @@ bool DownloadRemoteFileIntoMemory(const std::string&     url,
                                   size_t&                dataSize,
                                   size_t                 maximumAllowedSizeBytes);
 
+/**
+ * Result of a download of DownloadRemoteFilesIntoMemory().
+ */
+struct DownloadResult
+{
+  Dali::Vector<uint8_t> dataBuffer;        ///< A memory buffer object written with downloaded file data.
+  size_t                dataSize{0u};      ///< The size of the downloaded file data.
+  bool                  succeeded{false};  ///< Whether the download succeeded.
+};
+
+/**
+ * Download many requested files into memory buffers, running several downloads at the same time.
+ *
+ * @note Threading notes: As DownloadRemoteFileIntoMemory(). The function returns when all the downloads have finished.
+ *
+ * @param[in] urls The requested file urls
+ * @param[out] results The result of the download of each url, in the same order
+ * @param[in] maximumAllowedSizeBytes The maxmimum allowed file size in bytes to download.
+ * @param[in] maximumConcurrentDownloads The maximum number of downloads running at the same time.
+ * @return true if all the downloads succeeded, false otherwise
+ */
+bool DownloadRemoteFilesIntoMemory(const std::vector<std::string>& urls,
+                                   std::vector<DownloadResult>&    results,
+                                   size_t                          maximumAllowedSizeBytes,
+                                   uint32_t                        maximumConcurrentDownloads = 8u);
+
 } // namespace Network
 
 } // namespace TizenPlatform
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,13 +15,19 @@
  */
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/integration-api/debug.h>
 #include <memory.h>
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/internal/imaging/common/gaussian-blur.h>
 #include <dali/internal/imaging/common/pixel-buffer-impl.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/system/common/worker-thread-pool.h>
 
 namespace Dali
 {
@@ -29,86 +35,341 @@ namespace Internal
 {
 namespace Adaptor
 {
-void ConvoluteAndTranspose(unsigned char*     inBuffer,
-                           unsigned char*     outBuffer,
-                           const unsigned int bufferWidth,
-                           const unsigned int bufferHeight,
-                           const unsigned int inBufferStride,
-                           const unsigned int outBufferStride,
-                           const float        blurRadius)
+namespace
 {
-  // Calculate the weights for gaussian blur
-  int radius = static_cast<int>(std::ceil(blurRadius));
-  int rows   = radius * 2 + 1;
+constexpr uint32_t BYTES_PER_PIXEL     = 4u;
+constexpr uint32_t WEIGHT_SHIFT        = 16u;                        ///< Weights are fixed point numbers, summed up to 1 << WEIGHT_SHIFT.
+constexpr uint32_t WEIGHT_ONE          = 1u << WEIGHT_SHIFT;
+constexpr uint32_t WEIGHT_ROUND        = 1u << (WEIGHT_SHIFT - 1u);
+constexpr uint32_t TRANSPOSE_TILE_SIZE = 16u;                        ///< Rows blurred together, so each transposed write fills a 64 byte cache line.
+constexpr uint32_t NUMBER_OF_BOXES     = 3u;                         ///< Number of box blurs to approximate Gaussian blur.
 
-  float sigma           = (blurRadius < Math::MACHINE_EPSILON_1) ? 0.0f : blurRadius * 0.4f + 0.6f; // The same equation used by Android
-  float sigma22         = 2.0f * sigma * sigma;
-  float sqrtSigmaPi2    = std::sqrt(2.0f * Math::PI) * sigma;
-  float radius2         = radius * radius;
-  float normalizeFactor = 0.0f;
+constexpr uint32_t MINIMUM_PIXELS_FOR_MULTI_THREAD = 256u * 256u;    ///< Smaller buffers are blurred on the calling thread.
+constexpr uint32_t MINIMUM_ROWS_PER_PART           = 64u;
 
-  float* weightMatrix = new float[rows];
-  int    index        = 0;
+#if defined(__GNUC__) || defined(__clang__)
+/**
+ * Four 32 bit lanes, one for each channel of a RGBA pixel.
+ * The compiler maps it to a SSE or NEON register.
+ */
+typedef uint32_t PixelVector __attribute__((vector_size(16)));
+
+inline PixelVector LoadPixel(const uint8_t* pixel)
+{
+  return PixelVector{pixel[0], pixel[1], pixel[2], pixel[3]};
+}
+
+inline PixelVector SplatPixel(uint32_t value)
+{
+  return PixelVector{value, value, value, value};
+}
+#else
+struct PixelVector
+{
+  uint32_t v[4];
+
+  uint32_t operator[](int index) const
+  {
+    return v[index];
+  }
+  PixelVector& operator+=(const PixelVector& rhs)
+  {
+    v[0] += rhs.v[0], v[1] += rhs.v[1], v[2] += rhs.v[2], v[3] += rhs.v[3];
+    return *this;
+  }
+  PixelVector& operator-=(const PixelVector& rhs)
+  {
+    v[0] -= rhs.v[0], v[1] -= rhs.v[1], v[2] -= rhs.v[2], v[3] -= rhs.v[3];
+    return *this;
+  }
+  PixelVector operator*(uint32_t rhs) const
+  {
+    return PixelVector{{v[0] * rhs, v[1] * rhs, v[2] * rhs, v[3] * rhs}};
+  }
+  PixelVector operator+(const PixelVector& rhs) const
+  {
+    return PixelVector{{v[0] + rhs.v[0], v[1] + rhs.v[1], v[2] + rhs.v[2], v[3] + rhs.v[3]}};
+  }
+  PixelVector operator>>(uint32_t rhs) const
+  {
+    return PixelVector{{v[0] >> rhs, v[1] >> rhs, v[2] >> rhs, v[3] >> rhs}};
+  }
+};
+
+inline PixelVector LoadPixel(const uint8_t* pixel)
+{
+  return PixelVector{{pixel[0], pixel[1], pixel[2], pixel[3]}};
+}
+
+inline PixelVector SplatPixel(uint32_t value)
+{
+  return PixelVector{{value, value, value, value}};
+}
+#endif
+
+inline void StorePixel(uint8_t* pixel, const PixelVector& value)
+{
+  pixel[0] = static_cast<uint8_t>(value[0]);
+  pixel[1] = static_cast<uint8_t>(value[1]);
+  pixel[2] = static_cast<uint8_t>(value[2]);
+  pixel[3] = static_cast<uint8_t>(value[3]);
+}
 
+/**
+ * The kernel shared by both passes of the blur.
+ */
+struct BlurKernel
+{
+  std::vector<uint32_t> weights;                ///< Fixed point weights of the Gaussian blur, from -radius to +radius.
+  uint32_t              boxRadii[NUMBER_OF_BOXES]; ///< Radii of the box blurs, if boxApproximation is true.
+  uint32_t              padding{0u};            ///< Number of pixels to replicate at both edges of a row.
+  bool                  boxApproximation{false};
+};
+
+/**
+ * Calculate the weights for gaussian blur, as same as the float weights used before, in fixed point.
+ */
+void CalculateGaussianWeights(BlurKernel& kernel, const float blurRadius)
+{
+  const int radius = static_cast<int>(std::ceil(blurRadius));
+  const int rows   = radius * 2 + 1;
+
+  const float sigma        = (blurRadius < Math::MACHINE_EPSILON_1) ? 0.0f : blurRadius * 0.4f + 0.6f; // The same equation used by Android
+  const float sigma22      = 2.0f * sigma * sigma;
+  const float sqrtSigmaPi2 = std::sqrt(2.0f * Math::PI) * sigma;
+
+  std::vector<float> weights(rows);
+  float              normalizeFactor = 0.0f;
   for(int row = -radius; row <= radius; row++)
   {
-    float distance = row * row;
-    if(distance > radius2)
+    const float distance  = static_cast<float>(row * row);
+    weights[row + radius] = static_cast<float>(std::exp(-(distance) / sigma22) / sqrtSigmaPi2);
+    normalizeFactor += weights[row + radius];
+  }
+
+  kernel.weights.resize(rows);
+  uint32_t sum = 0u;
+  for(int i = 0; i < rows; i++)
+  {
+    kernel.weights[i] = static_cast<uint32_t>(weights[i] / normalizeFactor * WEIGHT_ONE + 0.5f);
+    sum += kernel.weights[i];
+  }
+
+  // Give the rounding error to the center, so the weights are summed up to exactly one and the result never overflows.
+  kernel.weights[radius] += WEIGHT_ONE - sum;
+  kernel.padding = static_cast<uint32_t>(radius);
+}
+
+/**
+ * Calculate the sizes of three box blurs approximating Gaussian blur.
+ * @see http://www.peterkovesi.com/papers/FastGaussianSmoothing.pdf
+ */
+void CalculateBoxRadii(BlurKernel& kernel, const float blurRadius)
+{
+  const float sigma     = blurRadius * 0.4f + 0.6f;
+  const float boxes     = static_cast<float>(NUMBER_OF_BOXES);
+  const float idealSize = std::sqrt(12.0f * sigma * sigma / boxes + 1.0f);
+
+  int lowerSize = static_cast<int>(std::floor(idealSize));
+  if(lowerSize % 2 == 0)
+  {
+    lowerSize--;
+  }
+  const int upperSize = lowerSize + 2;
+
+  const float idealLowerCount = (12.0f * sigma * sigma - boxes * lowerSize * lowerSize - 4.0f * boxes * lowerSize - 3.0f * boxes) / (-4.0f * lowerSize - 4.0f);
+  const int   lowerCount      = static_cast<int>(std::round(idealLowerCount));
+
+  kernel.padding = 0u;
+  for(uint32_t i = 0u; i < NUMBER_OF_BOXES; ++i)
+  {
+    kernel.boxRadii[i] = static_cast<uint32_t>(((static_cast<int>(i) < lowerCount ? lowerSize : upperSize) - 1) / 2);
+    kernel.padding     = std::max(kernel.padding, kernel.boxRadii[i]);
+  }
+  kernel.boxApproximation = true;
+}
+
+/**
+ * Expand a row to PixelVectors, with its edge pixels replicated by padding.
+ * Each pixel is unpacked only once, and the kernels don't need to clamp each tap.
+ */
+void PadRow(const uint8_t* inRow, PixelVector* paddedRow, const uint32_t width, const uint32_t padding)
+{
+  const PixelVector first = LoadPixel(inRow);
+  const PixelVector last  = LoadPixel(inRow + (width - 1u) * BYTES_PER_PIXEL);
+
+  std::fill(paddedRow, paddedRow + padding, first);
+  for(uint32_t x = 0u; x < width; ++x)
+  {
+    paddedRow[padding + x] = LoadPixel(inRow + x * BYTES_PER_PIXEL);
+  }
+  std::fill(paddedRow + padding + width, paddedRow + padding + width + padding, last);
+}
+
+/**
+ * Blur a padded row with the Gaussian weights.
+ */
+void GaussianBlurRow(const PixelVector* paddedRow, uint8_t* outRow, const uint32_t width, const BlurKernel& kernel)
+{
+  const uint32_t* weights = kernel.weights.data();
+  const uint32_t  taps    = static_cast<uint32_t>(kernel.weights.size());
+
+  for(uint32_t x = 0u; x < width; ++x)
+  {
+    const PixelVector* source = paddedRow + x;
+
+    PixelVector sum = SplatPixel(WEIGHT_ROUND);
+    for(uint32_t tap = 0u; tap < taps; ++tap)
+    {
+      sum += source[tap] * weights[tap];
+    }
+    StorePixel(outRow + x * BYTES_PER_PIXEL, sum >> WEIGHT_SHIFT);
+  }
+}
+
+/**
+ * Blur a padded row with three box blurs, with running sums.
+ * The reciprocal of the box size is rounded down, so the result never exceeds 255.
+ */
+void BoxBlurRow(PixelVector* paddedRow, PixelVector* boxRow, uint8_t* outRow, const uint32_t width, const BlurKernel& kernel)
+{
+  const uint32_t padding = kernel.padding;
+  for(uint32_t box = 0u; box < NUMBER_OF_BOXES; ++box)
+  {
+    const uint32_t     radius     = kernel.boxRadii[box];
+    const uint32_t     size       = radius * 2u + 1u;
+    const uint32_t     reciprocal = WEIGHT_ONE / size;
+    const PixelVector* first      = paddedRow + (padding - radius);
+
+    PixelVector sum = SplatPixel(0u);
+    for(uint32_t i = 0u; i < size; ++i)
     {
-      weightMatrix[index] = 0.0f;
+      sum += first[i];
     }
-    else
+
+    for(uint32_t x = 0u; x < width; ++x)
     {
-      weightMatrix[index] = static_cast<float>(std::exp(-(distance) / sigma22) / sqrtSigmaPi2);
+      boxRow[x] = (sum * reciprocal + SplatPixel(WEIGHT_ROUND)) >> WEIGHT_SHIFT;
+      sum += first[x + size];
+      sum -= first[x];
     }
-    normalizeFactor += weightMatrix[index];
-    index++;
+
+    // The output of this box is the input of the next box.
+    std::copy(boxRow, boxRow + width, paddedRow + padding);
+    std::fill(paddedRow, paddedRow + padding, boxRow[0]);
+    std::fill(paddedRow + padding + width, paddedRow + padding + width + padding, boxRow[width - 1u]);
   }
 
-  for(int i = 0; i < rows; i++)
+  for(uint32_t x = 0u; x < width; ++x)
   {
-    weightMatrix[i] /= normalizeFactor;
+    StorePixel(outRow + x * BYTES_PER_PIXEL, boxRow[x]);
   }
+}
 
-  // Perform the convolution and transposition using the weights
-  int columns  = rows;
-  int columns2 = columns / 2;
-  for(unsigned int y = 0; y < bufferHeight; y++)
+/**
+ * Perform a one dimension blur for the rows [beginRow, endRow) and write its output buffer transposed.
+ *
+ * Rows are blurred by tiles of TRANSPOSE_TILE_SIZE rows, so each output row is written contiguously.
+ */
+void ConvoluteAndTransposeRows(const uint8_t*    inBuffer,
+                               uint8_t*          outBuffer,
+                               const uint32_t    bufferWidth,
+                               const uint32_t    inBufferStride,
+                               const uint32_t    outBufferStride,
+                               const BlurKernel& kernel,
+                               const uint32_t    beginRow,
+                               const uint32_t    endRow)
+{
+  const uint32_t           rowSize = bufferWidth * BYTES_PER_PIXEL;
+  std::vector<PixelVector> paddedRow(bufferWidth + kernel.padding * 2u + 1u);
+  std::vector<PixelVector> boxRow(kernel.boxApproximation ? bufferWidth : 0u);
+  std::vector<uint8_t>     tile(TRANSPOSE_TILE_SIZE * rowSize);
+
+  for(uint32_t tileRow = beginRow; tileRow < endRow; tileRow += TRANSPOSE_TILE_SIZE)
   {
-    unsigned int targetPixelIndex = y;
-    unsigned int ioffset          = y * inBufferStride;
-    for(unsigned int x = 0; x < bufferWidth; x++)
+    const uint32_t tileHeight = std::min(TRANSPOSE_TILE_SIZE, endRow - tileRow);
+
+    for(uint32_t row = 0u; row < tileHeight; ++row)
     {
-      float r = 0.0f, g = 0.0f, b = 0.0f, a = 0.0f;
-      int   weightColumnOffset = columns2;
-      for(int column = -columns2; column <= columns2; column++)
+      PadRow(inBuffer + (tileRow + row) * inBufferStride * BYTES_PER_PIXEL, paddedRow.data(), bufferWidth, kernel.padding);
+      if(kernel.boxApproximation)
       {
-        float weight = weightMatrix[weightColumnOffset + column];
-        if(fabsf(weight) > Math::MACHINE_EPSILON_1)
-        {
-          int ix                        = x + column;
-          ix                            = std::max(0, std::min(ix, static_cast<int>(bufferWidth - 1)));
-          unsigned int sourcePixelIndex = ioffset + ix;
-          r += weight * inBuffer[sourcePixelIndex * 4];
-          g += weight * inBuffer[sourcePixelIndex * 4 + 1];
-          b += weight * inBuffer[sourcePixelIndex * 4 + 2];
-          a += weight * inBuffer[sourcePixelIndex * 4 + 3];
-        }
+        BoxBlurRow(paddedRow.data(), boxRow.data(), tile.data() + row * rowSize, bufferWidth, kernel);
       }
+      else
+      {
+        GaussianBlurRow(paddedRow.data(), tile.data() + row * rowSize, bufferWidth, kernel);
+      }
+    }
 
-      outBuffer[targetPixelIndex * 4]     = std::max(0, std::min(static_cast<int>(r + 0.5f), 255));
-      outBuffer[targetPixelIndex * 4 + 1] = std::max(0, std::min(static_cast<int>(g + 0.5f), 255));
-      outBuffer[targetPixelIndex * 4 + 2] = std::max(0, std::min(static_cast<int>(b + 0.5f), 255));
-      outBuffer[targetPixelIndex * 4 + 3] = std::max(0, std::min(static_cast<int>(a + 0.5f), 255));
-
-      targetPixelIndex += outBufferStride;
+    for(uint32_t x = 0u; x < bufferWidth; ++x)
+    {
+      uint8_t*       target = outBuffer + (x * outBufferStride + tileRow) * BYTES_PER_PIXEL;
+      const uint8_t* source = tile.data() + x * BYTES_PER_PIXEL;
+      for(uint32_t row = 0u; row < tileHeight; ++row)
+      {
+        memcpy(target + row * BYTES_PER_PIXEL, source + row * rowSize, BYTES_PER_PIXEL);
+      }
     }
   }
+}
+
+/**
+ * Perform a one dimension blur and write its output buffer transposed.
+ * Large buffers are split by rows to the worker threads.
+ */
+void ConvoluteAndTranspose(const uint8_t*    inBuffer,
+                           uint8_t*          outBuffer,
+                           const uint32_t    bufferWidth,
+                           const uint32_t    bufferHeight,
+                           const uint32_t    inBufferStride,
+                           const uint32_t    outBufferStride,
+                           const BlurKernel& kernel)
+{
+  uint32_t numberOfParts = 1u;
+  if(bufferWidth * bufferHeight >= MINIMUM_PIXELS_FOR_MULTI_THREAD)
+  {
+    // The calling thread blurs a part too.
+    numberOfParts = std::max(1u, std::min(WorkerThreadPool::Get().GetWorkerCount() + 1u, bufferHeight / MINIMUM_ROWS_PER_PART));
+  }
+
+  if(numberOfParts == 1u)
+  {
+    ConvoluteAndTransposeRows(inBuffer, outBuffer, bufferWidth, inBufferStride, outBufferStride, kernel, 0u, bufferHeight);
+    return;
+  }
+
+  // Split by whole tiles, so the parts never write to the same cache line.
+  const uint32_t numberOfTiles = (bufferHeight + TRANSPOSE_TILE_SIZE - 1u) / TRANSPOSE_TILE_SIZE;
+  const uint32_t rowsPerPart   = (numberOfTiles + numberOfParts - 1u) / numberOfParts * TRANSPOSE_TILE_SIZE;
 
-  delete[] weightMatrix;
+  WorkerThreadPool::Get().Run(numberOfParts, [&kernel, inBuffer, outBuffer, bufferWidth, bufferHeight, inBufferStride, outBufferStride, rowsPerPart](uint32_t index) {
+    const uint32_t beginRow = std::min(index * rowsPerPart, bufferHeight);
+    const uint32_t endRow   = std::min(beginRow + rowsPerPart, bufferHeight);
+    if(beginRow < endRow)
+    {
+      ConvoluteAndTransposeRows(inBuffer, outBuffer, bufferWidth, inBufferStride, outBufferStride, kernel, beginRow, endRow);
+    }
+  });
+}
+
+} // namespace
+
+float GetDefaultBoxApproximationRadius()
+{
+  static const float boxApproximationRadius = []() {
+    auto radiusString = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_GAUSSIAN_BLUR_BOX_APPROXIMATION_RADIUS);
+    return radiusString ? std::max(0.0f, static_cast<float>(std::atof(radiusString))) : 0.0f;
+  }();
+  return boxApproximationRadius;
 }
 
 void PerformGaussianBlurRGBA(PixelBuffer& buffer, const float blurRadius)
+{
+  PerformGaussianBlurRGBA(buffer, blurRadius, GetDefaultBoxApproximationRadius());
+}
+
+void PerformGaussianBlurRGBA(PixelBuffer& buffer, const float blurRadius, const float boxApproximationRadius)
 {
   unsigned int bufferWidth  = buffer.GetWidth();
   unsigned int bufferHeight = buffer.GetHeight();
@@ -120,6 +381,17 @@ void PerformGaussianBlurRGBA(PixelBuffer& buffer, const float blurRadius)
     return;
   }
 
+  // Calculate the kernel once for both passes.
+  BlurKernel kernel;
+  if(boxApproximationRadius > 0.0f && blurRadius >= boxApproximationRadius)
+  {
+    CalculateBoxRadii(kernel, blurRadius);
+  }
+  else
+  {
+    CalculateGaussianWeights(kernel, blurRadius);
+  }
+
   // Create a temporary buffer for the two-pass blur
   PixelBufferPtr softShadowImageBuffer = PixelBuffer::New(bufferWidth, bufferHeight, Pixel::RGBA8888);
 
@@ -128,8 +400,8 @@ void PerformGaussianBlurRGBA(PixelBuffer& buffer, const float blurRadius)
   // second pass does the same, but as the image is now transposed, it's really doing a
   // vertical blur. The second transposition makes the image the right way up again. This
   // is much faster than doing a 2D convolution.
-  ConvoluteAndTranspose(buffer.GetBuffer(), softShadowImageBuffer->GetBuffer(), bufferWidth, bufferHeight, bufferStride, bufferHeight, blurRadius);
-  ConvoluteAndTranspose(softShadowImageBuffer->GetBuffer(), buffer.GetBuffer(), bufferHeight, bufferWidth, bufferHeight, bufferStride, blurRadius);
+  ConvoluteAndTranspose(buffer.GetBuffer(), softShadowImageBuffer->GetBuffer(), bufferWidth, bufferHeight, bufferStride, bufferHeight, kernel);
+  ConvoluteAndTranspose(softShadowImageBuffer->GetBuffer(), buffer.GetBuffer(), bufferHeight, bufferWidth, bufferHeight, bufferStride, kernel);
 
   // On leaving scope, softShadowImageBuffer will get destroyed.
 }
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ADAPTOR_GAUSSIAN_BLUR_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -26,15 +26,12 @@ namespace Internal
 namespace Adaptor
 {
 /**
- * Perform a one dimension Gaussian blur convolution and write its output buffer transposed.
+ * Get the radius from which Gaussian blur is approximated by box blurs by default.
  *
- * @param[in] inBuffer The input buffer with the source image
- * @param[in] outBuffer The output buffer with the Gaussian blur applied and transposed
- * @param[in] bufferWidth The width of the buffer
- * @param[in] bufferHeight The height of the buffer
- * @param[in] blurRadius The radius for Gaussian blur
+ * It is read once from DALI_GAUSSIAN_BLUR_BOX_APPROXIMATION_RADIUS.
+ * @return The radius, 0 if Gaussian blur is never approximated
  */
-void ConvoluteAndTranspose(unsigned char* inBuffer, unsigned char* outBuffer, const unsigned int bufferWidth, const unsigned int bufferHeight, const float blurRadius);
+float GetDefaultBoxApproximationRadius();
 
 /**
  * Perform Gaussian blur on a buffer.
@@ -42,6 +39,9 @@ void ConvoluteAndTranspose(unsigned char* inBuffer, unsigned char* outBuffer, co
  * A Gaussian blur is generated by replacing each pixel’s color values with the average of the surrounding pixels’
  * colors. This region is a circle with the given radius. Thus, a bigger radius yields a blurrier image.
  *
+ * Both passes use fixed point weights and are split to the worker threads for large buffers.
+ * A blur with the radius of GetDefaultBoxApproximationRadius() or more is approximated by three box blurs.
+ *
  * @note The pixel format of the buffer must be RGBA8888
  *
  * @param[in] buffer The buffer to apply the Gaussian blur to
@@ -49,6 +49,19 @@ void ConvoluteAndTranspose(unsigned char* inBuffer, unsigned char* outBuffer, co
  */
 void PerformGaussianBlurRGBA(PixelBuffer& buffer, const float blurRadius);
 
+/**
+ * Perform Gaussian blur on a buffer, approximated by three box blurs from the given radius.
+ *
+ * The box blurs are faster for large radii, but differ from Gaussian blur by a few levels.
+ *
+ * @note The pixel format of the buffer must be RGBA8888
+ *
+ * @param[in] buffer The buffer to apply the Gaussian blur to
+ * @param[in] blurRadius The radius for Gaussian blur
+ * @param[in] boxApproximationRadius The radius from which the blur is approximated, 0 for never
+ */
+void PerformGaussianBlurRGBA(PixelBuffer& buffer, const float blurRadius, const float boxApproximationRadius);
+
 } //namespace Adaptor
 
 } //namespace Internal
@@ -32,6 +32,7 @@
 #include <dali/devel-api/threading/mutex.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/imaging/common/file-download.h>
+#include <dali/internal/system/common/file-mapper.h>
 #include <dali/internal/system/common/file-reader.h>
 #include <dali/public-api/images/pixel-data.h>
 
@@ -176,15 +177,24 @@ struct LoaderInfo
 
     bool LoadFile();
 
+    /**
+     * @brief Get the entire contents of the file, either mapped or read into globalMap.
+     */
+    const unsigned char* GetData() const
+    {
+      return fileMapper.IsMapped() ? fileMapper.GetData() : globalMap;
+    }
+
   private:
     bool LoadLocalFile();
     bool LoadRemoteFile();
 
   public:
-    const char*    fileName;        /**< The absolute path of the file. */
-    unsigned char* globalMap;       /**< A pointer to the entire contents of the file */
-    long long      length;          /**< The length of the file in bytes. */
-    bool           isLocalResource; /**< The flag whether the file is a local resource */
+    const char*                    fileName;        /**< The absolute path of the file. */
+    unsigned char*                 globalMap;       /**< A pointer to the entire contents of the file, if it is read */
+    long long                      length;          /**< The length of the file in bytes. */
+    bool                           isLocalResource; /**< The flag whether the file is a local resource */
+    Internal::Platform::FileMapper fileMapper;      /**< The local file mapped in memory, to avoid reading it */
   };
 
   struct FileInfo
@@ -196,8 +206,8 @@ struct LoaderInfo
     {
     }
 
-    unsigned char* map;
-    int            position, length; // yes - gif uses ints for file sizes.
+    const unsigned char* map;
+    int                  position, length; // yes - gif uses ints for file sizes.
   };
 
   FileData                     fileData;
@@ -295,6 +305,12 @@ bool LoaderInfo::FileData::LoadFile()
 
 bool LoaderInfo::FileData::LoadLocalFile()
 {
+  if(fileMapper.Map(fileName))
+  {
+    length = static_cast<long long>(fileMapper.GetSize());
+    return true;
+  }
+
   Internal::Platform::FileReader fileReader(fileName);
   FILE*                          fp = fileReader.GetFile();
   if(DALI_UNLIKELY(fp == NULL))
@@ -1128,14 +1144,14 @@ bool ReadHeader(LoaderInfo&      loaderInfo,
   bool       full        = true;
 
   success = fileData.LoadFile();
-  if(DALI_UNLIKELY(!success || !fileData.globalMap))
+  if(DALI_UNLIKELY(!success || !fileData.GetData()))
   {
     success = false;
     DALI_LOG_ERROR("LOAD_ERROR_CORRUPT_FILE\n");
   }
   else
   {
-    fileInfo.map      = fileData.globalMap;
+    fileInfo.map      = fileData.GetData();
     fileInfo.length   = fileData.length;
     fileInfo.position = 0;
     GifAccessor gifAccessor(fileInfo);
@@ -1165,6 +1181,12 @@ bool ReadHeader(LoaderInfo&      loaderInfo,
         success = true;
         WalkThroughGifRecordsWhileReadingHeader(gifAccessor, rec, imageNumber, frameInfo, full, prop, animated, loopCount, success);
 
+        if(DALI_UNLIKELY(fileData.fileMapper.IsTruncated()))
+        {
+          success = false;
+          DALI_LOG_ERROR("LOAD_ERROR_CORRUPT_FILE, the file is truncated while it is read\n");
+        }
+
         if(success)
         {
           // if the gif main says we have more than one image or our image counting
@@ -1479,7 +1501,7 @@ bool ReadNextFrame(LoaderInfo& loaderInfo, ImageProperties& prop, //  use for w
     // actually ask libgif to open the file
     if(!loaderInfo.gifAccessor)
     {
-      loaderInfo.fileInfo.map      = fileData.globalMap;
+      loaderInfo.fileInfo.map      = fileData.GetData();
       loaderInfo.fileInfo.length   = fileData.length;
       loaderInfo.fileInfo.position = 0;
       if(DALI_UNLIKELY(!loaderInfo.fileInfo.map))
@@ -1505,6 +1527,12 @@ bool ReadNextFrame(LoaderInfo& loaderInfo, ImageProperties& prop, //  use for w
       return false;
     }
 
+    if(DALI_UNLIKELY(fileData.fileMapper.IsTruncated()))
+    {
+      DALI_LOG_ERROR("LOAD_ERROR_CORRUPT_FILE, the file is truncated while it is read\n");
+      return false;
+    }
+
     // if we are at the end of the animation or not animated, close file
     loaderInfo.imageNumber = imageNumber;
     if((animated.frameCount <= 1) || (rec == TERMINATE_RECORD_TYPE))
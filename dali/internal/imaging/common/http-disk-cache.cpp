@@ -0,0 +1,638 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/http-disk-cache.h>
+
+// EXTERNAL INCLUDES
+#include <curl/curl.h>
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/common/hash.h>
+#include <dali/integration-api/debug.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cerrno>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/environment-variables.h>
+
+extern std::string GetSystemCachePath();
+
+namespace Dali
+{
+namespace TizenPlatform
+{
+namespace Network
+{
+namespace
+{
+constexpr const char* HTTP_CACHE_DIRECTORY  = "http-cache/";
+constexpr const char* HTTP_CACHE_EXTENSION  = ".entry";
+constexpr const char* TEMPORARY_EXTENSION   = ".tmp";
+constexpr const char* LOCK_FILE             = "lock";
+constexpr uint32_t    HTTP_CACHE_MAGIC      = 0x44414c48; // 'DALH'
+constexpr uint32_t    HTTP_CACHE_LOCK_MAGIC = 0x44414c4c; // 'DALL'
+constexpr uint32_t    HTTP_CACHE_VERSION    = 1u;
+
+constexpr size_t  DEFAULT_MAXIMUM_SIZE        = 50u * 1024u * 1024u; ///< 50MB
+constexpr int64_t MAXIMUM_HEURISTIC_FRESHNESS = 24 * 60 * 60;        ///< One day, as recommended by RFC 9111
+constexpr int64_t TEMPORARY_FILE_EXPIRY_TIME  = 60 * 60;             ///< Temporary files older than this are left by a crashed process
+constexpr float   EVICTION_TARGET_RATIO       = 0.9f;                ///< Evict a bit more than required, so the next stores don't scan again
+
+/**
+ * @brief Header written in front of each entry. It is followed by the url, the ETag, the Last-Modified date and the content.
+ */
+struct HttpCacheHeader
+{
+  uint32_t magic{HTTP_CACHE_MAGIC};
+  uint32_t version{HTTP_CACHE_VERSION};
+  int64_t  expiryTime{0};
+  uint64_t dataSize{0u};
+  uint32_t urlLength{0u};
+  uint32_t etagLength{0u};
+  uint32_t lastModifiedLength{0u};
+  uint32_t reserved{0u};
+};
+
+/**
+ * @brief Content of the lock file. It keeps the total size of the entries, so a store doesn't scan the directory.
+ */
+struct HttpCacheLockHeader
+{
+  uint32_t magic{HTTP_CACHE_LOCK_MAGIC};
+  uint32_t version{HTTP_CACHE_VERSION};
+  uint64_t totalSize{0u};
+};
+
+std::atomic<uint32_t> gTemporaryFileIndex{0u};
+
+/**
+ * @brief Get an unique path to write an entry, before it is renamed to the path of the entry.
+ */
+std::string GetTemporaryFilePath(const std::string& filePath)
+{
+  return filePath + '.' + std::to_string(getpid()) + '.' + std::to_string(gTemporaryFileIndex++) + TEMPORARY_EXTENSION;
+}
+
+/**
+ * @brief Get the maximum total size of the entries from the environment.
+ */
+size_t GetMaximumSize()
+{
+  auto maximumSizeString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_HTTP_CACHE_MAX_SIZE);
+  return maximumSizeString ? static_cast<size_t>(std::strtoul(maximumSizeString, nullptr, 10)) : DEFAULT_MAXIMUM_SIZE;
+}
+
+/**
+ * @brief Get the modification time of a file in nanoseconds, as several entries may be used in the same second.
+ */
+int64_t GetModificationTime(const struct stat& fileStat)
+{
+#if defined(__APPLE__)
+  const struct timespec& time = fileStat.st_mtimespec;
+#else
+  const struct timespec& time = fileStat.st_mtim;
+#endif
+  return static_cast<int64_t>(time.tv_sec) * 1000000000 + time.tv_nsec;
+}
+
+bool HasExtension(const char* name, const char* extension)
+{
+  const auto nameLength      = strlen(name);
+  const auto extensionLength = strlen(extension);
+  return nameLength > extensionLength && strcmp(name + nameLength - extensionLength, extension) == 0;
+}
+
+/**
+ * @brief Read the header and the strings of an entry, and check it belongs to the url.
+ */
+bool ReadEntryHeader(std::ifstream& file, const std::string& url, HttpCacheHeader& header, std::string& etag, std::string& lastModified)
+{
+  file.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if(!file || header.magic != HTTP_CACHE_MAGIC || header.version != HTTP_CACHE_VERSION || header.urlLength != url.size())
+  {
+    return false;
+  }
+
+  std::string storedUrl(header.urlLength, '\0');
+  etag.resize(header.etagLength);
+  lastModified.resize(header.lastModifiedLength);
+  file.read(&storedUrl[0], header.urlLength);
+  file.read(&etag[0], header.etagLength);
+  file.read(&lastModified[0], header.lastModifiedLength);
+
+  // The url is compared as different urls may have the same hash.
+  return file && storedUrl == url;
+}
+
+/**
+ * @brief Compare a header name case insensitively.
+ * @return The position of the value, or nullptr if the line is not this header
+ */
+const char* MatchHeaderName(const char* line, size_t length, const char* name)
+{
+  const size_t nameLength = strlen(name);
+  if(length <= nameLength || line[nameLength] != ':' || strncasecmp(line, name, nameLength) != 0)
+  {
+    return nullptr;
+  }
+  return line + nameLength + 1u;
+}
+
+} // namespace
+
+void HttpDiskCache::ResponseHeaders::Clear()
+{
+  cacheControl.clear();
+  etag.clear();
+  lastModified.clear();
+  expires.clear();
+}
+
+void HttpDiskCache::ResponseHeaders::Parse(const char* line, size_t length)
+{
+  if(length >= 5u && strncmp(line, "HTTP/", 5u) == 0)
+  {
+    // The status line of a new response, e.g. after a redirection.
+    Clear();
+    return;
+  }
+
+  const char* end = line + length;
+  while(end > line && std::isspace(static_cast<unsigned char>(end[-1])))
+  {
+    --end;
+  }
+  length = static_cast<size_t>(end - line);
+
+  std::string* target = nullptr;
+  const char*  value  = nullptr;
+  if((value = MatchHeaderName(line, length, "Cache-Control")))
+  {
+    target = &cacheControl;
+  }
+  else if((value = MatchHeaderName(line, length, "ETag")))
+  {
+    target = &etag;
+  }
+  else if((value = MatchHeaderName(line, length, "Last-Modified")))
+  {
+    target = &lastModified;
+  }
+  else if((value = MatchHeaderName(line, length, "Expires")))
+  {
+    target = &expires;
+  }
+
+  if(target)
+  {
+    while(value < end && std::isspace(static_cast<unsigned char>(*value)))
+    {
+      ++value;
+    }
+    if(!target->empty())
+    {
+      // Repeated headers are a comma separated list, e.g. Cache-Control.
+      target->append(", ");
+    }
+    target->append(value, end);
+  }
+}
+
+HttpDiskCache& HttpDiskCache::Get()
+{
+  static HttpDiskCache cache;
+  return cache;
+}
+
+HttpDiskCache::HttpDiskCache()
+: mMaximumSize(GetMaximumSize())
+{
+  if(mMaximumSize == 0u)
+  {
+    DALI_LOG_RELEASE_INFO("Http disk cache disabled\n");
+    return;
+  }
+
+  const auto systemCachePath = GetSystemCachePath();
+  if(systemCachePath.empty())
+  {
+    return;
+  }
+
+  mCacheDirectory = systemCachePath + HTTP_CACHE_DIRECTORY;
+  if((mkdir(systemCachePath.c_str(), S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH) != 0 && errno != EEXIST) ||
+     (mkdir(mCacheDirectory.c_str(), S_IRWXU) != 0 && errno != EEXIST))
+  {
+    DALI_LOG_ERROR("Error creating http cache directory: %s!\n", mCacheDirectory.c_str());
+    return;
+  }
+
+  mLockFile = open((mCacheDirectory + LOCK_FILE).c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+  if(mLockFile < 0)
+  {
+    DALI_LOG_ERROR("Error opening http cache lock file: %s!\n", mCacheDirectory.c_str());
+    return;
+  }
+
+  mEnabled = true;
+}
+
+HttpDiskCache::~HttpDiskCache()
+{
+  if(mLockFile >= 0)
+  {
+    close(mLockFile);
+  }
+}
+
+bool HttpDiskCache::GetResponseMetadata(const ResponseHeaders& headers, int64_t now, Metadata& metadata)
+{
+  bool    noCache = false;
+  int64_t maxAge  = -1;
+
+  std::string cacheControl(headers.cacheControl);
+  std::transform(cacheControl.begin(), cacheControl.end(), cacheControl.begin(), [](unsigned char c) { return std::tolower(c); });
+
+  size_t position = 0u;
+  while(position < cacheControl.size())
+  {
+    size_t directiveEnd = cacheControl.find(',', position);
+    if(directiveEnd == std::string::npos)
+    {
+      directiveEnd = cacheControl.size();
+    }
+
+    size_t directiveStart = cacheControl.find_first_not_of(' ', position);
+    if(directiveStart < directiveEnd)
+    {
+      const std::string directive = cacheControl.substr(directiveStart, directiveEnd - directiveStart);
+      if(directive.compare(0u, 8u, "no-store") == 0)
+      {
+        return false;
+      }
+      else if(directive.compare(0u, 8u, "no-cache") == 0)
+      {
+        noCache = true;
+      }
+      else if(directive.compare(0u, 8u, "max-age=") == 0)
+      {
+        maxAge = std::strtoll(directive.c_str() + 8u, nullptr, 10);
+      }
+    }
+    position = directiveEnd + 1u;
+  }
+
+  metadata.etag         = headers.etag;
+  metadata.lastModified = headers.lastModified;
+
+  if(noCache)
+  {
+    // Always revalidated.
+    metadata.expiryTime = now;
+  }
+  else if(maxAge >= 0)
+  {
+    metadata.expiryTime = now + maxAge;
+  }
+  else if(!headers.expires.empty())
+  {
+    const time_t expires = curl_getdate(headers.expires.c_str(), nullptr);
+    metadata.expiryTime  = expires > 0 ? static_cast<int64_t>(expires) : now;
+  }
+  else if(!headers.lastModified.empty())
+  {
+    // Heuristic freshness: a tenth of the time since the last modification.
+    const time_t lastModified = curl_getdate(headers.lastModified.c_str(), nullptr);
+    metadata.expiryTime       = (lastModified > 0 && lastModified < now) ? now + std::min((now - static_cast<int64_t>(lastModified)) / 10, MAXIMUM_HEURISTIC_FRESHNESS) : now;
+  }
+  else
+  {
+    metadata.expiryTime = now;
+  }
+
+  // A stale entry without any validator could never be used.
+  return metadata.expiryTime > now || metadata.HasValidator();
+}
+
+std::string HttpDiskCache::GetFilePath(const std::string& url) const
+{
+  return mCacheDirectory + std::to_string(Dali::CalculateHash(url)) + HTTP_CACHE_EXTENSION;
+}
+
+bool HttpDiskCache::LoadMetadata(const std::string& url, Metadata& metadata)
+{
+  if(!mEnabled)
+  {
+    return false;
+  }
+
+  // No lock is needed to read. The entries are replaced atomically, and an opened file stays readable after it is removed.
+  std::ifstream file(GetFilePath(url), std::ios::binary);
+  if(!file.is_open())
+  {
+    return false;
+  }
+
+  HttpCacheHeader header;
+  if(!ReadEntryHeader(file, url, header, metadata.etag, metadata.lastModified))
+  {
+    return false;
+  }
+  metadata.expiryTime = header.expiryTime;
+  return true;
+}
+
+bool HttpDiskCache::LoadData(const std::string& url, Dali::Vector<uint8_t>& dataBuffer, size_t& dataSize)
+{
+  if(!mEnabled)
+  {
+    return false;
+  }
+
+  const auto    filePath = GetFilePath(url);
+  std::ifstream file(filePath, std::ios::binary);
+  if(!file.is_open())
+  {
+    return false;
+  }
+
+  HttpCacheHeader header;
+  std::string     etag;
+  std::string     lastModified;
+  if(!ReadEntryHeader(file, url, header, etag, lastModified))
+  {
+    return false;
+  }
+
+  dataBuffer.ResizeUninitialized(static_cast<size_t>(header.dataSize));
+  file.read(reinterpret_cast<char*>(dataBuffer.Begin()), static_cast<std::streamsize>(header.dataSize));
+  if(!file)
+  {
+    DALI_LOG_ERROR("Corrupt http cache entry of %s\n", url.c_str());
+    dataBuffer.Clear();
+    return false;
+  }
+  dataSize = static_cast<size_t>(header.dataSize);
+
+  // The modification time orders the entries for the eviction.
+  utimensat(AT_FDCWD, filePath.c_str(), nullptr, 0);
+  return true;
+}
+
+void HttpDiskCache::Store(const std::string& url, const Metadata& metadata, const uint8_t* data, size_t dataSize)
+{
+  if(!mEnabled || dataSize > mMaximumSize)
+  {
+    return;
+  }
+
+  const auto filePath          = GetFilePath(url);
+  const auto temporaryFilePath = GetTemporaryFilePath(filePath);
+
+  HttpCacheHeader header;
+  header.expiryTime         = metadata.expiryTime;
+  header.dataSize           = dataSize;
+  header.urlLength          = static_cast<uint32_t>(url.size());
+  header.etagLength         = static_cast<uint32_t>(metadata.etag.size());
+  header.lastModifiedLength = static_cast<uint32_t>(metadata.lastModified.size());
+
+  // Write the entry without holding the lock, as it may take a while.
+  {
+    std::ofstream file(temporaryFilePath, std::ios::binary | std::ios::trunc);
+    if(!file.is_open())
+    {
+      DALI_LOG_ERROR("Error creating http cache entry: %s!\n", temporaryFilePath.c_str());
+      return;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(url.data(), url.size());
+    file.write(metadata.etag.data(), metadata.etag.size());
+    file.write(metadata.lastModified.data(), metadata.lastModified.size());
+    file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(dataSize));
+    file.close();
+    if(!file)
+    {
+      DALI_LOG_ERROR("Error writing http cache entry: %s!\n", temporaryFilePath.c_str());
+      unlink(temporaryFilePath.c_str());
+      return;
+    }
+  }
+
+  const uint64_t entrySize = sizeof(header) + url.size() + metadata.etag.size() + metadata.lastModified.size() + dataSize;
+
+  Lock();
+  struct stat    replacedFileStat;
+  const uint64_t replacedSize = stat(filePath.c_str(), &replacedFileStat) == 0 ? static_cast<uint64_t>(replacedFileStat.st_size) : 0u;
+  if(rename(temporaryFilePath.c_str(), filePath.c_str()) != 0)
+  {
+    DALI_LOG_ERROR("Error renaming http cache entry: %s!\n", filePath.c_str());
+    unlink(temporaryFilePath.c_str());
+  }
+  else
+  {
+    // The directory is scanned only when the cache is full, or the total size is unknown, e.g. written by an older version.
+    uint64_t totalSize = 0u;
+    if(ReadTotalSize(totalSize) && (totalSize = totalSize - std::min(totalSize, replacedSize) + entrySize) <= mMaximumSize)
+    {
+      WriteTotalSize(totalSize);
+    }
+    else
+    {
+      Evict();
+    }
+  }
+  Unlock();
+}
+
+void HttpDiskCache::UpdateExpiryTime(const std::string& url, int64_t expiryTime)
+{
+  if(!mEnabled)
+  {
+    return;
+  }
+
+  const auto filePath          = GetFilePath(url);
+  const auto temporaryFilePath = GetTemporaryFilePath(filePath);
+
+  // The entry is copied and renamed as in Store(), as the readers don't hold the lock.
+  // The lock is held so that a concurrent Store() of the url isn't replaced by the old content.
+  Lock();
+  std::vector<char> content;
+  {
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if(file.is_open())
+    {
+      content.resize(static_cast<size_t>(file.tellg()));
+      file.seekg(0);
+      file.read(content.data(), static_cast<std::streamsize>(content.size()));
+      if(!file)
+      {
+        content.clear();
+      }
+    }
+  }
+
+  HttpCacheHeader header;
+  if(content.size() >= sizeof(header))
+  {
+    memcpy(&header, content.data(), sizeof(header));
+    if(header.magic == HTTP_CACHE_MAGIC && header.version == HTTP_CACHE_VERSION)
+    {
+      header.expiryTime = expiryTime;
+      memcpy(content.data(), &header, sizeof(header));
+
+      std::ofstream file(temporaryFilePath, std::ios::binary | std::ios::trunc);
+      file.write(content.data(), static_cast<std::streamsize>(content.size()));
+      file.close();
+
+      // The size of the entry is unchanged, so is the total size.
+      if(!file || rename(temporaryFilePath.c_str(), filePath.c_str()) != 0)
+      {
+        DALI_LOG_ERROR("Error updating http cache entry: %s!\n", filePath.c_str());
+        unlink(temporaryFilePath.c_str());
+      }
+    }
+  }
+  Unlock();
+}
+
+void HttpDiskCache::Evict()
+{
+  DIR* dir = opendir(mCacheDirectory.c_str());
+  if(!dir)
+  {
+    return;
+  }
+
+  struct EntryFile
+  {
+    std::string path;
+    int64_t     modificationTime;
+    size_t      size;
+  };
+  std::vector<EntryFile> entryFiles;
+  size_t                 totalSize = 0u;
+  const time_t           now       = std::time(nullptr);
+
+  while(auto* entry = readdir(dir))
+  {
+    const bool isEntry     = HasExtension(entry->d_name, HTTP_CACHE_EXTENSION);
+    const bool isTemporary = !isEntry && HasExtension(entry->d_name, TEMPORARY_EXTENSION);
+    if(!isEntry && !isTemporary)
+    {
+      continue;
+    }
+
+    std::string path = mCacheDirectory + entry->d_name;
+    struct stat fileStat;
+    if(stat(path.c_str(), &fileStat) != 0)
+    {
+      continue;
+    }
+
+    if(isTemporary)
+    {
+      if(now - fileStat.st_mtime > TEMPORARY_FILE_EXPIRY_TIME)
+      {
+        unlink(path.c_str());
+      }
+      continue;
+    }
+
+    totalSize += static_cast<size_t>(fileStat.st_size);
+    entryFiles.push_back({std::move(path), GetModificationTime(fileStat), static_cast<size_t>(fileStat.st_size)});
+  }
+  closedir(dir);
+
+  if(totalSize <= mMaximumSize)
+  {
+    WriteTotalSize(totalSize);
+    return;
+  }
+
+  // Remove the least recently used entries first.
+  std::sort(entryFiles.begin(), entryFiles.end(), [](const EntryFile& lhs, const EntryFile& rhs) { return lhs.modificationTime < rhs.modificationTime; });
+
+  const size_t targetSize = static_cast<size_t>(mMaximumSize * EVICTION_TARGET_RATIO);
+  for(const auto& entryFile : entryFiles)
+  {
+    if(totalSize <= targetSize)
+    {
+      break;
+    }
+    if(unlink(entryFile.path.c_str()) == 0)
+    {
+      totalSize -= entryFile.size;
+    }
+  }
+  WriteTotalSize(totalSize);
+}
+
+bool HttpDiskCache::ReadTotalSize(uint64_t& totalSize)
+{
+  HttpCacheLockHeader lockHeader;
+  if(pread(mLockFile, &lockHeader, sizeof(lockHeader), 0) != static_cast<ssize_t>(sizeof(lockHeader)) ||
+     lockHeader.magic != HTTP_CACHE_LOCK_MAGIC || lockHeader.version != HTTP_CACHE_VERSION)
+  {
+    return false;
+  }
+  totalSize = lockHeader.totalSize;
+  return true;
+}
+
+void HttpDiskCache::WriteTotalSize(uint64_t totalSize)
+{
+  HttpCacheLockHeader lockHeader;
+  lockHeader.totalSize = totalSize;
+  if(pwrite(mLockFile, &lockHeader, sizeof(lockHeader), 0) != static_cast<ssize_t>(sizeof(lockHeader)))
+  {
+    DALI_LOG_ERROR("Error writing http cache lock file: %s!\n", mCacheDirectory.c_str());
+  }
+}
+
+void HttpDiskCache::Lock()
+{
+  mMutex.lock();
+  while(flock(mLockFile, LOCK_EX) != 0 && errno == EINTR)
+  {
+  }
+}
+
+void HttpDiskCache::Unlock()
+{
+  flock(mLockFile, LOCK_UN);
+  mMutex.unlock();
+}
+
+} // namespace Network
+
+} // namespace TizenPlatform
+
+} // namespace Dali
@@ -0,0 +1,231 @@
+#ifndef DALI_TIZEN_PLATFORM_NETWORK_HTTP_DISK_CACHE_H
+#define DALI_TIZEN_PLATFORM_NETWORK_HTTP_DISK_CACHE_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <string>
+
+namespace Dali
+{
+namespace TizenPlatform
+{
+namespace Network
+{
+/**
+ * @brief Bounded on-disk cache of downloaded files, keyed by URL.
+ *
+ * The entries are stored under the system cache path, with the validators and the
+ * expiry time of the response. A fresh entry is used without any request. A stale entry
+ * is revalidated with a conditional request, and used if the server answers 304.
+ *
+ * The least recently used entries are removed when the total size exceeds the maximum,
+ * set by DALI_HTTP_CACHE_MAX_SIZE in bytes. Zero disables the cache. The total size is kept
+ * in the lock file, so the directory is scanned only when the cache is full.
+ *
+ * The cache can be shared between processes. Entries are written to a temporary file and
+ * renamed, so readers never see a partial entry, and the writers hold a file lock.
+ */
+class HttpDiskCache
+{
+public:
+  /**
+   * @brief The metadata of a cached response.
+   */
+  struct Metadata
+  {
+    int64_t     expiryTime{0}; ///< The time until the entry can be used without revalidation, in seconds since the epoch.
+    std::string etag;          ///< The ETag of the response, if any.
+    std::string lastModified;  ///< The Last-Modified date of the response, if any.
+
+    /**
+     * @brief Whether the entry can be revalidated with a conditional request.
+     */
+    bool HasValidator() const
+    {
+      return !etag.empty() || !lastModified.empty();
+    }
+  };
+
+  /**
+   * @brief The caching headers of a response.
+   */
+  struct ResponseHeaders
+  {
+    std::string cacheControl;
+    std::string etag;
+    std::string lastModified;
+    std::string expires;
+
+    /**
+     * @brief Clear the headers, e.g. when a redirection starts a new response.
+     */
+    void Clear();
+
+    /**
+     * @brief Parse a header line and keep it if it is a caching header.
+     * @param[in] line The header line, without the line break
+     * @param[in] length The length of the line
+     */
+    void Parse(const char* line, size_t length);
+  };
+
+public:
+  /**
+   * @brief Get the cache of the process.
+   * @return The cache
+   */
+  static HttpDiskCache& Get();
+
+  /**
+   * @brief Whether the cache is usable.
+   * @return True if the cache directory exists and the maximum size isn't zero
+   */
+  bool IsEnabled() const
+  {
+    return mEnabled;
+  }
+
+  /**
+   * @brief Compute the metadata of a response to store.
+   *
+   * @param[in] headers The caching headers of the response
+   * @param[in] now The current time in seconds since the epoch
+   * @param[out] metadata The metadata
+   * @return False if the response must not be stored, i.e. no-store, or neither fresh nor revalidatable
+   */
+  static bool GetResponseMetadata(const ResponseHeaders& headers, int64_t now, Metadata& metadata);
+
+  /**
+   * @brief Load the metadata of the cached response of an URL.
+   *
+   * @param[in] url The URL
+   * @param[out] metadata The metadata
+   * @return True if the URL is cached
+   */
+  bool LoadMetadata(const std::string& url, Metadata& metadata);
+
+  /**
+   * @brief Load the cached content of an URL, and mark it as recently used.
+   *
+   * @param[in] url The URL
+   * @param[out] dataBuffer The content
+   * @param[out] dataSize The size of the content
+   * @return True if the content has been loaded
+   */
+  bool LoadData(const std::string& url, Dali::Vector<uint8_t>& dataBuffer, size_t& dataSize);
+
+  /**
+   * @brief Store the content of an URL, and remove the least recently used entries if the cache is full.
+   *
+   * @param[in] url The URL
+   * @param[in] metadata The metadata of the response
+   * @param[in] data The content
+   * @param[in] dataSize The size of the content
+   */
+  void Store(const std::string& url, const Metadata& metadata, const uint8_t* data, size_t dataSize);
+
+  /**
+   * @brief Update the expiry time of a cached URL, after it has been revalidated.
+   *
+   * @param[in] url The URL
+   * @param[in] expiryTime The new expiry time in seconds since the epoch
+   */
+  void UpdateExpiryTime(const std::string& url, int64_t expiryTime);
+
+  /**
+   * @brief Get the current time, as used by the cache.
+   * @return The current time in seconds since the epoch
+   */
+  static int64_t GetCurrentTime()
+  {
+    return static_cast<int64_t>(std::time(nullptr));
+  }
+
+  // Not copyable
+  HttpDiskCache(const HttpDiskCache&) = delete;
+  HttpDiskCache& operator=(const HttpDiskCache&) = delete;
+
+private:
+  /**
+   * @brief Constructor. Creates the cache directory.
+   */
+  HttpDiskCache();
+
+  /**
+   * @brief Destructor.
+   */
+  ~HttpDiskCache();
+
+  /**
+   * @brief Get the path of the file of an URL.
+   */
+  std::string GetFilePath(const std::string& url) const;
+
+  /**
+   * @brief Scan the entries, and remove the least recently used ones until the total size fits in the maximum size.
+   * The temporary files left by crashed processes are removed too, and the total size is written in the lock file.
+   * @note The caller holds the lock.
+   */
+  void Evict();
+
+  /**
+   * @brief Read the total size of the entries from the lock file.
+   * @param[out] totalSize The total size in bytes
+   * @return False if the size is unknown, e.g. the lock file has just been created
+   * @note The caller holds the lock.
+   */
+  bool ReadTotalSize(uint64_t& totalSize);
+
+  /**
+   * @brief Write the total size of the entries in the lock file.
+   * @param[in] totalSize The total size in bytes
+   * @note The caller holds the lock.
+   */
+  void WriteTotalSize(uint64_t totalSize);
+
+  /**
+   * @brief Take the lock shared by the processes writing in the cache.
+   */
+  void Lock();
+
+  /**
+   * @brief Release the lock shared by the processes.
+   */
+  void Unlock();
+
+private:
+  std::string mCacheDirectory;  ///< Directory containing the entries
+  size_t      mMaximumSize{0u}; ///< The maximum total size of the entries in bytes
+  int         mLockFile{-1};    ///< The file locked by the writers, which keeps the total size of the entries
+  std::mutex  mMutex;           ///< The lock of the threads of this process, as the file lock is per process
+  bool        mEnabled{false};  ///< Whether the cache directory is usable
+};
+
+} // namespace Network
+
+} // namespace TizenPlatform
+
+} // namespace Dali
+
+#endif // DALI_TIZEN_PLATFORM_NETWORK_HTTP_DISK_CACHE_H
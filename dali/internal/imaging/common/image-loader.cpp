@@ -32,6 +32,7 @@
 #include <dali/internal/imaging/common/loader-png.h>
 #include <dali/internal/imaging/common/loader-wbmp.h>
 #include <dali/internal/imaging/common/loader-webp.h>
+#include <dali/internal/system/common/file-mapper.h>
 #include <dali/internal/system/common/file-reader.h>
 
 using namespace Dali::Integration;
@@ -296,12 +297,22 @@ bool ConvertStreamToBitmap(const BitmapResourceType& resource, const std::string
                                 profile,
                                 path))
     {
+      // Let the decoder read the file from memory without copying it, if the file can be mapped.
+      Internal::Platform::FileMapper fileMapper;
+      fileMapper.Map(fp);
+
       const Dali::ImageLoader::ScalingParameters scalingParameters(resource.size, resource.scalingMode, resource.samplingMode);
-      const Dali::ImageLoader::Input             input(fp, scalingParameters, resource.orientationCorrection);
+      const Dali::ImageLoader::Input             input(fp, scalingParameters, resource.orientationCorrection, fileMapper.GetData(), fileMapper.GetSize());
 
       // Run the image type decoder:
       result = function(input, pixelBuffer);
 
+      if(DALI_UNLIKELY(result && fileMapper.IsTruncated()))
+      {
+        DALI_LOG_ERROR("%s is truncated while it is decoded\n", path.c_str());
+        result = false;
+      }
+
       if(!result)
       {
         DALI_LOG_ERROR("Unable to convert %s\n", path.c_str());
@@ -341,8 +352,12 @@ bool ConvertStreamToPlanes(const Integration::BitmapResourceType& resource, cons
                                 profile,
                                 path))
     {
+      // Let the decoder read the file from memory without copying it, if the file can be mapped.
+      Internal::Platform::FileMapper fileMapper;
+      fileMapper.Map(fp);
+
       const Dali::ImageLoader::ScalingParameters scalingParameters(resource.size, resource.scalingMode, resource.samplingMode);
-      const Dali::ImageLoader::Input             input(fp, scalingParameters, resource.orientationCorrection);
+      const Dali::ImageLoader::Input             input(fp, scalingParameters, resource.orientationCorrection, fileMapper.GetData(), fileMapper.GetSize());
 
       pixelBuffers.clear();
 
@@ -350,6 +365,11 @@ bool ConvertStreamToPlanes(const Integration::BitmapResourceType& resource, cons
       if(planeLoader)
       {
         result = planeLoader(input, pixelBuffers);
+        if(DALI_UNLIKELY(result && fileMapper.IsTruncated()))
+        {
+          DALI_LOG_ERROR("%s is truncated while it is decoded\n", path.c_str());
+          result = false;
+        }
         if(!result || pixelBuffers.empty())
         {
           DALI_LOG_ERROR("Unable to convert %s\n", path.c_str());
@@ -376,6 +396,11 @@ bool ConvertStreamToPlanes(const Integration::BitmapResourceType& resource, cons
       {
         Dali::Devel::PixelBuffer pixelBuffer;
         result = loader(input, pixelBuffer);
+        if(DALI_UNLIKELY(result && fileMapper.IsTruncated()))
+        {
+          DALI_LOG_ERROR("%s is truncated while it is decoded\n", path.c_str());
+          result = false;
+        }
         if(!result)
         {
           DALI_LOG_ERROR("Unable to convert %s\n", path.c_str());
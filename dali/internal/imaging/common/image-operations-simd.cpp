@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/common/image-operations-simd.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DALI_IMAGE_OPERATIONS_SSE41
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DALI_IMAGE_OPERATIONS_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+namespace
+{
+std::atomic<bool> gSimdEnabled{true};
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE41) || defined(DALI_IMAGE_OPERATIONS_NEON)
+
+#if defined(DALI_IMAGE_OPERATIONS_SSE41)
+
+// SSE4.1 is not the baseline of x86 builds, so only these functions are compiled for it,
+// and they are called only after the CPU is checked.
+#define SIMD_TARGET __attribute__((target("sse4.1"), always_inline)) inline
+#define SIMD_KERNEL __attribute__((target("sse4.1")))
+
+using U32x4 = __m128i;
+
+constexpr uint32_t RGB888_HALVE_OUTPUT_PIXELS = 4u; ///< Output pixels of one HalvePixelsRGB888() call.
+
+/// @return Floor average of each byte, as ((a ^ b) >> 1) + (a & b)
+SIMD_TARGET __m128i AverageFloorU8x16(__m128i a, __m128i b)
+{
+  return _mm_sub_epi8(_mm_avg_epu8(a, b), _mm_and_si128(_mm_xor_si128(a, b), _mm_set1_epi8(1)));
+}
+
+/// Average 16 byte components of two scanlines.
+SIMD_TARGET void AverageComponents(const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* output)
+{
+  const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(scanline1));
+  const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(scanline2));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(output), AverageFloorU8x16(a, b));
+}
+
+/// Halve 8 RGBA8888 pixels into 4.
+SIMD_TARGET void HalvePixelsRGBA8888(const uint8_t* in, uint8_t* out)
+{
+  const __m128 a    = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in)));
+  const __m128 b    = _mm_castsi128_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16)));
+  const __m128i even = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+  const __m128i odd  = _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), AverageFloorU8x16(even, odd));
+}
+
+/// Halve 32 single byte pixels into 16.
+SIMD_TARGET void HalvePixels1Byte(const uint8_t* in, uint8_t* out)
+{
+  const __m128i a    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+  const __m128i b    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16));
+  const __m128i mask = _mm_set1_epi16(0x00ff);
+  const __m128i even = _mm_packus_epi16(_mm_and_si128(a, mask), _mm_and_si128(b, mask));
+  const __m128i odd  = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), AverageFloorU8x16(even, odd));
+}
+
+/**
+ * Halve 8 RGB888 pixels (24 bytes) into 4 (12 bytes).
+ * @note 16 bytes are stored. The last 4 bytes are garbage, overwritten by the next output.
+ */
+SIMD_TARGET void HalvePixelsRGB888(const uint8_t* in, uint8_t* out)
+{
+  const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));     // bytes 0 ~ 15
+  const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 8)); // bytes 8 ~ 23
+
+  // Pixels 0, 2, 4, 6 and pixels 1, 3, 5, 7.
+  const __m128i even = _mm_or_si128(_mm_shuffle_epi8(low, _mm_setr_epi8(0, 1, 2, 6, 7, 8, 12, 13, 14, -1, -1, -1, -1, -1, -1, -1)),
+                                    _mm_shuffle_epi8(high, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, 10, 11, 12, -1, -1, -1, -1)));
+  const __m128i odd  = _mm_or_si128(_mm_shuffle_epi8(low, _mm_setr_epi8(3, 4, 5, 9, 10, 11, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+                                   _mm_shuffle_epi8(high, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, 8, 9, 13, 14, 15, -1, -1, -1, -1)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out), AverageFloorU8x16(even, odd));
+}
+
+SIMD_TARGET U32x4 MakeU32x4(uint32_t a, uint32_t b, uint32_t c, uint32_t d)
+{
+  return _mm_setr_epi32(static_cast<int>(a), static_cast<int>(b), static_cast<int>(c), static_cast<int>(d));
+}
+
+SIMD_TARGET U32x4 SplatU32x4(uint32_t value)
+{
+  return _mm_set1_epi32(static_cast<int>(value));
+}
+
+/// Expand the 4 bytes of a packed pixel into 4 lanes.
+SIMD_TARGET U32x4 ExpandPixel(uint32_t pixel)
+{
+  return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(static_cast<int>(pixel)));
+}
+
+/// Pack the low byte of 4 lanes into a packed pixel.
+SIMD_TARGET uint32_t PackPixel(U32x4 value)
+{
+  const __m128i packed16 = _mm_packus_epi32(value, value);
+  return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_packus_epi16(packed16, packed16)));
+}
+
+/**
+ * Blend 4 taps with horizontal and vertical weights, as BilinearFilter1Component() does for each lane.
+ * The vertical blend needs 40 bits, so it is done in 64 bit lanes.
+ */
+SIMD_TARGET U32x4 BilinearFilter(U32x4 tl, U32x4 tr, U32x4 bl, U32x4 br, U32x4 fractBlendHorizontal, uint32_t fractBlendVertical)
+{
+  const __m128i inverseHorizontal = _mm_sub_epi32(_mm_set1_epi32(65535), fractBlendHorizontal);
+  const __m128i top               = _mm_add_epi32(_mm_mullo_epi32(tl, inverseHorizontal), _mm_mullo_epi32(tr, fractBlendHorizontal));
+  const __m128i bottom            = _mm_add_epi32(_mm_mullo_epi32(bl, inverseHorizontal), _mm_mullo_epi32(br, fractBlendHorizontal));
+
+  const __m128i vertical        = _mm_set1_epi32(static_cast<int>(fractBlendVertical));
+  const __m128i inverseVertical = _mm_set1_epi32(static_cast<int>(65535u - fractBlendVertical));
+  const __m128i rounding        = _mm_set1_epi64x(1ll << 31);
+
+  const __m128i even = _mm_add_epi64(_mm_add_epi64(_mm_mul_epu32(top, inverseVertical), _mm_mul_epu32(bottom, vertical)), rounding);
+  const __m128i odd  = _mm_add_epi64(_mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(top, 32), inverseVertical), _mm_mul_epu32(_mm_srli_epi64(bottom, 32), vertical)), rounding);
+
+  // The high 32 bits of each 64 bit lane are the results.
+  return _mm_or_si128(_mm_srli_epi64(even, 32), _mm_and_si128(odd, _mm_set1_epi64x(static_cast<long long>(0xffffffff00000000ull))));
+}
+
+SIMD_TARGET uint32_t GetLane(U32x4 value, int lane)
+{
+  alignas(16) uint32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), value);
+  return lanes[lane];
+}
+
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+
+#define SIMD_TARGET __attribute__((always_inline)) inline
+#define SIMD_KERNEL
+
+using U32x4 = uint32x4_t;
+
+constexpr uint32_t RGB888_HALVE_OUTPUT_PIXELS = 8u; ///< Output pixels of one HalvePixelsRGB888() call.
+
+SIMD_TARGET void AverageComponents(const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* output)
+{
+  vst1q_u8(output, vhaddq_u8(vld1q_u8(scanline1), vld1q_u8(scanline2)));
+}
+
+SIMD_TARGET void HalvePixelsRGBA8888(const uint8_t* in, uint8_t* out)
+{
+  const uint32x4x2_t pixels = vld2q_u32(reinterpret_cast<const uint32_t*>(in));
+  vst1q_u8(out, vhaddq_u8(vreinterpretq_u8_u32(pixels.val[0]), vreinterpretq_u8_u32(pixels.val[1])));
+}
+
+SIMD_TARGET void HalvePixels1Byte(const uint8_t* in, uint8_t* out)
+{
+  const uint8x16x2_t pixels = vld2q_u8(in);
+  vst1q_u8(out, vhaddq_u8(pixels.val[0], pixels.val[1]));
+}
+
+/// Halve 16 RGB888 pixels (48 bytes) into 8 (24 bytes).
+SIMD_TARGET void HalvePixelsRGB888(const uint8_t* in, uint8_t* out)
+{
+  const uint8x16x3_t pixels = vld3q_u8(in);
+  uint8x8x3_t        halved;
+  for(int channel = 0; channel < 3; ++channel)
+  {
+    const uint16x8_t pairs = vreinterpretq_u16_u8(pixels.val[channel]);
+    halved.val[channel]    = vhadd_u8(vmovn_u16(pairs), vshrn_n_u16(pairs, 8));
+  }
+  vst3_u8(out, halved);
+}
+
+SIMD_TARGET U32x4 MakeU32x4(uint32_t a, uint32_t b, uint32_t c, uint32_t d)
+{
+  const uint32_t lanes[4] = {a, b, c, d};
+  return vld1q_u32(lanes);
+}
+
+SIMD_TARGET U32x4 SplatU32x4(uint32_t value)
+{
+  return vdupq_n_u32(value);
+}
+
+SIMD_TARGET U32x4 ExpandPixel(uint32_t pixel)
+{
+  return vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(pixel)))));
+}
+
+SIMD_TARGET uint32_t PackPixel(U32x4 value)
+{
+  const uint16x4_t packed16 = vmovn_u32(value);
+  const uint8x8_t  packed8  = vmovn_u16(vcombine_u16(packed16, packed16));
+  return vget_lane_u32(vreinterpret_u32_u8(packed8), 0);
+}
+
+SIMD_TARGET U32x4 BilinearFilter(U32x4 tl, U32x4 tr, U32x4 bl, U32x4 br, U32x4 fractBlendHorizontal, uint32_t fractBlendVertical)
+{
+  const uint32x4_t inverseHorizontal = vsubq_u32(vdupq_n_u32(65535u), fractBlendHorizontal);
+  const uint32x4_t top               = vmlaq_u32(vmulq_u32(tl, inverseHorizontal), tr, fractBlendHorizontal);
+  const uint32x4_t bottom            = vmlaq_u32(vmulq_u32(bl, inverseHorizontal), br, fractBlendHorizontal);
+
+  const uint32x2_t vertical        = vdup_n_u32(fractBlendVertical);
+  const uint32x2_t inverseVertical = vdup_n_u32(65535u - fractBlendVertical);
+  const uint64x2_t rounding        = vdupq_n_u64(1ull << 31);
+
+  const uint64x2_t low  = vaddq_u64(vmlal_u32(vmull_u32(vget_low_u32(top), inverseVertical), vget_low_u32(bottom), vertical), rounding);
+  const uint64x2_t high = vaddq_u64(vmlal_u32(vmull_u32(vget_high_u32(top), inverseVertical), vget_high_u32(bottom), vertical), rounding);
+  return vcombine_u32(vshrn_n_u64(low, 32), vshrn_n_u64(high, 32));
+}
+
+SIMD_TARGET uint32_t GetLane(U32x4 value, int lane)
+{
+  uint32_t lanes[4];
+  vst1q_u32(lanes, value);
+  return lanes[lane];
+}
+
+#endif
+
+// Kernels built on the instruction set layer above.
+
+SIMD_KERNEL uint32_t AverageScanlinesSimd(const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* outputScanline, uint32_t componentCount)
+{
+  uint32_t component = 0u;
+  for(; component + 16u <= componentCount; component += 16u)
+  {
+    AverageComponents(scanline1 + component, scanline2 + component, outputScanline + component);
+  }
+  return component;
+}
+
+SIMD_KERNEL uint32_t HalveScanlineRGBA8888Simd(uint8_t* pixels, uint32_t width)
+{
+  uint32_t outPixel = 0u;
+  for(; (outPixel + 4u) * 2u <= width; outPixel += 4u)
+  {
+    HalvePixelsRGBA8888(pixels + outPixel * 8u, pixels + outPixel * 4u);
+  }
+  return outPixel;
+}
+
+SIMD_KERNEL uint32_t HalveScanlineRGB888Simd(uint8_t* pixels, uint32_t width)
+{
+  uint32_t outPixel = 0u;
+  for(; (outPixel + RGB888_HALVE_OUTPUT_PIXELS) * 2u <= width; outPixel += RGB888_HALVE_OUTPUT_PIXELS)
+  {
+    HalvePixelsRGB888(pixels + outPixel * 6u, pixels + outPixel * 3u);
+  }
+  return outPixel;
+}
+
+SIMD_KERNEL uint32_t HalveScanline1ByteSimd(uint8_t* pixels, uint32_t width)
+{
+  uint32_t outPixel = 0u;
+  for(; (outPixel + 16u) * 2u <= width; outPixel += 16u)
+  {
+    HalvePixels1Byte(pixels + outPixel * 2u, pixels + outPixel);
+  }
+  return outPixel;
+}
+
+/// Load a pixel of 3 or 4 bytes into the low bytes of an integer.
+template<uint32_t BYTES_PER_PIXEL>
+SIMD_TARGET uint32_t LoadPixel(const uint8_t* pixel)
+{
+  uint32_t value = 0u;
+  memcpy(&value, pixel, BYTES_PER_PIXEL);
+  return value;
+}
+
+/// Linear sample a scanline of 3 or 4 bytes per pixel. Each output pixel is blended in one vector.
+template<uint32_t BYTES_PER_PIXEL>
+SIMD_TARGET void LinearSampleScanlineMultipleComponents(const uint8_t* inScanline1, const uint8_t* inScanline2, uint8_t* outScanline, uint32_t inputWidth, uint32_t desiredWidth, uint32_t deltaX, uint32_t inputYWeight)
+{
+  uint32_t inX = 0u;
+  for(uint32_t outX = 0u; outX < desiredWidth; ++outX)
+  {
+    const uint32_t integerX1 = inX >> 16u;
+    const uint32_t integerX2 = integerX1 + 1 >= inputWidth ? integerX1 : integerX1 + 1;
+
+    const U32x4 tl = ExpandPixel(LoadPixel<BYTES_PER_PIXEL>(inScanline1 + integerX1 * BYTES_PER_PIXEL));
+    const U32x4 tr = ExpandPixel(LoadPixel<BYTES_PER_PIXEL>(inScanline1 + integerX2 * BYTES_PER_PIXEL));
+    const U32x4 bl = ExpandPixel(LoadPixel<BYTES_PER_PIXEL>(inScanline2 + integerX1 * BYTES_PER_PIXEL));
+    const U32x4 br = ExpandPixel(LoadPixel<BYTES_PER_PIXEL>(inScanline2 + integerX2 * BYTES_PER_PIXEL));
+
+    const uint32_t pixel = PackPixel(BilinearFilter(tl, tr, bl, br, SplatU32x4(inX & 65535u), inputYWeight));
+    memcpy(outScanline + outX * BYTES_PER_PIXEL, &pixel, BYTES_PER_PIXEL);
+
+    inX += deltaX;
+  }
+}
+
+SIMD_KERNEL void LinearSampleScanline4BPPSimd(const uint8_t* inScanline1, const uint8_t* inScanline2, uint8_t* outScanline, uint32_t inputWidth, uint32_t desiredWidth, uint32_t deltaX, uint32_t inputYWeight)
+{
+  LinearSampleScanlineMultipleComponents<4u>(inScanline1, inScanline2, outScanline, inputWidth, desiredWidth, deltaX, inputYWeight);
+}
+
+SIMD_KERNEL void LinearSampleScanline3BPPSimd(const uint8_t* inScanline1, const uint8_t* inScanline2, uint8_t* outScanline, uint32_t inputWidth, uint32_t desiredWidth, uint32_t deltaX, uint32_t inputYWeight)
+{
+  LinearSampleScanlineMultipleComponents<3u>(inScanline1, inScanline2, outScanline, inputWidth, desiredWidth, deltaX, inputYWeight);
+}
+
+/// Linear sample a scanline of 1 byte per pixel. Four output pixels are blended in one vector.
+SIMD_KERNEL void LinearSampleScanline1BPPSimd(const uint8_t* inScanline1, const uint8_t* inScanline2, uint8_t* outScanline, uint32_t inputWidth, uint32_t desiredWidth, uint32_t deltaX, uint32_t inputYWeight)
+{
+  uint32_t inX = 0u;
+  for(uint32_t outX = 0u; outX < desiredWidth; outX += 4u)
+  {
+    uint32_t tl[4], tr[4], bl[4], br[4], weights[4];
+    for(uint32_t lane = 0u; lane < 4u; ++lane)
+    {
+      // Lanes after the end of the scanline repeat the last pixel, and are not stored.
+      const uint32_t laneX     = (outX + lane < desiredWidth) ? inX + lane * deltaX : inX;
+      const uint32_t integerX1 = laneX >> 16u;
+      const uint32_t integerX2 = integerX1 + 1 >= inputWidth ? integerX1 : integerX1 + 1;
+
+      tl[lane]      = inScanline1[integerX1];
+      tr[lane]      = inScanline1[integerX2];
+      bl[lane]      = inScanline2[integerX1];
+      br[lane]      = inScanline2[integerX2];
+      weights[lane] = laneX & 65535u;
+    }
+
+    const uint32_t pixels = PackPixel(BilinearFilter(MakeU32x4(tl[0], tl[1], tl[2], tl[3]),
+                                                     MakeU32x4(tr[0], tr[1], tr[2], tr[3]),
+                                                     MakeU32x4(bl[0], bl[1], bl[2], bl[3]),
+                                                     MakeU32x4(br[0], br[1], br[2], br[3]),
+                                                     MakeU32x4(weights[0], weights[1], weights[2], weights[3]),
+                                                     inputYWeight));
+    memcpy(outScanline + outX, &pixels, (outX + 4u <= desiredWidth) ? 4u : desiredWidth - outX);
+
+    inX += deltaX * 4u;
+  }
+}
+
+const ImageOperationsSimdKernels SIMD_KERNELS =
+  {
+    AverageScanlinesSimd,
+    HalveScanlineRGBA8888Simd,
+    HalveScanlineRGB888Simd,
+    HalveScanline1ByteSimd,
+    LinearSampleScanline4BPPSimd,
+    LinearSampleScanline3BPPSimd,
+    LinearSampleScanline1BPPSimd,
+};
+
+#endif
+
+/**
+ * @brief Check the instruction set supported by the CPU.
+ */
+const ImageOperationsSimdKernels* DetectSimdKernels()
+{
+#if defined(DALI_IMAGE_OPERATIONS_SSE41)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("sse4.1"))
+  {
+    DALI_LOG_DEBUG_INFO("Image operations use SSE4.1\n");
+    return &SIMD_KERNELS;
+  }
+#elif defined(DALI_IMAGE_OPERATIONS_NEON)
+  // NEON is enabled at compile time, so every CPU running this build has it.
+  DALI_LOG_DEBUG_INFO("Image operations use NEON\n");
+  return &SIMD_KERNELS;
+#endif
+  return nullptr;
+}
+
+} // namespace
+
+const ImageOperationsSimdKernels* GetImageOperationsSimdKernels()
+{
+  static const ImageOperationsSimdKernels* kernels = DetectSimdKernels();
+  return gSimdEnabled.load(std::memory_order_relaxed) ? kernels : nullptr;
+}
+
+void SetImageOperationsSimdEnabled(bool enabled)
+{
+  gSimdEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+} // namespace Platform
+
+} // namespace Internal
+
+} // namespace Dali
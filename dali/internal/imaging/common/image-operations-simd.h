@@ -0,0 +1,91 @@
+#ifndef DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H
+#define DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+/**
+ * @brief SIMD kernels of the image operations.
+ *
+ * The kernels give exactly the same result as the scalar code in image-operations.cpp,
+ * which is kept as reference and used for the pixels the kernels don't process.
+ */
+struct ImageOperationsSimdKernels
+{
+  /**
+   * @brief Average the components of two scanlines, as AverageScanlines1().
+   * @return The number of components written. The caller averages the rest.
+   */
+  uint32_t (*averageScanlines)(const uint8_t* scanline1, const uint8_t* scanline2, uint8_t* outputScanline, uint32_t componentCount);
+
+  /**
+   * @brief Halve a scanline in place, as HalveScanlineInPlaceRGBA8888(), HalveScanlineInPlaceRGB888() and HalveScanlineInPlace1Byte().
+   * @return The number of output pixels written. The caller halves the rest, from input pixel (2 * returned value).
+   */
+  uint32_t (*halveScanlineRGBA8888)(uint8_t* pixels, uint32_t width);
+  uint32_t (*halveScanlineRGB888)(uint8_t* pixels, uint32_t width); ///< @copydoc halveScanlineRGBA8888
+  uint32_t (*halveScanline1Byte)(uint8_t* pixels, uint32_t width);  ///< @copydoc halveScanlineRGBA8888
+
+  /**
+   * @brief Bilinear filter one output scanline, as LinearSample4BPP(), LinearSample3BPP() and LinearSample1BPP().
+   *
+   * @param[in] inScanline1 The upper input scanline
+   * @param[in] inScanline2 The lower input scanline
+   * @param[out] outScanline The output scanline
+   * @param[in] inputWidth The width of the input scanlines
+   * @param[in] desiredWidth The width of the output scanline
+   * @param[in] deltaX The 16.16 fixed point step of the input x coordinate
+   * @param[in] inputYWeight The 0.16 fixed point weight of the lower scanline
+   */
+  void (*linearSampleScanline4BPP)(const uint8_t* inScanline1, const uint8_t* inScanline2, uint8_t* outScanline, uint32_t inputWidth, uint32_t desiredWidth, uint32_t deltaX, uint32_t inputYWeight);
+  void (*linearSampleScanline3BPP)(const uint8_t* inScanline1, const uint8_t* inScanline2, uint8_t* outScanline, uint32_t inputWidth, uint32_t desiredWidth, uint32_t deltaX, uint32_t inputYWeight); ///< @copydoc linearSampleScanline4BPP
+  void (*linearSampleScanline1BPP)(const uint8_t* inScanline1, const uint8_t* inScanline2, uint8_t* outScanline, uint32_t inputWidth, uint32_t desiredWidth, uint32_t deltaX, uint32_t inputYWeight); ///< @copydoc linearSampleScanline4BPP
+};
+
+/**
+ * @brief Get the SIMD kernels supported by the CPU.
+ *
+ * The instruction set is detected at runtime on the first call: SSE4.1 on x86, NEON on ARM.
+ *
+ * @return The kernels, or nullptr if the CPU has no supported instruction set or SIMD is disabled.
+ */
+const ImageOperationsSimdKernels* GetImageOperationsSimdKernels();
+
+/**
+ * @brief Enable or disable the SIMD kernels. They are enabled by default if the CPU supports them.
+ *
+ * @note Used to compare with the scalar reference code, e.g. by tests and benchmarks.
+ * @param[in] enabled Whether to use the SIMD kernels
+ */
+void SetImageOperationsSimdEnabled(bool enabled);
+
+} // namespace Platform
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PLATFORM_IMAGE_OPERATIONS_SIMD_H
@@ -31,6 +31,7 @@
 #include <memory>
 
 // INTERNAL INCLUDES
+#include <dali/internal/imaging/common/image-operations-simd.h>
 
 namespace Dali
 {
@@ -1351,10 +1352,15 @@ void HalveScanlineInPlaceRGB888(uint8_t* const pixels, const uint32_t width)
    * }
    *   @endcode
    */
-  //@ToDo : Fix here if we found that collect 12 bytes == 3 uint32_t with 4 colors, and calculate in one-operation
-  std::uint8_t* inPixelPtr  = pixels;
-  std::uint8_t* outPixelPtr = pixels;
-  for(std::uint32_t scanedPixelCount = 0; scanedPixelCount <= lastPair; scanedPixelCount += 2)
+  std::uint32_t scanedPixelCount = 0;
+  if(auto* simdKernels = GetImageOperationsSimdKernels())
+  {
+    scanedPixelCount = simdKernels->halveScanlineRGB888(pixels, width) * 2u;
+  }
+
+  std::uint8_t* inPixelPtr  = pixels + scanedPixelCount * 3;
+  std::uint8_t* outPixelPtr = pixels + (scanedPixelCount >> 1) * 3;
+  for(; scanedPixelCount <= lastPair; scanedPixelCount += 2)
   {
     *(outPixelPtr + 0) = ((*(inPixelPtr + 0) ^ *(inPixelPtr + 3)) >> 1) + (*(inPixelPtr + 0) & *(inPixelPtr + 3));
     *(outPixelPtr + 1) = ((*(inPixelPtr + 1) ^ *(inPixelPtr + 4)) >> 1) + (*(inPixelPtr + 1) & *(inPixelPtr + 4));
@@ -1373,7 +1379,13 @@ void HalveScanlineInPlaceRGBA8888(uint8_t* const pixels, const uint32_t width)
 
   const uint32_t lastPair = EvenDown(width - 2);
 
-  for(uint32_t pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel)
+  uint32_t outPixel = 0;
+  if(auto* simdKernels = GetImageOperationsSimdKernels())
+  {
+    outPixel = simdKernels->halveScanlineRGBA8888(pixels, width);
+  }
+
+  for(uint32_t pixel = outPixel * 2; pixel <= lastPair; pixel += 2, ++outPixel)
   {
     const uint32_t averaged = AveragePixelRGBA8888(alignedPixels[pixel], alignedPixels[pixel + 1]);
     alignedPixels[outPixel] = averaged;
@@ -1429,7 +1441,13 @@ void HalveScanlineInPlace1Byte(uint8_t* const pixels, const uint32_t width)
 
   const uint32_t lastPair = EvenDown(width - 2);
 
-  for(uint32_t pixel = 0, outPixel = 0; pixel <= lastPair; pixel += 2, ++outPixel)
+  uint32_t outPixel = 0;
+  if(auto* simdKernels = GetImageOperationsSimdKernels())
+  {
+    outPixel = simdKernels->halveScanline1Byte(pixels, width);
+  }
+
+  for(uint32_t pixel = outPixel * 2; pixel <= lastPair; pixel += 2, ++outPixel)
   {
     /**
      * @code
@@ -1463,7 +1481,12 @@ inline void AverageScanlinesWithMultipleComponents(
   const uint32_t totalComponentCount)
 {
   uint32_t component = 0;
-  if(DALI_LIKELY(totalComponentCount >= 16))
+  if(auto* simdKernels = GetImageOperationsSimdKernels())
+  {
+    // Vector loads and stores don't need aligned pointers.
+    component = simdKernels->averageScanlines(scanline1, scanline2, outputScanline, totalComponentCount);
+  }
+  else if(DALI_LIKELY(totalComponentCount >= 16))
   {
     // Note reinsterpret_cast from uint8_t to uint64_t (or uint32_t) and read/write only allowed
     // If pointer of data is aligned well.
@@ -2120,6 +2143,52 @@ inline void LinearSampleGeneric(const uint8_t* __restrict__ inPixels,
   }
 }
 
+/**
+ * @brief Bilinear sampling image resize function using a SIMD scanline kernel.
+ * @note It gives the same result as LinearSampleGeneric().
+ */
+template<uint32_t BYTES_PER_PIXEL>
+inline void LinearSampleSimd(const uint8_t* __restrict__ inPixels,
+                             ImageDimensions inputDimensions,
+                             uint32_t        inputStride,
+                             uint8_t* __restrict__ outPixels,
+                             ImageDimensions desiredDimensions,
+                             void (*linearSampleScanline)(const uint8_t*, const uint8_t*, uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t))
+{
+  const uint32_t inputWidth    = inputDimensions.GetWidth();
+  const uint32_t inputHeight   = inputDimensions.GetHeight();
+  const uint32_t desiredWidth  = desiredDimensions.GetWidth();
+  const uint32_t desiredHeight = desiredDimensions.GetHeight();
+
+  DALI_ASSERT_DEBUG(((outPixels >= inPixels + inputStride * inputHeight * BYTES_PER_PIXEL) ||
+                     (inPixels >= outPixels + desiredWidth * desiredHeight * BYTES_PER_PIXEL)) &&
+                    "Input and output buffers cannot overlap.");
+
+  if(inputWidth < 1u || inputHeight < 1u || desiredWidth < 1u || desiredHeight < 1u)
+  {
+    return;
+  }
+  const uint32_t deltaX = (inputWidth << 16u) / desiredWidth;
+  const uint32_t deltaY = (inputHeight << 16u) / desiredHeight;
+
+  uint32_t inY = 0;
+  for(uint32_t outY = 0; outY < desiredHeight; ++outY)
+  {
+    const uint32_t integerY1 = inY >> 16u;
+    const uint32_t integerY2 = integerY1 + 1 >= inputHeight ? integerY1 : integerY1 + 1;
+
+    linearSampleScanline(&inPixels[inputStride * integerY1 * BYTES_PER_PIXEL],
+                         &inPixels[inputStride * integerY2 * BYTES_PER_PIXEL],
+                         &outPixels[desiredWidth * outY * BYTES_PER_PIXEL],
+                         inputWidth,
+                         desiredWidth,
+                         deltaX,
+                         inY & 65535u);
+
+    inY += deltaY;
+  }
+}
+
 } // namespace
 
 // Format-specific linear scaling instantiations:
@@ -2130,6 +2199,11 @@ void LinearSample1BPP(const uint8_t* __restrict__ inPixels,
                       uint8_t* __restrict__ outPixels,
                       ImageDimensions desiredDimensions)
 {
+  if(auto* simdKernels = GetImageOperationsSimdKernels())
+  {
+    LinearSampleSimd<1u>(inPixels, inputDimensions, inputStride, outPixels, desiredDimensions, simdKernels->linearSampleScanline1BPP);
+    return;
+  }
   LinearSampleGeneric<uint8_t, BilinearFilter1BPPByte, false>(inPixels, inputDimensions, inputStride, outPixels, desiredDimensions);
 }
 
@@ -2157,6 +2231,11 @@ void LinearSample3BPP(const uint8_t* __restrict__ inPixels,
                       uint8_t* __restrict__ outPixels,
                       ImageDimensions desiredDimensions)
 {
+  if(auto* simdKernels = GetImageOperationsSimdKernels())
+  {
+    LinearSampleSimd<3u>(inPixels, inputDimensions, inputStride, outPixels, desiredDimensions, simdKernels->linearSampleScanline3BPP);
+    return;
+  }
   LinearSampleGeneric<Pixel3Bytes, BilinearFilterRGB888, false>(inPixels, inputDimensions, inputStride, outPixels, desiredDimensions);
 }
 
@@ -2166,6 +2245,11 @@ void LinearSample4BPP(const uint8_t* __restrict__ inPixels,
                       uint8_t* __restrict__ outPixels,
                       ImageDimensions desiredDimensions)
 {
+  if(auto* simdKernels = GetImageOperationsSimdKernels())
+  {
+    LinearSampleSimd<4u>(inPixels, inputDimensions, inputStride, outPixels, desiredDimensions, simdKernels->linearSampleScanline4BPP);
+    return;
+  }
   LinearSampleGeneric<Pixel4Bytes, BilinearFilter4Bytes, true>(inPixels, inputDimensions, inputStride, outPixels, desiredDimensions);
 }
 
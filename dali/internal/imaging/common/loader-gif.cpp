@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -21,6 +21,8 @@
 
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
 #include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 // We need to check if giflib has the new open and close API (including error parameter).
@@ -82,22 +84,45 @@ const InterlacePair INTERLACE_PAIR_TABLE[] = {
 };
 const unsigned int INTERLACE_PAIR_TABLE_SIZE(sizeof(INTERLACE_PAIR_TABLE) / sizeof(InterlacePair));
 
+/// The image file Gif_Lib reads from: the mapped file if there is one, the FILE stream otherwise.
+struct GifSource
+{
+  GifSource(const Dali::ImageLoader::Input& input)
+  : file(input.file),
+    data(input.encodedData),
+    size(input.encodedDataSize)
+  {
+  }
+
+  FILE*          file;
+  const uint8_t* data;
+  size_t         size;
+  size_t         position{0u};
+};
+
 /// Function used by Gif_Lib to read from the image file.
 int ReadDataFromGif(GifFileType* gifInfo, GifByteType* data, int length)
 {
-  FILE* fp = reinterpret_cast<FILE*>(gifInfo->UserData);
-  return fread(data, sizeof(GifByteType), length, fp);
+  GifSource* source = reinterpret_cast<GifSource*>(gifInfo->UserData);
+  if(source->data)
+  {
+    const size_t readLength = std::min(static_cast<size_t>(length), source->size - source->position);
+    memcpy(data, source->data + source->position, readLength);
+    source->position += readLength;
+    return static_cast<int>(readLength);
+  }
+  return fread(data, sizeof(GifByteType), length, source->file);
 }
 
 /// Loads the GIF Header.
-bool LoadGifHeader(FILE* fp, unsigned int& width, unsigned int& height, GifFileType** gifInfo)
+bool LoadGifHeader(GifSource& source, unsigned int& width, unsigned int& height, GifFileType** gifInfo)
 {
   int errorCode = 0; //D_GIF_SUCCEEDED is 0
 
 #ifdef LIBGIF_VERSION_5_1_OR_ABOVE
-  *gifInfo = DGifOpen(reinterpret_cast<void*>(fp), ReadDataFromGif, &errorCode);
+  *gifInfo = DGifOpen(reinterpret_cast<void*>(&source), ReadDataFromGif, &errorCode);
 #else
-  *gifInfo = DGifOpen(reinterpret_cast<void*>(fp), ReadDataFromGif);
+  *gifInfo = DGifOpen(reinterpret_cast<void*>(&source), ReadDataFromGif);
 #endif
 
   if(DALI_UNLIKELY(!(*gifInfo) || errorCode))
@@ -270,22 +295,22 @@ bool HandleExtensionRecordType(GifFileType* gifInfo)
 
 bool LoadGifHeader(const Dali::ImageLoader::Input& input, unsigned int& width, unsigned int& height)
 {
+  GifSource      source(input);
   GifFileType*   gifInfo = NULL;
   AutoCleanupGif autoCleanupGif(gifInfo);
-  FILE* const    fp = input.file;
 
-  return LoadGifHeader(fp, width, height, &gifInfo);
+  return LoadGifHeader(source, width, height, &gifInfo);
 }
 
 bool LoadBitmapFromGif(const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap)
 {
-  FILE* const fp = input.file;
+  GifSource source(input);
   // Load the GIF Header file.
 
   GifFileType* gifInfo(NULL);
   unsigned int width(0);
   unsigned int height(0);
-  if(DALI_UNLIKELY(!LoadGifHeader(fp, width, height, &gifInfo)))
+  if(DALI_UNLIKELY(!LoadGifHeader(source, width, height, &gifInfo)))
   {
     return false;
   }
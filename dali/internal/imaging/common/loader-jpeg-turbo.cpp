@@ -25,6 +25,7 @@
 #include <libexif/exif-tag.h>
 #include <setjmp.h>
 #include <turbojpeg.h>
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <functional>
@@ -131,6 +132,16 @@ void JpegOutputMessageHandler(j_common_ptr cinfo)
   /* Stop libjpeg from printing to stderr - Do Nothing */
 }
 
+/**
+  * @brief Clamp the quality in the documented allowable range of the jpeg-turbo lib.
+  */
+unsigned ClampJpegQuality(unsigned quality)
+{
+  DALI_ASSERT_DEBUG(quality >= 1);
+  DALI_ASSERT_DEBUG(quality <= 100);
+  return std::min(std::max(quality, 1u), 100u);
+}
+
 /**
   * LibJPEG Turbo tjDecompress2 API doesn't distinguish between errors that still allow
   * the JPEG to be displayed and fatal errors.
@@ -663,8 +674,26 @@ bool TransformBitmap(int scaledPreXformWidth, int scaledPreXformHeight, JpegTran
   return result;
 }
 
-bool LoadJpegFile(const Dali::ImageLoader::Input& input, Vector<uint8_t>& jpegBuffer, unsigned int& jpegBufferSize)
+/**
+ * @brief Get the whole JPEG file in memory.
+ *
+ * The mapped file of the input is used directly if there is one. Otherwise the file is read into jpegBuffer.
+ * @param[in] input The input of the loader
+ * @param[out] jpegBuffer The buffer the file is read into, if it is not mapped
+ * @param[out] jpegBufferPtr The start of the JPEG data
+ * @param[out] jpegBufferSize The size of the JPEG data
+ * @return True on success
+ */
+bool LoadJpegFile(const Dali::ImageLoader::Input& input, Vector<uint8_t>& jpegBuffer, uint8_t*& jpegBufferPtr, unsigned int& jpegBufferSize)
 {
+  if(input.encodedData != nullptr && input.encodedDataSize > 0u)
+  {
+    // The decoders only read the data, so the read-only mapping can be used.
+    jpegBufferPtr  = const_cast<uint8_t*>(input.encodedData);
+    jpegBufferSize = static_cast<unsigned int>(input.encodedDataSize);
+    return true;
+  }
+
   FILE* const fp = input.file;
 
   if(DALI_UNLIKELY(fseek(fp, 0, SEEK_END)))
@@ -701,7 +730,7 @@ bool LoadJpegFile(const Dali::ImageLoader::Input& input, Vector<uint8_t>& jpegBu
     DALI_LOG_ERROR("Could not allocate temporary memory to hold JPEG file of size %uMB.\n", jpegBufferSize / 1048576U);
     return false;
   }
-  uint8_t* const jpegBufferPtr = jpegBuffer.Begin();
+  jpegBufferPtr = jpegBuffer.Begin();
 
   // Pull the compressed JPEG image bytes out of a file and into memory:
   if(DALI_UNLIKELY(fread(jpegBufferPtr, 1, jpegBufferSize, fp) != jpegBufferSize))
@@ -822,9 +851,10 @@ bool LoadPlanesFromJpeg(const Dali::ImageLoader::Input& input, std::vector<Dali:
 bool DecodeJpeg(const Dali::ImageLoader::Input& input, std::vector<Dali::Devel::PixelBuffer>& pixelBuffers, bool decodeToYuv)
 {
   Vector<uint8_t> jpegBuffer;
+  uint8_t*        jpegBufferPtr  = nullptr;
   unsigned int    jpegBufferSize = 0u;
 
-  if(!LoadJpegFile(input, jpegBuffer, jpegBufferSize))
+  if(!LoadJpegFile(input, jpegBuffer, jpegBufferPtr, jpegBufferSize))
   {
     DALI_LOG_ERROR("LoadJpegFile failed\n");
     return false;
@@ -837,8 +867,7 @@ bool DecodeJpeg(const Dali::ImageLoader::Input& input, std::vector<Dali::Devel::
     return false;
   }
 
-  uint8_t* const jpegBufferPtr = jpegBuffer.Begin();
-  auto           transform     = JpegTransform::NONE;
+  auto transform = JpegTransform::NONE;
 
   // extract exif data
   auto exifData = MakeExifDataFromData(jpegBufferPtr, jpegBufferSize);
@@ -1057,17 +1086,7 @@ bool EncodeToJpeg(const uint8_t* const pixelBuffer, Vector<uint8_t>& encodedPixe
     }
   }
 
-  // Assert quality is in the documented allowable range of the jpeg-turbo lib:
-  DALI_ASSERT_DEBUG(quality >= 1);
-  DALI_ASSERT_DEBUG(quality <= 100);
-  if(quality < 1)
-  {
-    quality = 1;
-  }
-  if(quality > 100)
-  {
-    quality = 100;
-  }
+  quality = ClampJpegQuality(quality);
 
   // Initialise a JPEG codec:
   {
@@ -1109,6 +1128,105 @@ bool EncodeToJpeg(const uint8_t* const pixelBuffer, Vector<uint8_t>& encodedPixe
   return true;
 }
 
+bool EncodeToJpeg(const EncodeRowFunction& getRow, FILE* file, const std::size_t width, const std::size_t height, const Pixel::Format pixelFormat, unsigned quality)
+{
+  // Translate pixel format enum:
+  J_COLOR_SPACE colorSpace = JCS_UNKNOWN;
+  int           components = 0;
+
+  switch(pixelFormat)
+  {
+    case Pixel::L8:
+    {
+      colorSpace = JCS_GRAYSCALE;
+      components = 1;
+      break;
+    }
+    case Pixel::RGB888:
+    {
+      colorSpace = JCS_RGB;
+      components = 3;
+      break;
+    }
+    case Pixel::RGBA8888:
+    {
+      // Ignore the alpha:
+      colorSpace = JCS_EXT_RGBX;
+      components = 4;
+      break;
+    }
+    case Pixel::BGRA8888:
+    {
+      // Ignore the alpha:
+      colorSpace = JCS_EXT_BGRX;
+      components = 4;
+      break;
+    }
+    default:
+    {
+      DALI_LOG_ERROR("Unsupported pixel format for encoding to JPEG. Format enum : [%d]\n", pixelFormat);
+      return false;
+    }
+  }
+
+  quality = ClampJpegQuality(quality);
+
+  // using libjpeg API to write the rows one by one, instead of tjCompress2() reading a whole image
+  struct jpeg_compress_struct cinfo;
+  struct JpegErrorState       jerr;
+  cinfo.err = jpeg_std_error(&jerr.errorManager);
+
+  jerr.errorManager.output_message = JpegOutputMessageHandler;
+  jerr.errorManager.error_exit     = JpegErrorHandler;
+
+  // On error exit from the JPEG lib, control will pass via JpegErrorHandler
+  // into this branch body for cleanup and error return:
+  if(DALI_UNLIKELY(setjmp(jerr.jumpBuffer)))
+  {
+    DALI_LOG_ERROR("JPEG Compression failed\n");
+    jpeg_destroy_compress(&cinfo);
+    return false;
+  }
+
+// jpeg_create_compress internally uses C casts
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+  jpeg_create_compress(&cinfo);
+#pragma GCC diagnostic pop
+
+  jpeg_stdio_dest(&cinfo, file);
+
+  cinfo.image_width      = static_cast<JDIMENSION>(width);
+  cinfo.image_height     = static_cast<JDIMENSION>(height);
+  cinfo.input_components = components;
+  cinfo.in_color_space   = colorSpace;
+  jpeg_set_defaults(&cinfo);
+  jpeg_set_quality(&cinfo, static_cast<int>(quality), TRUE);
+
+  // No chrominance subsampling, as TJSAMP_444 of the EncodeToJpeg() above
+  for(int i = 0; i < cinfo.num_components; ++i)
+  {
+    cinfo.comp_info[i].h_samp_factor = 1;
+    cinfo.comp_info[i].v_samp_factor = 1;
+  }
+
+  jpeg_start_compress(&cinfo, TRUE);
+  while(cinfo.next_scanline < cinfo.image_height)
+  {
+    JSAMPROW row = const_cast<JSAMPROW>(getRow(cinfo.next_scanline));
+    if(DALI_UNLIKELY(!row))
+    {
+      DALI_LOG_ERROR("Fail to get the row to encode\n");
+      jpeg_destroy_compress(&cinfo);
+      return false;
+    }
+    jpeg_write_scanlines(&cinfo, &row, 1);
+  }
+  jpeg_finish_compress(&cinfo);
+  jpeg_destroy_compress(&cinfo);
+  return true;
+}
+
 JpegTransform ConvertExifOrientation(ExifData* exifData)
 {
   auto             transform   = JpegTransform::NONE;
@@ -2,7 +2,7 @@
 #define DALI_TIZEN_PLATFORM_LOADER_JPEG_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -84,6 +84,19 @@ bool LoadJpegHeader(const Dali::ImageLoader::Input& input, unsigned int& width,
  */
 bool EncodeToJpeg(const unsigned char* pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat, unsigned quality = 80);
 
+/**
+ * Encode rows of raw pixel data to JPEG format, straight into a file.
+ * The rows are read one by one, so the whole image is neither copied nor encoded in memory.
+ * @param[in]  getRow         Gives the pixels of each row, from the top
+ * @param[in]  file           The file to write, opened for writing in binary mode
+ * @param[in]  width          Image width
+ * @param[in]  height         Image height
+ * @param[in]  pixelFormat    Input pixel format
+ * @param[in]  quality        JPEG quality on usual 1 to 100 scale.
+ * @return true if the image was encoded
+ */
+bool EncodeToJpeg(const EncodeRowFunction& getRow, FILE* file, std::size_t width, std::size_t height, Pixel::Format pixelFormat, unsigned quality = 80);
+
 } // namespace TizenPlatform
 
 } // namespace Dali
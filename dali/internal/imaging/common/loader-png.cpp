@@ -53,16 +53,52 @@ struct auto_png
   png_infop&   info;
 }; // struct auto_png;
 
-bool LoadPngHeader(FILE* fp, unsigned int& width, unsigned int& height, png_structp& png, png_infop& info)
+/// The mapped file the PNG data is read from
+struct PngMemoryReader
+{
+  const uint8_t* data{nullptr};
+  size_t         size{0u};
+  size_t         position{0u};
+};
+
+/// Function used by libpng to read from the mapped file.
+void ReadPngData(png_structp png, png_bytep data, png_size_t length)
+{
+  PngMemoryReader* reader = static_cast<PngMemoryReader*>(png_get_io_ptr(png));
+  if(DALI_UNLIKELY(length > reader->size - reader->position))
+  {
+    png_error(png, "Read past the end of the PNG data");
+  }
+  memcpy(data, reader->data + reader->position, length);
+  reader->position += length;
+}
+
+bool LoadPngHeader(const Dali::ImageLoader::Input& input, PngMemoryReader& reader, unsigned int& width, unsigned int& height, png_structp& png, png_infop& info)
 {
   png_byte header[8] = {0};
 
   // Check header to see if it is a PNG file
-  size_t size = fread(header, 1, 8, fp);
-  if(DALI_UNLIKELY(size != 8))
+  if(input.encodedData != nullptr)
   {
-    DALI_LOG_ERROR("fread failed\n");
-    return false;
+    reader.data     = input.encodedData;
+    reader.size     = input.encodedDataSize;
+    reader.position = 0u;
+    if(DALI_UNLIKELY(reader.size < 8))
+    {
+      DALI_LOG_ERROR("PNG data is too small\n");
+      return false;
+    }
+    memcpy(header, reader.data, 8);
+    reader.position = 8;
+  }
+  else
+  {
+    size_t size = fread(header, 1, 8, input.file);
+    if(DALI_UNLIKELY(size != 8))
+    {
+      DALI_LOG_ERROR("fread failed\n");
+      return false;
+    }
   }
 
   if(DALI_UNLIKELY(png_sig_cmp(header, 0, 8)))
@@ -94,7 +130,14 @@ bool LoadPngHeader(FILE* fp, unsigned int& width, unsigned int& height, png_stru
     return false;
   }
 
-  png_init_io(png, fp);
+  if(reader.data)
+  {
+    png_set_read_fn(png, &reader, ReadPngData);
+  }
+  else
+  {
+    png_init_io(png, input.file);
+  }
   png_set_sig_bytes(png, 8);
 
   // read image info
@@ -111,20 +154,22 @@ bool LoadPngHeader(FILE* fp, unsigned int& width, unsigned int& height, png_stru
 
 bool LoadPngHeader(const Dali::ImageLoader::Input& input, unsigned int& width, unsigned int& height)
 {
-  png_structp png  = NULL;
-  png_infop   info = NULL;
-  auto_png    autoPng(png, info);
+  png_structp     png  = NULL;
+  png_infop       info = NULL;
+  auto_png        autoPng(png, info);
+  PngMemoryReader reader;
 
-  bool success = LoadPngHeader(input.file, width, height, png, info);
+  bool success = LoadPngHeader(input, reader, width, height, png, info);
 
   return success;
 }
 
 bool LoadBitmapFromPng(const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap)
 {
-  png_structp png  = NULL;
-  png_infop   info = NULL;
-  auto_png    autoPng(png, info);
+  png_structp     png  = NULL;
+  png_infop       info = NULL;
+  auto_png        autoPng(png, info);
+  PngMemoryReader reader;
 
   /// @todo: consider parameters
   unsigned int y;
@@ -134,7 +179,7 @@ bool LoadBitmapFromPng(const Dali::ImageLoader::Input& input, Dali::Devel::Pixel
   bool         valid = false;
 
   // Load info from the header
-  if(DALI_UNLIKELY(!LoadPngHeader(input.file, width, height, png, info)))
+  if(DALI_UNLIKELY(!LoadPngHeader(input, reader, width, height, png, info)))
   {
     return false;
   }
@@ -402,24 +447,22 @@ extern "C" void FlushData(png_structp png_ptr)
 }
 } // namespace
 
+namespace
+{
 /**
- * Potential improvements:
- * 1. Detect <= 256 colours and write in palette mode.
- * 2. Detect grayscale (will early-out quickly for colour images).
- * 3. Store colour space / gamma correction info related to the device screen?
- *    http://www.libpng.org/pub/png/book/chapter10.html
- * 4. Refactor with callers to write straight through to disk and save keeping a big buffer around.
- * 5. Prealloc buffer (reserve) to input size / <A number greater than 2 (expexcted few realloc but without using lots of memory) | 1 (expected zero reallocs but using a lot of memory)>.
- * 6. Set the modification time with png_set_tIME(png_ptr, info_ptr, mod_time);
- * 7. If caller asks for no compression, bypass libpng and blat raw data to
- *    disk, topped and tailed with header/tail blocks.
+ * Encode the rows to PNG format, into memory or straight into a file.
+ * @param[in]  getRow         Gives the pixels of each row, from the top
+ * @param[out] encodedPixels  Encoded pixel data, if not nullptr. Existing contents will be overwritten
+ * @param[out] file           The file to write, if encodedPixels is nullptr
+ * @param[in]  width          Image width
+ * @param[in]  height         Image height
+ * @param[in]  pixelFormat    Input pixel format
  */
-bool EncodeToPng(const unsigned char* const pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat)
+bool EncodeRowsToPng(const EncodeRowFunction& getRow, Vector<unsigned char>* encodedPixels, FILE* file, std::size_t width, std::size_t height, Pixel::Format pixelFormat)
 {
   // Translate pixel format enum:
-  int      pngPixelFormat = -1;
-  unsigned pixelBytes     = 0;
-  bool     rgbaOrder      = true;
+  int  pngPixelFormat = -1;
+  bool rgbaOrder      = true;
 
   // Account for RGB versus BGR and presence of alpha in input pixels:
   switch(pixelFormat)
@@ -427,19 +470,16 @@ bool EncodeToPng(const unsigned char* const pixelBuffer, Vector<unsigned char>&
     case Pixel::L8:
     {
       pngPixelFormat = PNG_COLOR_TYPE_GRAY;
-      pixelBytes     = 1;
       break;
     }
     case Pixel::LA88:
     {
       pngPixelFormat = PNG_COLOR_TYPE_GRAY_ALPHA;
-      pixelBytes     = 2;
       break;
     }
     case Pixel::RGB888:
     {
       pngPixelFormat = PNG_COLOR_TYPE_RGB;
-      pixelBytes     = 3;
       break;
     }
     case Pixel::BGRA8888:
@@ -450,7 +490,6 @@ bool EncodeToPng(const unsigned char* const pixelBuffer, Vector<unsigned char>&
     case Pixel::RGBA8888:
     {
       pngPixelFormat = PNG_COLOR_TYPE_RGB_ALPHA;
-      pixelBytes     = 4;
       break;
     }
     default:
@@ -487,10 +526,17 @@ bool EncodeToPng(const unsigned char* const pixelBuffer, Vector<unsigned char>&
     return false;
   }
 
-  // Since we are going to write to memory instead of a file, lets provide
-  // libpng with a custom write function and ask it to pass back our
-  // Vector buffer each time it calls back to flush data to "file":
-  png_set_write_fn(png_ptr, &encodedPixels, WriteData, FlushData);
+  if(encodedPixels)
+  {
+    // Since we are going to write to memory instead of a file, lets provide
+    // libpng with a custom write function and ask it to pass back our
+    // Vector buffer each time it calls back to flush data to "file":
+    png_set_write_fn(png_ptr, encodedPixels, WriteData, FlushData);
+  }
+  else
+  {
+    png_init_io(png_ptr, file);
+  }
 
   // png_set_compression_level( png_ptr, Z_BEST_COMPRESSION);
   png_set_compression_level(png_ptr, Z_BEST_SPEED);
@@ -524,11 +570,14 @@ bool EncodeToPng(const unsigned char* const pixelBuffer, Vector<unsigned char>&
   png_write_info(png_ptr, info_ptr);
 
   // Walk the rows:
-  const unsigned  row_step = width * pixelBytes;
-  png_bytep       row_ptr  = const_cast<png_bytep>(pixelBuffer);
-  const png_bytep row_end  = row_ptr + height * row_step;
-  for(; row_ptr < row_end; row_ptr += row_step)
+  for(std::size_t row = 0; row < height; ++row)
   {
+    const png_bytep row_ptr = const_cast<png_bytep>(getRow(static_cast<uint32_t>(row)));
+    if(DALI_UNLIKELY(!row_ptr))
+    {
+      // Jumps to the setjmp() above.
+      png_error(png_ptr, "Fail to get the row to encode");
+    }
     png_write_row(png_ptr, row_ptr);
   }
 
@@ -538,6 +587,29 @@ bool EncodeToPng(const unsigned char* const pixelBuffer, Vector<unsigned char>&
   png_destroy_write_struct(&png_ptr, &info_ptr);
   return true;
 }
+} // namespace
+
+/**
+ * Potential improvements:
+ * 1. Detect <= 256 colours and write in palette mode.
+ * 2. Detect grayscale (will early-out quickly for colour images).
+ * 3. Store colour space / gamma correction info related to the device screen?
+ *    http://www.libpng.org/pub/png/book/chapter10.html
+ * 4. Prealloc buffer (reserve) to input size / <A number greater than 2 (expexcted few realloc but without using lots of memory) | 1 (expected zero reallocs but using a lot of memory)>.
+ * 5. Set the modification time with png_set_tIME(png_ptr, info_ptr, mod_time);
+ * 6. If caller asks for no compression, bypass libpng and blat raw data to
+ *    disk, topped and tailed with header/tail blocks.
+ */
+bool EncodeToPng(const unsigned char* const pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat)
+{
+  const std::size_t rowStride = width * Pixel::GetBytesPerPixel(pixelFormat);
+  return EncodeRowsToPng([pixelBuffer, rowStride](uint32_t row) { return pixelBuffer + row * rowStride; }, &encodedPixels, nullptr, width, height, pixelFormat);
+}
+
+bool EncodeToPng(const EncodeRowFunction& getRow, FILE* file, std::size_t width, std::size_t height, Pixel::Format pixelFormat)
+{
+  return EncodeRowsToPng(getRow, nullptr, file, width, height, pixelFormat);
+}
 
 } // namespace TizenPlatform
 
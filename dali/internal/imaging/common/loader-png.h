@@ -2,7 +2,7 @@
 #define DALI_TIZEN_PLATFORM_LOADER_PNG_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -70,6 +70,18 @@ bool LoadPngHeader(const Dali::ImageLoader::Input& input, unsigned int& width, u
  */
 bool EncodeToPng(const unsigned char* pixelBuffer, Vector<unsigned char>& encodedPixels, std::size_t width, std::size_t height, Pixel::Format pixelFormat);
 
+/**
+ * Encode rows of raw pixel data to PNG format, straight into a file.
+ * The rows are read one by one, so the whole image is neither copied nor encoded in memory.
+ * @param[in]  getRow         Gives the pixels of each row, from the top
+ * @param[in]  file           The file to write, opened for writing in binary mode
+ * @param[in]  width          Image width
+ * @param[in]  height         Image height
+ * @param[in]  pixelFormat    Input pixel format
+ * @return true if the image was encoded
+ */
+bool EncodeToPng(const EncodeRowFunction& getRow, FILE* file, std::size_t width, std::size_t height, Pixel::Format pixelFormat);
+
 } // namespace TizenPlatform
 
 } // namespace Dali
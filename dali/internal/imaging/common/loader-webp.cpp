@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,12 +29,23 @@ namespace TizenPlatform
 namespace
 {
 constexpr uint32_t FIRST_FRAME_INDEX = 0u;
+
+/**
+ * @brief Create a WebPLoading which decodes the mapped file of the input, or reads the file if it is not mapped.
+ */
+Dali::AnimatedImageLoading CreateWebPLoading(const Dali::ImageLoader::Input& input)
+{
+  if(input.encodedData != nullptr)
+  {
+    return Dali::AnimatedImageLoading(Dali::Internal::Adaptor::WebPLoading::New(input.encodedData, input.encodedDataSize).Get());
+  }
+  return Dali::AnimatedImageLoading(Dali::Internal::Adaptor::WebPLoading::New(input.file).Get());
 }
+} // namespace
 
 bool LoadWebpHeader(const Dali::ImageLoader::Input& input, unsigned int& width, unsigned int& height)
 {
-  FILE* const                fp          = input.file;
-  Dali::AnimatedImageLoading webPLoading = Dali::AnimatedImageLoading(Dali::Internal::Adaptor::WebPLoading::New(fp).Get());
+  Dali::AnimatedImageLoading webPLoading = CreateWebPLoading(input);
   if(webPLoading)
   {
     ImageDimensions imageSize = webPLoading.GetImageSize();
@@ -50,8 +61,7 @@ bool LoadWebpHeader(const Dali::ImageLoader::Input& input, unsigned int& width,
 
 bool LoadBitmapFromWebp(const Dali::ImageLoader::Input& input, Dali::Devel::PixelBuffer& bitmap)
 {
-  FILE* const                fp          = input.file;
-  Dali::AnimatedImageLoading webPLoading = Dali::AnimatedImageLoading(Dali::Internal::Adaptor::WebPLoading::New(fp).Get());
+  Dali::AnimatedImageLoading webPLoading = CreateWebPLoading(input);
   if(webPLoading)
   {
     Dali::Devel::PixelBuffer pixelBuffer = webPLoading.LoadFrame(FIRST_FRAME_INDEX);
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_NATIVE_IMAGE_SOURCE_IMPL_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -182,8 +182,9 @@ public:
    *                     The two valid encoding are (".jpeg"|".jpg") and ".png".
    * @param[in] quality The quality of encoded jpeg image
    * @return    @c true if the pixels were written, and @c false otherwise
+   * @note The pixels are copied with GetPixels() by default. It may be called in a worker thread.
    */
-  inline bool EncodeToFile(const std::string& filename, const uint32_t quality) const
+  virtual bool EncodeToFile(const std::string& filename, const uint32_t quality) const
   {
     std::vector<uint8_t> pixbuf;
     uint32_t             width(0), height(0);
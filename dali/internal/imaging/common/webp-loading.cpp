@@ -33,6 +33,7 @@
 
 #include <dali/devel-api/threading/mutex.h>
 #include <dali/internal/imaging/common/file-download.h>
+#include <dali/internal/system/common/file-mapper.h>
 #include <dali/internal/system/common/file-reader.h>
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -94,6 +95,22 @@ public:
   {
   }
 
+  Impl(const uint8_t* encodedData, size_t encodedDataSize)
+  : mFile(nullptr),
+    mUrl(),
+    mFrameCount(1u),
+    mMutex(),
+    mBuffer(nullptr),
+    mBufferSize(0u),
+    mImageSize(),
+    mLoadSucceeded(false),
+    mIsAnimatedImage(false),
+    mIsLocalResource(true),
+    mEncodedData(encodedData),
+    mEncodedDataSize(encodedDataSize)
+  {
+  }
+
   bool LoadWebPInformation()
   {
     // Block to do not load this file again.
@@ -164,6 +181,14 @@ public:
   {
     mBufferSize = 0;
 
+    if(mEncodedData != nullptr)
+    {
+      // Decode the data of the caller without copying it.
+      mBuffer     = mEncodedData;
+      mBufferSize = static_cast<uint32_t>(mEncodedDataSize);
+      return true;
+    }
+
     FILE*                                           fp = mFile;
     std::unique_ptr<Internal::Platform::FileReader> fileReader;
     Dali::Vector<uint8_t>                           dataBuffer;
@@ -171,6 +196,12 @@ public:
     {
       if(mIsLocalResource)
       {
+        if(mFileMapper.Map(mUrl.c_str()))
+        {
+          mBuffer     = mFileMapper.GetData();
+          mBufferSize = static_cast<uint32_t>(mFileMapper.GetSize());
+          return true;
+        }
         fileReader = std::make_unique<Internal::Platform::FileReader>(mUrl);
       }
       else
@@ -206,13 +237,14 @@ public:
 
       if(DALI_LIKELY(!fseek(fp, 0, SEEK_SET)))
       {
-        mBuffer = reinterpret_cast<WebPByteType*>(malloc(sizeof(WebPByteType) * mBufferSize));
-        if(DALI_UNLIKELY(!mBuffer))
+        WebPByteType* buffer = reinterpret_cast<WebPByteType*>(malloc(sizeof(WebPByteType) * mBufferSize));
+        if(DALI_UNLIKELY(!buffer))
         {
           DALI_LOG_ERROR("malloc is failed. request malloc size : %zu\n", sizeof(WebPByteType) * mBufferSize);
           return false;
         }
-        mBufferSize = fread(mBuffer, sizeof(WebPByteType), mBufferSize, fp);
+        mBufferSize = fread(buffer, sizeof(WebPByteType), mBufferSize, fp);
+        mBuffer     = buffer;
         return true;
       }
     }
@@ -237,7 +269,14 @@ public:
 #endif
     if(mBuffer != nullptr)
     {
-      free((void*)mBuffer);
+      if(mFileMapper.IsMapped())
+      {
+        mFileMapper.Unmap();
+      }
+      else if(mBuffer != mEncodedData)
+      {
+        free((void*)mBuffer);
+      }
       mBuffer = nullptr;
     }
 
@@ -263,12 +302,16 @@ public:
   uint32_t              mFrameCount;
   Mutex                 mMutex;
   // For the case the system doesn't support DALI_ANIMATED_WEBP_ENABLED
-  unsigned char*  mBuffer;
-  uint32_t        mBufferSize;
-  ImageDimensions mImageSize;
-  bool            mLoadSucceeded;
-  bool            mIsAnimatedImage;
-  bool            mIsLocalResource;
+  const unsigned char* mBuffer;
+  uint32_t             mBufferSize;
+  ImageDimensions      mImageSize;
+  bool                 mLoadSucceeded;
+  bool                 mIsAnimatedImage;
+  bool                 mIsLocalResource;
+
+  const uint8_t*                 mEncodedData{nullptr}; ///< The encoded data of the caller, used instead of the file if not null
+  size_t                         mEncodedDataSize{0u};
+  Internal::Platform::FileMapper mFileMapper; ///< The mapped local file, used instead of reading it
 
 #ifdef DALI_WEBP_AVAILABLE
   WebPData mWebPData{0};
@@ -297,6 +340,14 @@ AnimatedImageLoadingPtr WebPLoading::New(FILE* const fp)
   return AnimatedImageLoadingPtr(new WebPLoading(fp));
 }
 
+AnimatedImageLoadingPtr WebPLoading::New(const uint8_t* encodedData, size_t encodedDataSize)
+{
+#ifndef DALI_ANIMATED_WEBP_ENABLED
+  DALI_LOG_ERROR("The system does not support Animated WebP format.\n");
+#endif
+  return AnimatedImageLoadingPtr(new WebPLoading(encodedData, encodedDataSize));
+}
+
 WebPLoading::WebPLoading(const std::string& url, bool isLocalResource)
 : mImpl(new WebPLoading::Impl(url, isLocalResource))
 {
@@ -307,6 +358,11 @@ WebPLoading::WebPLoading(FILE* const fp)
 {
 }
 
+WebPLoading::WebPLoading(const uint8_t* encodedData, size_t encodedDataSize)
+: mImpl(new WebPLoading::Impl(encodedData, encodedDataSize))
+{
+}
+
 WebPLoading::~WebPLoading()
 {
   delete mImpl;
@@ -406,6 +462,12 @@ Dali::Devel::PixelBuffer WebPLoading::LoadFrame(uint32_t frameIndex, ImageDimens
         }
       }
     }
+    if(DALI_UNLIKELY(pixelBuffer && mImpl->mFileMapper.IsTruncated()))
+    {
+      DALI_LOG_ERROR("The file is truncated while it is decoded [%s]\n", mImpl->mUrl.c_str());
+      pixelBuffer.Reset();
+    }
+
     // The single frame resource should be released after loading.
     mImpl->ReleaseResource();
   }
@@ -462,6 +524,12 @@ Dali::Devel::PixelBuffer WebPLoading::DecodeFrame(uint32_t frameIndex)
     mImpl->mTimeStamp[++mImpl->mLatestLoadedFrame] = timestamp;
   }
 
+  if(DALI_UNLIKELY(mImpl->mFileMapper.IsTruncated()))
+  {
+    DALI_LOG_ERROR("The file is truncated while it is decoded [%s]\n", mImpl->mUrl.c_str());
+    frameBuffer = nullptr;
+  }
+
   if(frameBuffer != nullptr)
   {
     const int bufferSize = mImpl->mWebPAnimInfo.canvas_width * mImpl->mWebPAnimInfo.canvas_height * sizeof(uint32_t);
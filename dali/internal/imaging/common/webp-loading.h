@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_WEBP_LOADING_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -63,6 +63,14 @@ public:
    */
   static AnimatedImageLoadingPtr New(FILE* const fp);
 
+  /**
+   * Create a WebPLoading which decodes data in memory.
+   * @param[in] encodedData The encoded webp image. It should be kept alive while the WebPLoading is used.
+   * @param[in] encodedDataSize The size of the encoded data in bytes.
+   * @return A newly created WebPLoading.
+   */
+  static AnimatedImageLoadingPtr New(const uint8_t* encodedData, size_t encodedDataSize);
+
   /**
    * @brief Constructor
    *
@@ -80,6 +88,15 @@ public:
    */
   WebPLoading(FILE* const fp);
 
+  /**
+   * @brief Constructor
+   *
+   * Construct a Loader with the encoded data in memory
+   * @param[in] encodedData The encoded webp image.
+   * @param[in] encodedDataSize The size of the encoded data in bytes.
+   */
+  WebPLoading(const uint8_t* encodedData, size_t encodedDataSize);
+
   /**
    * @brief Destructor
    */
@@ -57,6 +57,78 @@ tbm_format FORMATS_BLENDING_REQUIRED[] = {
 
 const int NUM_FORMATS_BLENDING_REQUIRED = 18;
 
+/**
+ * @brief Get the pixel format of the pixels read from a tbm surface.
+ * @return false if the tbm format cannot be read
+ */
+bool GetReadPixelFormat(tbm_format format, Pixel::Format& pixelFormat)
+{
+  switch(format)
+  {
+    case TBM_FORMAT_RGB888:
+    {
+      pixelFormat = Pixel::RGB888;
+      return true;
+    }
+    case TBM_FORMAT_RGBA8888:
+    case TBM_FORMAT_ARGB8888:
+    {
+      pixelFormat = Pixel::RGBA8888;
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/**
+ * @brief Read a row of a mapped tbm surface, in the pixel format given by GetReadPixelFormat().
+ */
+void ReadRow(tbm_format format, const uint8_t* source, uint8_t* destination, uint32_t width)
+{
+  switch(format)
+  {
+    case TBM_FORMAT_RGB888:
+    {
+      for(uint32_t c = 0; c < width; ++c, source += 3, destination += 3)
+      {
+        destination[0] = source[2];
+        destination[1] = source[1];
+        destination[2] = source[0];
+      }
+      break;
+    }
+    case TBM_FORMAT_RGBA8888:
+    {
+      for(uint32_t c = 0; c < width; ++c, source += 4, destination += 4)
+      {
+        destination[0] = source[3];
+        destination[1] = source[2];
+        destination[2] = source[1];
+        destination[3] = source[0];
+      }
+      break;
+    }
+    case TBM_FORMAT_ARGB8888:
+    {
+      for(uint32_t c = 0; c < width; ++c, source += 4, destination += 4)
+      {
+        destination[0] = source[2];
+        destination[1] = source[1];
+        destination[2] = source[0];
+        destination[3] = source[3];
+      }
+      break;
+    }
+    default:
+    {
+      break;
+    }
+  }
+}
+
 } // namespace
 
 using Dali::Integration::PixelBuffer;
@@ -244,80 +316,21 @@ bool NativeImageSourceTizen::GetPixels(std::vector<uint8_t>& pixbuf, uint32_t& w
 
     width  = mWidth;
     height = mHeight;
-    size_t lineSize;
-    size_t offset;
-    size_t cOffset;
 
-    switch(format)
+    if(!GetReadPixelFormat(format, pixelFormat))
     {
-      case TBM_FORMAT_RGB888:
-      {
-        lineSize    = width * 3;
-        pixelFormat = Pixel::RGB888;
-        pixbuf.resize(lineSize * height);
-        uint8_t* bufptr = &pixbuf[0];
+      DALI_ASSERT_ALWAYS(0 && "Tbm surface has unsupported pixel format.\n");
 
-        for(uint32_t r = 0; r < height; ++r, bufptr += lineSize)
-        {
-          for(uint32_t c = 0; c < width; ++c)
-          {
-            cOffset                 = c * 3;
-            offset                  = cOffset + r * stride;
-            *(bufptr + cOffset)     = ptr[offset + 2];
-            *(bufptr + cOffset + 1) = ptr[offset + 1];
-            *(bufptr + cOffset + 2) = ptr[offset];
-          }
-        }
-        break;
-      }
-      case TBM_FORMAT_RGBA8888:
-      {
-        lineSize    = width * 4;
-        pixelFormat = Pixel::RGBA8888;
-        pixbuf.resize(lineSize * height);
-        uint8_t* bufptr = &pixbuf[0];
+      return false;
+    }
 
-        for(uint32_t r = 0; r < height; ++r, bufptr += lineSize)
-        {
-          for(uint32_t c = 0; c < width; ++c)
-          {
-            cOffset                 = c * 4;
-            offset                  = cOffset + r * stride;
-            *(bufptr + cOffset)     = ptr[offset + 3];
-            *(bufptr + cOffset + 1) = ptr[offset + 2];
-            *(bufptr + cOffset + 2) = ptr[offset + 1];
-            *(bufptr + cOffset + 3) = ptr[offset];
-          }
-        }
-        break;
-      }
-      case TBM_FORMAT_ARGB8888:
-      {
-        lineSize    = width * 4;
-        pixelFormat = Pixel::RGBA8888;
-        pixbuf.resize(lineSize * height);
-        uint8_t* bufptr = &pixbuf[0];
+    const size_t lineSize = width * Pixel::GetBytesPerPixel(pixelFormat);
+    pixbuf.resize(lineSize * height);
+    uint8_t* bufptr = &pixbuf[0];
 
-        for(uint32_t r = 0; r < height; ++r, bufptr += lineSize)
-        {
-          for(uint32_t c = 0; c < width; ++c)
-          {
-            cOffset                 = c * 4;
-            offset                  = cOffset + r * stride;
-            *(bufptr + cOffset)     = ptr[offset + 2];
-            *(bufptr + cOffset + 1) = ptr[offset + 1];
-            *(bufptr + cOffset + 2) = ptr[offset];
-            *(bufptr + cOffset + 3) = ptr[offset + 3];
-          }
-        }
-        break;
-      }
-      default:
-      {
-        DALI_ASSERT_ALWAYS(0 && "Tbm surface has unsupported pixel format.\n");
-
-        return false;
-      }
+    for(uint32_t r = 0; r < height; ++r, bufptr += lineSize)
+    {
+      ReadRow(format, ptr + r * stride, bufptr, width);
     }
 
     if(tbm_surface_unmap(mTbmSurface) != TBM_SURFACE_ERROR_NONE)
@@ -336,6 +349,51 @@ bool NativeImageSourceTizen::GetPixels(std::vector<uint8_t>& pixbuf, uint32_t& w
   return false;
 }
 
+bool NativeImageSourceTizen::EncodeToFile(const std::string& filename, const uint32_t quality) const
+{
+  std::scoped_lock lock(mMutex);
+  if(mTbmSurface == NULL)
+  {
+    DALI_LOG_WARNING("TBM surface does not exist.\n");
+    return false;
+  }
+
+  tbm_surface_info_s surface_info;
+  if(tbm_surface_map(mTbmSurface, TBM_SURF_OPTION_READ, &surface_info) != TBM_SURFACE_ERROR_NONE)
+  {
+    DALI_LOG_ERROR("Fail to map tbm_surface\n");
+    return false;
+  }
+
+  tbm_format    format = surface_info.format;
+  uint32_t      stride = surface_info.planes[0].stride;
+  uint8_t*      ptr    = surface_info.planes[0].ptr;
+  Pixel::Format pixelFormat;
+
+  if(!GetReadPixelFormat(format, pixelFormat))
+  {
+    DALI_ASSERT_ALWAYS(0 && "Tbm surface has unsupported pixel format.\n");
+
+    return false;
+  }
+
+  // The rows are read from the mapped surface one by one, while they are encoded.
+  std::vector<uint8_t> row(mWidth * Pixel::GetBytesPerPixel(pixelFormat));
+  auto                 getRow = [&](uint32_t r) -> const uint8_t* {
+    ReadRow(format, ptr + r * stride, row.data(), mWidth);
+    return row.data();
+  };
+
+  const bool result = Dali::EncodeRowsToFile(getRow, filename, pixelFormat, mWidth, mHeight, quality);
+
+  if(tbm_surface_unmap(mTbmSurface) != TBM_SURFACE_ERROR_NONE)
+  {
+    DALI_LOG_ERROR("Fail to unmap tbm_surface\n");
+  }
+
+  return result;
+}
+
 void NativeImageSourceTizen::SetSource(Any source)
 {
   std::scoped_lock lock(mMutex);
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_NATIVE_IMAGE_SOURCE_IMPL_TIZEN_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -67,6 +67,11 @@ public:
    */
   bool GetPixels(std::vector<uint8_t>& pixbuf, uint32_t& width, uint32_t& height, Pixel::Format& pixelFormat) const override;
 
+  /**
+   * @copydoc Dali::Internal::Adaptor::NativeImageSource::EncodeToFile(const std::string&, const uint32_t)
+   */
+  bool EncodeToFile(const std::string& filename, const uint32_t quality) const override;
+
   /**
    * @copydoc Dali::NativeImageSource::SetSource( Any source )
    */
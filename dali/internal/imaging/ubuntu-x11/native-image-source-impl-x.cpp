@@ -20,7 +20,6 @@
 
 // EXTERNAL INCLUDES
 #include <X11/Xlib.h>
-#include <X11/Xutil.h>
 #include <dali/devel-api/common/stage.h>
 #include <dali/integration-api/debug.h>
 #include <dali/internal/system/linux/dali-ecore-x.h>
@@ -30,6 +29,7 @@
 #include <dali/internal/adaptor/common/adaptor-impl.h>
 #include <dali/internal/graphics/common/egl-image-extensions.h>
 #include <dali/internal/graphics/gles/egl-graphics.h>
+#include <dali/internal/imaging/x11/pixmap-reader-x.h>
 
 namespace Dali
 {
@@ -39,38 +39,6 @@ namespace Adaptor
 {
 using Dali::Integration::PixelBuffer;
 
-// Pieces needed to save compressed images (temporary location while plumbing):
-namespace
-{
-/**
- * Free an allocated XImage on destruction.
- */
-struct XImageJanitor
-{
-  XImageJanitor(XImage* const pXImage)
-  : mXImage(pXImage)
-  {
-    DALI_ASSERT_DEBUG(pXImage != 0 && "Null pointer to XImage.");
-  }
-
-  ~XImageJanitor()
-  {
-    if(mXImage)
-    {
-      if(!XDestroyImage(mXImage))
-      {
-        DALI_LOG_ERROR("XImage deallocation failure");
-      }
-    }
-  }
-  XImage* const mXImage;
-
-private:
-  XImageJanitor(const XImageJanitor& rhs);
-  XImageJanitor& operator=(const XImageJanitor& rhs);
-};
-} // namespace
-
 NativeImageSourceX* NativeImageSourceX::New(uint32_t width, uint32_t height, Dali::NativeImageSource::ColorDepth depth, Any nativeImageSource)
 {
   NativeImageSourceX* image = new NativeImageSourceX(width, height, depth, nativeImageSource);
@@ -150,118 +118,20 @@ Any NativeImageSourceX::GetNativeImageSource() const
 
 bool NativeImageSourceX::GetPixels(std::vector<uint8_t>& pixbuf, uint32_t& width, uint32_t& height, Pixel::Format& pixelFormat) const
 {
-  DALI_ASSERT_DEBUG(sizeof(uint32_t) == 4);
-  bool success = false;
-  width        = mWidth;
-  height       = mHeight;
-
-  // Open a display connection
-  Display* displayConnection = XOpenDisplay(0);
-
-  XImageJanitor xImageJanitor(XGetImage(displayConnection,
-                                        mPixmap,
-                                        0,
-                                        0, // x,y of subregion to extract.
-                                        width,
-                                        height, // of subregion to extract.
-                                        0xFFFFFFFF,
-                                        ZPixmap));
-  XImage* const pXImage = xImageJanitor.mXImage;
-  DALI_ASSERT_DEBUG(pXImage && "XImage (from pixmap) could not be retrieved from the server");
-  if(!pXImage)
-  {
-    DALI_LOG_ERROR("Could not retrieve Ximage.\n");
-  }
-  else
-  {
-    switch(pXImage->depth)
-    {
-      // Note, depth is a logical value. On target the framebuffer is still 32bpp
-      // (see pXImage->bits_per_pixel) so we go through XGetPixel() and swizzle.
-      // Note, this could be the default, fallback case for all depths if *pXImage
-      // didn't have blank RGB masks (X bug), but we have to hardcode the masks and
-      // shifts instead.
-      case 24:
-      {
-        pixelFormat = Pixel::RGB888;
-        pixbuf.resize(width * height * 3);
-        uint8_t* bufPtr = &pixbuf[0];
-
-        for(uint32_t y = 0; y < height; ++y)
-        {
-          for(uint32_t x = 0; x < width; ++x, bufPtr += 3)
-          {
-            const uint32_t pixel = XGetPixel(pXImage, x, y);
-
-            // store as RGB
-            const uint32_t blue  = pixel & 0xFFU;
-            const uint32_t green = (pixel >> 8) & 0xFFU;
-            const uint32_t red   = (pixel >> 16) & 0xFFU;
-
-            *bufPtr       = red;
-            *(bufPtr + 1) = green;
-            *(bufPtr + 2) = blue;
-          }
-        }
-        success = true;
-        break;
-      }
-      case 32:
-      {
-        if(pXImage->data)
-        {
-          // Sweep through the image, doing a vertical flip, but handling each scanline as
-          // an inlined intrinsic/builtin memcpy (should be fast):
-          pixbuf.resize(width * height * 4);
-          uint32_t*      bufPtr        = reinterpret_cast<uint32_t*>(&pixbuf[0]);
-          const uint32_t xDataLineSkip = pXImage->bytes_per_line;
-          const size_t   copy_count    = static_cast<size_t>(width) * 4;
-          pixelFormat                  = Pixel::BGRA8888;
-
-          for(uint32_t y = 0; y < height; ++y, bufPtr += width)
-          {
-            const char* const in = pXImage->data + xDataLineSkip * y;
-
-            // Copy a whole scanline at a time:
-            DALI_ASSERT_DEBUG(size_t(bufPtr) >= size_t(&pixbuf[0]));
-            DALI_ASSERT_DEBUG(reinterpret_cast<size_t>(bufPtr) + copy_count <= reinterpret_cast<size_t>(&pixbuf[pixbuf.size()]));
-            DALI_ASSERT_DEBUG(in >= pXImage->data);
-            DALI_ASSERT_DEBUG(in + copy_count <= pXImage->data + xDataLineSkip * height);
-            __builtin_memcpy(bufPtr, in, copy_count);
-          }
-          success = true;
-        }
-        else
-        {
-          DALI_LOG_ERROR("XImage has null data pointer.\n");
-        }
-        break;
-      }
-      // Make a case for 16 bit modes especially to remember that the only reason we don't support them is a bug in X:
-      case 16:
-      {
-        DALI_ASSERT_DEBUG(pXImage->red_mask && pXImage->green_mask && pXImage->blue_mask && "No image masks mean 16 bit modes are not possible.");
-        ///! If the above assert doesn't fail in a debug build, the X bug may have been fixed, so revisit this function.
-        ///! No break, fall through to the general unsupported format warning below.
-      }
-      default:
-      {
-        DALI_LOG_WARNING("Pixmap has unsupported bit-depth for getting pixels: %u\n", pXImage->depth);
-      }
-    }
-  }
-  if(!success)
+  width  = mWidth;
+  height = mHeight;
+
+  // The pixels are read on a connection kept by the reader, so the events of this one are not held up.
+  ::Display* display = static_cast<::Display*>(ecore_x_display_get());
+  if(!ReadPixmapPixels(display, mPixmap, width, height, pixbuf, pixelFormat))
   {
     DALI_LOG_ERROR("Failed to get pixels from NativeImageSource.\n");
     pixbuf.resize(0);
     width  = 0;
     height = 0;
+    return false;
   }
-
-  // Close the display connection
-  XCloseDisplay(displayConnection);
-
-  return success;
+  return true;
 }
 
 void NativeImageSourceX::SetSource(Any source)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -247,6 +247,24 @@ bool DownloadRemoteFileIntoMemory(const std::string&     url,
   return result;
 }
 
+bool DownloadRemoteFilesIntoMemory(const std::vector<std::string>& urls,
+                                   std::vector<DownloadResult>&    results,
+                                   size_t                          maximumAllowedSizeBytes,
+                                   uint32_t                        maximumConcurrentDownloads)
+{
+  // Download one by one.
+  results.clear();
+  results.resize(urls.size());
+
+  bool succeeded = true;
+  for(size_t i = 0u; i < urls.size(); ++i)
+  {
+    results[i].succeeded = DownloadRemoteFileIntoMemory(urls[i], results[i].dataBuffer, results[i].dataSize, maximumAllowedSizeBytes);
+    succeeded &= results[i].succeeded;
+  }
+  return succeeded;
+}
+
 } // namespace Network
 
 } // namespace TizenPlatform
@@ -0,0 +1,699 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/imaging/x11/pixmap-reader-x.h>
+
+// EXTERNAL INCLUDES
+#include <X11/Xutil.h>
+#include <X11/extensions/XShm.h>
+#include <dali/integration-api/debug.h>
+#include <sys/ipc.h>
+#include <sys/shm.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+// XESetCloseDisplay() is declared for the extensions, with macros clashing with the standard library.
+#include <X11/Xlibint.h>
+#undef min
+#undef max
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DALI_PIXMAP_READER_SSSE3
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define DALI_PIXMAP_READER_NEON
+#include <arm_neon.h>
+#endif
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+namespace
+{
+constexpr int    X_SHM_ATTACH              = 1;  ///< X_ShmAttach of shmproto.h, which needs the server headers
+constexpr size_t MAXIMUM_CACHED_SHM_IMAGES = 4u; ///< The number of segments kept attached, one per size
+
+std::atomic<bool> gShmUnavailable{false}; ///< Set once the server could not attach a segment, the pixmaps are read with XGetImage() then
+
+// The error handler of Xlib is global, so it is replaced by one thread at a time.
+std::mutex        gErrorHandlerMutex;
+XErrorHandler     gPreviousErrorHandler = nullptr;
+int               gShmMajorOpcode       = 0;
+std::atomic<bool> gShmErrorOccurred{false};
+std::atomic<bool> gShmAttachFailed{false};
+
+/**
+ * Catches the errors of the MIT-SHM requests, which would stop the application with the default handler.
+ */
+int ShmErrorHandler(::Display* display, XErrorEvent* event)
+{
+  if(event->request_code == gShmMajorOpcode)
+  {
+    gShmErrorOccurred = true;
+    if(event->minor_code == X_SHM_ATTACH)
+    {
+      gShmAttachFailed = true;
+    }
+    return 0;
+  }
+  return gPreviousErrorHandler ? gPreviousErrorHandler(display, event) : 0;
+}
+
+/**
+ * Catches the errors of the MIT-SHM requests sent during its lifetime.
+ */
+class ShmErrorTrap
+{
+public:
+  explicit ShmErrorTrap(::Display* display)
+  : mLock(gErrorHandlerMutex),
+    mDisplay(display)
+  {
+    int firstEvent, firstError;
+    XQueryExtension(mDisplay, "MIT-SHM", &gShmMajorOpcode, &firstEvent, &firstError);
+    gShmErrorOccurred     = false;
+    gShmAttachFailed      = false;
+    gPreviousErrorHandler = XSetErrorHandler(ShmErrorHandler);
+  }
+
+  ~ShmErrorTrap()
+  {
+    XSetErrorHandler(gPreviousErrorHandler);
+  }
+
+  /**
+   * Waits for the errors of the requests.
+   */
+  void Sync()
+  {
+    XSync(mDisplay, False);
+  }
+
+private:
+  ShmErrorTrap(const ShmErrorTrap& rhs);
+  ShmErrorTrap& operator=(const ShmErrorTrap& rhs);
+
+  std::lock_guard<std::mutex> mLock;
+  ::Display*                  mDisplay;
+};
+
+/**
+ * Free an allocated XImage on destruction.
+ */
+struct XImageJanitor
+{
+  XImageJanitor(XImage* const pXImage)
+  : mXImage(pXImage)
+  {
+  }
+
+  ~XImageJanitor()
+  {
+    if(mXImage)
+    {
+      if(!XDestroyImage(mXImage))
+      {
+        DALI_LOG_ERROR("XImage deallocation failure");
+      }
+    }
+  }
+  XImage* const mXImage;
+
+private:
+  XImageJanitor(const XImageJanitor& rhs);
+  XImageJanitor& operator=(const XImageJanitor& rhs);
+};
+
+/**
+ * An image in a shared memory segment, which the server fills with XShmGetImage().
+ * The pixels are not copied through the connection, unlike XGetImage().
+ */
+class ShmImage
+{
+public:
+  ShmImage(::Display* display, unsigned int depth, uint32_t width, uint32_t height)
+  : mDisplay(display),
+    mImage(nullptr),
+    mDepth(depth),
+    mWidth(width),
+    mHeight(height),
+    mAttached(false)
+  {
+    mShmInfo.shmseg   = 0;
+    mShmInfo.shmid    = -1;
+    mShmInfo.shmaddr  = nullptr;
+    mShmInfo.readOnly = False;
+  }
+
+  ~ShmImage()
+  {
+    if(mAttached)
+    {
+      XShmDetach(mDisplay, &mShmInfo);
+    }
+    if(mImage)
+    {
+      // Frees the structure only, not the segment.
+      XDestroyImage(mImage);
+    }
+    if(mShmInfo.shmaddr)
+    {
+      shmdt(mShmInfo.shmaddr);
+    }
+  }
+
+  /**
+   * Creates the segment and attaches it to the server.
+   * @return false if the segment cannot be used. MIT-SHM is not used any more if the server cannot attach it.
+   */
+  bool Attach()
+  {
+    mImage = XShmCreateImage(mDisplay, DefaultVisual(mDisplay, DefaultScreen(mDisplay)), mDepth, ZPixmap, nullptr, &mShmInfo, mWidth, mHeight);
+    if(!mImage)
+    {
+      return false;
+    }
+
+    mShmInfo.shmid = shmget(IPC_PRIVATE, static_cast<size_t>(mImage->bytes_per_line) * mImage->height, IPC_CREAT | 0600);
+    if(mShmInfo.shmid < 0)
+    {
+      DALI_LOG_ERROR("Fail to create a shared memory segment of %d bytes\n", mImage->bytes_per_line * mImage->height);
+      return false;
+    }
+
+    void* address = shmat(mShmInfo.shmid, nullptr, 0);
+    if(address == reinterpret_cast<void*>(-1))
+    {
+      DALI_LOG_ERROR("Fail to attach the shared memory segment\n");
+      shmctl(mShmInfo.shmid, IPC_RMID, nullptr);
+      return false;
+    }
+    mShmInfo.shmaddr = mImage->data = static_cast<char*>(address);
+
+    {
+      ShmErrorTrap errorTrap(mDisplay);
+      mAttached = XShmAttach(mDisplay, &mShmInfo);
+      errorTrap.Sync();
+      mAttached = mAttached && !gShmAttachFailed;
+    }
+
+    // The server has attached the segment, so it is destroyed once both sides have detached it.
+    shmctl(mShmInfo.shmid, IPC_RMID, nullptr);
+
+    if(!mAttached)
+    {
+      // e.g. The server runs on another machine, or doesn't share our IPC namespace.
+      DALI_LOG_ERROR("Fail to attach a segment with MIT-SHM, XGetImage() is used from now on\n");
+      gShmUnavailable = true;
+    }
+    return mAttached;
+  }
+
+  /**
+   * Reads the pixmap into the segment.
+   * @return false if the server could not, e.g. the pixmap is smaller than the image. XGetImage() is used for this read only.
+   */
+  bool Read(::Pixmap pixmap)
+  {
+    ShmErrorTrap errorTrap(mDisplay);
+    const bool   read = XShmGetImage(mDisplay, pixmap, mImage, 0, 0, AllPlanes);
+    errorTrap.Sync();
+    return read && !gShmErrorOccurred;
+  }
+
+  /**
+   * @return Whether the image can be used to read a pixmap of this depth and size.
+   */
+  bool Matches(::Display* display, unsigned int depth, uint32_t width, uint32_t height) const
+  {
+    return mDisplay == display && mDepth == depth && mWidth == width && mHeight == height;
+  }
+
+  /**
+   * @return Whether both images can be used to read the same pixmaps.
+   */
+  bool Matches(const ShmImage& rhs) const
+  {
+    return Matches(rhs.mDisplay, rhs.mDepth, rhs.mWidth, rhs.mHeight);
+  }
+
+  /**
+   * The connection is closed, so the server has detached the segment already.
+   */
+  void OnDisplayClosed()
+  {
+    mAttached = false;
+  }
+
+  ::Display* GetDisplay() const
+  {
+    return mDisplay;
+  }
+
+  XImage* GetImage() const
+  {
+    return mImage;
+  }
+
+private:
+  ShmImage(const ShmImage& rhs);
+  ShmImage& operator=(const ShmImage& rhs);
+
+  ::Display*      mDisplay;
+  XImage*         mImage;
+  XShmSegmentInfo mShmInfo;
+  unsigned int    mDepth;
+  uint32_t        mWidth;
+  uint32_t        mHeight;
+  bool            mAttached;
+};
+
+using ShmImagePtr = std::unique_ptr<ShmImage>;
+
+// The segments stay attached between the reads, as creating and attaching one costs more than reading a small pixmap.
+std::mutex               gShmImageCacheMutex;
+std::vector<ShmImagePtr> gShmImageCache;  ///< At most one image per display, depth and size, the oldest first
+std::vector<::Display*>  gShmCacheDisplays; ///< The displays which drop their images from the cache when closed
+
+/**
+ * Drops the images of a display being closed, called by XCloseDisplay().
+ */
+int OnCloseDisplay(::Display* display, XExtCodes* /* codes */)
+{
+  std::vector<ShmImagePtr> closedImages;
+  {
+    std::lock_guard<std::mutex> lock(gShmImageCacheMutex);
+    for(auto iter = gShmImageCache.begin(); iter != gShmImageCache.end();)
+    {
+      if((*iter)->GetDisplay() == display)
+      {
+        (*iter)->OnDisplayClosed();
+        closedImages.push_back(std::move(*iter));
+        iter = gShmImageCache.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+    gShmCacheDisplays.erase(std::remove(gShmCacheDisplays.begin(), gShmCacheDisplays.end(), display), gShmCacheDisplays.end());
+  }
+  return 0;
+}
+
+// The reads use a connection of their own, so their round trips never read the events of the connection
+// of the adaptor. Those would wait in its queue, as WindowSystemX drains it only when its socket wakes up.
+std::mutex gReaderDisplayMutex;
+::Display* gReaderDisplay       = nullptr; ///< The connection of the reads, opened at the first read
+::Display* gReaderDisplayOwner  = nullptr; ///< The connection of the adaptor, which closes the reader connection when closed
+bool       gReaderDisplayFailed = false;   ///< Set once the reader connection could not be opened, the connection of the adaptor is used then
+
+/**
+ * Closes the reader connection with the connection of the adaptor, called by XCloseDisplay().
+ */
+int OnCloseOwnerDisplay(::Display* display, XExtCodes* /* codes */)
+{
+  ::Display* readerDisplay = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(gReaderDisplayMutex);
+    if(display == gReaderDisplayOwner)
+    {
+      readerDisplay       = gReaderDisplay;
+      gReaderDisplay      = nullptr;
+      gReaderDisplayOwner = nullptr;
+    }
+  }
+
+  // Closed out of the lock, as it drops the cached images of the reader connection.
+  if(readerDisplay)
+  {
+    XCloseDisplay(readerDisplay);
+  }
+  return 0;
+}
+
+/**
+ * Gets the reader connection to the server of the display, opening it at the first call.
+ * @return The reader connection, or the display itself if it cannot be opened
+ */
+::Display* GetReaderDisplay(::Display* display)
+{
+  std::lock_guard<std::mutex> lock(gReaderDisplayMutex);
+  if(gReaderDisplay && gReaderDisplayOwner == display)
+  {
+    return gReaderDisplay;
+  }
+  if(gReaderDisplayOwner || gReaderDisplayFailed)
+  {
+    // Only one connection of the adaptor is expected.
+    return display;
+  }
+
+  ::Display* readerDisplay = XOpenDisplay(DisplayString(display));
+  XExtCodes* codes         = readerDisplay ? XAddExtension(display) : nullptr;
+  if(!codes)
+  {
+    DALI_LOG_ERROR("Fail to open a connection to read the pixmaps, the connection of the adaptor is used\n");
+    if(readerDisplay)
+    {
+      XCloseDisplay(readerDisplay);
+    }
+    gReaderDisplayFailed = true;
+    return display;
+  }
+  XESetCloseDisplay(display, codes->extension, OnCloseOwnerDisplay);
+
+  gReaderDisplay      = readerDisplay;
+  gReaderDisplayOwner = display;
+  return gReaderDisplay;
+}
+
+/**
+ * Takes the cached image of the size of the pixmap, or creates one.
+ * @return nullptr if MIT-SHM cannot be used
+ */
+ShmImagePtr AcquireShmImage(::Display* display, ::Pixmap pixmap, uint32_t width, uint32_t height)
+{
+  if(gShmUnavailable.load(std::memory_order_relaxed) || !XShmQueryExtension(display))
+  {
+    return nullptr;
+  }
+
+  // The image must have the depth of the pixmap.
+  ::Window     root;
+  int          x, y;
+  unsigned int pixmapWidth, pixmapHeight, borderWidth, depth;
+  if(!XGetGeometry(display, pixmap, &root, &x, &y, &pixmapWidth, &pixmapHeight, &borderWidth, &depth))
+  {
+    return nullptr;
+  }
+
+  {
+    // Taken out of the cache, so the threads reading pixmaps of the same size don't share it.
+    std::lock_guard<std::mutex> lock(gShmImageCacheMutex);
+    for(auto iter = gShmImageCache.begin(); iter != gShmImageCache.end(); ++iter)
+    {
+      if((*iter)->Matches(display, depth, width, height))
+      {
+        ShmImagePtr image = std::move(*iter);
+        gShmImageCache.erase(iter);
+        return image;
+      }
+    }
+  }
+
+  ShmImagePtr image(new ShmImage(display, depth, width, height));
+  if(!image->Attach())
+  {
+    return nullptr;
+  }
+  return image;
+}
+
+/**
+ * Puts an image back into the cache, for the next read of the same size.
+ */
+void ReleaseShmImage(ShmImagePtr image)
+{
+  // Destroyed out of the lock, as detaching them waits for the connection.
+  ShmImagePtr droppedImage;
+  {
+    std::lock_guard<std::mutex> lock(gShmImageCacheMutex);
+    for(const auto& cachedImage : gShmImageCache)
+    {
+      if(cachedImage->Matches(*image))
+      {
+        // Another thread has read a pixmap of the same size meanwhile.
+        return;
+      }
+    }
+
+    ::Display* display = image->GetDisplay();
+    if(std::find(gShmCacheDisplays.begin(), gShmCacheDisplays.end(), display) == gShmCacheDisplays.end())
+    {
+      XExtCodes* codes = XAddExtension(display);
+      if(!codes)
+      {
+        return;
+      }
+      XESetCloseDisplay(display, codes->extension, OnCloseDisplay);
+      gShmCacheDisplays.push_back(display);
+    }
+
+    gShmImageCache.push_back(std::move(image));
+    if(gShmImageCache.size() > MAXIMUM_CACHED_SHM_IMAGES)
+    {
+      droppedImage = std::move(gShmImageCache.front());
+      gShmImageCache.erase(gShmImageCache.begin());
+    }
+  }
+}
+
+/**
+ * Puts the image back into the cache on destruction.
+ */
+struct ShmImageJanitor
+{
+  ShmImageJanitor(ShmImagePtr& image)
+  : mImage(image)
+  {
+  }
+
+  ~ShmImageJanitor()
+  {
+    if(mImage)
+    {
+      ReleaseShmImage(std::move(mImage));
+    }
+  }
+  ShmImagePtr& mImage;
+
+private:
+  ShmImageJanitor(const ShmImageJanitor& rhs);
+  ShmImageJanitor& operator=(const ShmImageJanitor& rhs);
+};
+
+/**
+ * @return Whether the pixels of the image are B G R X in memory.
+ */
+bool IsBGRX8888(const XImage* image)
+{
+  // The masks are blank with some servers, the default layout is expected then.
+  const bool defaultMasks = (image->red_mask == 0xFF0000UL && image->green_mask == 0xFF00UL && image->blue_mask == 0xFFUL) ||
+                            (image->red_mask == 0 && image->green_mask == 0 && image->blue_mask == 0);
+  return image->bits_per_pixel == 32 && image->byte_order == LSBFirst && defaultMasks;
+}
+
+#if defined(DALI_PIXMAP_READER_SSSE3)
+
+// SSSE3 is not the baseline of x86 builds, so the kernel is compiled for it and called after the CPU is checked.
+#define SIMD_KERNEL __attribute__((target("ssse3")))
+
+/// @return The number of pixels converted. The caller converts the rest.
+SIMD_KERNEL uint32_t ConvertScanlineBGRX8888ToRGB888Simd(const uint8_t* in, uint8_t* out, uint32_t width)
+{
+  const __m128i shuffle = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+  // Each store writes 4 bytes after its 4 pixels, which the next store overwrites, so 2 more pixels must follow.
+  uint32_t x = 0;
+  for(; x + 6u <= width; x += 4u)
+  {
+    const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + x * 4u));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + x * 3u), _mm_shuffle_epi8(pixels, shuffle));
+  }
+  return x;
+}
+
+#elif defined(DALI_PIXMAP_READER_NEON)
+
+/// @return The number of pixels converted. The caller converts the rest.
+uint32_t ConvertScanlineBGRX8888ToRGB888Simd(const uint8_t* in, uint8_t* out, uint32_t width)
+{
+  uint32_t x = 0;
+  for(; x + 16u <= width; x += 16u)
+  {
+    const uint8x16x4_t bgrx = vld4q_u8(in + x * 4u);
+    uint8x16x3_t       rgb;
+    rgb.val[0] = bgrx.val[2];
+    rgb.val[1] = bgrx.val[1];
+    rgb.val[2] = bgrx.val[0];
+    vst3q_u8(out + x * 3u, rgb);
+  }
+  return x;
+}
+
+#endif
+
+using ConvertScanlineFunction = uint32_t (*)(const uint8_t* in, uint8_t* out, uint32_t width);
+
+ConvertScanlineFunction DetectConvertScanlineSimd()
+{
+#if defined(DALI_PIXMAP_READER_SSSE3)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("ssse3"))
+  {
+    return ConvertScanlineBGRX8888ToRGB888Simd;
+  }
+#elif defined(DALI_PIXMAP_READER_NEON)
+  // NEON is enabled at compile time, so every CPU running this build has it.
+  return ConvertScanlineBGRX8888ToRGB888Simd;
+#endif
+  return nullptr;
+}
+
+} // namespace
+
+void ConvertScanlineBGRX8888ToRGB888(const uint8_t* in, uint8_t* out, uint32_t width)
+{
+  static const ConvertScanlineFunction convertScanlineSimd = DetectConvertScanlineSimd();
+
+  uint32_t x = convertScanlineSimd ? convertScanlineSimd(in, out, width) : 0u;
+  for(; x < width; ++x)
+  {
+    out[x * 3u]      = in[x * 4u + 2u];
+    out[x * 3u + 1u] = in[x * 4u + 1u];
+    out[x * 3u + 2u] = in[x * 4u];
+  }
+}
+
+bool ReadPixmapPixels(::Display* eventDisplay, ::Pixmap pixmap, uint32_t width, uint32_t height, std::vector<uint8_t>& pixbuf, Pixel::Format& pixelFormat)
+{
+  if(!eventDisplay || !pixmap || width == 0 || height == 0)
+  {
+    return false;
+  }
+
+  // Sends the requests drawing into the pixmap before it is read on the other connection. It doesn't wait for any reply.
+  XFlush(eventDisplay);
+  ::Display* display = GetReaderDisplay(eventDisplay);
+
+  ShmImagePtr     shmImage = AcquireShmImage(display, pixmap, width, height);
+  ShmImageJanitor shmImageJanitor(shmImage);
+  const bool      shmRead = shmImage && shmImage->Read(pixmap);
+  XImageJanitor   xImageJanitor(shmRead ? nullptr : XGetImage(display, pixmap, 0, 0, width, height, AllPlanes, ZPixmap));
+
+  XImage* const pXImage = shmRead ? shmImage->GetImage() : xImageJanitor.mXImage;
+  if(!pXImage)
+  {
+    DALI_LOG_ERROR("Could not retrieve Ximage.\n");
+    return false;
+  }
+  if(!pXImage->data)
+  {
+    DALI_LOG_ERROR("XImage has null data pointer.\n");
+    return false;
+  }
+
+  const char* const data          = pXImage->data;
+  const uint32_t    xDataLineSkip = pXImage->bytes_per_line;
+  bool              success       = false;
+
+  switch(pXImage->depth)
+  {
+    // Note, depth is a logical value. On target the framebuffer is still 32bpp
+    // (see pXImage->bits_per_pixel), so the pixels are swizzled a scanline at a time.
+    case 24:
+    {
+      pixelFormat = Pixel::RGB888;
+      pixbuf.resize(static_cast<size_t>(width) * height * 3);
+      uint8_t* bufPtr = &pixbuf[0];
+
+      if(IsBGRX8888(pXImage))
+      {
+        for(uint32_t y = 0; y < height; ++y, bufPtr += width * 3)
+        {
+          ConvertScanlineBGRX8888ToRGB888(reinterpret_cast<const uint8_t*>(data + xDataLineSkip * y), bufPtr, width);
+        }
+      }
+      else
+      {
+        // Other layouts go through XGetPixel(), with hardcoded shifts as the masks may be blank (X bug).
+        for(uint32_t y = 0; y < height; ++y)
+        {
+          for(uint32_t x = 0; x < width; ++x, bufPtr += 3)
+          {
+            const uint32_t pixel = XGetPixel(pXImage, x, y);
+
+            // store as RGB
+            const uint32_t blue  = pixel & 0xFFU;
+            const uint32_t green = (pixel >> 8) & 0xFFU;
+            const uint32_t red   = (pixel >> 16) & 0xFFU;
+
+            *bufPtr       = red;
+            *(bufPtr + 1) = green;
+            *(bufPtr + 2) = blue;
+          }
+        }
+      }
+      success = true;
+      break;
+    }
+    case 32:
+    {
+      if(pXImage->bits_per_pixel != 32)
+      {
+        DALI_LOG_WARNING("Pixmap has unsupported bits per pixel for getting pixels: %d\n", pXImage->bits_per_pixel);
+        break;
+      }
+
+      // Sweep through the image, handling each scanline as an inlined intrinsic/builtin memcpy (should be fast):
+      pixelFormat = Pixel::BGRA8888;
+      pixbuf.resize(static_cast<size_t>(width) * height * 4);
+      const size_t copyCount = static_cast<size_t>(width) * 4;
+      if(xDataLineSkip == copyCount)
+      {
+        __builtin_memcpy(&pixbuf[0], data, copyCount * height);
+      }
+      else
+      {
+        uint8_t* bufPtr = &pixbuf[0];
+        for(uint32_t y = 0; y < height; ++y, bufPtr += copyCount)
+        {
+          __builtin_memcpy(bufPtr, data + xDataLineSkip * y, copyCount);
+        }
+      }
+      success = true;
+      break;
+    }
+    // Make a case for 16 bit modes especially to remember that the only reason we don't support them is a bug in X:
+    case 16:
+    {
+      DALI_ASSERT_DEBUG(pXImage->red_mask && pXImage->green_mask && pXImage->blue_mask && "No image masks mean 16 bit modes are not possible.");
+      ///! If the above assert doesn't fail in a debug build, the X bug may have been fixed, so revisit this function.
+      ///! No break, fall through to the general unsupported format warning below.
+    }
+    default:
+    {
+      DALI_LOG_WARNING("Pixmap has unsupported bit-depth for getting pixels: %u\n", pXImage->depth);
+    }
+  }
+
+  return success;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
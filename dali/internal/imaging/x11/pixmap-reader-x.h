@@ -0,0 +1,72 @@
+#ifndef DALI_INTERNAL_IMAGING_X11_PIXMAP_READER_X_H
+#define DALI_INTERNAL_IMAGING_X11_PIXMAP_READER_X_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <X11/Xlib.h>
+#include <dali/public-api/images/pixel.h>
+#include <cstdint>
+#include <vector>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+/**
+ * @brief Reads the pixels of a pixmap, for NativeImageSource::GetPixels().
+ *
+ * The pixels are read with XShmGetImage() into a shared memory segment when the server supports MIT-SHM,
+ * and with XGetImage() otherwise, or once attaching a segment has failed (e.g. with a remote server).
+ * A read failing with XShmGetImage() falls back to XGetImage() for this read only.
+ * A few segments stay attached, one per size, for the next reads of the same size. They are dropped
+ * when the display is closed.
+ * The reads use a connection of their own to the server, opened at the first read and closed with the
+ * connection of the adaptor. So their round trips never read the events of the adaptor's connection,
+ * which would stay queued until its socket wakes up the event thread again.
+ * Depth 24 pixmaps are converted to RGB888, depth 32 pixmaps are copied as BGRA8888.
+ *
+ * @note It may be called in a worker thread, Xlib must be initialised with XInitThreads().
+ * @param[in] eventDisplay The connection of the adaptor
+ * @param[in] pixmap The pixmap
+ * @param[in] width The width of the pixmap
+ * @param[in] height The height of the pixmap
+ * @param[out] pixbuf The pixels
+ * @param[out] pixelFormat The format of the pixels
+ * @return true if the pixels were read
+ */
+bool ReadPixmapPixels(::Display* eventDisplay, ::Pixmap pixmap, uint32_t width, uint32_t height, std::vector<uint8_t>& pixbuf, Pixel::Format& pixelFormat);
+
+/**
+ * @brief Converts a scanline of a depth 24 image, with 32 bits per pixel in the LSBFirst byte order, to RGB888.
+ *
+ * @param[in] in The input pixels, B G R X in memory
+ * @param[out] out The output pixels
+ * @param[in] width The number of pixels
+ */
+void ConvertScanlineBGRX8888ToRGB888(const uint8_t* in, uint8_t* out, uint32_t width);
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_IMAGING_X11_PIXMAP_READER_X_H
@@ -2,7 +2,7 @@
 #define DALI_TIZEN_PLATFORM_IMAGE_ENCODER_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -18,8 +18,18 @@
  *
  */
 
+// EXTERNAL INCLUDES
+#include <cstdint>
+#include <functional>
+
 namespace Dali
 {
+/**
+ * Gives the rows of an image to encode, one by one from the top.
+ * The pixels of a row are valid until the next call. nullptr means that the row cannot be read.
+ */
+using EncodeRowFunction = std::function<const uint8_t*(uint32_t row)>;
+
 /**
  * Used file format
  */
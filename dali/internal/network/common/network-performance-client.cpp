@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <stdio.h>
+#include <string.h>
 #include <iostream>
 #include <string>
 
@@ -27,6 +28,7 @@
 #include <dali/internal/network/common/automation.h>
 #include <dali/internal/network/common/network-performance-protocol.h>
 #include <dali/internal/network/common/socket-interface.h>
+#include <dali/internal/trace/common/trace-recorder.h>
 
 namespace Dali
 {
@@ -148,7 +150,8 @@ NetworkPerformanceClient::NetworkPerformanceClient(pthread_t*               thre
   mSendDataInterface(sendDataInterface),
   mSocketFactoryInterface(socketFactory),
   mClientId(clientId),
-  mConsoleClient(false)
+  mConsoleClient(false),
+  mStatisticsEnabled(false)
 {
 }
 
@@ -197,6 +200,22 @@ bool NetworkPerformanceClient::TransmitMarker(const PerformanceMarker& marker, c
   return false;
 }
 
+bool NetworkPerformanceClient::TransmitStatistics(const char* const text)
+{
+  if(!mStatisticsEnabled)
+  {
+    return true;
+  }
+  if(mConsoleClient)
+  {
+    // the text already ends with a line break
+    return mSocket->Write(text, strlen(text));
+  }
+
+  // todo serialize the data
+  return false;
+}
+
 void NetworkPerformanceClient::ExitSelect()
 {
   mSocket->ExitSelect();
@@ -262,6 +281,28 @@ void NetworkPerformanceClient::ProcessCommand(char* buffer, unsigned int bufferS
       break;
     }
 
+    case PerformanceProtocol::DUMP_TRACE:
+    {
+      // The recorder can be dumped from any thread.
+      TraceRecorder* recorder = TraceRecorder::Get();
+      if(!recorder)
+      {
+        response = "Trace recorder disabled";
+      }
+      else
+      {
+        response = recorder->Dump(stringParam) ? "Completed" : "Failed to write the trace";
+      }
+      break;
+    }
+
+    case PerformanceProtocol::ENABLE_STATISTICS:
+    {
+      mStatisticsEnabled = (param != 0u);
+      response           = mStatisticsEnabled ? "statistics enabled" : "statistics disabled";
+      break;
+    }
+
     case PerformanceProtocol::LIST_METRICS_AVAILABLE:
     case PerformanceProtocol::ENABLE_METRIC:
     case PerformanceProtocol::DISABLE_METRIC:
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ADAPTOR_NETWORK_PERFORMANCE_CLIENT_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <pthread.h>
+#include <atomic>
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/adaptor-framework/trigger-event-factory.h>
@@ -102,6 +103,12 @@ public:
    */
   bool TransmitMarker(const PerformanceMarker& marker, const char* const description);
 
+  /**
+   * @brief Write the statistics of a context to the socket, if this client has enabled them.
+   * @param[in] text the statistics text
+   */
+  bool TransmitStatistics(const char* const text);
+
   /**
    * @brief If the client is waiting inside a select statement, this will cause it
    * to break out.
@@ -122,6 +129,7 @@ private:
   SocketFactoryInterface&         mSocketFactoryInterface; ///< used to delete the socket
   unsigned int                    mClientId;               ///< unique client id
   bool                            mConsoleClient;          ///< if connected via a console then all responses are in ASCII, not binary packed data.
+  std::atomic<bool>               mStatisticsEnabled;      ///< whether the statistics are sent, read from the thread logging them
 };
 
 } // namespace Adaptor
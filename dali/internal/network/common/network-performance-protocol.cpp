@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -65,6 +65,8 @@ CommandInfo CommandLookup[]=
   {DUMP_SCENE_GRAPH,            "dump_scene",     NO_PARAMS   },
   {SET_PROPERTIES,              "set_properties", STRING      },
   {CUSTOM_COMMAND,              "custom_command", STRING      },
+  {DUMP_TRACE,                  "dump_trace",     STRING      },
+  {ENABLE_STATISTICS,           "set_statistics", UNSIGNED_INT},
   {UNKNOWN_COMMAND,             "unknown",        NO_PARAMS   }
 };
 // clang-format on
@@ -93,6 +95,9 @@ const char* const helpMsg =
     "            : Bit 5  = Life cycle events  (32)\n"
     "            : Bit 6  = Resource event (64)\n"
     "\n"
+    GREEN " set_statistics " PARAM " value " NORMAL "- 1 to output the statistics of each context every log period, 0 to stop\n"
+    "            : min, max, avg, std dev, p50, p90, p99 and p99.9 of update, render, event processing, v-sync to present and custom contexts\n"
+    "\n"
     GREEN " set_properties " NORMAL " - set an actor property command. Format:\n\n"
     GREEN " set_properties " PARAM "|ActorIndex;Property;Value|" NORMAL ", e.g: \n"
     GREEN " set_properties " PARAM "|178;Size;[ 144.0, 144.0, 144.0 ]|178;Color;[ 1.0, 1,0, 1.0 ]|\n"
@@ -100,7 +105,8 @@ const char* const helpMsg =
     GREEN " custom_command " NORMAL " - A custom command for an application. Format:\n\n"
     GREEN " custom_command " PARAM "ANY_STRING" NORMAL "\n"
     "\n"
-    GREEN " dump_scene" NORMAL " - dump the current scene in json format\n";
+    GREEN " dump_scene" NORMAL " - dump the current scene in json format\n"
+    GREEN " dump_trace " PARAM "path" NORMAL " - write the recorded trace in Chrome trace event json format (needs DALI_TRACE_RECORDER_OUTPUT)\n";
 // clang-format off
 } // un-named namespace
 
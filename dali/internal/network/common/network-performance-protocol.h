@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ADAPTOR_NETWORK_PERFORMANCE_PROTOCOL_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -40,6 +40,8 @@ enum CommandId
   SET_PROPERTIES              = 5, ///< set property
   DUMP_SCENE_GRAPH            = 6, ///< dump the scene graph
   CUSTOM_COMMAND              = 7, ///< custom command for the application
+  DUMP_TRACE                  = 8, ///< write the recorded trace events to a file
+  ENABLE_STATISTICS           = 9, ///< send the periodic statistics of the contexts
   UNKNOWN_COMMAND             = 4096
 };
 
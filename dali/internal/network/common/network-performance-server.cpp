@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -305,6 +305,22 @@ void NetworkPerformanceServer::TransmitMarker(const PerformanceMarker& marker, c
   }
 }
 
+void NetworkPerformanceServer::TransmitStatistics(const char* const text)
+{
+  if(!IsRunning())
+  {
+    return;
+  }
+  // prevent clients been added / deleted while transmiting data
+  Mutex::ScopedLock lock(mClientListMutex);
+
+  for(ClientList::Iterator iter = mClients.Begin(); iter != mClients.End(); ++iter)
+  {
+    NetworkPerformanceClient* client = (*iter);
+    client->TransmitStatistics(text);
+  }
+}
+
 void NetworkPerformanceServer::TriggerMainThreadAutomation(CallbackBase* callback)
 {
   // Called from client thread.
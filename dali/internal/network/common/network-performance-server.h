@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ADAPTOR_NETWORK_PERFORMANCE_SERVER_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -92,6 +92,13 @@ public:
    */
   void TransmitMarker(const PerformanceMarker& marker, const char* const description);
 
+  /**
+   * @brief Transmit the statistics of a context to any clients which have enabled them.
+   * @param[in] text the statistics text
+   * @pre Can be called from any thread
+   */
+  void TransmitStatistics(const char* const text);
+
   /**
    * Destructor
    */
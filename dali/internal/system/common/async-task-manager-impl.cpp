@@ -28,6 +28,8 @@
 // INTERNAL INCLUDES
 #include <dali/internal/system/common/environment-variables.h>
 
+#include <algorithm>
+#include <chrono>
 #include <unordered_map>
 
 namespace Dali
@@ -45,6 +47,9 @@ constexpr auto DEFAULT_NUMBER_OF_ASYNC_THREADS = size_t{8u};
 // The number of threads for low priority task.
 constexpr auto DEFAULT_NUMBER_OF_LOW_PRIORITY_THREADS = size_t{6u};
 
+// Subtracted from the priority value of the tasks which missed their deadline.
+constexpr int64_t LATE_TASK_PRIORITY_OFFSET = int64_t{1} << 32;
+
 size_t GetNumberOfThreads(size_t defaultValue)
 {
   auto           numberString          = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_ASYNC_MANAGER_THREAD_POOL_SIZE);
@@ -81,15 +86,44 @@ const char* GetTaskName(AsyncTaskPtr task)
   return task ? task->GetTaskName().data() : "(nil)";
 }
 
+/**
+ * @brief Get the current time of the steady clock, as same as AsyncTask::SetDeadline() used.
+ */
+uint64_t GetCurrentMilliSeconds()
+{
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief Get the priority value to compare the waiting tasks.
+ * Tasks which missed their deadline are ordered after all the others, keeping their priority value order.
+ */
+int64_t GetEffectivePriorityValue(int32_t priorityValue, uint64_t deadline, uint64_t now)
+{
+  const bool deadlinePassed = (deadline != 0u && deadline < now);
+  return deadlinePassed ? static_cast<int64_t>(priorityValue) - LATE_TASK_PRIORITY_OFFSET : static_cast<int64_t>(priorityValue);
+}
+
+/**
+ * @brief Check whether the waiting task should be processed before the other one in the same queue.
+ * The larger priority value goes first. Among the same priority value, the task pushed first goes first,
+ * or the task pushed last if it is stolen by the other thread.
+ */
+bool IsPriorTo(int64_t priorityValue, uint64_t sequence, int64_t otherPriorityValue, uint64_t otherSequence, bool steal)
+{
+  return priorityValue > otherPriorityValue || (priorityValue == otherPriorityValue && (steal ? sequence > otherSequence : sequence < otherSequence));
+}
+
 } // unnamed namespace
 
 // AsyncTaskThread
 
-AsyncTaskThread::AsyncTaskThread(AsyncTaskManager& asyncTaskManager)
+AsyncTaskThread::AsyncTaskThread(AsyncTaskManager& asyncTaskManager, uint32_t workerIndex)
 : mConditionalWait(),
   mAsyncTaskManager(asyncTaskManager),
   mLogFactory(Dali::Adaptor::Get().GetLogFactory()),
   mTraceFactory(Dali::Adaptor::Get().GetTraceFactory()),
+  mWorkerIndex(workerIndex),
   mDestroyThread(false),
   mIsThreadStarted(false),
   mIsThreadIdle(true)
@@ -150,7 +184,7 @@ void AsyncTaskThread::Run()
 
   while(!mDestroyThread)
   {
-    AsyncTaskPtr task = mAsyncTaskManager.PopNextTaskToProcess();
+    AsyncTaskPtr task = mAsyncTaskManager.PopNextTaskToProcess(mWorkerIndex);
     if(!task)
     {
       ConditionalWait::ScopedLock lock(mConditionalWait);
@@ -582,11 +616,9 @@ public:
   AsyncTaskManager& mManager; ///< Owner of this CacheImpl.
 
   // Keep cache iterators as list since we take tasks by FIFO as default.
-  using TaskCacheContainer          = std::unordered_map<const AsyncTask*, std::list<AsyncTaskContainer::iterator>>;
   using RunningTaskCacheContainer   = std::unordered_map<const AsyncTask*, std::list<AsyncRunningTaskContainer::iterator>>;
   using CompletedTaskCacheContainer = std::unordered_map<const AsyncTask*, std::list<AsyncCompletedTaskContainer::iterator>>;
 
-  TaskCacheContainer          mWaitingTasksCache;   ///< The cache of tasks and iterator for waiting to async process. Must be locked under mWaitingTasksMutex.
   RunningTaskCacheContainer   mRunningTasksCache;   ///< The cache of tasks and iterator for running tasks. Must be locked under mRunningTasksMutex.
   CompletedTaskCacheContainer mCompletedTasksCache; ///< The cache of tasks and iterator for completed async process. Must be locked under mCompletedTasksMutex.
 };
@@ -619,9 +651,18 @@ Dali::AsyncTaskManager AsyncTaskManager::Get()
 }
 
 AsyncTaskManager::AsyncTaskManager()
-: mTasks(GetNumberOfThreads(DEFAULT_NUMBER_OF_ASYNC_THREADS), [&]() { return TaskHelper(*this); }),
+: mWaitingTaskQueues(),
+  mTasks(GetNumberOfThreads(DEFAULT_NUMBER_OF_ASYNC_THREADS), [&]() {
+    // Each worker thread owns one waiting task queue.
+    mWaitingTaskQueues.emplace_back(new WaitingTaskQueue());
+    return TaskHelper(*this, static_cast<uint32_t>(mWaitingTaskQueues.size() - 1u));
+  }),
   mAvaliableLowPriorityTaskCounts(GetNumberOfLowPriorityThreads(DEFAULT_NUMBER_OF_LOW_PRIORITY_THREADS, mTasks.GetElementCount())),
   mWaitingHighProirityTaskCounts(0u),
+  mWaitingTaskCounts(0u),
+  mNextWaitingTaskQueueIndex(0u),
+  mNextStealingQueueOffset(0u),
+  mBlockedTaskCounts(0u),
   mTrigger(new EventThreadCallback(MakeCallback(this, &AsyncTaskManager::TasksCompleted))),
   mTasksCompletedImpl(new TasksCompletedImpl(*this, mTrigger.get())),
   mCacheImpl(new CacheImpl(*this)),
@@ -645,7 +686,8 @@ AsyncTaskManager::~AsyncTaskManager()
   mCacheImpl.reset();
 
   // Remove tasks after CacheImpl removed
-  mWaitingTasks.clear();
+  mBlockedTasks.clear();
+  mWaitingTaskQueues.clear();
   mRunningTasks.clear();
   mCompletedTasks.clear();
 }
@@ -653,54 +695,171 @@ AsyncTaskManager::~AsyncTaskManager()
 void AsyncTaskManager::AddTask(AsyncTaskPtr task)
 {
   if(task)
+  {
+    // The task might be added again after it was canceled.
+    task->mImpl->canceled = false;
+    {
+      Mutex::ScopedLock lock(task->mImpl->mutex);
+      ++task->mImpl->inProgressCounts;
+    }
+
+    if(!task->mImpl->dependencies.empty() && HoldUntilDependenciesCompleted(task))
+    {
+      // The task will be pushed into the waiting queue when all its dependencies are completed.
+      RegisterProcessor();
+      return;
+    }
+
+    if(!PushWaitingTask(task))
+    {
+      // Finish all Running threads are working
+      return;
+    }
+  }
+
+  RequestWorkerThread();
+
+  // Register Process (Since mTrigger execute too late timing if event thread running a lots of events.)
+  RegisterProcessor();
+
+  return;
+}
+
+bool AsyncTaskManager::PushWaitingTask(AsyncTaskPtr task)
+{
+  const int32_t  priorityValue = task->mImpl->priorityValue;
+  const uint64_t deadline      = task->mImpl->deadline;
+
+  // Distribute tasks to the waiting task queues by round robin. Idle workers steal from the others.
+  auto& queue = *mWaitingTaskQueues[mNextWaitingTaskQueueIndex++ % mWaitingTaskQueues.size()];
   {
     // Lock while adding task to the queue
-    Mutex::ScopedLock lock(mWaitingTasksMutex);
+    Mutex::ScopedLock lock(queue.mutex);
 
     DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "AddTask [%p][%s]\n", task.Get(), GetTaskName(task));
 
-    // push back into waiting queue.
-    auto waitingIter = mWaitingTasks.insert(mWaitingTasks.end(), task);
-    CacheImpl::InsertTaskCache(mCacheImpl->mWaitingTasksCache, task, waitingIter);
+    WaitingTask waitingTask{task, queue.nextSequence++, deadline, priorityValue};
+
+    if(IsPrioritizedTask(waitingTask))
+    {
+      ++queue.prioritizedTaskCounts;
+    }
 
+    // push back into waiting queue.
     if(task->GetPriorityType() == AsyncTask::PriorityType::HIGH)
     {
+      queue.highPriorityTasks.push_back(std::move(waitingTask));
+
       // Increase the number of waiting tasks for high priority.
       ++mWaitingHighProirityTaskCounts;
     }
+    else
+    {
+      queue.lowPriorityTasks.push_back(std::move(waitingTask));
+    }
+    ++mWaitingTaskCounts;
+  }
+
+  // For thread safety
+  Mutex::ScopedLock lock(mRunningTasksMutex);
+  return mRunningTasks.size() < mTasks.GetElementCount();
+}
 
+void AsyncTaskManager::RequestWorkerThread()
+{
+  Mutex::ScopedLock lock(mTasksMutex);
+  size_t            count = mTasks.GetElementCount();
+  size_t            index = 0;
+  while(index++ < count)
+  {
+    auto processHelperIt = mTasks.GetNext();
+    DALI_ASSERT_ALWAYS(processHelperIt != mTasks.End());
+    if(processHelperIt->Request())
     {
-      // For thread safety
-      Mutex::ScopedLock lock(mRunningTasksMutex); // We can lock this mutex under mWaitingTasksMutex.
+      break;
+    }
+    // If all threads are busy, then it's ok just to push the task because they will try to get the next job.
+  }
+}
 
-      // Finish all Running threads are working
-      if(mRunningTasks.size() >= mTasks.GetElementCount())
-      {
-        return;
-      }
+bool AsyncTaskManager::HoldUntilDependenciesCompleted(const AsyncTaskPtr& task)
+{
+  Mutex::ScopedLock lock(mDependencyMutex);
+
+  uint32_t unresolvedCount = 0u;
+  for(auto& dependency : task->mImpl->dependencies)
+  {
+    // We can lock the mutex of the dependency under mDependencyMutex.
+    Mutex::ScopedLock lockDependency(dependency->mImpl->mutex);
+    if(dependency->mImpl->inProgressCounts == 0u)
+    {
+      // Completed already, or never added.
+      DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "Dependency [%p][%s] of task [%p][%s] is not in progress. Ignore it\n", dependency.Get(), GetTaskName(dependency), task.Get(), GetTaskName(task));
+      continue;
     }
+
+    // If the dependency completes now, it resolves this task after we unlock mDependencyMutex.
+    dependency->mImpl->dependents.push_back(task);
+    ++unresolvedCount;
   }
 
+  if(unresolvedCount == 0u)
   {
-    Mutex::ScopedLock lock(mTasksMutex);
-    size_t            count = mTasks.GetElementCount();
-    size_t            index = 0;
-    while(index++ < count)
+    return false;
+  }
+
+  DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "Hold task [%p][%s] until %u dependencies completed\n", task.Get(), GetTaskName(task), unresolvedCount);
+
+  task->mImpl->unresolvedDependencyCounts = unresolvedCount;
+  mBlockedTasks[task.Get()]               = task;
+  ++mBlockedTaskCounts;
+  return true;
+}
+
+std::vector<AsyncTaskPtr> AsyncTaskManager::LeaveInProgress(const AsyncTask& task, uint32_t count)
+{
+  std::vector<AsyncTaskPtr> dependents;
+
+  Mutex::ScopedLock lock(task.mImpl->mutex);
+  DALI_ASSERT_DEBUG(task.mImpl->inProgressCounts >= count);
+  task.mImpl->inProgressCounts -= std::min(count, task.mImpl->inProgressCounts);
+  dependents.swap(task.mImpl->dependents);
+  return dependents;
+}
+
+void AsyncTaskManager::ResolveDependencies(std::vector<AsyncTaskPtr>&& dependents)
+{
+  if(dependents.empty())
+  {
+    return;
+  }
+
+  bool requestRequired = false;
+  {
+    Mutex::ScopedLock lock(mDependencyMutex);
+
+    for(auto& dependent : dependents)
     {
-      auto processHelperIt = mTasks.GetNext();
-      DALI_ASSERT_ALWAYS(processHelperIt != mTasks.End());
-      if(processHelperIt->Request())
+      auto blockedIter = mBlockedTasks.find(dependent.Get());
+      if(blockedIter == mBlockedTasks.end() || --dependent->mImpl->unresolvedDependencyCounts > 0u)
       {
-        break;
+        continue;
       }
-      // If all threads are busy, then it's ok just to push the task because they will try to get the next job.
+
+      DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "Dependencies completed [%p][%s]\n", dependent.Get(), GetTaskName(dependent));
+
+      mBlockedTasks.erase(blockedIter);
+
+      // Push under mDependencyMutex, so SetCompletedCallback always sees the task in one of the queues.
+      requestRequired |= PushWaitingTask(dependent);
+      --mBlockedTaskCounts;
     }
   }
 
-  // Register Process (Since mTrigger execute too late timing if event thread running a lots of events.)
-  RegisterProcessor();
-
-  return;
+  if(requestRequired)
+  {
+    RequestWorkerThread();
+  }
 }
 
 void AsyncTaskManager::RemoveTask(AsyncTaskPtr task)
@@ -714,29 +873,71 @@ void AsyncTaskManager::RemoveTask(AsyncTaskPtr task)
     bool needCheckUnregisterProcessor = true;
 
     uint32_t removedCount = 0u;
+    uint32_t leftCount    = 0u; ///< The number of times the task left the blocked, waiting and running queues.
 
+    if(mBlockedTaskCounts > 0u && !task->mImpl->dependencies.empty())
     {
-      // Lock while remove task from the queue
-      Mutex::ScopedLock lock(mWaitingTasksMutex);
+      // Lock while remove task from the blocked tasks
+      Mutex::ScopedLock lock(mDependencyMutex);
 
-      auto mapIter = mCacheImpl->mWaitingTasksCache.find(task.Get());
-      if(mapIter != mCacheImpl->mWaitingTasksCache.end())
+      auto blockedIter = mBlockedTasks.find(task.Get());
+      if(blockedIter != mBlockedTasks.end())
       {
-        for(auto& iterator : mapIter->second)
+        mBlockedTasks.erase(blockedIter);
+        --mBlockedTaskCounts;
+        ++removedCount;
+        ++leftCount;
+
+        for(auto& dependency : task->mImpl->dependencies)
         {
-          DALI_ASSERT_DEBUG((*iterator) == task);
-          if((*iterator)->GetPriorityType() == AsyncTask::PriorityType::HIGH && mWaitingHighProirityTaskCounts > 0u)
-          {
-            // Decrease the number of waiting tasks for high priority.
-            --mWaitingHighProirityTaskCounts;
-          }
-          mWaitingTasks.erase(iterator);
-          ++removedCount;
+          // We can lock the mutex of the dependency under mDependencyMutex.
+          Mutex::ScopedLock lockDependency(dependency->mImpl->mutex);
+
+          auto& dependents = dependency->mImpl->dependents;
+          dependents.erase(std::remove(dependents.begin(), dependents.end(), task), dependents.end());
+        }
+      }
+    }
+
+    if(mBlockedTaskCounts > 0u)
+    {
+      needCheckUnregisterProcessor = false;
+    }
+
+    for(auto& queue : mWaitingTaskQueues)
+    {
+      // Lock while remove task from the queue
+      Mutex::ScopedLock lock(queue->mutex);
+
+      auto& tasks = (task->GetPriorityType() == AsyncTask::PriorityType::HIGH) ? queue->highPriorityTasks : queue->lowPriorityTasks;
+
+      uint32_t removedFromQueue   = 0u;
+      uint32_t removedPrioritized = 0u;
+      tasks.erase(std::remove_if(tasks.begin(), tasks.end(), [&](const WaitingTask& waitingTask) {
+                    if(waitingTask.task != task)
+                    {
+                      return false;
+                    }
+                    ++removedFromQueue;
+                    removedPrioritized += IsPrioritizedTask(waitingTask) ? 1u : 0u;
+                    return true;
+                  }),
+                  tasks.end());
+
+      if(removedFromQueue > 0u)
+      {
+        if(task->GetPriorityType() == AsyncTask::PriorityType::HIGH)
+        {
+          // Decrease the number of waiting tasks for high priority.
+          mWaitingHighProirityTaskCounts -= removedFromQueue;
         }
-        CacheImpl::EraseAllTaskCache(mCacheImpl->mWaitingTasksCache, task);
+        mWaitingTaskCounts -= removedFromQueue;
+        removedCount += removedFromQueue;
+        leftCount += removedFromQueue;
+        queue->prioritizedTaskCounts -= removedPrioritized;
       }
 
-      if(!mWaitingTasks.empty())
+      if(!queue->highPriorityTasks.empty() || !queue->lowPriorityTasks.empty())
       {
         needCheckUnregisterProcessor = false;
       }
@@ -758,6 +959,10 @@ void AsyncTaskManager::RemoveTask(AsyncTaskPtr task)
           {
             (*iterator).second = RunningTaskState::CANCELED;
             ++removedCount;
+            ++leftCount;
+
+            // Let the running Process() abort early.
+            task->mImpl->canceled = true;
           }
         }
       }
@@ -799,6 +1004,9 @@ void AsyncTaskManager::RemoveTask(AsyncTaskPtr task)
       mTasksCompletedImpl->RemoveTaskTrace(task, removedCount);
     }
 
+    // The tasks depending on the removed task don't need to wait anymore.
+    ResolveDependencies(LeaveInProgress(*task, leftCount));
+
     // UnregisterProcessor required to lock mutex. Call this API only if required.
     if(needCheckUnregisterProcessor)
     {
@@ -818,22 +1026,46 @@ Dali::AsyncTaskManager::TasksCompletedId AsyncTaskManager::SetCompletedCallback(
 
   // Please be careful the order of mutex, to avoid dead lock.
   {
-    Mutex::ScopedLock lockWait(mWaitingTasksMutex);
+    Mutex::ScopedLock lockDependency(mDependencyMutex);
+
+    // Collect all tasks waiting for their dependencies
+    for(auto& blockedTaskPair : mBlockedTasks)
+    {
+      auto& task      = blockedTaskPair.second;
+      auto  checkMask = (task->GetCallbackInvocationThread() == Dali::AsyncTask::ThreadType::MAIN_THREAD ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_MAIN : Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_WORKER) |
+                       (task->GetPriorityType() == Dali::AsyncTask::PriorityType::HIGH ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_HIGH : Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_LOW);
+
+      if((checkMask & mask) == checkMask)
+      {
+        ++addedTaskCount;
+        mTasksCompletedImpl->AppendTaskTrace(tasksCompletedId, task);
+      }
+    }
+
+    std::vector<std::unique_ptr<Mutex::ScopedLock>> lockWaits;
+    LockAllWaitingTaskQueues(lockWaits); // We can lock these mutexes under mDependencyMutex.
     {
-      Mutex::ScopedLock lockRunning(mRunningTasksMutex); // We can lock this mutex under mWaitingTasksMutex.
+      Mutex::ScopedLock lockRunning(mRunningTasksMutex); // We can lock this mutex under the waiting task queue mutex.
       {
-        Mutex::ScopedLock lockComplete(mCompletedTasksMutex); // We can lock this mutex under mWaitingTasksMutex and mRunningTasksMutex.
+        Mutex::ScopedLock lockComplete(mCompletedTasksMutex); // We can lock this mutex under the waiting task queue mutex and mRunningTasksMutex.
 
         // Collect all tasks from waiting tasks
-        for(auto& task : mWaitingTasks)
+        for(auto& queue : mWaitingTaskQueues)
         {
-          auto checkMask = (task->GetCallbackInvocationThread() == Dali::AsyncTask::ThreadType::MAIN_THREAD ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_MAIN : Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_WORKER) |
-                           (task->GetPriorityType() == Dali::AsyncTask::PriorityType::HIGH ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_HIGH : Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_LOW);
-
-          if((checkMask & mask) == checkMask)
+          for(auto* tasks : {&queue->highPriorityTasks, &queue->lowPriorityTasks})
           {
-            ++addedTaskCount;
-            mTasksCompletedImpl->AppendTaskTrace(tasksCompletedId, task);
+            for(auto& waitingTask : *tasks)
+            {
+              auto& task      = waitingTask.task;
+              auto checkMask = (task->GetCallbackInvocationThread() == Dali::AsyncTask::ThreadType::MAIN_THREAD ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_MAIN : Dali::AsyncTaskManager::CompletedCallbackTraceMask::THREAD_MASK_WORKER) |
+                               (task->GetPriorityType() == Dali::AsyncTask::PriorityType::HIGH ? Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_HIGH : Dali::AsyncTaskManager::CompletedCallbackTraceMask::PRIORITY_MASK_LOW);
+
+              if((checkMask & mask) == checkMask)
+              {
+                ++addedTaskCount;
+                mTasksCompletedImpl->AppendTaskTrace(tasksCompletedId, task);
+              }
+            }
           }
         }
 
@@ -949,13 +1181,14 @@ void AsyncTaskManager::UnregisterProcessor()
     // Keep processor at least 1 task exist.
     // Please be careful the order of mutex, to avoid dead lock.
     // TODO : Should we lock all mutex rightnow?
-    Mutex::ScopedLock lockWait(mWaitingTasksMutex);
-    if(mWaitingTasks.empty())
+    std::vector<std::unique_ptr<Mutex::ScopedLock>> lockWaits;
+    LockAllWaitingTaskQueues(lockWaits);
+    if(mWaitingTaskCounts == 0u && mBlockedTaskCounts == 0u)
     {
-      Mutex::ScopedLock lockRunning(mRunningTasksMutex); // We can lock this mutex under mWaitingTasksMutex.
+      Mutex::ScopedLock lockRunning(mRunningTasksMutex); // We can lock this mutex under the waiting task queue mutex.
       if(mRunningTasks.empty())
       {
-        Mutex::ScopedLock lockComplete(mCompletedTasksMutex); // We can lock this mutex under mWaitingTasksMutex and mRunningTasksMutex.
+        Mutex::ScopedLock lockComplete(mCompletedTasksMutex); // We can lock this mutex under the waiting task queue mutex and mRunningTasksMutex.
         if(mCompletedTasks.empty())
         {
           mProcessorRegistered = false;
@@ -993,98 +1226,226 @@ void AsyncTaskManager::Process(bool postProcessor)
   TasksCompleted();
 }
 
-/// Worker thread called
-AsyncTaskPtr AsyncTaskManager::PopNextTaskToProcess()
+void AsyncTaskManager::AddTaskDependency(const AsyncTask& task, AsyncTaskPtr dependency)
 {
-  // Lock while popping task out from the queue
-  Mutex::ScopedLock lock(mWaitingTasksMutex);
+  task.mImpl->dependencies.push_back(std::move(dependency));
+}
 
-  DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "PopNextTaskToProcess, waiting task count : [%zu]\n", mWaitingTasks.size());
+void AsyncTaskManager::SetTaskPriorityValue(const AsyncTask& task, int32_t priorityValue)
+{
+  task.mImpl->priorityValue = priorityValue;
+}
+
+int32_t AsyncTaskManager::GetTaskPriorityValue(const AsyncTask& task)
+{
+  return task.mImpl->priorityValue;
+}
+
+void AsyncTaskManager::SetTaskDeadline(const AsyncTask& task, uint32_t milliSeconds)
+{
+  task.mImpl->deadline = GetCurrentMilliSeconds() + milliSeconds;
+}
+
+bool AsyncTaskManager::IsTaskCanceled(const AsyncTask& task)
+{
+  return task.mImpl->canceled;
+}
+
+bool AsyncTaskManager::IsPrioritizedTask(const WaitingTask& task)
+{
+  return task.priorityValue != 0 || task.deadline != 0u;
+}
+
+void AsyncTaskManager::LockAllWaitingTaskQueues(std::vector<std::unique_ptr<Mutex::ScopedLock>>& locks)
+{
+  // Worker threads lock only one queue at a time, so locking all of them in index order can't dead lock.
+  locks.reserve(mWaitingTaskQueues.size());
+  for(auto& queue : mWaitingTaskQueues)
+  {
+    locks.emplace_back(new Mutex::ScopedLock(queue->mutex));
+  }
+}
+
+/// Worker thread called
+AsyncTaskPtr AsyncTaskManager::PopNextTaskToProcess(uint32_t workerIndex)
+{
+  DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "PopNextTaskToProcess, worker [%u] waiting task count : [%u]\n", workerIndex, mWaitingTaskCounts.load());
 
   // pop out the next task from the queue
   AsyncTaskPtr nextTask = nullptr;
 
-  // Fast cut if all waiting tasks are LOW priority, and we cannot excute low task anymore.
-  if(mWaitingHighProirityTaskCounts == 0u && !mWaitingTasks.empty())
+  // Fast cut if there is no waiting task, or all waiting tasks are LOW priority and we cannot excute low task anymore.
+  if(mWaitingTaskCounts == 0u || (mWaitingHighProirityTaskCounts == 0u && mAvaliableLowPriorityTaskCounts == 0u))
   {
-    // For thread safety
-    Mutex::ScopedLock lock(mRunningTasksMutex); // We can lock this mutex under mWaitingTasksMutex.
+    return nextTask;
+  }
 
-    if(mAvaliableLowPriorityTaskCounts == 0u)
+  // Take from the front of our own queue first.
+  nextTask = PopReadyTask(*mWaitingTaskQueues[workerIndex], false);
+
+  // Steal from the back of the other queues only if our own queue has nothing to process.
+  // Start from the next victim by round robin, so the idle threads don't all steal from the same queue.
+  const auto queueCount = static_cast<uint32_t>(mWaitingTaskQueues.size());
+  if(!nextTask && queueCount > 1u && mWaitingTaskCounts > 0u)
+  {
+    const uint32_t victimOffset = mNextStealingQueueOffset++;
+    for(uint32_t i = 0u; i + 1u < queueCount && !nextTask; ++i)
     {
-      // There are no avaliabe tasks to run now. Return nullptr.
-      return nextTask;
+      const uint32_t victimIndex = (workerIndex + 1u + (victimOffset + i) % (queueCount - 1u)) % queueCount;
+      nextTask                   = PopReadyTask(*mWaitingTaskQueues[victimIndex], true);
     }
   }
 
-  for(auto iter = mWaitingTasks.begin(), endIter = mWaitingTasks.end(); iter != endIter; ++iter)
+  DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::General, "Pickup process [%p][%s]\n", nextTask.Get(), GetTaskName(nextTask));
+
+  return nextTask;
+}
+
+/// Worker thread called
+AsyncTaskPtr AsyncTaskManager::PopReadyTask(WaitingTaskQueue& queue, bool steal)
+{
+  AsyncTaskPtr task = nullptr;
+
+  // Lock while popping task out from the queue. Note that mRunningTasksMutex is not locked while calling IsReady(), since it is user code.
+  Mutex::ScopedLock lock(queue.mutex);
+
+  if(queue.highPriorityTasks.empty() && queue.lowPriorityTasks.empty())
+  {
+    return task;
+  }
+
+  // Compare the priority values only if some of the tasks have priority value or deadline.
+  const uint64_t now = (queue.prioritizedTaskCounts > 0u) ? GetCurrentMilliSeconds() : 0u;
+
+  bool                          lowPriorityAvailable = (mAvaliableLowPriorityTaskCounts > 0u);
+  std::vector<const AsyncTask*> skippedTasks; ///< The tasks running on the other threads now.
+
+  while(!task)
   {
-    if((*iter)->IsReady())
+    ReadyTaskCandidate candidate;
+    FindReadyTask(queue.highPriorityTasks, AsyncTask::PriorityType::HIGH, steal, skippedTasks, now, candidate);
+    if(lowPriorityAvailable)
     {
-      const auto priorityType  = (*iter)->GetPriorityType();
-      bool       taskAvaliable = priorityType == AsyncTask::PriorityType::HIGH; // Task always valid if it's priority is high
-      if(!taskAvaliable)
-      {
-        // For thread safety
-        Mutex::ScopedLock lock(mRunningTasksMutex); // We can lock this mutex under mWaitingTasksMutex.
+      FindReadyTask(queue.lowPriorityTasks, AsyncTask::PriorityType::LOW, steal, skippedTasks, now, candidate);
+    }
 
-        taskAvaliable = (mAvaliableLowPriorityTaskCounts > 0u); // priority is low, but we can use it.
-      }
+    if(!candidate.tasks)
+    {
+      break;
+    }
 
-      // Check whether we try to running same task at multiple threads.
-      if(taskAvaliable)
+    switch(TakeReadyTask(queue, candidate, task))
+    {
+      case TakeResult::TAKEN:
       {
-        Mutex::ScopedLock lock(mRunningTasksMutex); // We can lock this mutex under mWaitingTasksMutex.
-        auto              mapIter = mCacheImpl->mRunningTasksCache.find((*iter).Get());
-        if(mapIter != mCacheImpl->mRunningTasksCache.end())
-        {
-          if(!mapIter->second.empty())
-          {
-            // Some other thread running this tasks now. Ignore it.
-            DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "Some other thread running this task [%p][%s]\n", (*iter).Get(), GetTaskName(*iter));
-            taskAvaliable = false;
-          }
-        }
+        break;
       }
-
-      if(taskAvaliable)
+      case TakeResult::RUNNING_ALREADY:
+      {
+        // Some other thread running this tasks now. Ignore it.
+        skippedTasks.push_back(candidate.iterator->task.Get());
+        break;
+      }
+      case TakeResult::NOT_AVAILABLE:
       {
-        nextTask = *iter;
+        // No more low priority task can be processed now. Find the high priority one again.
+        lowPriorityAvailable = false;
+        break;
+      }
+    }
+  }
 
-        // Add Running queue
-        {
-          // Lock while popping task out from the queue
-          Mutex::ScopedLock lock(mRunningTasksMutex); // We can lock this mutex under mWaitingTasksMutex.
+  return task;
+}
 
-          DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "Waiting -> Running [%p][%s]\n", nextTask.Get(), GetTaskName(nextTask));
+/// Worker thread called
+void AsyncTaskManager::FindReadyTask(std::deque<WaitingTask>& tasks, AsyncTask::PriorityType priorityType, bool steal, const std::vector<const AsyncTask*>& skippedTasks, uint64_t now, ReadyTaskCandidate& candidate)
+{
+  const bool prioritized = (now != 0u);
+  const auto count       = tasks.size();
+  for(size_t i = 0u; i < count; ++i)
+  {
+    const auto    iter          = steal ? tasks.begin() + (count - 1u - i) : tasks.begin() + i;
+    const int64_t priorityValue = prioritized ? GetEffectivePriorityValue(iter->priorityValue, iter->deadline, now) : 0;
 
-          auto runningIter = mRunningTasks.insert(mRunningTasks.end(), std::make_pair(nextTask, RunningTaskState::RUNNING));
-          CacheImpl::InsertTaskCache(mCacheImpl->mRunningTasksCache, nextTask, runningIter);
+    // Check the order first, so IsReady() is not called for the tasks which cannot be taken.
+    if(candidate.tasks && !IsPriorTo(priorityValue, iter->sequence, candidate.priorityValue, candidate.iterator->sequence, steal))
+    {
+      if(!prioritized)
+      {
+        // The next tasks are pushed earlier, or later if stealing.
+        break;
+      }
+      continue;
+    }
 
-          CacheImpl::EraseTaskCache(mCacheImpl->mWaitingTasksCache, nextTask, iter);
-          mWaitingTasks.erase(iter);
+    if(std::find(skippedTasks.begin(), skippedTasks.end(), iter->task.Get()) != skippedTasks.end() || !iter->task->IsReady())
+    {
+      continue;
+    }
 
-          // Decrease avaliable task counts if it is low priority
-          if(priorityType == AsyncTask::PriorityType::LOW)
-          {
-            // We are under running task mutex. We can decrease it.
-            --mAvaliableLowPriorityTaskCounts;
-          }
-        }
+    candidate.tasks         = &tasks;
+    candidate.iterator      = iter;
+    candidate.priorityValue = priorityValue;
+    candidate.priorityType  = priorityType;
 
-        if(priorityType == AsyncTask::PriorityType::HIGH && mWaitingHighProirityTaskCounts > 0u)
-        {
-          // Decrease the number of waiting tasks for high priority.
-          --mWaitingHighProirityTaskCounts;
-        }
-        break;
-      }
+    if(!prioritized)
+    {
+      // The first ready task in this deque.
+      break;
     }
   }
+}
 
-  DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::General, "Pickup process [%p][%s]\n", nextTask.Get(), GetTaskName(nextTask));
+/// Worker thread called
+AsyncTaskManager::TakeResult AsyncTaskManager::TakeReadyTask(WaitingTaskQueue& queue, const ReadyTaskCandidate& candidate, AsyncTaskPtr& task)
+{
+  // For thread safety
+  Mutex::ScopedLock lockRunning(mRunningTasksMutex); // We can lock this mutex under the waiting task queue mutex.
 
-  return nextTask;
+  if(candidate.priorityType == AsyncTask::PriorityType::LOW && mAvaliableLowPriorityTaskCounts == 0u)
+  {
+    // There are no avaliabe low priority tasks to run now.
+    return TakeResult::NOT_AVAILABLE;
+  }
+
+  const auto iter = candidate.iterator;
+
+  // Check whether we try to running same task at multiple threads.
+  auto mapIter = mCacheImpl->mRunningTasksCache.find(iter->task.Get());
+  if(mapIter != mCacheImpl->mRunningTasksCache.end() && !mapIter->second.empty())
+  {
+    DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "Some other thread running this task [%p][%s]\n", iter->task.Get(), GetTaskName(iter->task));
+    return TakeResult::RUNNING_ALREADY;
+  }
+
+  if(IsPrioritizedTask(*iter))
+  {
+    --queue.prioritizedTaskCounts;
+  }
+
+  task = std::move(iter->task);
+  candidate.tasks->erase(iter);
+  --mWaitingTaskCounts;
+
+  // Add Running queue
+  DALI_LOG_INFO(gAsyncTasksManagerLogFilter, Debug::Verbose, "Waiting -> Running [%p][%s]\n", task.Get(), GetTaskName(task));
+
+  auto runningIter = mRunningTasks.insert(mRunningTasks.end(), std::make_pair(task, RunningTaskState::RUNNING));
+  CacheImpl::InsertTaskCache(mCacheImpl->mRunningTasksCache, task, runningIter);
+
+  if(candidate.priorityType == AsyncTask::PriorityType::LOW)
+  {
+    // Decrease avaliable task counts if it is low priority. We are under running task mutex.
+    --mAvaliableLowPriorityTaskCounts;
+  }
+  else
+  {
+    // Decrease the number of waiting tasks for high priority.
+    --mWaitingHighProirityTaskCounts;
+  }
+
+  return TakeResult::TAKEN;
 }
 
 /// Worker thread called
@@ -1094,6 +1455,8 @@ void AsyncTaskManager::CompleteTask(AsyncTaskPtr&& task)
   {
     bool needTrigger = false;
 
+    std::vector<AsyncTaskPtr> dependents; ///< The tasks depending on this task, taken before the task is moved into completed queue.
+
     // Check now whether we need to execute callback or not, for worker thread cases.
     if(task->GetCallbackInvocationThread() == AsyncTask::ThreadType::WORKER_THREAD)
     {
@@ -1160,6 +1523,9 @@ void AsyncTaskManager::CompleteTask(AsyncTaskPtr&& task)
         {
           // This task is valid.
           notify = true;
+
+          // The canceled task left the queues when it was removed.
+          dependents = LeaveInProgress(*task, 1u); // We can lock the mutex of the task under mRunningTasksMutex.
         }
 
         const auto priorityType = iter->first->GetPriorityType();
@@ -1197,6 +1563,9 @@ void AsyncTaskManager::CompleteTask(AsyncTaskPtr&& task)
       }
     }
 
+    // Release the tasks depending on this task, after it left the running queue.
+    ResolveDependencies(std::move(dependents));
+
     // Wake up the main thread
     if(needTrigger)
     {
@@ -1208,8 +1577,8 @@ void AsyncTaskManager::CompleteTask(AsyncTaskPtr&& task)
 
 // AsyncTaskManager::TaskHelper
 
-AsyncTaskManager::TaskHelper::TaskHelper(AsyncTaskManager& asyncTaskManager)
-: TaskHelper(std::unique_ptr<AsyncTaskThread>(new AsyncTaskThread(asyncTaskManager)), asyncTaskManager)
+AsyncTaskManager::TaskHelper::TaskHelper(AsyncTaskManager& asyncTaskManager, uint32_t workerIndex)
+: TaskHelper(std::unique_ptr<AsyncTaskThread>(new AsyncTaskThread(asyncTaskManager, workerIndex)), asyncTaskManager)
 {
 }
 
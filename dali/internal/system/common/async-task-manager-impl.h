@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ASYNC_TASK_MANAGER_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -27,7 +27,11 @@
 #include <dali/integration-api/processor-interface.h>
 #include <dali/public-api/common/list-wrapper.h>
 #include <dali/public-api/object/base-object.h>
+#include <atomic>
+#include <deque>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/adaptor-framework/async-task-manager.h>
@@ -35,6 +39,32 @@
 
 namespace Dali
 {
+/**
+ * @brief The state of the AsyncTask, kept in the task itself so the AsyncTaskManager never looks it up.
+ *
+ * The values set by the AsyncTask API are atomic, so the worker threads can read them without lock.
+ */
+struct AsyncTask::Impl
+{
+  Impl(CallbackBase* callback)
+  : completedCallback(callback)
+  {
+  }
+
+  std::unique_ptr<CallbackBase> completedCallback;
+
+  std::atomic<uint64_t> deadline{0u};     ///< The deadline in milliseconds of the steady clock. 0 if not set.
+  std::atomic<int32_t>  priorityValue{0}; ///< The priority value among the waiting tasks.
+  std::atomic<bool>     canceled{false};  ///< Whether the task is removed while processing.
+
+  std::vector<AsyncTaskPtr> dependencies;                  ///< The tasks which should be completed before the task is processed. Changed by main thread only.
+  uint32_t                  unresolvedDependencyCounts{0u}; ///< The number of dependencies not completed yet, while blocked. Must be locked under mDependencyMutex of AsyncTaskManager.
+
+  Dali::Mutex               mutex;                ///< We cannot lock any mutex under this scope.
+  std::vector<AsyncTaskPtr> dependents;           ///< The blocked tasks waiting for this task. Must be locked under mutex.
+  uint32_t                  inProgressCounts{0u}; ///< The number of times the task is blocked, waiting or running now. Must be locked under mutex.
+};
+
 namespace Internal
 {
 namespace Adaptor
@@ -49,8 +79,11 @@ class AsyncTaskThread : public Thread
 public:
   /**
    * Constructor.
+   *
+   * @param[in] asyncTaskManager Reference to the AsyncTaskManager
+   * @param[in] workerIndex The index of the waiting task queue owned by this thread
    */
-  AsyncTaskThread(AsyncTaskManager& asyncTaskManager);
+  AsyncTaskThread(AsyncTaskManager& asyncTaskManager, uint32_t workerIndex);
 
   /**
    * Destructor.
@@ -81,6 +114,7 @@ private:
   AsyncTaskManager&                  mAsyncTaskManager;
   const Dali::LogFactoryInterface&   mLogFactory;   ///< The log factory
   const Dali::TraceFactoryInterface& mTraceFactory; ///< The trace factory
+  const uint32_t                     mWorkerIndex;  ///< The index of the waiting task queue owned by this thread
   bool                               mDestroyThread;
   bool                               mIsThreadStarted;
   bool                               mIsThreadIdle;
@@ -151,13 +185,51 @@ public:
    */
   void TasksCompleted();
 
+public: // AsyncTask called method
+  /**
+   * @copydoc Dali::AsyncTask::AddDependency()
+   * @param[in] task The task depending on the dependency.
+   * @param[in] dependency The task depended on.
+   */
+  static void AddTaskDependency(const AsyncTask& task, AsyncTaskPtr dependency);
+
+  /**
+   * @copydoc Dali::AsyncTask::SetPriorityValue()
+   * @param[in] task The task.
+   */
+  static void SetTaskPriorityValue(const AsyncTask& task, int32_t priorityValue);
+
+  /**
+   * @copydoc Dali::AsyncTask::GetPriorityValue()
+   * @param[in] task The task.
+   */
+  static int32_t GetTaskPriorityValue(const AsyncTask& task);
+
+  /**
+   * @copydoc Dali::AsyncTask::SetDeadline()
+   * @param[in] task The task.
+   */
+  static void SetTaskDeadline(const AsyncTask& task, uint32_t milliSeconds);
+
+  /**
+   * @copydoc Dali::AsyncTask::IsCanceled()
+   * @param[in] task The task.
+   */
+  static bool IsTaskCanceled(const AsyncTask& task);
+
 public: // Worker thread called method
   /**
    * Pop the next task out from the queue.
    *
+   * The task is taken from the front of the waiting task queue owned by the worker. Only if it has nothing
+   * to process, the task is stolen from the back of some other queue, chosen by round robin.
+   * Low priority tasks are taken only while fewer than the number of low priority threads are running,
+   * so long term tasks can't block the high priority ones.
+   *
+   * @param[in] workerIndex The index of the waiting task queue owned by the calling worker.
    * @return The next task to be processed.
    */
-  AsyncTaskPtr PopNextTaskToProcess();
+  AsyncTaskPtr PopNextTaskToProcess(uint32_t workerIndex);
 
   /**
    * Pop the next task out from the running queue and add this task to the completed queue.
@@ -192,8 +264,9 @@ private:
      * @brief Create an TaskHelper.
      *
      * @param[in] asyncTaskManager Reference to the AsyncTaskManager
+     * @param[in] workerIndex The index of the waiting task queue owned by the thread
      */
-    TaskHelper(AsyncTaskManager& asyncTaskManager);
+    TaskHelper(AsyncTaskManager& asyncTaskManager, uint32_t workerIndex);
 
     /**
      * @brief Request the thread to process the task.
@@ -237,6 +310,148 @@ private:
     SKIP_CALLBACK    = 1, ///< Do not execute callback
   };
 
+  /**
+   * @brief The task waiting to async process.
+   */
+  struct WaitingTask
+  {
+    AsyncTaskPtr task;
+    uint64_t     sequence;      ///< The order the task was pushed in its waiting task queue.
+    uint64_t     deadline;      ///< The deadline of the task when it was pushed. 0 if not set.
+    int32_t      priorityValue; ///< The priority value of the task when it was pushed.
+  };
+
+  /**
+   * @brief The queue of the tasks waiting to async process, owned by one worker thread.
+   *
+   * Each priority type has its own deque, so high priority tasks can be picked up
+   * without walking over the low priority ones. The deques are ordered by sequence.
+   */
+  struct WaitingTaskQueue
+  {
+    std::deque<WaitingTask> highPriorityTasks;         ///< Must be locked under mutex.
+    std::deque<WaitingTask> lowPriorityTasks;          ///< Must be locked under mutex.
+    Dali::Mutex             mutex;                     ///< We can lock mRunningTasksMutex and mCompletedTasksMutex under this scope.
+    uint32_t                prioritizedTaskCounts{0u}; ///< The number of tasks with priority value or deadline. Must be locked under mutex.
+    uint64_t                nextSequence{0u};          ///< The sequence of the next pushed task. Must be locked under mutex.
+  };
+
+  /**
+   * @brief The best ready task found in one waiting task queue.
+   */
+  struct ReadyTaskCandidate
+  {
+    std::deque<WaitingTask>*          tasks{nullptr}; ///< The deque of the task. nullptr if not found.
+    std::deque<WaitingTask>::iterator iterator;
+    int64_t                           priorityValue{0}; ///< The priority value, lowered if the deadline was missed.
+    AsyncTask::PriorityType           priorityType{AsyncTask::PriorityType::HIGH};
+  };
+
+  /**
+   * @brief Push the task into one of the waiting task queues.
+   *
+   * @param[in] task The task to be pushed.
+   * @return True if some worker thread can process the task now, so we need to request it.
+   */
+  bool PushWaitingTask(AsyncTaskPtr task);
+
+  /**
+   * @brief Request an idle worker thread to process the waiting tasks.
+   */
+  void RequestWorkerThread();
+
+  /**
+   * @brief Hold the task until all its dependencies are completed.
+   *
+   * The dependencies which are not waiting, blocked nor running now are regarded as completed,
+   * so the task is never blocked by a dependency which is not added to AsyncTaskManager.
+   * The task is added to the dependents of each dependency in progress.
+   *
+   * @param[in] task The task which has dependencies.
+   * @return True if the task is held. False if all the dependencies are completed already.
+   */
+  bool HoldUntilDependenciesCompleted(const AsyncTaskPtr& task);
+
+  /**
+   * @brief Count the task out of the waiting, blocked and running queues, and take its dependents.
+   *
+   * @param[in] task The task completed or removed.
+   * @param[in] count The number of times the task left the queues.
+   * @return The blocked tasks which were waiting for the task.
+   */
+  static std::vector<AsyncTaskPtr> LeaveInProgress(const AsyncTask& task, uint32_t count);
+
+  /**
+   * @brief Push the dependents into the waiting queue, if all their dependencies are completed now.
+   *
+   * @param[in] dependents The tasks taken by LeaveInProgress().
+   */
+  void ResolveDependencies(std::vector<AsyncTaskPtr>&& dependents);
+
+  /**
+   * @brief Pop the ready task out from the waiting task queue, and move it into the running queue.
+   *
+   * The queue mutex is kept locked until the task is taken, so no other queue is visited meanwhile.
+   *
+   * @param[in] queue The waiting task queue.
+   * @param[in] steal True to take from the back, if the queue is owned by some other worker.
+   * @return The task taken, or nullptr if no task in the queue can be processed now.
+   */
+  AsyncTaskPtr PopReadyTask(WaitingTaskQueue& queue, bool steal);
+
+  /**
+   * @brief Find the ready task in the deque which should be processed before the candidate.
+   *
+   * The tasks are processed in the order they were pushed, unless some task has a priority value or a deadline.
+   * The task with the larger priority value is taken first, and the tasks which missed their deadline are
+   * taken after all the others. Only the queue mutex is locked while calling AsyncTask::IsReady().
+   *
+   * @pre The mutex of the waiting task queue is locked.
+   * @param[in] tasks The deque of the waiting task queue.
+   * @param[in] priorityType The priority type of the tasks in the deque.
+   * @param[in] steal True to find from the back, so the task pushed last goes first among the same priority value.
+   * @param[in] skippedTasks The tasks running on the other threads now, which should not be taken.
+   * @param[in] now The current time in milliseconds, or 0 if no task in the queue has priority value or deadline.
+   * @param[in,out] candidate The best ready task found so far. Replaced if a better one is found.
+   */
+  void FindReadyTask(std::deque<WaitingTask>& tasks, AsyncTask::PriorityType priorityType, bool steal, const std::vector<const AsyncTask*>& skippedTasks, uint64_t now, ReadyTaskCandidate& candidate);
+
+  /**
+   * @brief The result of TakeReadyTask().
+   */
+  enum class TakeResult
+  {
+    TAKEN,           ///< The task is moved into the running queue.
+    RUNNING_ALREADY, ///< Some other thread is running the same task now.
+    NOT_AVAILABLE,   ///< No more low priority task can be processed.
+  };
+
+  /**
+   * @brief Move the candidate task from its waiting task queue into the running queue.
+   *
+   * @pre The mutex of the waiting task queue is locked since the candidate was found.
+   * @param[in] queue The waiting task queue of the candidate.
+   * @param[in] candidate The task found by FindReadyTask().
+   * @param[out] task The task moved into the running queue, if taken.
+   * @return The result.
+   */
+  TakeResult TakeReadyTask(WaitingTaskQueue& queue, const ReadyTaskCandidate& candidate, AsyncTaskPtr& task);
+
+  /**
+   * @brief Check whether the task has priority value or deadline, so it should be compared with other tasks.
+   *
+   * @param[in] task The task to check.
+   * @return True if the task has priority value or deadline.
+   */
+  static bool IsPrioritizedTask(const WaitingTask& task);
+
+  /**
+   * @brief Lock all the waiting task queues, in index order.
+   *
+   * @param[out] locks The locks of the waiting task queues.
+   */
+  void LockAllWaitingTaskQueues(std::vector<std::unique_ptr<Mutex::ScopedLock>>& locks);
+
 private:
   // Undefined
   AsyncTaskManager(const AsyncTaskManager& manager);
@@ -245,30 +460,35 @@ private:
   AsyncTaskManager& operator=(const AsyncTaskManager& manager);
 
 private:
-  // Keep Task as list since we take tasks by FIFO as default.
-  using AsyncTaskContainer = std::list<AsyncTaskPtr>;
-
   using AsyncRunningTaskPair      = std::pair<AsyncTaskPtr, RunningTaskState>;
   using AsyncRunningTaskContainer = std::list<AsyncRunningTaskPair>;
 
   using AsyncCompletedTaskPair      = std::pair<AsyncTaskPtr, CompletedTaskState>;
   using AsyncCompletedTaskContainer = std::list<AsyncCompletedTaskPair>;
 
-  AsyncTaskContainer          mWaitingTasks;   ///< The queue of the tasks waiting to async process. Must be locked under mWaitingTasksMutex.
-  AsyncRunningTaskContainer   mRunningTasks;   ///< The queue of the running tasks. Must be locked under mRunningTasksMutex.
-  AsyncCompletedTaskContainer mCompletedTasks; ///< The queue of the tasks with the async process. Must be locked under mCompletedTasksMutex.
+  using AsyncBlockedTaskContainer = std::unordered_map<const AsyncTask*, AsyncTaskPtr>;
 
-  RoundRobinContainerView<TaskHelper> mTasks;
+  std::vector<std::unique_ptr<WaitingTaskQueue>> mWaitingTaskQueues; ///< The waiting task queues, one per worker thread. Never lock two of them at once, except in index order.
+  AsyncRunningTaskContainer                      mRunningTasks;      ///< The queue of the running tasks. Must be locked under mRunningTasksMutex.
+  AsyncCompletedTaskContainer                    mCompletedTasks;    ///< The queue of the tasks with the async process. Must be locked under mCompletedTasksMutex.
+  AsyncBlockedTaskContainer                      mBlockedTasks;      ///< The tasks waiting for their dependencies. Must be locked under mDependencyMutex.
 
-  uint32_t mAvaliableLowPriorityTaskCounts; ///< The number of tasks that can be processed for priority type LOW.
-                                            ///< Be used to select next wating task determining algorithm.
-                                            ///< Note : For thread safety, Please set/get this value under mRunningTasksMutex scope.
-  uint32_t mWaitingHighProirityTaskCounts;  ///< The number of tasks that waiting now for priority type HIGH.
-                                            ///< Be used to select next wating task determining algorithm.
-                                            ///< Note : For thread safety, Please set/get this value under mWaitingTasksMutex scope.
+  RoundRobinContainerView<TaskHelper> mTasks;
 
-  Dali::Mutex mWaitingTasksMutex;   ///< Mutex for mWaitingTasks. We can lock mRunningTasksMutex and mCompletedTasksMutex under this scope.
-  Dali::Mutex mRunningTasksMutex;   ///< Mutex for mRunningTasks. We can lock mCompletedTasksMutex under this scope.
+  std::atomic<uint32_t> mAvaliableLowPriorityTaskCounts; ///< The number of tasks that can be processed for priority type LOW.
+                                                         ///< Be used to select next wating task determining algorithm.
+                                                         ///< Note : For thread safety, Please change this value under mRunningTasksMutex scope.
+  std::atomic<uint32_t> mWaitingHighProirityTaskCounts;  ///< The number of tasks that waiting now for priority type HIGH.
+                                                         ///< Note : Changed under the mutex of the waiting task queue.
+  std::atomic<uint32_t> mWaitingTaskCounts;              ///< The number of tasks that waiting now in all queues.
+                                                         ///< Note : Changed under the mutex of the waiting task queue.
+  std::atomic<uint32_t> mNextWaitingTaskQueueIndex;      ///< The index of the waiting task queue to push the next task.
+  std::atomic<uint32_t> mNextStealingQueueOffset;        ///< The offset of the next waiting task queue to steal from, for the idle worker threads.
+  std::atomic<uint32_t> mBlockedTaskCounts;              ///< The number of tasks waiting for their dependencies.
+                                                         ///< Note : Changed under mDependencyMutex.
+
+  Dali::Mutex mDependencyMutex;     ///< Mutex for mBlockedTasks. We can lock the waiting task queue mutex and the mutex of the task under this scope.
+  Dali::Mutex mRunningTasksMutex;   ///< Mutex for mRunningTasks. We can lock mCompletedTasksMutex and the mutex of the task under this scope.
   Dali::Mutex mCompletedTasksMutex; ///< Mutex for mCompletedTasks. We cannot lock any mutex under this scope.
   Dali::Mutex mTasksMutex;          ///< Mutex for mTasks.        We cannot lock any mutex under this scope.
 
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/capture-file-saver.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/async-task-manager-impl.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+namespace
+{
+/**
+ * Encodes a captured image into a file, in a worker thread.
+ */
+class CaptureEncodeTask : public AsyncTask
+{
+public:
+  CaptureEncodeTask(const std::string& path, CaptureFileSaver::EncodeFunction encodeFunction, CallbackBase* callback)
+  : AsyncTask(callback),
+    mPath(path),
+    mEncodeFunction(std::move(encodeFunction)),
+    mSucceeded(false)
+  {
+  }
+
+  void Process() override
+  {
+    mSucceeded = mEncodeFunction(mPath);
+  }
+
+  bool IsReady() override
+  {
+    return true;
+  }
+
+  std::string_view GetTaskName() const override
+  {
+    return "CaptureEncodeTask";
+  }
+
+  /**
+   * @return The path of the file.
+   */
+  const std::string& GetPath() const
+  {
+    return mPath;
+  }
+
+  /**
+   * @return Whether the file has been saved.
+   */
+  bool IsSucceeded() const
+  {
+    return mSucceeded;
+  }
+
+private:
+  const std::string                      mPath;
+  const CaptureFileSaver::EncodeFunction mEncodeFunction;
+  bool                                   mSucceeded;
+};
+
+} // namespace
+
+CaptureFileSaver::CaptureFileSaver(AsyncTaskManager& asyncTaskManager, FinishedFunction finishedFunction)
+: mAsyncTaskManager(&asyncTaskManager),
+  mFinishedFunction(std::move(finishedFunction)),
+  mTasks()
+{
+}
+
+CaptureFileSaver::~CaptureFileSaver()
+{
+  for(auto& task : mTasks)
+  {
+    mAsyncTaskManager->RemoveTask(task);
+  }
+}
+
+void CaptureFileSaver::Save(const std::string& path, EncodeFunction encodeFunction)
+{
+  AsyncTaskPtr task = new CaptureEncodeTask(path, std::move(encodeFunction), MakeCallback(this, &CaptureFileSaver::OnTaskCompleted));
+  mTasks.push_back(task);
+  mAsyncTaskManager->AddTask(task);
+}
+
+bool CaptureFileSaver::IsSaving() const
+{
+  return !mTasks.empty();
+}
+
+void CaptureFileSaver::OnTaskCompleted(AsyncTaskPtr task)
+{
+  auto iter = std::find(mTasks.begin(), mTasks.end(), task);
+  if(iter == mTasks.end())
+  {
+    return;
+  }
+  mTasks.erase(iter);
+
+  // The finished function may start another save.
+  const CaptureEncodeTask& encodeTask = static_cast<const CaptureEncodeTask&>(*task);
+  mFinishedFunction(encodeTask.GetPath(), encodeTask.IsSucceeded());
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
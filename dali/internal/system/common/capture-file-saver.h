@@ -0,0 +1,109 @@
+#ifndef DALI_INTERNAL_SYSTEM_COMMON_CAPTURE_FILE_SAVER_H
+#define DALI_INTERNAL_SYSTEM_COMMON_CAPTURE_FILE_SAVER_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/object/intrusive-ptr.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/adaptor-framework/async-task-manager.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+class AsyncTaskManager;
+
+/**
+ * @brief Saves the captured images into files in the worker threads of the AsyncTaskManager.
+ *
+ * Each save keeps its own path, so a capture started while the previous one is saved
+ * doesn't change the file the previous one reports.
+ */
+class CaptureFileSaver
+{
+public:
+  /**
+   * @brief The function encoding the captured image into the file. It is called in a worker thread.
+   * @param[in] path The path of the file
+   * @return True if the file has been saved
+   */
+  using EncodeFunction = std::function<bool(const std::string& path)>;
+
+  /**
+   * @brief The function called on the event thread once a file is saved, or failed.
+   * @param[in] path The path of the file
+   * @param[in] succeeded Whether the file has been saved
+   */
+  using FinishedFunction = std::function<void(const std::string& path, bool succeeded)>;
+
+  /**
+   * @brief Constructor.
+   * @param[in] asyncTaskManager The manager running the encode tasks
+   * @param[in] finishedFunction Called once each file is saved, or failed, in the order of the saves completion
+   */
+  CaptureFileSaver(AsyncTaskManager& asyncTaskManager, FinishedFunction finishedFunction);
+
+  /**
+   * @brief Destructor. The saves not finished are canceled, without calling the finished function.
+   */
+  ~CaptureFileSaver();
+
+  /**
+   * @brief Start saving a file.
+   * @param[in] path The path of the file
+   * @param[in] encodeFunction Encodes the captured image into the file. It keeps the image it reads.
+   */
+  void Save(const std::string& path, EncodeFunction encodeFunction);
+
+  /**
+   * @brief Query whether a file is still being saved.
+   * @return True if the finished function has not been called for one of the saves yet
+   */
+  bool IsSaving() const;
+
+  // Not copyable
+  CaptureFileSaver(const CaptureFileSaver&) = delete;
+  CaptureFileSaver& operator=(const CaptureFileSaver&) = delete;
+
+private:
+  /**
+   * @brief Callback when an encode task is completed.
+   * @param[in] task The encode task
+   */
+  void OnTaskCompleted(AsyncTaskPtr task);
+
+private:
+  IntrusivePtr<AsyncTaskManager> mAsyncTaskManager;
+  FinishedFunction               mFinishedFunction;
+  std::vector<AsyncTaskPtr>      mTasks; ///< The encode tasks not completed yet, oldest first
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SYSTEM_COMMON_CAPTURE_FILE_SAVER_H
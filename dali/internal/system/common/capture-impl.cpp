@@ -31,6 +31,7 @@
 #include <dali/devel-api/adaptor-framework/window-devel.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/internal/adaptor/common/adaptor-impl.h>
+#include <dali/internal/system/common/async-task-manager-impl.h>
 
 namespace Dali
 {
@@ -42,6 +43,7 @@ namespace
 {
 constexpr int32_t  SHADER_VERSION_NATIVE_IMAGE_SOURCE_AVAILABLE = 300;
 constexpr uint32_t TIME_OUT_DURATION                            = 1000;
+
 } // namespace
 
 Capture::Capture()
@@ -103,6 +105,13 @@ void Capture::Start(Dali::Actor source, const Dali::Vector2& position, const Dal
   // Increase the reference count focely to avoid application mistake.
   Reference();
 
+  if(mFileSaver && mFileSaver->IsSaving() && mNativeImageSourcePtr)
+  {
+    // The previous capture is still read by its encode task. Render this one into another native image.
+    DeleteNativeImageSource();
+    mTexture.Reset();
+  }
+
   mPath = path;
   if(!mPath.empty())
   {
@@ -323,17 +332,31 @@ void Capture::UnsetResources()
 
 void Capture::OnRenderFinished(Dali::RenderTask& task)
 {
-  Dali::Capture::FinishState state = Dali::Capture::FinishState::SUCCEEDED;
-
   mTimer.Stop();
 
-  if(mFileSave)
+  if(mFileSave && mNativeImageSourcePtr)
   {
-    if(!SaveFile())
+    // Read and encode the pixels in a worker thread. The finished signal is emitted once the file is saved.
+    UnsetResources();
+
+    if(!mFileSaver)
     {
-      DALI_LOG_ERROR("Fail to Capture Path[%s]\n", mPath.c_str());
-      state = Dali::Capture::FinishState::FAILED;
+      Dali::AsyncTaskManager asyncTaskManager = Dali::AsyncTaskManager::Get();
+      mFileSaver.reset(new CaptureFileSaver(GetImplementation(asyncTaskManager), [this](const std::string& path, bool succeeded) { OnFileSaved(path, succeeded); }));
     }
+
+    // The task keeps the native image, a capture started meanwhile renders into another one.
+    Dali::NativeImageSourcePtr nativeImageSource = mNativeImageSourcePtr;
+    const uint32_t             quality           = mQuality;
+    mFileSaver->Save(mPath, [nativeImageSource, quality](const std::string& path) { return Dali::DevelNativeImageSource::EncodeToFile(*nativeImageSource, path, quality); });
+    return;
+  }
+
+  Dali::Capture::FinishState state = Dali::Capture::FinishState::SUCCEEDED;
+  if(mFileSave)
+  {
+    DALI_LOG_ERROR("Fail to Capture Path[%s]\n", mPath.c_str());
+    state = Dali::Capture::FinishState::FAILED;
   }
 
   Dali::Capture handle(this);
@@ -345,6 +368,23 @@ void Capture::OnRenderFinished(Dali::RenderTask& task)
   Unreference();
 }
 
+void Capture::OnFileSaved(const std::string& path, bool succeeded)
+{
+  Dali::Capture::FinishState state = Dali::Capture::FinishState::SUCCEEDED;
+  if(!succeeded)
+  {
+    // mPath may be the one of a capture started since.
+    DALI_LOG_ERROR("Fail to Capture Path[%s]\n", path.c_str());
+    state = Dali::Capture::FinishState::FAILED;
+  }
+
+  Dali::Capture handle(this);
+  mFinishedSignal.Emit(handle, state);
+
+  // Decrease the reference count forcely. It is increased at Start().
+  Unreference();
+}
+
 bool Capture::OnTimeOut()
 {
   Dali::Capture::FinishState state = Dali::Capture::FinishState::FAILED;
@@ -360,16 +400,6 @@ bool Capture::OnTimeOut()
   return false;
 }
 
-bool Capture::SaveFile()
-{
-  if(mNativeImageSourcePtr)
-  {
-    return Dali::DevelNativeImageSource::EncodeToFile(*mNativeImageSourcePtr, mPath, mQuality);
-  }
-
-  return false;
-}
-
 } // End of namespace Adaptor
 
 } // End of namespace Internal
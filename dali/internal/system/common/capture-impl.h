@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_CAPTURE_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,6 +29,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/pixel-buffer.h>
+#include <dali/internal/system/common/capture-file-saver.h>
 #include <dali/public-api/adaptor-framework/native-image-source.h>
 #include <dali/public-api/adaptor-framework/timer.h>
 #include <dali/public-api/capture/capture.h>
@@ -188,11 +189,12 @@ private:
   bool OnTimeOut();
 
   /**
-   * @brief Save framebuffer.
+   * @brief Callback when the captured image is saved into the file, or failed.
    *
-   * @return True is success to save, false is fail.
+   * @param[in] path The path of the file.
+   * @param[in] succeeded Whether the file has been saved.
    */
-  bool SaveFile();
+  void OnFileSaved(const std::string& path, bool succeeded);
 
 private:
   // Undefined
@@ -213,6 +215,7 @@ private:
   std::string                              mPath;
   Dali::NativeImageSourcePtr               mNativeImageSourcePtr; ///< pointer to surface image
   Dali::Devel::PixelBuffer                 mPixelBuffer;
+  std::unique_ptr<CaptureFileSaver>        mFileSaver; ///< Saves the files of the captures in the worker threads.
   bool                                     mFileSave;
   bool                                     mUseDefaultCamera;                   // Whether we use default generated camera, or use inputed camera.
   bool                                     mSceneOffCameraAfterCaptureFinished; // Whether we need to scene-off after capture finished.
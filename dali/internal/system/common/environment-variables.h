@@ -125,6 +125,9 @@ namespace Adaptor
 
 #define DALI_ENV_MAX_COMBINED_TEXTURE_UNITS "DALI_MAX_COMBINED_TEXTURE_UNITS"
 
+// The maximum bytes of the textures uploaded from worker threads per frame, 0 for unlimited
+#define DALI_ENV_TEXTURE_UPLOAD_BUDGET "DALI_TEXTURE_UPLOAD_BUDGET"
+
 #define DALI_RENDER_TO_FBO "DALI_RENDER_TO_FBO"
 
 #define DALI_ENV_DISABLE_DEPTH_BUFFER "DALI_DISABLE_DEPTH_BUFFER"
@@ -133,6 +136,9 @@ namespace Adaptor
 
 #define DALI_ENV_DISABLE_PARTIAL_UPDATE "DALI_DISABLE_PARTIAL_UPDATE"
 
+// Whether the X11 pointer motions are coalesced, one per window each time the event queue is read, 0 to deliver every motion
+#define DALI_ENV_X11_MOTION_COALESCING "DALI_X11_MOTION_COALESCING"
+
 #define DALI_ENV_WEB_ENGINE_NAME "DALI_WEB_ENGINE_NAME"
 
 #define DALI_ENV_DPI_HORIZONTAL "DALI_DPI_HORIZONTAL"
@@ -153,6 +159,11 @@ namespace Adaptor
 
 #define DALI_ENV_ENABLE_IMAGE_LOADER_PLUGIN "DALI_ENABLE_IMAGE_LOADER_PLUGIN"
 
+#define DALI_ENV_DISABLE_PROGRAM_BINARY_CACHE "DALI_DISABLE_PROGRAM_BINARY_CACHE"
+
+// The radius from which Gaussian blur is approximated by three box blurs. 0 or unset means never.
+#define DALI_ENV_GAUSSIAN_BLUR_BOX_APPROXIMATION_RADIUS "DALI_GAUSSIAN_BLUR_BOX_APPROXIMATION_RADIUS"
+
 // Threshold time in miliseconds when we want to print the egl performance as a warning.
 #define DALI_ENV_EGL_PERFORMANCE_LOG_THRESHOLD_TIME "DALI_EGL_PERFORMANCE_LOG_THRESHOLD_TIME"
 
@@ -162,6 +173,9 @@ namespace Adaptor
 
 #define DALI_ENV_ASYNC_MANAGER_LOW_PRIORITY_THREAD_POOL_SIZE "DALI_ASYNC_MANAGER_LOW_PRIORITY_THREAD_POOL_SIZE"
 
+// The number of threads sharing the parts of the large jobs, e.g. texture staging, blur and SVG bands. 0 runs them on the caller.
+#define DALI_ENV_WORKER_THREAD_POOL_SIZE "DALI_WORKER_THREAD_POOL_SIZE"
+
 // Glyph Cache
 #define DALI_ENV_MAX_NUMBER_OF_GLYPH_CACHE "DALI_GLYPH_CACHE_MAX"
 
@@ -169,6 +183,18 @@ namespace Adaptor
 
 #define DALI_ENV_RENDERED_GLYPH_COMPRESS_POLICY "DALI_RENDERED_GLYPH_COMPRESS_POLICY"
 
+#define DALI_ENV_ENABLE_GLYPH_MIP_LEVELS "DALI_ENABLE_GLYPH_MIP_LEVELS"
+
+#define DALI_ENV_GLYPH_MIP_LEVEL_QUALITY_THRESHOLD "DALI_GLYPH_MIP_LEVEL_QUALITY_THRESHOLD"
+
+#define DALI_ENV_GLYPH_MIP_LEVEL_CACHE_MAX_BYTES "DALI_GLYPH_MIP_LEVEL_CACHE_MAX_BYTES"
+
+// Shaping Cache
+#define DALI_ENV_SHAPING_CACHE_MAX_SIZE "DALI_SHAPING_CACHE_MAX_SIZE"
+
+// Http disk cache of the downloaded files. The maximum total size in bytes, 0 disables the cache.
+#define DALI_ENV_HTTP_CACHE_MAX_SIZE "DALI_HTTP_CACHE_MAX_SIZE"
+
 // Debug relative environments
 #define DALI_ENV_CURLOPT_VERBOSE_MODE "DALI_CURLOPT_VERBOSE_MODE"
 
@@ -176,6 +202,12 @@ namespace Adaptor
 
 #define DALI_ENV_TRACE_ENABLE_PRINT_LOG "DALI_TRACE_ENABLE_PRINT_LOG"
 
+// Records the trace markers into per thread ring buffers, written to this Chrome trace event JSON file on exit
+#define DALI_ENV_TRACE_RECORDER_OUTPUT "DALI_TRACE_RECORDER_OUTPUT"
+
+// The number of trace events kept per thread by the trace recorder
+#define DALI_ENV_TRACE_RECORDER_BUFFER_SIZE "DALI_TRACE_RECORDER_BUFFER_SIZE"
+
 } // namespace Adaptor
 
 } // namespace Internal
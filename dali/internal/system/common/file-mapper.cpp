@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/file-mapper.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <mutex>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+/**
+ * @brief A mapping which the SIGBUS handler may repair. The slots are claimed and released without
+ * locks, since the handler reads them.
+ */
+struct GuardedMapping
+{
+  std::atomic<bool>      claimed{false};   ///< Whether the slot is used by a FileMapper
+  std::atomic<uintptr_t> begin{0u};        ///< The start of the mapping, or 0 while it is not guarded
+  std::atomic<size_t>    size{0u};         ///< The size of the mapping
+  std::atomic<bool>      truncated{false}; ///< Whether a page of the mapping was beyond the end of the file
+};
+
+namespace
+{
+// Files smaller than this are read faster than they are mapped and unmapped.
+constexpr off_t MINIMUM_MAPPED_FILE_SIZE = 64 * 1024;
+
+// The number of files which can be mapped at the same time. The others are read.
+constexpr size_t MAXIMUM_GUARDED_MAPPINGS = 64u;
+
+GuardedMapping   gGuardedMappings[MAXIMUM_GUARDED_MAPPINGS];
+struct sigaction gPreviousBusAction;
+std::once_flag   gBusHandlerInstalled;
+bool             gBusHandlerAvailable = false;
+
+/**
+ * @brief Handle SIGBUS raised by reading a mapped page beyond the end of a file truncated meanwhile.
+ *
+ * The pages from the faulting one to the end of the mapping are replaced by zero filled pages, so the
+ * decoder reads zeros instead of crashing, and the mapping is marked as truncated for its owner.
+ * Faults out of the guarded mappings are passed to the previous handler.
+ */
+void OnBusError(int signalNumber, siginfo_t* info, void* context)
+{
+  // Only the faults raised by the kernel have an address.
+  const uintptr_t address = (info->si_code > 0) ? reinterpret_cast<uintptr_t>(info->si_addr) : 0u;
+  for(auto& mapping : gGuardedMappings)
+  {
+    const uintptr_t begin = mapping.begin.load();
+    const size_t    size  = mapping.size.load();
+    if(begin != 0u && address >= begin && address < begin + size)
+    {
+      const uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+      const uintptr_t page     = address & ~(pageSize - 1u);
+      if(mmap(reinterpret_cast<void*>(page), begin + size - page, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) != MAP_FAILED)
+      {
+        mapping.truncated = true;
+        return;
+      }
+      break;
+    }
+  }
+
+  if(gPreviousBusAction.sa_flags & SA_SIGINFO)
+  {
+    gPreviousBusAction.sa_sigaction(signalNumber, info, context);
+  }
+  else if(gPreviousBusAction.sa_handler != SIG_DFL && gPreviousBusAction.sa_handler != SIG_IGN)
+  {
+    gPreviousBusAction.sa_handler(signalNumber);
+  }
+  else
+  {
+    // Deliver it again with the default action, once the handler returns.
+    signal(signalNumber, SIG_DFL);
+    raise(signalNumber);
+  }
+}
+
+/**
+ * @brief Install the SIGBUS handler once per process.
+ * @return True if the handler is installed
+ */
+bool InstallBusHandler()
+{
+  std::call_once(gBusHandlerInstalled, []() {
+    struct sigaction action = {};
+    action.sa_sigaction     = OnBusError;
+    action.sa_flags         = SA_SIGINFO | SA_ONSTACK;
+    sigemptyset(&action.sa_mask);
+    gBusHandlerAvailable = (sigaction(SIGBUS, &action, &gPreviousBusAction) == 0);
+    if(!gBusHandlerAvailable)
+    {
+      DALI_LOG_ERROR("Failed to install the SIGBUS handler, files are not mapped\n");
+    }
+  });
+  return gBusHandlerAvailable;
+}
+
+/**
+ * @brief Claim a free slot for a mapping, so the SIGBUS handler repairs it.
+ * @return The slot, or nullptr if all the slots are in use
+ */
+GuardedMapping* GuardMapping(const void* address, size_t size)
+{
+  for(auto& mapping : gGuardedMappings)
+  {
+    bool expected = false;
+    if(mapping.claimed.compare_exchange_strong(expected, true))
+    {
+      // The handler reads the size only once the start is set.
+      mapping.truncated = false;
+      mapping.size      = size;
+      mapping.begin     = reinterpret_cast<uintptr_t>(address);
+      return &mapping;
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Release the slot of a mapping, before it is unmapped.
+ */
+void UnguardMapping(GuardedMapping& mapping)
+{
+  mapping.begin   = 0u;
+  mapping.claimed = false;
+}
+} // namespace
+
+FileMapper::~FileMapper()
+{
+  Unmap();
+}
+
+bool FileMapper::Map(const char* filename)
+{
+  Unmap();
+
+  const int fileDescriptor = open(filename, O_RDONLY | O_CLOEXEC);
+  if(fileDescriptor < 0)
+  {
+    return false;
+  }
+
+  const bool mapped = MapFileDescriptor(fileDescriptor);
+  close(fileDescriptor);
+  return mapped;
+}
+
+bool FileMapper::Map(FILE* file)
+{
+  Unmap();
+
+  // A FILE opened on a memory buffer has no descriptor.
+  const int fileDescriptor = file ? fileno(file) : -1;
+  if(fileDescriptor < 0)
+  {
+    return false;
+  }
+  return MapFileDescriptor(fileDescriptor);
+}
+
+void FileMapper::Unmap()
+{
+  if(mData)
+  {
+    UnguardMapping(*mGuardedMapping);
+    mGuardedMapping = nullptr;
+
+    if(munmap(const_cast<uint8_t*>(mData), mSize) != 0)
+    {
+      DALI_LOG_ERROR("munmap failed for %p (%zu bytes)\n", static_cast<const void*>(mData), mSize);
+    }
+    mData = nullptr;
+    mSize = 0u;
+  }
+}
+
+bool FileMapper::IsTruncated() const
+{
+  return mGuardedMapping && mGuardedMapping->truncated;
+}
+
+bool FileMapper::MapFileDescriptor(int fileDescriptor)
+{
+  struct stat fileStat;
+  if(fstat(fileDescriptor, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || fileStat.st_size < MINIMUM_MAPPED_FILE_SIZE)
+  {
+    return false;
+  }
+
+  if(!InstallBusHandler())
+  {
+    return false;
+  }
+
+  void* address = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+  if(address == MAP_FAILED)
+  {
+    DALI_LOG_DEBUG_INFO("mmap failed for a file of %lld bytes\n", static_cast<long long>(fileStat.st_size));
+    return false;
+  }
+
+  mGuardedMapping = GuardMapping(address, static_cast<size_t>(fileStat.st_size));
+  if(!mGuardedMapping)
+  {
+    DALI_LOG_DEBUG_INFO("Too many mapped files, the file is read\n");
+    munmap(address, static_cast<size_t>(fileStat.st_size));
+    return false;
+  }
+
+  // Decoders read the file from start to end.
+  madvise(address, static_cast<size_t>(fileStat.st_size), MADV_SEQUENTIAL);
+
+  mData = static_cast<const uint8_t*>(address);
+  mSize = static_cast<size_t>(fileStat.st_size);
+  return true;
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
@@ -0,0 +1,132 @@
+#ifndef DALI_INTERNAL_PORTABLE_FILE_MAPPER_H
+#define DALI_INTERNAL_PORTABLE_FILE_MAPPER_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+struct GuardedMapping;
+
+/**
+ * @brief Maps the whole content of a file read-only into memory, so it can be decoded without copying it.
+ *
+ * Mapping fails for files which are not regular files (e.g. a FILE opened on a memory buffer),
+ * for small files which are cheaper to read than to map, and on platforms without memory mapped files.
+ * Callers should fall back to reading the file in that case.
+ *
+ * A file may be truncated while it is mapped, e.g. when a download cache rewrites it. Reading the
+ * pages beyond its new end raises SIGBUS: the handler of the FileMapper replaces them by zero filled
+ * pages instead of crashing. Callers should check IsTruncated() once decoding is done, and discard
+ * what was decoded if it returns true.
+ */
+class FileMapper
+{
+public:
+  /**
+   * @brief Constructor. Nothing is mapped until Map() is called.
+   */
+  FileMapper() = default;
+
+  /**
+   * @brief Destructor. Unmaps the file.
+   */
+  ~FileMapper();
+
+  /**
+   * @brief Map the file at the given path.
+   * @param[in] filename The path of the file
+   * @return True if the file is mapped
+   */
+  bool Map(const char* filename);
+
+  /**
+   * @brief Map the file behind the given FILE stream. The position of the stream is not changed.
+   * @param[in] file The opened file
+   * @return True if the file is mapped
+   */
+  bool Map(FILE* file);
+
+  /**
+   * @brief Unmap the file, if it is mapped.
+   */
+  void Unmap();
+
+  /**
+   * @brief Whether a file is mapped.
+   * @return True if a file is mapped
+   */
+  bool IsMapped() const
+  {
+    return mData != nullptr;
+  }
+
+  /**
+   * @brief Whether the file was truncated while it is mapped, so a part of the content read as zeros.
+   * @return True if the content is not the one of the file
+   */
+  bool IsTruncated() const;
+
+  /**
+   * @brief Get the mapped content of the file. It is valid until the file is unmapped.
+   * @return The mapped content, or nullptr if nothing is mapped
+   */
+  const uint8_t* GetData() const
+  {
+    return mData;
+  }
+
+  /**
+   * @brief Get the size of the mapped content.
+   * @return The size in bytes, or 0 if nothing is mapped
+   */
+  size_t GetSize() const
+  {
+    return mSize;
+  }
+
+  // Not copyable
+  FileMapper(const FileMapper&) = delete;
+  FileMapper& operator=(const FileMapper&) = delete;
+
+private:
+  /**
+   * @brief Map the file of the given descriptor.
+   * @param[in] fileDescriptor The file descriptor. The mapping stays valid after it is closed.
+   * @return True if the file is mapped
+   */
+  bool MapFileDescriptor(int fileDescriptor);
+
+private:
+  const uint8_t*  mData{nullptr};
+  size_t          mSize{0u};
+  GuardedMapping* mGuardedMapping{nullptr}; ///< The slot of the mapping in the SIGBUS handler
+};
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
+
+#endif // DALI_INTERNAL_PORTABLE_FILE_MAPPER_H
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/frame-time-histogram.h>
+
+// EXTERNAL INCLUDES
+#include <cmath>
+#include <cstring>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+FrameTimeHistogram::FrameTimeHistogram()
+{
+  Reset();
+}
+
+void FrameTimeHistogram::Add(unsigned int microseconds)
+{
+  ++mBuckets[GetBucketIndex(microseconds)];
+
+  if(mCount == 0u || microseconds < mMin)
+  {
+    mMin = microseconds;
+  }
+  if(mCount == 0u || microseconds > mMax)
+  {
+    mMax = microseconds;
+  }
+  ++mCount;
+}
+
+void FrameTimeHistogram::Reset()
+{
+  memset(mBuckets, 0, sizeof(mBuckets));
+  mCount = 0u;
+  mMin   = 0u;
+  mMax   = 0u;
+}
+
+unsigned int FrameTimeHistogram::GetPercentile(float percentile) const
+{
+  if(mCount == 0u)
+  {
+    return 0u;
+  }
+
+  // the rank of the sample, starting at 1
+  uint64_t rank = static_cast<uint64_t>(std::ceil(static_cast<double>(percentile) * 0.01 * static_cast<double>(mCount)));
+  if(rank < 1u)
+  {
+    rank = 1u;
+  }
+  else if(rank >= mCount)
+  {
+    return mMax;
+  }
+
+  uint64_t count = 0u;
+  for(unsigned int index = 0u; index < BUCKET_COUNT; ++index)
+  {
+    count += mBuckets[index];
+    if(count >= rank)
+    {
+      const unsigned int value = GetBucketValue(index);
+      return value < mMin ? mMin : (value > mMax ? mMax : value);
+    }
+  }
+  return mMax;
+}
+
+unsigned int FrameTimeHistogram::GetBucketIndex(unsigned int value)
+{
+  // the first two ranges have a bucket per value
+  unsigned int shift = 0u;
+  while((value >> shift) >= (SUB_BUCKET_COUNT << 1u))
+  {
+    ++shift;
+  }
+  if(shift == 0u)
+  {
+    return value;
+  }
+  // (value >> shift) is in [SUB_BUCKET_COUNT, 2 * SUB_BUCKET_COUNT)
+  return (shift + 1u) * SUB_BUCKET_COUNT + (value >> shift) - SUB_BUCKET_COUNT;
+}
+
+unsigned int FrameTimeHistogram::GetBucketValue(unsigned int index)
+{
+  if(index < (SUB_BUCKET_COUNT << 1u))
+  {
+    return index;
+  }
+  const unsigned int shift    = index / SUB_BUCKET_COUNT - 1u;
+  const unsigned int mantissa = SUB_BUCKET_COUNT + index % SUB_BUCKET_COUNT;
+  return (mantissa << shift) + (((1u << shift) - 1u) >> 1u);
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
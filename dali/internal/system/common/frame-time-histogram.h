@@ -0,0 +1,117 @@
+#ifndef DALI_INTERNAL_ADAPTOR_FRAME_TIME_HISTOGRAM_H
+#define DALI_INTERNAL_ADAPTOR_FRAME_TIME_HISTOGRAM_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+/**
+ * Fixed size log-linear histogram of durations in microseconds, used to calculate percentiles.
+ *
+ * Each power of two range is split into SUB_BUCKET_COUNT linear buckets, so the relative
+ * error of a percentile is below 1 / SUB_BUCKET_COUNT (about 3%), whatever the duration.
+ * Durations below 2 * SUB_BUCKET_COUNT microseconds are counted exactly.
+ *
+ * The memory used doesn't depend on the number of samples.
+ */
+class FrameTimeHistogram
+{
+public:
+  /**
+   * Constructor
+   */
+  FrameTimeHistogram();
+
+  /**
+   * Add a sample
+   * @param[in] microseconds the duration
+   */
+  void Add(unsigned int microseconds);
+
+  /**
+   * Remove all the samples
+   */
+  void Reset();
+
+  /**
+   * @return the number of samples
+   */
+  uint64_t GetCount() const
+  {
+    return mCount;
+  }
+
+  /**
+   * @return the minimum value in microseconds, or zero if there are no samples
+   */
+  unsigned int GetMin() const
+  {
+    return mMin;
+  }
+
+  /**
+   * @return the maximum value in microseconds, or zero if there are no samples
+   */
+  unsigned int GetMax() const
+  {
+    return mMax;
+  }
+
+  /**
+   * Get the value below which a percentage of the samples fall
+   * @param[in] percentile the percentage, e.g. 99.9
+   * @return the value in microseconds, or zero if there are no samples
+   */
+  unsigned int GetPercentile(float percentile) const;
+
+private:
+  static const unsigned int SUB_BUCKET_BITS  = 5u;
+  static const unsigned int SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+  static const unsigned int BUCKET_COUNT     = (32u - SUB_BUCKET_BITS + 1u) * SUB_BUCKET_COUNT; ///< enough for any unsigned int
+
+  /**
+   * @return the index of the bucket of a value
+   */
+  static unsigned int GetBucketIndex(unsigned int value);
+
+  /**
+   * @return the middle of the range of values of a bucket
+   */
+  static unsigned int GetBucketValue(unsigned int index);
+
+private:
+  uint32_t     mBuckets[BUCKET_COUNT]; ///< sample count of each bucket
+  uint64_t     mCount;                 ///< total sample count
+  unsigned int mMin;                   ///< minimum value, percentiles are clamped to the real range
+  unsigned int mMax;                   ///< maximum value
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_ADAPTOR_FRAME_TIME_HISTOGRAM_H
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -29,15 +29,13 @@ namespace Adaptor
 {
 namespace
 {
-const float EPSILON                          = 0.9f;            // rolling average = (average * epsilon) + (current * epsilon)
 const float ONE_OVER_MICROSECONDS_TO_SECONDS = 1.f / 1000000.f; ///< microseconds per second
 } // namespace
 
 FrameTimeStats::FrameTimeStats()
-: mTotal(0.f)
+: mTotal(0u),
+  mTimeState(WAITING_FOR_START_TIME)
 {
-  mSamples.Reserve(16); // Fill out a little to avoid early reallocations
-
   Reset();
 }
 
@@ -47,12 +45,7 @@ FrameTimeStats::~FrameTimeStats()
 
 void FrameTimeStats::StartTime(const FrameTimeStamp& timeStamp)
 {
-  // check to make sure we don't get 2 start times in a row
-  if(mTimeState != WAITING_FOR_START_TIME)
-  {
-    Reset();
-  }
-
+  // if we get 2 start times in a row, the duration is measured from the latest one
   mStart     = timeStamp;
   mTimeState = WAITING_FOR_END_TIME;
 }
@@ -61,59 +54,39 @@ void FrameTimeStats::EndTime(const FrameTimeStamp& timeStamp)
 {
   if(mTimeState != WAITING_FOR_END_TIME)
   {
-    Reset();
     return;
   }
 
   mTimeState = WAITING_FOR_START_TIME;
   mRunCount++;
 
-  // frame time in seconds
+  // frame time in microseconds
   unsigned int elapsedTime = FrameTimeStamp::MicrosecondDiff(mStart, timeStamp);
 
-  mSamples.PushBack(elapsedTime);
-
-  // if the min and max times haven't been set, do that now.
-  if(!mMinMaxTimeSet)
-  {
-    mMin           = elapsedTime;
-    mMax           = elapsedTime;
-    mMinMaxTimeSet = true;
-  }
-  else
-  {
-    if(elapsedTime < mMin)
-    {
-      mMin = elapsedTime;
-    }
-    else if(elapsedTime > mMax)
-    {
-      mMax = elapsedTime;
-    }
-  }
+  mHistogram.Add(elapsedTime);
+  mTotalHistogram.Add(elapsedTime);
 
+  mSum += elapsedTime;
+  mSumOfSquares += static_cast<double>(elapsedTime) * static_cast<double>(elapsedTime);
   mTotal += elapsedTime;
 }
 
 void FrameTimeStats::Reset()
 {
-  mTimeState     = WAITING_FOR_START_TIME;
-  mMinMaxTimeSet = false;
-  mMin           = 0.f;
-  mMax           = 0.f;
-  mRunCount      = 0;
-  mStart         = FrameTimeStamp();
-  mSamples.Clear();
+  mHistogram.Reset();
+  mSum          = 0u;
+  mSumOfSquares = 0.0;
+  mRunCount     = 0;
 }
 
 float FrameTimeStats::GetMaxTime() const
 {
-  return mMax * ONE_OVER_MICROSECONDS_TO_SECONDS;
+  return mHistogram.GetMax() * ONE_OVER_MICROSECONDS_TO_SECONDS;
 }
 
 float FrameTimeStats::GetMinTime() const
 {
-  return mMin * ONE_OVER_MICROSECONDS_TO_SECONDS;
+  return mHistogram.GetMin() * ONE_OVER_MICROSECONDS_TO_SECONDS;
 }
 
 float FrameTimeStats::GetTotalTime() const
@@ -128,37 +101,13 @@ unsigned int FrameTimeStats::GetRunCount() const
 
 void FrameTimeStats::CalculateMean(float& meanOut, float& standardDeviationOut) const
 {
-  if(mSamples.Size() > 0)
+  if(mRunCount > 0)
   {
-    // Mean
-    unsigned int sum = 0;
-    for(Samples::ConstIterator it = mSamples.Begin(), itEnd = mSamples.End(); it != itEnd; ++it)
-    {
-      unsigned int value = *it;
-
-      sum += value;
-    }
-
-    meanOut = static_cast<float>(sum) / mSamples.Size();
+    const double mean     = static_cast<double>(mSum) / mRunCount;
+    const double variance = mSumOfSquares / mRunCount - mean * mean;
 
-    // Variance
-    float variance = 0.0f;
-    for(Samples::ConstIterator it = mSamples.Begin(), itEnd = mSamples.End(); it != itEnd; ++it)
-    {
-      unsigned int value = *it;
-
-      float difference = static_cast<float>(value) - meanOut;
-
-      variance += difference * difference;
-    }
-
-    variance /= mSamples.Size();
-
-    // Standard deviation
-    standardDeviationOut = sqrtf(variance);
-
-    meanOut *= ONE_OVER_MICROSECONDS_TO_SECONDS;
-    standardDeviationOut *= ONE_OVER_MICROSECONDS_TO_SECONDS;
+    meanOut              = static_cast<float>(mean) * ONE_OVER_MICROSECONDS_TO_SECONDS;
+    standardDeviationOut = static_cast<float>(variance > 0.0 ? std::sqrt(variance) : 0.0) * ONE_OVER_MICROSECONDS_TO_SECONDS;
   }
   else
   {
@@ -167,6 +116,16 @@ void FrameTimeStats::CalculateMean(float& meanOut, float& standardDeviationOut)
   }
 }
 
+float FrameTimeStats::GetPercentile(float percentile) const
+{
+  return mHistogram.GetPercentile(percentile) * ONE_OVER_MICROSECONDS_TO_SECONDS;
+}
+
+float FrameTimeStats::GetTotalPercentile(float percentile) const
+{
+  return mTotalHistogram.GetPercentile(percentile) * ONE_OVER_MICROSECONDS_TO_SECONDS;
+}
+
 } // namespace Adaptor
 
 } // namespace Internal
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ADAPTOR_FRAME_TIME_STATS_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,8 +19,8 @@
  */
 
 // INTERNAL INCLUDES
+#include <dali/internal/system/common/frame-time-histogram.h>
 #include <dali/internal/system/common/frame-time-stamp.h>
-#include <dali/public-api/common/dali-vector.h>
 
 namespace Dali
 {
@@ -30,8 +30,11 @@ namespace Adaptor
 {
 /**
  * Used to get statistics about time stamps over a period of time.
- * E.g. the min, max, total and average time spent inside two markers,
+ * E.g. the min, max, total, average and percentiles of the time spent inside two markers,
  * such as UPDATE_START and UPDATE_END
+ *
+ * The samples are counted in fixed size histograms rather than stored, so the memory
+ * used doesn't grow with the run time.
  */
 struct FrameTimeStats
 {
@@ -47,6 +50,7 @@ struct FrameTimeStats
 
   /**
    * Timer start time
+   * If the timer is already running, e.g. a v-sync without a render, it is restarted.
    * @param timeStamp time stamp
    */
   void StartTime(const FrameTimeStamp& timeStamp);
@@ -58,7 +62,8 @@ struct FrameTimeStats
   void EndTime(const FrameTimeStamp& timeStamp);
 
   /**
-    * Reset all internal counters / state except total time.
+    * Reset all internal counters except total time and total percentiles.
+    * A running timer is kept, so a duration spanning two periods isn't lost.
     */
   void Reset();
 
@@ -90,6 +95,20 @@ struct FrameTimeStats
     */
   void CalculateMean(float& meanOut, float& standardDeviationOut) const;
 
+  /**
+    * Get a percentile of the times since the last reset
+    * @param[in] percentile the percentage of samples, e.g. 99.9
+    * @return time in seconds
+    */
+  float GetPercentile(float percentile) const;
+
+  /**
+    * Get a percentile of all the times, which isn't reset
+    * @param[in] percentile the percentage of samples, e.g. 99.9
+    * @return time in seconds
+    */
+  float GetTotalPercentile(float percentile) const;
+
 private:
   /**
     * internal time state.
@@ -100,16 +119,14 @@ private:
     WAITING_FOR_END_TIME    ///< waiting for end time marker
   };
 
-  typedef Dali::Vector<unsigned int> Samples;
-  Samples                            mSamples;
-
-  unsigned int   mMin;               ///< current minimum value in microseconds
-  unsigned int   mMax;               ///< current maximum value in microseconds
-  unsigned int   mTotal;             ///< current total in in microseconds
-  unsigned int   mRunCount;          ///< how many times the timer has been start / stopped
-  FrameTimeStamp mStart;             ///< start time stamp, to calculate the diff
-  TimeState      mTimeState : 1;     ///< time state
-  bool           mMinMaxTimeSet : 1; ///< whether the min-max values have been configured
+  FrameTimeHistogram mHistogram;      ///< times since the last reset
+  FrameTimeHistogram mTotalHistogram; ///< all the times
+  uint64_t           mSum;            ///< sum of the times since the last reset in microseconds
+  double             mSumOfSquares;   ///< sum of the squared times since the last reset, for the standard deviation
+  uint64_t           mTotal;          ///< current total in in microseconds
+  unsigned int       mRunCount;       ///< how many times the timer has been start / stopped
+  FrameTimeStamp     mStart;          ///< start time stamp, to calculate the diff
+  TimeState          mTimeState : 1;  ///< time state
 };
 
 } // namespace Adaptor
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_BASE_PERFORMANCE_INTERFACE_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -36,12 +36,14 @@ public:
 
   /**
    * bitmask of statistics logging options.
-   * Used for output data like min/max/average time spent in event, update,render and custom tasks.
+   * Used for output data like min/max/average/percentiles of the time spent in event, update, render,
+   * v-sync to present and custom tasks.
    * E.g.
-   * Event, min 0.04 ms, max 5.27 ms, total (0.1 secs), avg 0.28 ms, std dev 0.73 ms
-   * Update, min 0.29 ms, max 0.91 ms, total (0.5 secs), avg 0.68 ms, std dev 0.15 ms
-   * Render, min 0.33 ms, max 0.97 ms, total (0.6 secs), avg 0.73 ms, std dev 0.17 ms
-   * TableViewInit, min 76.55 ms, max 76.55 ms, total (0.1 secs), avg 76.55 ms, std dev 0.00 ms
+   * Event, min 0.04 ms, max 5.27 ms, total (0.1 secs), avg 0.28 ms, std dev 0.73 ms, p50 0.09 ms, p90 0.41 ms, p99 4.12 ms, p99.9 5.27 ms
+   * Update, min 0.29 ms, max 0.91 ms, total (0.5 secs), avg 0.68 ms, std dev 0.15 ms, p50 0.67 ms, p90 0.86 ms, p99 0.91 ms, p99.9 0.91 ms
+   * Render, min 0.33 ms, max 0.97 ms, total (0.6 secs), avg 0.73 ms, std dev 0.17 ms, p50 0.72 ms, p90 0.93 ms, p99 0.97 ms, p99.9 0.97 ms
+   * VSyncToPresent, min 0.70 ms, max 1.95 ms, total (1.2 secs), avg 1.45 ms, std dev 0.27 ms, p50 1.43 ms, p90 1.78 ms, p99 1.95 ms, p99.9 1.95 ms
+   * TableViewInit, min 76.55 ms, max 76.55 ms, total (0.1 secs), avg 76.55 ms, std dev 0.00 ms, p50 76.55 ms, p90 76.55 ms, p99 76.55 ms, p99.9 76.55 ms
    */
   enum StatisticsLogOptions
   {
@@ -171,6 +173,15 @@ public:
    */
   virtual void EnableLogging(bool enable, ContextId contextId) = 0;
 
+  /**
+   * @brief Get a percentile of all the times measured by a context, since it has been created
+   *
+   * @param[in] percentile The percentage of samples, e.g. 99.9
+   * @param[in] contextId The id of the context. This must be one generated by AddContext.
+   * @return The time in seconds
+   */
+  virtual float GetPercentile(float percentile, ContextId contextId) = 0;
+
 private:
   // Undefined copy constructor.
   PerformanceInterface(const PerformanceInterface&);
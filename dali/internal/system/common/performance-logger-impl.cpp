@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -108,6 +108,16 @@ void PerformanceLogger::EnableLogging(bool enable)
   }
 }
 
+float PerformanceLogger::GetPercentile(float percentile) const
+{
+  PerformanceInterface* performance = GetPerformanceInterface();
+  if(performance)
+  {
+    return performance->GetPercentile(percentile, mContext);
+  }
+  return 0.0f;
+}
+
 } // namespace Adaptor
 
 } // namespace Internal
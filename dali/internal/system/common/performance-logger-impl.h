@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_PERFORMANCE_LOGGER_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -81,6 +81,11 @@ public:
    */
   void EnableLogging(bool enable);
 
+  /**
+   * @copydoc Dali::PerformanceLogger::GetPercentile()
+   */
+  float GetPercentile(float percentile) const;
+
 private: // Implementation
   // not implemented
   PerformanceLogger(const PerformanceLogger&);
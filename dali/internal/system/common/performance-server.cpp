@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -110,6 +110,11 @@ void PerformanceServer::EnableLogging(bool enable, ContextId contextId)
   mStatContextManager.EnableLogging(enable, contextId);
 }
 
+float PerformanceServer::GetPercentile(float percentile, ContextId contextId)
+{
+  return mStatContextManager.GetPercentile(percentile, contextId);
+}
+
 PerformanceInterface::ContextId PerformanceServer::AddContext(const char* name)
 {
   // for adding custom contexts
@@ -194,6 +199,17 @@ void PerformanceServer::LogContextStatistics(const char* const text)
   Integration::Log::LogMessage(Dali::Integration::Log::INFO, text);
 }
 
+void PerformanceServer::TransmitContextStatistics(const char* const text)
+{
+#if defined(NETWORK_LOGGING_ENABLED)
+  // send to the network clients which have enabled the statistics ( this is thread safe )
+  if(mNetworkControlEnabled)
+  {
+    mNetworkServer.TransmitStatistics(text);
+  }
+#endif
+}
+
 void PerformanceServer::LogMarker(const PerformanceMarker& marker, const char* const description)
 {
 #if defined(NETWORK_LOGGING_ENABLED)
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ADAPTOR_PERFORMANCE_SERVER_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -100,12 +100,22 @@ public:
    */
   void EnableLogging(bool enable, ContextId contextId) override;
 
+  /**
+   * @copydoc PerformanceLogger::GetPercentile()
+   */
+  float GetPercentile(float percentile, ContextId contextId) override;
+
 public: //StatLogInterface
   /**
    * @copydoc StatLogInterface::LogContextStatistics()
    */
   void LogContextStatistics(const char* const text) override;
 
+  /**
+   * @copydoc StatLogInterface::TransmitContextStatistics()
+   */
+  void TransmitContextStatistics(const char* const text) override;
+
 private:
   /**
    * @brief log the marker out to kernel/ DALi log
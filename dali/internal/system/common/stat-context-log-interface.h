@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ADAPTOR_STATISTICS_STAT_CONTEXT_LOG_INTERFACE_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -36,6 +36,12 @@ public:
    */
   virtual void LogContextStatistics(const char* const text) = 0;
 
+  /**
+   * @brief Used to send statistics to the network clients, even if logging is disabled
+   * @param[in] text the statistics text
+   */
+  virtual void TransmitContextStatistics(const char* const text) = 0;
+
 protected:
   /**
    * @brief  Constructor
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -32,6 +32,7 @@ namespace
 const char* const  UPDATE_CONTEXT_NAME   = "Update";
 const char* const  RENDER_CONTEXT_NAME   = "Render";
 const char* const  EVENT_CONTEXT_NAME    = "Event";
+const char* const  PRESENT_CONTEXT_NAME  = "VSyncToPresent";
 const unsigned int DEFAULT_LOG_FREQUENCY = 2;
 } // namespace
 
@@ -41,12 +42,16 @@ StatContextManager::StatContextManager(StatContextLogInterface& logInterface)
   mStatisticsLogBitmask(0),
   mLogFrequency(DEFAULT_LOG_FREQUENCY)
 {
-  mStatContexts.Reserve(4); // intially reserve enough for 3 internal + 1 custom
+  mStatContexts.Reserve(5); // intially reserve enough for 4 internal + 1 custom
 
   // Add defaults
-  mUpdateStats = AddContext(UPDATE_CONTEXT_NAME, PerformanceMarker::UPDATE);
-  mRenderStats = AddContext(RENDER_CONTEXT_NAME, PerformanceMarker::RENDER);
-  mEventStats  = AddContext(EVENT_CONTEXT_NAME, PerformanceMarker::EVENT_PROCESS);
+  mUpdateStats  = AddContext(UPDATE_CONTEXT_NAME, PerformanceMarker::UPDATE);
+  mRenderStats  = AddContext(RENDER_CONTEXT_NAME, PerformanceMarker::RENDER);
+  mEventStats   = AddContext(EVENT_CONTEXT_NAME, PerformanceMarker::EVENT_PROCESS);
+  mPresentStats = AddContext(PRESENT_CONTEXT_NAME, PerformanceMarker::V_SYNC_EVENTS);
+
+  // the frame is presented at the end of the render
+  GetContext(mPresentStats)->SetTimedMarkers(PerformanceInterface::VSYNC, PerformanceInterface::RENDER_END);
 }
 
 StatContextManager::~StatContextManager()
@@ -147,6 +152,7 @@ void StatContextManager::SetLoggingLevel(unsigned int statisticsLogOptions, unsi
   }
   EnableLogging(mStatisticsLogBitmask & PerformanceInterface::LOG_UPDATE_RENDER, mUpdateStats);
   EnableLogging(mStatisticsLogBitmask & PerformanceInterface::LOG_UPDATE_RENDER, mRenderStats);
+  EnableLogging(mStatisticsLogBitmask & PerformanceInterface::LOG_UPDATE_RENDER, mPresentStats);
   EnableLogging(mStatisticsLogBitmask & PerformanceInterface::LOG_EVENT_PROCESS, mEventStats);
 
   for(StatContexts::Iterator it = mStatContexts.Begin(), itEnd = mStatContexts.End(); it != itEnd; ++it)
@@ -169,6 +175,17 @@ void StatContextManager::SetLoggingFrequency(unsigned int                    log
     context->SetLogFrequency(logFrequency);
   }
 }
+float StatContextManager::GetPercentile(float percentile, PerformanceInterface::ContextId contextId) const
+{
+  Mutex::ScopedLock lock(mDataMutex);
+  StatContext*      context = GetContext(contextId);
+  if(context)
+  {
+    return context->GetPercentile(percentile);
+  }
+  return 0.0f;
+}
+
 const char* StatContextManager::GetContextName(PerformanceInterface::ContextId contextId) const
 {
   StatContext* context = GetContext(contextId);
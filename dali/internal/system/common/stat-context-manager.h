@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ADAPTOR_STAT_CONTEXT_MANAGER_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,6 +20,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/threading/mutex.h>
+#include <dali/public-api/common/dali-vector.h>
 
 // INTERNAL INCLUDES
 #include <dali/internal/system/common/performance-interface.h>
@@ -35,15 +36,18 @@ namespace Adaptor
 /**
  * Class to manage StatContext objects.
  *
- * Contains 3 built in contexts for event, update, render.
+ * Contains 4 built in contexts for event, update, render and v-sync to present.
  * The application developer can add more using the PerformanceLogger public API
  *
- * Example output of 4 contexts ( event, update, render and a custom one):
+ * Example output of 5 contexts ( event, update, render, v-sync to present and a custom one):
  *
- * Event, min 0.04 ms, max 5.27 ms, total (0.1 secs), avg 0.28 ms, std dev 0.73 ms
- * Update, min 0.29 ms, max 0.91 ms, total (0.5 secs), avg 0.68 ms, std dev 0.15 ms
- * Render, min 0.33 ms, max 0.97 ms, total (0.6 secs), avg 0.73 ms, std dev 0.17 ms
- * MyAppTask, min 76.55 ms, max 76.55 ms, total (0.1 secs), avg 76.55 ms, std dev 0.00 ms  (CUSTOM CONTEXT)
+ * Event, min 0.04 ms, max 5.27 ms, total (0.1 secs), avg 0.28 ms, std dev 0.73 ms, p50 0.09 ms, p90 0.41 ms, p99 4.12 ms, p99.9 5.27 ms
+ * Update, min 0.29 ms, max 0.91 ms, total (0.5 secs), avg 0.68 ms, std dev 0.15 ms, p50 0.67 ms, p90 0.86 ms, p99 0.91 ms, p99.9 0.91 ms
+ * Render, min 0.33 ms, max 0.97 ms, total (0.6 secs), avg 0.73 ms, std dev 0.17 ms, p50 0.72 ms, p90 0.93 ms, p99 0.97 ms, p99.9 0.97 ms
+ * VSyncToPresent, min 0.70 ms, max 1.95 ms, total (1.2 secs), avg 1.45 ms, std dev 0.27 ms, p50 1.43 ms, p90 1.78 ms, p99 1.95 ms, p99.9 1.95 ms
+ * MyAppTask, min 76.55 ms, max 76.55 ms, total (0.1 secs), avg 76.55 ms, std dev 0.00 ms, p50 76.55 ms, p90 76.55 ms, p99 76.55 ms, p99.9 76.55 ms  (CUSTOM CONTEXT)
+ *
+ * The percentiles of a context since its creation can also be queried with GetPercentile().
  *
  */
 class StatContextManager
@@ -87,6 +91,14 @@ public:
    */
   void AddCustomMarker( const PerformanceMarker& marker , PerformanceInterface::ContextId contextId );
 
+  /**
+   * @brief Get a percentile of all the times measured by a context, since it has been created
+   * @param[in] percentile the percentage of samples, e.g. 99.9
+   * @param[in] contextId the context
+   * @return the time in seconds, or zero if the context isn't found
+   */
+  float GetPercentile( float percentile, PerformanceInterface::ContextId contextId ) const;
+
   /**
    * @brief Get the name of a context
    * @param[in] contextId id of the context to get the name
@@ -143,7 +155,7 @@ private:
    */
   StatContext* GetContext( PerformanceInterface::ContextId contextId ) const;
 
-  Dali::Mutex mDataMutex;                            ///< mutex
+  mutable Dali::Mutex mDataMutex;                    ///< mutex
   StatContexts mStatContexts;                        ///< The list of stat contexts
   StatContextLogInterface& mLogInterface;            ///< Log interface
 
@@ -153,6 +165,7 @@ private:
   PerformanceInterface::ContextId mUpdateStats;    ///< update time statistics
   PerformanceInterface::ContextId mRenderStats;    ///< render time statistics
   PerformanceInterface::ContextId mEventStats;     ///< event time statistics
+  PerformanceInterface::ContextId mPresentStats;   ///< v-sync to present time statistics
 
   unsigned int mStatisticsLogBitmask;              ///< statistics log bitmask
   unsigned int mLogFrequency;                      ///< log frequency
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -38,7 +38,7 @@ namespace
 const unsigned int MILLISECONDS_PER_SECOND = 1000; ///< 1000 milliseconds per second
 const char* const  UNKNOWN_CONTEXT_NAME    = "UNKNOWN_CONTEXT_NAME";
 const unsigned int MICROSECONDS_PER_SECOND = 1000000; ///< 1000000 microseconds per second
-const unsigned int CONTEXT_LOG_SIZE        = 120;
+const unsigned int CONTEXT_LOG_SIZE        = 256;
 
 } // namespace
 
@@ -55,8 +55,11 @@ StatContext::StatContext(unsigned int                    id,
   mId(id),
   mLogFrequencyMicroseconds(logFrequencySeconds * MICROSECONDS_PER_SECOND),
   mFilterType(contextType),
+  mStartMarker(PerformanceInterface::START),
+  mEndMarker(PerformanceInterface::END),
   mLoggingEnabled(true),
-  mInitialMarkerSet(false)
+  mInitialMarkerSet(false),
+  mUseTimedMarkers(false)
 {
   mTempLogBuffer = new char[CONTEXT_LOG_SIZE];
 }
@@ -97,6 +100,18 @@ void StatContext::EnableLogging(bool enableLogging)
   mLoggingEnabled = enableLogging;
 }
 
+void StatContext::SetTimedMarkers(PerformanceInterface::MarkerType startMarker, PerformanceInterface::MarkerType endMarker)
+{
+  mStartMarker     = startMarker;
+  mEndMarker       = endMarker;
+  mUseTimedMarkers = true;
+}
+
+float StatContext::GetPercentile(float percentile) const
+{
+  return mStats.GetTotalPercentile(percentile);
+}
+
 void StatContext::ProcessCustomMarker(const PerformanceMarker& marker)
 {
   // this marker has come from the application PerformanceLogger API
@@ -107,7 +122,18 @@ void StatContext::ProcessInternalMarker(const PerformanceMarker& marker)
 {
   // this marker has come from DALi internal not the application
   // see if this context is for update, render or event
-  if(marker.IsFilterEnabled(mFilterType))
+  if(mUseTimedMarkers)
+  {
+    if(marker.GetType() == mStartMarker)
+    {
+      mStats.StartTime(marker.GetTimeStamp());
+    }
+    else if(marker.GetType() == mEndMarker)
+    {
+      mStats.EndTime(marker.GetTimeStamp());
+    }
+  }
+  else if(marker.IsFilterEnabled(mFilterType))
   {
     RecordMarker(marker);
   }
@@ -148,10 +174,7 @@ void StatContext::FrameTick(const PerformanceMarker& marker)
     return;
   }
 
-  if(mLoggingEnabled)
-  {
-    LogMarker();
-  }
+  LogMarker();
   mStats.Reset();            // reset data for statistics
   mInitialMarkerSet = false; // need to restart the timer
 }
@@ -163,15 +186,26 @@ void StatContext::LogMarker()
 
   snprintf(mTempLogBuffer,
            CONTEXT_LOG_SIZE,
-           "%s, min " TIME_FMT ", max " TIME_FMT ", total (" TOTAL_TIME_FMT "), avg " TIME_FMT ", std dev " TIME_FMT "\n",
+           "%s, min " TIME_FMT ", max " TIME_FMT ", total (" TOTAL_TIME_FMT "), avg " TIME_FMT ", std dev " TIME_FMT
+           ", p50 " TIME_FMT ", p90 " TIME_FMT ", p99 " TIME_FMT ", p99.9 " TIME_FMT "\n",
            mName ? mName : UNKNOWN_CONTEXT_NAME,
            mStats.GetMinTime() * MILLISECONDS_PER_SECOND,
            mStats.GetMaxTime() * MILLISECONDS_PER_SECOND,
            mStats.GetTotalTime(),
            mean * MILLISECONDS_PER_SECOND,
-           standardDeviation * MILLISECONDS_PER_SECOND);
+           standardDeviation * MILLISECONDS_PER_SECOND,
+           mStats.GetPercentile(50.f) * MILLISECONDS_PER_SECOND,
+           mStats.GetPercentile(90.f) * MILLISECONDS_PER_SECOND,
+           mStats.GetPercentile(99.f) * MILLISECONDS_PER_SECOND,
+           mStats.GetPercentile(99.9f) * MILLISECONDS_PER_SECOND);
+
+  if(mLoggingEnabled)
+  {
+    mLogInterface.LogContextStatistics(mTempLogBuffer);
+  }
 
-  mLogInterface.LogContextStatistics(mTempLogBuffer);
+  // network clients can ask for the statistics whatever the log options
+  mLogInterface.TransmitContextStatistics(mTempLogBuffer);
 }
 
 } // namespace Adaptor
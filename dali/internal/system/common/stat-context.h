@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_ADAPTOR_STAT_CONTEXT_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -94,6 +94,25 @@ public:
      */
   void EnableLogging(bool enableLogging);
 
+  /**
+     * @brief Measure the time between two internal markers, instead of the timed events of the filter type.
+     *
+     * E.g. VSYNC to RENDER_END. If the start marker comes twice before the end marker, the time is
+     * measured from the latest one.
+     *
+     * @param[in] startMarker The marker starting the timer
+     * @param[in] endMarker The marker stopping the timer
+     */
+  void SetTimedMarkers(PerformanceInterface::MarkerType startMarker, PerformanceInterface::MarkerType endMarker);
+
+  /**
+     * @brief Get a percentile of all the times measured by the context, since it has been created
+     *
+     * @param[in] percentile The percentage of samples, e.g. 99.9
+     * @return The time in seconds
+     */
+  float GetPercentile(float percentile) const;
+
   /**
      * @brief  Process a custom marker from the application
      *
@@ -123,7 +142,7 @@ private:
   void FrameTick(const PerformanceMarker& marker);
 
   /**
-     * @brief Helper to print to console
+     * @brief Helper to print to console and to the network clients
      */
   void LogMarker();
 
@@ -145,8 +164,11 @@ private:
   unsigned int                    mId;                       ///< The ID of the context
   unsigned int                    mLogFrequencyMicroseconds; ///< if logging is enabled, what frequency to log out at in micro-seconds
   PerformanceMarker::MarkerFilter mFilterType;               ///< type of events the context is filtering
+  PerformanceInterface::MarkerType mStartMarker;             ///< marker starting the timer, if mUseTimedMarkers
+  PerformanceInterface::MarkerType mEndMarker;               ///< marker stopping the timer, if mUseTimedMarkers
   bool                            mLoggingEnabled : 1;       ///< Whether to print the log for this context or not
   bool                            mInitialMarkerSet : 1;     ///< Whether the initial marker has been set
+  bool                            mUseTimedMarkers : 1;      ///< Whether the timer uses mStartMarker and mEndMarker
 };
 
 } // namespace Adaptor
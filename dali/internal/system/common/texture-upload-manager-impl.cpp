@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 #include <dali/internal/system/common/texture-upload-manager-impl.h>
 
 // EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/common/singleton-service.h>
 #include <dali/graphics-api/graphics-texture-upload-helper.h> ///< for Dali::Graphics::ConvertPixelFormat
 #include <dali/integration-api/adaptor-framework/adaptor.h>
@@ -26,9 +27,13 @@
 #include <dali/integration-api/pixel-data-integ.h>
 #include <dali/integration-api/texture-integ.h>
 #include <dali/integration-api/trace.h>
+#include <algorithm>
+#include <cstdlib>
 
 // INTERNAL INCLUDES
 #include <dali/internal/adaptor/common/adaptor-impl.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/trace/common/trace-recorder.h>
 
 namespace Dali
 {
@@ -40,8 +45,20 @@ namespace
 {
 Dali::Devel::TextureUploadManager::ResourceId gUniqueResourceId = 0;
 
+// A burst of images is spread over several frames, instead of making a long one.
+constexpr uint32_t DEFAULT_UPLOAD_BUDGET = 4u * 1024u * 1024u;
+
+const char* TRACE_QUEUE_DEPTH_COUNTER    = "DALI_TEXTURE_UPLOAD_QUEUE_DEPTH";
+const char* TRACE_UPLOADED_BYTES_COUNTER = "DALI_TEXTURE_UPLOAD_BYTES";
+
 DALI_INIT_TRACE_FILTER(gTraceFilter, DALI_TRACE_PERFORMANCE_MARKER, false);
 
+uint32_t GetUploadBudget()
+{
+  auto budgetString = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_TEXTURE_UPLOAD_BUDGET);
+  return budgetString ? static_cast<uint32_t>(std::strtoul(budgetString, nullptr, 10)) : DEFAULT_UPLOAD_BUDGET;
+}
+
 #if defined(DEBUG_ENABLED)
 Debug::Filter* gTextureUploadManagerLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_TEXTURE_UPLOAD_MANAGER");
 #endif
@@ -77,7 +94,10 @@ Dali::Devel::TextureUploadManager TextureUploadManager::Get()
 
 TextureUploadManager::TextureUploadManager()
 : mGraphicsController{nullptr},
-  mRenderTrigger(new EventThreadCallback(MakeCallback(this, &TextureUploadManager::RequestUpdateOnce)))
+  mRenderTrigger(new EventThreadCallback(MakeCallback(this, &TextureUploadManager::RequestUpdateOnce))),
+  mUploadBudget(GetUploadBudget()),
+  mFrameUploadedBytes(0u),
+  mFrameProcessedCount(0u)
 {
 }
 
@@ -119,19 +139,38 @@ void TextureUploadManager::RequestUpdateOnce()
 // Called by update thread
 
 bool TextureUploadManager::ResourceUpload()
+{
+  // Every call of the devel api starts a new frame.
+  ResetUploadBudget();
+
+  return ContinueResourceUpload();
+}
+
+bool TextureUploadManager::ContinueResourceUpload()
 {
   DALI_ASSERT_DEBUG(mGraphicsController && "GraphicsController is not prepared!");
 
-  // Copy queue first.
+  // Take the new requests first.
   RequestUploadQueue copiedRequestUploadQueue;
 
   {
     Dali::Mutex::ScopedLock lock(mRequestMutex);
     copiedRequestUploadQueue = std::move(mRequestUploadQueue);
+    mRequestUploadQueue.clear();
+  }
+
+  if(!copiedRequestUploadQueue.empty())
+  {
+    // The worker threads complete in any order, upload the oldest resources first.
+    mPendingUploadQueue.insert(mPendingUploadQueue.end(), std::make_move_iterator(copiedRequestUploadQueue.begin()), std::make_move_iterator(copiedRequestUploadQueue.end()));
+    // The ids are compared as serial numbers, so the order is kept when they wrap around.
+    std::sort(mPendingUploadQueue.begin(), mPendingUploadQueue.end(), [](const UploadRequestItem& lhs, const UploadRequestItem& rhs) {
+      return static_cast<int32_t>(lhs.first - rhs.first) < 0;
+    });
   }
 
   // Upload.
-  bool uploaded = ProcessUploadQueue(std::move(copiedRequestUploadQueue));
+  bool uploaded = ProcessUploadQueue();
 
   return uploaded;
 }
@@ -141,25 +180,45 @@ void TextureUploadManager::InitalizeGraphicsController(Dali::Graphics::Controlle
   mGraphicsController = &graphicsController;
 }
 
-bool TextureUploadManager::ProcessUploadQueue(RequestUploadQueue&& queue)
+void TextureUploadManager::ResetUploadBudget()
+{
+  mFrameUploadedBytes  = 0u;
+  mFrameProcessedCount = 0u;
+}
+
+bool TextureUploadManager::ProcessUploadQueue()
 {
   bool uploaded = false;
 
-  if(!queue.empty())
+  if(!mPendingUploadQueue.empty())
   {
     DALI_TRACE_BEGIN_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_WORKER_THREAD_RESOURCE_UPLOAD", [&](std::ostringstream& oss) {
-      oss << "[upload request \'" << queue.size() << "\' images]";
+      oss << "[upload request \'" << mPendingUploadQueue.size() << "\' images]";
     });
-#ifdef TRACE_ENABLED
-    uint32_t uploadedCount = 0u;
-#endif
 
-    DALI_LOG_INFO(gTextureUploadManagerLogFilter, Debug::Concise, "Upload request %zu images\n", queue.size());
-    for(auto& requests : queue)
+    DALI_LOG_INFO(gTextureUploadManagerLogFilter, Debug::Concise, "Upload request %zu images\n", mPendingUploadQueue.size());
+
+    std::vector<Graphics::TextureUpdateInfo>       updateInfoList;
+    std::vector<Graphics::TextureUpdateSourceInfo> updateSourceInfoList;
+    updateInfoList.reserve(mPendingUploadQueue.size());
+    updateSourceInfoList.reserve(mPendingUploadQueue.size());
+
+    uint64_t uploadedBytes  = 0u;
+    size_t   processedCount = 0u;
+    for(auto& requests : mPendingUploadQueue)
     {
       auto& resourceId = requests.first;
       auto& pixelData  = requests.second;
 
+      // The budget is shared by the calls of a frame. At least one resource is uploaded per frame, even if it's larger than the budget.
+      const uint32_t dataSize = Dali::Integration::GetPixelDataBuffer(pixelData).bufferSize;
+      if(mFrameProcessedCount > 0u && mUploadBudget > 0u && mFrameUploadedBytes + dataSize > mUploadBudget)
+      {
+        break;
+      }
+      ++processedCount;
+      ++mFrameProcessedCount;
+
       Graphics::Texture* graphicsTexture = nullptr;
 
       {
@@ -188,10 +247,10 @@ bool TextureUploadManager::ProcessUploadQueue(RequestUploadQueue&& queue)
         info.dstOffset2D  = {0u, 0u};
         info.layer        = 0u;
         info.level        = 0u;
-        info.srcReference = 0;
+        info.srcReference = static_cast<uint32_t>(updateSourceInfoList.size());
         info.srcExtent2D  = {pixelData.GetWidth(), pixelData.GetHeight()};
         info.srcOffset    = 0;
-        info.srcSize      = Dali::Integration::GetPixelDataBuffer(pixelData).bufferSize;
+        info.srcSize      = dataSize;
         info.srcStride    = pixelData.GetStride();
         info.srcFormat    = Dali::Graphics::ConvertPixelFormat(pixelData.GetPixelFormat());
 
@@ -199,25 +258,44 @@ bool TextureUploadManager::ProcessUploadQueue(RequestUploadQueue&& queue)
         updateSourceInfo.sourceType                = Graphics::TextureUpdateSourceInfo::Type::PIXEL_DATA;
         updateSourceInfo.pixelDataSource.pixelData = pixelData;
 
-        mGraphicsController->UpdateTextures({info}, {updateSourceInfo});
+        updateInfoList.push_back(info);
+        updateSourceInfoList.push_back(updateSourceInfo);
 
-        uploaded = true;
-#ifdef TRACE_ENABLED
-        ++uploadedCount;
-#endif
+        uploadedBytes       += dataSize;
+        mFrameUploadedBytes += dataSize;
       }
     }
 
-    if(uploaded)
+    mPendingUploadQueue.erase(mPendingUploadQueue.begin(), mPendingUploadQueue.begin() + processedCount);
+
+    if(!updateInfoList.empty())
     {
+      mGraphicsController->UpdateTextures(updateInfoList, updateSourceInfoList);
+      uploaded = true;
+
       // Flush here
       Graphics::SubmitInfo submitInfo;
       submitInfo.cmdBuffer.clear(); // Only flush
       submitInfo.flags = 0 | Graphics::SubmitFlagBits::FLUSH;
       mGraphicsController->SubmitCommandBuffers(submitInfo);
     }
+
+    if(!mPendingUploadQueue.empty())
+    {
+      // Request another frame for the remaining resources. The budget is reset by the next frame.
+      DALI_LOG_INFO(gTextureUploadManagerLogFilter, Debug::Concise, "Upload budget reached, %zu images remain\n", mPendingUploadQueue.size());
+      mRenderTrigger->Trigger();
+    }
+
+    auto* traceRecorder = TraceRecorder::Get();
+    if(traceRecorder)
+    {
+      traceRecorder->Counter(TRACE_QUEUE_DEPTH_COUNTER, static_cast<int64_t>(mPendingUploadQueue.size()));
+      traceRecorder->Counter(TRACE_UPLOADED_BYTES_COUNTER, static_cast<int64_t>(uploadedBytes));
+    }
+
     DALI_TRACE_END_WITH_MESSAGE_GENERATOR(gTraceFilter, "DALI_WORKER_THREAD_RESOURCE_UPLOAD", [&](std::ostringstream& oss) {
-      oss << "[uploaded : \'" << uploadedCount << "\']";
+      oss << "[uploaded : \'" << updateInfoList.size() << "\', bytes : \'" << uploadedBytes << "\', remaining : \'" << mPendingUploadQueue.size() << "\']";
     });
   }
 
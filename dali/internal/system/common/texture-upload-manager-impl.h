@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_TEXTURE_UPLOAD_MANAGER_IMPL_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -82,9 +82,21 @@ private: // Main thread called method
 public: // Update thread called method
   /**
    * @copydoc Dali::Devel::TextureUploadManager::ResourceUpload()
+   * @note Each call starts a new frame. The resources are uploaded oldest first, up to the byte budget of the frame.
+   * The remaining ones are uploaded by the next frames, and another frame is requested for them.
    */
   bool ResourceUpload();
 
+  /**
+   * @brief Upload the requested resources within the budget left by the last ResourceUpload().
+   *
+   * The update thread uploads the resources before the update and before the render of a frame,
+   * and this second call shares the budget of the first one.
+   *
+   * @return True if there was at least 1 resources uploaded.
+   */
+  bool ContinueResourceUpload();
+
   /**
    * @brief Install graphics controller to be used when upload.
    * @note Please use this API internal side only.
@@ -99,12 +111,18 @@ private: // Update thread called method
   using RequestUploadQueue = std::vector<UploadRequestItem>;
 
   /**
-   * @brief Process queue of upload.
+   * @brief Reset the upload budget at the start of a frame.
+   */
+  void ResetUploadBudget();
+
+  /**
+   * @brief Process the pending upload queue, within the upload budget.
+   *
+   * All the textures are updated by a single call to the graphics controller.
    *
-   * @param queue The requested upload queue.
    * @return True if there was at least 1 resources uploaded.
    */
-  bool ProcessUploadQueue(RequestUploadQueue&& queue);
+  bool ProcessUploadQueue();
 
 public: // Worker thread called method
   /**
@@ -126,6 +144,11 @@ private:
 
   Dali::Mutex        mRequestMutex; ///< For worker thread
   RequestUploadQueue mRequestUploadQueue{};
+
+  RequestUploadQueue mPendingUploadQueue{}; ///< Requests not uploaded yet, oldest resource first. Update thread only.
+  uint32_t           mUploadBudget;         ///< The maximum bytes uploaded per frame, or 0 if unlimited
+  uint64_t           mFrameUploadedBytes;   ///< The bytes uploaded since ResetUploadBudget()
+  uint32_t           mFrameProcessedCount;  ///< The resources processed since ResetUploadBudget()
 };
 
 } // namespace Adaptor
@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/trigger-event-hub.h>
+
+// EXTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/system-factory.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+namespace
+{
+std::mutex       gHubMutex; ///< Protects gHub and the reference count of the hub
+TriggerEventHub* gHub = nullptr;
+
+inline uint64_t GetSlotBit(uint32_t slot)
+{
+  return uint64_t(1u) << (slot % 64u);
+}
+
+} // namespace
+
+TriggerEventHub* TriggerEventHub::Acquire()
+{
+  std::lock_guard<std::mutex> lock(gHubMutex);
+  if(!gHub)
+  {
+    gHub = new TriggerEventHub(true);
+  }
+  ++gHub->mReferenceCount;
+  return gHub;
+}
+
+void TriggerEventHub::Release(TriggerEventHub* hub)
+{
+  std::lock_guard<std::mutex> lock(gHubMutex);
+  if(--hub->mReferenceCount == 0u)
+  {
+    bool dispatching;
+    {
+      std::lock_guard<std::mutex> slotLock(hub->mSlotMutex);
+      dispatching = hub->mDispatching;
+    }
+
+    // A hub released by one of its own callbacks is deleted at the end of the dispatch
+    if(!dispatching)
+    {
+      if(gHub == hub)
+      {
+        gHub = nullptr;
+      }
+      delete hub;
+    }
+  }
+}
+
+TriggerEventHub::TriggerEventHub(bool monitorFileDescriptor)
+: mWakeupPending(false),
+  mSlotCount(0u),
+  mDispatching(false),
+  mTriggerCount(0u),
+  mWakeupCount(0u),
+  mDispatchCount(0u),
+  mCallbackCount(0u),
+  mFileDescriptorMonitor(),
+  mFileDescriptor(-1),
+  mReferenceCount(0u)
+{
+  for(auto& page : mPendingPages)
+  {
+    page.store(nullptr, std::memory_order_relaxed);
+  }
+
+  mFileDescriptor = eventfd(0, EFD_NONBLOCK);
+  if(mFileDescriptor >= 0)
+  {
+    if(monitorFileDescriptor)
+    {
+      mFileDescriptorMonitor = Dali::Internal::Adaptor::GetSystemFactory()->CreateFileDescriptorMonitor(mFileDescriptor, MakeCallback(this, &TriggerEventHub::OnFileDescriptorEvent), FileDescriptorMonitor::FD_READABLE);
+    }
+  }
+  else
+  {
+    DALI_LOG_ERROR("Unable to create TriggerEventHub File descriptor\n");
+  }
+}
+
+TriggerEventHub::~TriggerEventHub()
+{
+  mFileDescriptorMonitor.reset();
+
+  if(mFileDescriptor >= 0)
+  {
+    close(mFileDescriptor);
+    mFileDescriptor = -1;
+  }
+
+  for(CallbackBase* callback : mCallbacks)
+  {
+    delete callback;
+  }
+  for(CallbackBase* callback : mReleasedCallbacks)
+  {
+    delete callback;
+  }
+  for(auto& page : mPendingPages)
+  {
+    delete[] page.load(std::memory_order_relaxed);
+  }
+}
+
+uint32_t TriggerEventHub::Register(CallbackBase* callback)
+{
+  std::lock_guard<std::mutex> lock(mSlotMutex);
+
+  uint32_t slot;
+  if(!mFreeSlots.empty())
+  {
+    slot = mFreeSlots.back();
+    mFreeSlots.pop_back();
+    mCallbacks[slot] = callback;
+  }
+  else
+  {
+    slot = mSlotCount++;
+    DALI_ASSERT_ALWAYS(slot < MAXIMUM_PAGES * SLOTS_PER_PAGE && "Too many trigger events");
+
+    if(slot % SLOTS_PER_PAGE == 0u)
+    {
+      // The page is published before the slot is given to the trigger, so any thread triggering it sees the page
+      std::atomic<uint64_t>* page = new std::atomic<uint64_t>[WORDS_PER_PAGE];
+      for(uint32_t i = 0u; i < WORDS_PER_PAGE; ++i)
+      {
+        page[i].store(0u, std::memory_order_relaxed);
+      }
+      mPendingPages[slot / SLOTS_PER_PAGE].store(page, std::memory_order_release);
+    }
+    mCallbacks.push_back(callback);
+  }
+  return slot;
+}
+
+void TriggerEventHub::Unregister(uint32_t slot)
+{
+  std::lock_guard<std::mutex> lock(mSlotMutex);
+
+  // Forget a pending trigger, so the slot can be reused by another trigger
+  GetPendingWord(slot).fetch_and(~GetSlotBit(slot));
+
+  CallbackBase* callback = mCallbacks[slot];
+  mCallbacks[slot]       = nullptr;
+
+  if(mDispatching)
+  {
+    // The callback may be running, and the slot may still be set in the bits being dispatched
+    mReleasedCallbacks.push_back(callback);
+    mReleasedSlots.push_back(slot);
+  }
+  else
+  {
+    delete callback;
+    mFreeSlots.push_back(slot);
+  }
+}
+
+void TriggerEventHub::Trigger(uint32_t slot)
+{
+  mTriggerCount.fetch_add(1u, std::memory_order_relaxed);
+
+  const uint64_t bit = GetSlotBit(slot);
+  if(GetPendingWord(slot).fetch_or(bit) & bit)
+  {
+    // Already pending, it will be dispatched by the wakeup it had
+    return;
+  }
+
+  // Only the first trigger after a dispatch wakes up the main loop
+  if(!mWakeupPending.exchange(true))
+  {
+    if(mFileDescriptor >= 0)
+    {
+      mWakeupCount.fetch_add(1u, std::memory_order_relaxed);
+
+      uint64_t data = 1;
+      int      size = write(mFileDescriptor, &data, sizeof(uint64_t));
+      if(size != sizeof(uint64_t))
+      {
+        DALI_LOG_ERROR("Unable to write to TriggerEventHub File descriptor\n");
+      }
+    }
+    else
+    {
+      DALI_LOG_WARNING("Attempting to write to an invalid file descriptor\n");
+    }
+  }
+}
+
+void TriggerEventHub::Dispatch()
+{
+  uint32_t pageCount;
+  {
+    std::lock_guard<std::mutex> lock(mSlotMutex);
+    mDispatching = true;
+    pageCount    = (mSlotCount + SLOTS_PER_PAGE - 1u) / SLOTS_PER_PAGE;
+  }
+
+  mDispatchCount.fetch_add(1u, std::memory_order_relaxed);
+
+  // Any trigger from now on must wake up the main loop again, as its bit may be set after it's been read
+  mWakeupPending.store(false);
+
+  for(uint32_t pageIndex = 0u; pageIndex < pageCount; ++pageIndex)
+  {
+    std::atomic<uint64_t>* page = mPendingPages[pageIndex].load(std::memory_order_acquire);
+    for(uint32_t wordIndex = 0u; wordIndex < WORDS_PER_PAGE; ++wordIndex)
+    {
+      if(page[wordIndex].load(std::memory_order_relaxed) == 0u)
+      {
+        continue;
+      }
+
+      uint64_t bits = page[wordIndex].exchange(0u);
+      while(bits)
+      {
+        const uint32_t slot = pageIndex * SLOTS_PER_PAGE + wordIndex * 64u + static_cast<uint32_t>(__builtin_ctzll(bits));
+        bits &= bits - 1u;
+
+        CallbackBase* callback;
+        {
+          // A previous callback may have unregistered this trigger
+          std::lock_guard<std::mutex> lock(mSlotMutex);
+          callback = mCallbacks[slot];
+        }
+        if(callback)
+        {
+          mCallbackCount.fetch_add(1u, std::memory_order_relaxed);
+          CallbackBase::Execute(*callback);
+        }
+      }
+    }
+  }
+
+  bool deleteHub = false;
+  {
+    std::lock_guard<std::mutex> hubLock(gHubMutex);
+    std::lock_guard<std::mutex> lock(mSlotMutex);
+    mDispatching = false;
+
+    for(CallbackBase* callback : mReleasedCallbacks)
+    {
+      delete callback;
+    }
+    mReleasedCallbacks.clear();
+    mFreeSlots.insert(mFreeSlots.end(), mReleasedSlots.begin(), mReleasedSlots.end());
+    mReleasedSlots.clear();
+
+    // The last trigger event has been destroyed by a callback
+    if(mReferenceCount == 0u && gHub == this)
+    {
+      gHub      = nullptr;
+      deleteHub = true;
+    }
+  }
+
+  if(deleteHub)
+  {
+    delete this;
+  }
+}
+
+TriggerEventHub::Statistics TriggerEventHub::GetStatistics() const
+{
+  Statistics statistics;
+  statistics.triggerCount  = mTriggerCount.load(std::memory_order_relaxed);
+  statistics.wakeupCount   = mWakeupCount.load(std::memory_order_relaxed);
+  statistics.dispatchCount = mDispatchCount.load(std::memory_order_relaxed);
+  statistics.callbackCount = mCallbackCount.load(std::memory_order_relaxed);
+  return statistics;
+}
+
+void TriggerEventHub::OnFileDescriptorEvent(FileDescriptorMonitor::EventType eventBitMask, int fileDescriptor)
+{
+  if(!(eventBitMask & FileDescriptorMonitor::FD_READABLE))
+  {
+    DALI_ASSERT_ALWAYS(0 && "Trigger event file descriptor error");
+    return;
+  }
+
+  // Reading from the file descriptor resets the event counter, we can ignore the count.
+  uint64_t receivedData;
+  size_t   size;
+  size = read(mFileDescriptor, &receivedData, sizeof(uint64_t));
+  if(size != sizeof(uint64_t))
+  {
+    DALI_LOG_WARNING("Unable to read to TriggerEventHub File descriptor\n");
+  }
+
+  Dispatch();
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,178 @@
+#ifndef DALI_INTERNAL_TRIGGER_EVENT_HUB_H
+#define DALI_INTERNAL_TRIGGER_EVENT_HUB_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <dali/public-api/signals/callback.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/file-descriptor-monitor.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+/**
+ * The TriggerEventHub multiplexes all the trigger events of the process over a single event file descriptor.
+ *
+ * Each trigger event gets a slot, i.e. a bit in a pending bitset. Triggering sets the bit, and only writes to the
+ * file descriptor if nothing was pending, so the triggers raised before the main loop wakes up are coalesced into
+ * one wakeup and one dispatch pass. Only one file descriptor is monitored by the main loop, whatever the number of
+ * trigger events.
+ *
+ * As with a file descriptor per trigger event, triggering an event several times before it is dispatched calls its
+ * callback once.
+ */
+class TriggerEventHub
+{
+public:
+  /**
+   * Counters, to measure how well the triggers are coalesced.
+   */
+  struct Statistics
+  {
+    uint64_t triggerCount{0u};  ///< The number of calls to Trigger()
+    uint64_t wakeupCount{0u};   ///< The number of writes to the file descriptor
+    uint64_t dispatchCount{0u}; ///< The number of dispatch passes
+    uint64_t callbackCount{0u}; ///< The number of callbacks executed
+  };
+
+  /**
+   * @brief Get the hub of the process, creating it if needed, and add a reference to it.
+   * @note The first call is expected on the main thread, as the file descriptor is monitored by the main loop.
+   * @return The hub
+   */
+  static TriggerEventHub* Acquire();
+
+  /**
+   * @brief Remove a reference to the hub of the process. The hub is destroyed with its last reference.
+   * @param[in] hub The hub returned by Acquire()
+   */
+  static void Release(TriggerEventHub* hub);
+
+  /**
+   * @brief Constructor.
+   * @param[in] monitorFileDescriptor Whether the main loop calls Dispatch() when the file descriptor is written to
+   */
+  explicit TriggerEventHub(bool monitorFileDescriptor);
+
+  /**
+   * @brief Destructor.
+   */
+  ~TriggerEventHub();
+
+  /**
+   * @brief Add a trigger.
+   * @param[in] callback The callback to call when the trigger is dispatched. The ownership is taken.
+   * @return The slot of the trigger
+   */
+  uint32_t Register(CallbackBase* callback);
+
+  /**
+   * @brief Remove a trigger. Its callback won't be called any more, even if it was pending.
+   * @param[in] slot The slot returned by Register()
+   */
+  void Unregister(uint32_t slot);
+
+  /**
+   * @brief Mark a trigger as pending, and wake up the main loop if nothing was pending.
+   *
+   * This can be called from any thread, and never blocks.
+   * @param[in] slot The slot returned by Register()
+   */
+  void Trigger(uint32_t slot);
+
+  /**
+   * @brief Call the callbacks of all the pending triggers.
+   *
+   * A callback may trigger, register or unregister any trigger, including its own.
+   */
+  void Dispatch();
+
+  /**
+   * @return The counters since the hub has been created
+   */
+  Statistics GetStatistics() const;
+
+  /**
+   * @return The file descriptor, or -1 if it couldn't be created
+   */
+  int GetFileDescriptor() const
+  {
+    return mFileDescriptor;
+  }
+
+  // Not copyable
+  TriggerEventHub(const TriggerEventHub&) = delete;
+  TriggerEventHub& operator=(const TriggerEventHub&) = delete;
+
+private:
+  /**
+   * @brief Called by the main loop when the file descriptor has been written to.
+   */
+  void OnFileDescriptorEvent(FileDescriptorMonitor::EventType eventBitMask, int fileDescriptor);
+
+  /**
+   * @brief Get the word of the pending bitset holding the bit of a slot.
+   */
+  std::atomic<uint64_t>& GetPendingWord(uint32_t slot)
+  {
+    return mPendingPages[slot / SLOTS_PER_PAGE].load(std::memory_order_acquire)[(slot % SLOTS_PER_PAGE) / 64u];
+  }
+
+private:
+  static constexpr uint32_t WORDS_PER_PAGE = 64u;
+  static constexpr uint32_t SLOTS_PER_PAGE = WORDS_PER_PAGE * 64u;
+  static constexpr uint32_t MAXIMUM_PAGES  = 64u;
+
+  std::atomic<std::atomic<uint64_t>*> mPendingPages[MAXIMUM_PAGES]; ///< The pending bitset, allocated a page at a time, so the bits never move
+  std::atomic<bool>                   mWakeupPending;               ///< Whether the file descriptor has been written to since the last dispatch
+
+  std::mutex                 mSlotMutex;         ///< Protects the slots, as triggers can be created and destroyed on any thread
+  std::vector<CallbackBase*> mCallbacks;         ///< The callback of each slot, nullptr if the slot is free
+  std::vector<uint32_t>      mFreeSlots;         ///< The slots which can be reused
+  std::vector<uint32_t>      mReleasedSlots;     ///< The slots unregistered during a dispatch, freed after it
+  std::vector<CallbackBase*> mReleasedCallbacks; ///< The callbacks unregistered during a dispatch, deleted after it
+  uint32_t                   mSlotCount;         ///< The number of slots used so far
+  bool                       mDispatching;       ///< Whether Dispatch() is running
+
+  std::atomic<uint64_t> mTriggerCount;
+  std::atomic<uint64_t> mWakeupCount;
+  std::atomic<uint64_t> mDispatchCount;
+  std::atomic<uint64_t> mCallbackCount;
+
+  std::unique_ptr<FileDescriptorMonitor> mFileDescriptorMonitor;
+  int                                    mFileDescriptor;
+  uint32_t                               mReferenceCount; ///< References taken with Acquire()
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TRIGGER_EVENT_HUB_H
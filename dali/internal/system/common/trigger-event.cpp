@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,14 +19,10 @@
 #include <dali/internal/system/common/trigger-event.h>
 
 // EXTERNAL INCLUDES
-#include <sys/eventfd.h>
-#include <unistd.h>
-
 #include <dali/integration-api/debug.h>
 
 // INTERNAL INCLUDES
-#include <dali/internal/system/common/file-descriptor-monitor.h>
-#include <dali/internal/system/common/system-factory.h>
+#include <dali/internal/system/common/trigger-event-hub.h>
 
 namespace Dali
 {
@@ -35,74 +31,32 @@ namespace Internal
 namespace Adaptor
 {
 TriggerEvent::TriggerEvent(CallbackBase* callback, TriggerEventInterface::Options options)
-: mFileDescriptorMonitor(),
+: mHub(TriggerEventHub::Acquire()),
   mCallback(callback),
-  mFileDescriptor(-1),
+  mSlot(0u),
   mOptions(options)
 {
-  // Create accompanying file descriptor.
-  mFileDescriptor = eventfd(0, EFD_NONBLOCK);
-  if(mFileDescriptor >= 0)
-  {
-    // Now Monitor the created event file descriptor
-    mFileDescriptorMonitor = Dali::Internal::Adaptor::GetSystemFactory()->CreateFileDescriptorMonitor(mFileDescriptor, MakeCallback(this, &TriggerEvent::Triggered), FileDescriptorMonitor::FD_READABLE);
-  }
-  else
-  {
-    DALI_LOG_ERROR("Unable to create TriggerEvent File descriptor\n");
-  }
+  // Share the event file descriptor of the hub, rather than creating and monitoring one per trigger event
+  mSlot = mHub->Register(MakeCallback(this, &TriggerEvent::Triggered));
 }
 
 TriggerEvent::~TriggerEvent()
 {
-  delete mCallback;
+  mHub->Unregister(mSlot);
+  TriggerEventHub::Release(mHub);
 
-  if(mFileDescriptor >= 0)
-  {
-    close(mFileDescriptor);
-    mFileDescriptor = 0;
-  }
+  delete mCallback;
 }
 
 void TriggerEvent::Trigger()
 {
-  if(mFileDescriptor >= 0)
-  {
-    // Increment event counter by 1.
-    // Writing to the file descriptor triggers the Dispatch() method in the other thread
-    // (if in multi-threaded environment).
-
-    uint64_t data = 1;
-    int      size = write(mFileDescriptor, &data, sizeof(uint64_t));
-
-    if(size != sizeof(uint64_t))
-    {
-      DALI_LOG_ERROR("Unable to write to UpdateEvent File descriptor\n");
-    }
-  }
-  else
-  {
-    DALI_LOG_WARNING("Attempting to write to an invalid file descriptor\n");
-  }
+  // Marks the event as pending. The first pending event writes to the file descriptor, which
+  // wakes up the main loop to dispatch all the pending events (if in multi-threaded environment).
+  mHub->Trigger(mSlot);
 }
 
-void TriggerEvent::Triggered(FileDescriptorMonitor::EventType eventBitMask, int fileDescriptor)
+void TriggerEvent::Triggered()
 {
-  if(!(eventBitMask & FileDescriptorMonitor::FD_READABLE))
-  {
-    DALI_ASSERT_ALWAYS(0 && "Trigger event file descriptor error");
-    return;
-  }
-
-  // Reading from the file descriptor resets the event counter, we can ignore the count.
-  uint64_t receivedData;
-  size_t   size;
-  size = read(mFileDescriptor, &receivedData, sizeof(uint64_t));
-  if(size != sizeof(uint64_t))
-  {
-    DALI_LOG_WARNING("Unable to read to UpdateEvent File descriptor\n");
-  }
-
   // Save value to prevent duplicate deletion
   TriggerEventInterface::Options options = mOptions;
 
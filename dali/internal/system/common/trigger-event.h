@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_TRIGGER_EVENT_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -20,11 +20,10 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/signals/callback.h>
-#include <memory>
+#include <cstdint>
 
 // INTERNAL INCLUDES
 #include <dali/integration-api/adaptor-framework/trigger-event-interface.h>
-#include <dali/internal/system/common/file-descriptor-monitor.h>
 #include <dali/public-api/dali-adaptor-common.h>
 
 namespace Dali
@@ -33,6 +32,8 @@ namespace Internal
 {
 namespace Adaptor
 {
+class TriggerEventHub;
+
 /**
  * The TriggerEvent class is used to send events between threads.  For example, this can be used
  * to wake up one thread from another thread.
@@ -41,15 +42,16 @@ namespace Adaptor
  *
  * The observer will be informed whenever the event is triggered.
  *
- * The implementation of TriggerEvent uses an event file descriptor.
+ * The implementation of TriggerEvent uses a slot of the TriggerEventHub, which multiplexes all the trigger
+ * events over a single event file descriptor.
  */
 class TriggerEvent : public TriggerEventInterface
 {
 public:
   /**
    * Constructor
-   * Creates an event file descriptor and starts a GSource which reads from the file
-   * descriptor when there is data.
+   * Registers the trigger event in the hub, which creates the event file descriptor monitored by
+   * the main loop if it is the first trigger event.
    *
    * @param[in] callback The callback to call
    * @param[in] options Trigger event options.
@@ -72,20 +74,15 @@ public:
 
 private:
   /**
-   * @brief Called when our event file descriptor has been written to.
-   * @param[in] eventBitMask bit mask of events that occured on the file descriptor
-   * @param[in] fileDescriptor The file descriptor
+   * @brief Called by the hub when the event has been triggered.
    */
-  void Triggered(FileDescriptorMonitor::EventType eventBitMask, int fileDescriptor);
-
-private:
-  struct Source;
+  void Triggered();
 
 private:
-  std::unique_ptr<FileDescriptorMonitor> mFileDescriptorMonitor;
-  CallbackBase*                          mCallback;
-  int                                    mFileDescriptor;
-  TriggerEventInterface::Options         mOptions;
+  TriggerEventHub*               mHub;
+  CallbackBase*                  mCallback;
+  uint32_t                       mSlot;
+  TriggerEventInterface::Options mOptions;
 };
 
 } // namespace Adaptor
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/worker-thread-pool.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/devel-api/adaptor-framework/thread-settings.h>
+#include <dali/integration-api/debug.h>
+#include <algorithm>
+#include <cstdlib>
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/environment-variables.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+namespace
+{
+constexpr uint32_t MAXIMUM_WORKER_COUNT = 4u;
+
+uint32_t GetWorkerCountFromEnvironment()
+{
+  auto workerCountString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_WORKER_THREAD_POOL_SIZE);
+  if(workerCountString)
+  {
+    return std::min(static_cast<uint32_t>(std::strtoul(workerCountString, nullptr, 10)), MAXIMUM_WORKER_COUNT);
+  }
+
+  // The calling thread works too.
+  const uint32_t concurrency = std::max(1u, std::thread::hardware_concurrency());
+  return std::min(concurrency - 1u, MAXIMUM_WORKER_COUNT);
+}
+
+} // namespace
+
+struct WorkerThreadPool::Job
+{
+  PartFunction function;
+  uint32_t     partCount{0u};
+  uint32_t     nextPart{0u};       ///< The next part to start
+  uint32_t     completedParts{0u}; ///< The number of parts which have run
+};
+
+WorkerThreadPool& WorkerThreadPool::Get()
+{
+  // Never destroyed, as a static object may use it while the others are destroyed on exit.
+  static WorkerThreadPool* pool = new WorkerThreadPool();
+  return *pool;
+}
+
+WorkerThreadPool::WorkerThreadPool()
+: mWorkerCount(GetWorkerCountFromEnvironment())
+{
+}
+
+void WorkerThreadPool::Run(uint32_t partCount, const PartFunction& function)
+{
+  if(partCount == 0u)
+  {
+    return;
+  }
+
+  if(partCount == 1u || mWorkerCount == 0u)
+  {
+    for(uint32_t index = 0u; index < partCount; ++index)
+    {
+      function(index);
+    }
+    return;
+  }
+
+  // The function is only called before Run() returns, it doesn't need to be copied.
+  auto job       = std::make_shared<Job>();
+  job->function  = [&function](uint32_t index) { function(index); };
+  job->partCount = partCount;
+
+  std::unique_lock<std::mutex> lock(mMutex);
+  StartThreads();
+  mJobs.push_back(job);
+  mJobCondition.notify_all();
+
+  while(job->nextPart < job->partCount)
+  {
+    RunPart(lock, job);
+  }
+  mCompletedCondition.wait(lock, [&job]() { return job->completedParts == job->partCount; });
+}
+
+WorkerThreadPool::JobPtr WorkerThreadPool::Submit(uint32_t partCount, PartFunction function)
+{
+  auto job       = std::make_shared<Job>();
+  job->function  = std::move(function);
+  job->partCount = partCount;
+
+  if(partCount > 0u && mWorkerCount > 0u)
+  {
+    std::lock_guard<std::mutex> lock(mMutex);
+    StartThreads();
+    mJobs.push_front(job);
+    mJobCondition.notify_all();
+  }
+  return job;
+}
+
+void WorkerThreadPool::Wait(const JobPtr& job)
+{
+  if(!job)
+  {
+    return;
+  }
+
+  if(mWorkerCount == 0u)
+  {
+    // Nothing has been queued.
+    while(job->nextPart < job->partCount)
+    {
+      job->function(job->nextPart++);
+    }
+    job->completedParts = job->partCount;
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(mMutex);
+  mCompletedCondition.wait(lock, [&job]() { return job->completedParts == job->partCount; });
+}
+
+void WorkerThreadPool::StartThreads()
+{
+  if(mThreads.empty())
+  {
+    DALI_LOG_RELEASE_INFO("WorkerThreadPool starts %u threads\n", mWorkerCount);
+    for(uint32_t i = 0u; i < mWorkerCount; ++i)
+    {
+      mThreads.emplace_back(&WorkerThreadPool::WorkerLoop, this);
+    }
+  }
+}
+
+void WorkerThreadPool::RunPart(std::unique_lock<std::mutex>& lock, const JobPtr& job)
+{
+  const uint32_t index = job->nextPart++;
+  if(job->nextPart == job->partCount)
+  {
+    // Every part has started, no thread takes the job any more.
+    mJobs.erase(std::find(mJobs.begin(), mJobs.end(), job));
+  }
+
+  lock.unlock();
+  job->function(index);
+  lock.lock();
+
+  if(++job->completedParts == job->partCount)
+  {
+    mCompletedCondition.notify_all();
+  }
+}
+
+void WorkerThreadPool::WorkerLoop()
+{
+  SetThreadName("DaliWorkerPool");
+
+  std::unique_lock<std::mutex> lock(mMutex);
+  while(true)
+  {
+    mJobCondition.wait(lock, [this]() { return !mJobs.empty(); });
+
+    // Keep a reference, as the job leaves the queue when its last part starts.
+    JobPtr job = mJobs.front();
+    RunPart(lock, job);
+  }
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
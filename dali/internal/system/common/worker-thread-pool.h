@@ -0,0 +1,144 @@
+#ifndef DALI_INTERNAL_SYSTEM_COMMON_WORKER_THREAD_POOL_H
+#define DALI_INTERNAL_SYSTEM_COMMON_WORKER_THREAD_POOL_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+/**
+ * @brief A process wide pool of persistent threads, which run the independent parts of a job,
+ * e.g. the bands of an image.
+ *
+ * The number of threads is bounded, so the callers of every thread (event, render, async task
+ * workers) share the same workers instead of spawning their own. The pool doesn't depend on the
+ * adaptor, and can be used by any thread.
+ *
+ * A caller of Run() takes parts of its own job too, so it never waits for a busy pool and
+ * the jobs can't deadlock, even when called from a worker.
+ */
+class WorkerThreadPool
+{
+public:
+  /**
+   * @brief The function running a part of a job.
+   * @param[in] index The index of the part, from 0 to the number of parts - 1
+   */
+  using PartFunction = std::function<void(uint32_t index)>;
+
+  struct Job;
+  using JobPtr = std::shared_ptr<Job>;
+
+  /**
+   * @brief Get the pool of the process. The threads are started on first use.
+   * @return The pool
+   */
+  static WorkerThreadPool& Get();
+
+  /**
+   * @brief Get the number of worker threads.
+   * @return The number of threads, zero on a single core
+   */
+  uint32_t GetWorkerCount() const
+  {
+    return mWorkerCount;
+  }
+
+  /**
+   * @brief Run all the parts of a job, on the workers and the calling thread.
+   *
+   * @param[in] partCount The number of parts
+   * @param[in] function The function running a part. It is not used once Run() returns.
+   */
+  void Run(uint32_t partCount, const PartFunction& function);
+
+  /**
+   * @brief Start running the parts of a job on the workers only, so the calling thread can do something else.
+   *
+   * The job is queued before the ones of Run(), as the caller waits for it without helping.
+   * @param[in] partCount The number of parts
+   * @param[in] function The function running a part
+   * @return The job, to wait for
+   */
+  JobPtr Submit(uint32_t partCount, PartFunction function);
+
+  /**
+   * @brief Wait until all the parts of a submitted job have run.
+   *
+   * If the pool has no worker, the parts are run by the calling thread.
+   * @param[in] job The job returned by Submit()
+   */
+  void Wait(const JobPtr& job);
+
+  // Not copyable
+  WorkerThreadPool(const WorkerThreadPool&) = delete;
+  WorkerThreadPool& operator=(const WorkerThreadPool&) = delete;
+
+private:
+  /**
+   * @brief Constructor.
+   */
+  WorkerThreadPool();
+
+  /**
+   * @brief Start the threads, if not done yet.
+   * @note The caller holds the mutex.
+   */
+  void StartThreads();
+
+  /**
+   * @brief Run the next part of a job. The part is removed from the queue before it runs.
+   * @param[in] lock The lock of the mutex, released while the part runs
+   * @param[in] job The job
+   */
+  void RunPart(std::unique_lock<std::mutex>& lock, const JobPtr& job);
+
+  /**
+   * @brief The loop of a worker thread.
+   */
+  void WorkerLoop();
+
+private:
+  std::vector<std::thread> mThreads;
+  std::deque<JobPtr>       mJobs;               ///< The jobs with parts not started yet
+  std::mutex               mMutex;              ///< Guards the queue and the state of the jobs
+  std::condition_variable  mJobCondition;       ///< Signaled when a job is queued
+  std::condition_variable  mCompletedCondition; ///< Signaled when the last part of a job has run
+  uint32_t                 mWorkerCount{0u};
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_SYSTEM_COMMON_WORKER_THREAD_POOL_H
@@ -168,9 +168,8 @@ bool Capture::OnTimeOut()
   return false;
 }
 
-bool Capture::SaveFile()
+void Capture::OnFileSaved(const std::string& path, bool succeeded)
 {
-  return false;
 }
 
 } // End of namespace Adaptor
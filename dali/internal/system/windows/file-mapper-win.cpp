@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// CLASS HEADER
+#include <dali/internal/system/common/file-mapper.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Platform
+{
+// Files are not mapped on Windows. The image loaders read them instead.
+
+FileMapper::~FileMapper() = default;
+
+bool FileMapper::Map(const char* /*filename*/)
+{
+  return false;
+}
+
+bool FileMapper::Map(FILE* /*file*/)
+{
+  return false;
+}
+
+void FileMapper::Unmap()
+{
+}
+
+bool FileMapper::IsTruncated() const
+{
+  return false;
+}
+
+bool FileMapper::MapFileDescriptor(int /*fileDescriptor*/)
+{
+  return false;
+}
+
+} // namespace Platform
+} // namespace Internal
+} // namespace Dali
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -98,7 +98,8 @@ bool gFontPreLoadAvailable  = true;
 FontClient::FontClient()
 : mPlugin(nullptr),
   mDpiHorizontal(0),
-  mDpiVertical(0)
+  mDpiVertical(0),
+  mCacheGeneration(0u)
 {
 }
 
@@ -329,6 +330,7 @@ void FontClient::JoinFontThreads()
 
 void FontClient::ClearCache()
 {
+  ++mCacheGeneration;
   if(mPlugin)
   {
     mPlugin->ClearCache();
@@ -337,6 +339,7 @@ void FontClient::ClearCache()
 
 void FontClient::ClearCacheOnLocaleChanged()
 {
+  ++mCacheGeneration;
   if(mPlugin)
   {
     mPlugin->ClearCacheOnLocaleChanged();
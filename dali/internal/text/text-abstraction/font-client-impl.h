@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_TEXT_ABSTRACTION_FONT_CLIENT_IMPL_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -102,6 +102,18 @@ public: // API for Dali::TextAbstraction::FontClient used.
    */
   void ClearCacheOnLocaleChanged();
 
+  /**
+   * @brief Retrieves the number of times the cache has been cleared.
+   *
+   * Caches of data derived from the font ids, e.g. the shaping results, are invalid when it changes.
+   *
+   * @return The generation of the cache.
+   */
+  uint32_t GetCacheGeneration() const
+  {
+    return mCacheGeneration;
+  }
+
   /**
    * @copydoc Dali::TextAbstraction::FontClient::SetDpi()
    */
@@ -371,6 +383,8 @@ private:
   unsigned int mDpiHorizontal;
   unsigned int mDpiVertical;
 
+  uint32_t mCacheGeneration; ///< Increased every time the cache is cleared.
+
   static Dali::TextAbstraction::FontClient gPreCreatedFontClient;
 
 }; // class FontClient
@@ -105,6 +105,24 @@ inline size_t GetMaxNumberOfGlyphCache()
   return (number < MINIMUM_SIZE_OF_GLYPH_CACHE_MAX) ? MINIMUM_SIZE_OF_GLYPH_CACHE_MAX : number;
 }
 
+/**
+ * @brief Maximum size, in bytes, of the bitmaps of the glyphs rendered at the mip levels.
+ */
+constexpr std::size_t DEFAULT_MIP_GLYPH_CACHE_MAX_BYTES = 4u * 1024u * 1024u;
+
+/**
+ * @brief Get maximum size of the bitmaps of the glyphs rendered at the mip levels from environment.
+ * If not settuped, default as 4MB.
+ * @note This value fixed when we call it first time.
+ * @return The max size of the mip level cache, in bytes.
+ */
+inline size_t GetMaxMipGlyphCacheBytes()
+{
+  static auto numberString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_GLYPH_MIP_LEVEL_CACHE_MAX_BYTES);
+  static auto number       = numberString ? std::strtoul(numberString, nullptr, 10) : DEFAULT_MIP_GLYPH_CACHE_MAX_BYTES;
+  return number;
+}
+
 } // namespace
 
 namespace Dali::TextAbstraction::Internal
@@ -295,7 +313,7 @@ FontClient::Plugin::CacheHandler::CacheHandler()
   mFontFTFaceCache(),
   mEllipsisCache(),
   mEmbeddedItemCache(),
-  mGlyphCacheManager(new GlyphCacheManager(GetMaxNumberOfGlyphCache())),
+  mGlyphCacheManager(new GlyphCacheManager(GetMaxNumberOfGlyphCache(), GetMaxMipGlyphCacheBytes())),
   mLatestFoundFontDescription(),
   mLatestFoundFontDescriptionId(0u),
   mLatestFoundCacheKey(0, 0),
@@ -86,6 +86,43 @@ inline GlyphCacheManager::CompressionPolicyType GetRenderedGlyphCompressPolicy()
                                     : DEFAULT_RENDERED_GLYPH_COMPRESS_POLICY;
   return policy;
 }
+
+/**
+ * @brief Behavior about resample the glyphs from the mip levels rendered for all the point sizes, instead of render them.
+ */
+constexpr bool DEFAULT_ENABLE_GLYPH_MIP_LEVELS = false;
+
+/**
+ * @brief Get whether we allow to resample the glyphs from the mip levels from environment.
+ * If not settuped, default as false.
+ * @note This value fixed when we call it first time.
+ * @return True if we allow to resample the glyphs.
+ */
+inline bool EnableGlyphMipLevels()
+{
+  static auto numberString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_ENABLE_GLYPH_MIP_LEVELS);
+  static auto number       = numberString ? (std::strtoul(numberString, nullptr, 10) ? true : false) : DEFAULT_ENABLE_GLYPH_MIP_LEVELS;
+  return number;
+}
+
+/**
+ * @brief The minimum scale factor between the requested size and the mip level the glyph is resampled from.
+ * The mip levels are half an octave apart, so the default allows to resample all the sizes between them.
+ */
+constexpr float DEFAULT_GLYPH_MIP_LEVEL_QUALITY_THRESHOLD = 0.7f;
+
+/**
+ * @brief Get the quality threshold of the glyphs resampled from the mip levels from environment.
+ * If not settuped, default value used, as defined above.
+ * @note This value fixed when we call it first time.
+ * @return The minimum scale factor, in (0, 1].
+ */
+inline float GetGlyphMipLevelQualityThreshold()
+{
+  static auto thresholdString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_GLYPH_MIP_LEVEL_QUALITY_THRESHOLD);
+  static auto threshold       = thresholdString ? std::strtof(thresholdString, nullptr) : DEFAULT_GLYPH_MIP_LEVEL_QUALITY_THRESHOLD;
+  return threshold;
+}
 } // namespace
 
 FontFaceCacheItem::FontFaceCacheItem(const FT_Library&  freeTypeLibrary,
@@ -413,6 +450,7 @@ void FontFaceCacheItem::CreateBitmap(
         {
           // Copy new glyph, and keep original cached glyph.
           error = FT_Glyph_To_Bitmap(&glyph, FT_RENDER_MODE_NORMAL, 0, 0);
+          GlyphCacheManager::IncreaseFreeTypeRenderCount();
           if(FT_Err_Ok == error)
           {
             FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyph);
@@ -459,6 +497,7 @@ void FontFaceCacheItem::CreateBitmap(
       const bool ableUseCachedRenderedGlyph = EnableCacheRenderedGlyph() && !isOutlineGlyph && !isShearRequired;
 
       // If we cache rendered glyph, and if we can use it, use cached thing first.
+      FT_Bitmap mipBitmap;
       if(ableUseCachedRenderedGlyph && glyphData.mRenderedBuffer)
       {
         data.buffer          = glyphData.mRenderedBuffer->buffer;
@@ -468,11 +507,43 @@ void FontFaceCacheItem::CreateBitmap(
         data.compressionType = glyphData.mRenderedBuffer->compressionType;
         data.isBufferOwned   = false;
       }
+      else if(!isOutlineGlyph && glyph->format == FT_GLYPH_FORMAT_OUTLINE && EnableGlyphMipLevels() &&
+              mGlyphCacheManager->CreateBitmapFromMipLevel(mFreeTypeFace, mPath, mFaceIndex, glyphIndex, loadFlag, isBoldRequired, GetGlyphMipLevelQualityThreshold(), mipBitmap))
+      {
+        // Resampled from the glyph rendered at a bigger size. Cache it as if it was rendered.
+        if(ableUseCachedRenderedGlyph)
+        {
+          mGlyphCacheManager->CacheRenderedGlyphBuffer(mFreeTypeFace, glyphIndex, loadFlag, isBoldRequired, mipBitmap, GetRenderedGlyphCompressPolicy());
+
+          GlyphCacheManager::GlyphCacheDataPtr dummyDataPtr;
+          mGlyphCacheManager->GetGlyphCacheDataFromIndex(mFreeTypeFace, glyphIndex, loadFlag, isBoldRequired, dummyDataPtr, error);
+
+          if(DALI_LIKELY(FT_Err_Ok == error && dummyDataPtr->mRenderedBuffer))
+          {
+            data.buffer          = dummyDataPtr->mRenderedBuffer->buffer;
+            data.width           = dummyDataPtr->mRenderedBuffer->width;
+            data.height          = dummyDataPtr->mRenderedBuffer->height;
+            data.format          = dummyDataPtr->mRenderedBuffer->format;
+            data.compressionType = dummyDataPtr->mRenderedBuffer->compressionType;
+            data.isBufferOwned   = false;
+
+            free(mipBitmap.buffer);
+            mipBitmap.buffer = nullptr;
+          }
+        }
+
+        if(mipBitmap.buffer)
+        {
+          // Move bitmap buffer into data.buffer
+          ConvertBitmap(data, mipBitmap, isShearRequired, true);
+        }
+      }
       else
       {
         // Copy new glyph, and keep original cached glyph.
         // If we already copy new glyph by stroke, just re-use that.
         error = FT_Glyph_To_Bitmap(&glyph, FT_RENDER_MODE_NORMAL, 0, isStrokeGlyphSuccess);
+        GlyphCacheManager::IncreaseFreeTypeRenderCount();
         if(FT_Err_Ok == error)
         {
           FT_BitmapGlyph bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyph);
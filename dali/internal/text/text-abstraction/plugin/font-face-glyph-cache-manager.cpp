@@ -23,6 +23,9 @@
 #include <dali/internal/text/text-abstraction/plugin/font-client-utils.h>
 
 // EXTERNAL INCLUDES
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include FT_BITMAP_H
 
 #if defined(DEBUG_ENABLED)
@@ -34,13 +37,43 @@ namespace Dali::TextAbstraction::Internal
 namespace
 {
 constexpr uint32_t THRESHOLD_WIDTH_FOR_RLE4_COMPRESSION = 8; // The smallest width of glyph that we use RLE4 method.
+
+/**
+ * @brief The pixel sizes of the mip levels. Each level is half an octave bigger than the previous one.
+ */
+constexpr uint32_t MIP_LEVEL_PIXEL_SIZES[] = {16u, 23u, 32u, 45u, 64u, 91u, 128u, 181u, 256u};
+
+/**
+ * @brief Get the smallest mip level not smaller than the pixel size.
+ * @param[in] pixelSize The pixel size.
+ * @return The pixel size of the mip level, or zero if the pixel size is bigger than the biggest level.
+ */
+uint32_t GetMipLevelPixelSize(uint32_t pixelSize)
+{
+  for(const auto levelPixelSize : MIP_LEVEL_PIXEL_SIZES)
+  {
+    if(pixelSize <= levelPixelSize)
+    {
+      return levelPixelSize;
+    }
+  }
+  return 0u;
+}
+
+/**
+ * @brief The number of glyphs rendered to a bitmap by FreeType in the process.
+ */
+std::atomic<uint32_t> gFreeTypeRenderCount{0u};
 } // namespace
 
-GlyphCacheManager::GlyphCacheManager(std::size_t maxNumberOfGlyphCache)
+GlyphCacheManager::GlyphCacheManager(std::size_t maxNumberOfGlyphCache, std::size_t maxMipGlyphCacheBytes)
 : mGlyphCacheMaxSize(maxNumberOfGlyphCache),
-  mLRUGlyphCache(mGlyphCacheMaxSize)
+  mLRUGlyphCache(mGlyphCacheMaxSize),
+  mLRUMipGlyphCache(mGlyphCacheMaxSize),
+  mMipGlyphCacheMaxBytes(maxMipGlyphCacheBytes),
+  mMipGlyphCacheBytes(0u)
 {
-  DALI_LOG_INFO(gFontClientLogFilter, Debug::Verbose, "FontClient::Plugin::GlyphCacheManager Create with maximum size : %d\n", static_cast<int>(mGlyphCacheMaxSize));
+  DALI_LOG_INFO(gFontClientLogFilter, Debug::Verbose, "FontClient::Plugin::GlyphCacheManager Create with maximum size : %d, mip levels : %zu bytes\n", static_cast<int>(mGlyphCacheMaxSize), mMipGlyphCacheMaxBytes);
 }
 
 GlyphCacheManager::~GlyphCacheManager()
@@ -443,6 +476,8 @@ void GlyphCacheManager::ClearCache(const std::size_t remainCount)
   {
     // Clear all cache.
     mLRUGlyphCache.Clear();
+    mLRUMipGlyphCache.Clear();
+    mMipGlyphCacheBytes = 0u;
   }
   else
   {
@@ -453,7 +488,180 @@ void GlyphCacheManager::ClearCache(const std::size_t remainCount)
 
       DALI_LOG_INFO(gFontClientLogFilter, Debug::Verbose, "FontClient::Plugin::GlyphCacheManager::ClearCache[%zu / %zu]. Remove oldest cache for glyph : %p\n", mLRUGlyphCache.Count(), remainCount, removedData->mGlyph);
     }
+    while(mLRUMipGlyphCache.Count() > remainCount)
+    {
+      mMipGlyphCacheBytes -= mLRUMipGlyphCache.Pop()->mBuffer.size();
+    }
+  }
+}
+
+bool GlyphCacheManager::CreateBitmapFromMipLevel(
+  const FT_Face      freeTypeFace,
+  const std::string& path,
+  const FaceIndex    faceIndex,
+  const GlyphIndex   index,
+  const FT_Int32     flag,
+  const bool         isBoldRequired,
+  const float        qualityThreshold,
+  FT_Bitmap&         bitmap)
+{
+  if(DALI_UNLIKELY(!freeTypeFace->size || !FT_IS_SCALABLE(freeTypeFace)))
+  {
+    return false;
+  }
+
+  const uint32_t pixelSize      = freeTypeFace->size->metrics.y_ppem;
+  const uint32_t levelPixelSize = GetMipLevelPixelSize(pixelSize);
+  if(pixelSize == 0u || pixelSize == levelPixelSize || pixelSize < MIP_LEVEL_PIXEL_SIZES[0u] || levelPixelSize == 0u)
+  {
+    // Render the glyph at its own size. Small glyphs are cheap to render and sensitive to the hinting.
+    return false;
+  }
+
+  const float scale = static_cast<float>(pixelSize) / static_cast<float>(levelPixelSize);
+  if(scale < qualityThreshold)
+  {
+    return false;
+  }
+
+  // Get the id of the font file. All the point sizes of the same font file and face share the mip levels.
+  const std::string fontFileKey = path + '#' + std::to_string(faceIndex);
+  auto              idIter      = mMipFontFileIds.find(fontFileKey);
+  if(idIter == mMipFontFileIds.end())
+  {
+    idIter = mMipFontFileIds.insert({fontFileKey, static_cast<uint32_t>(mMipFontFileIds.size())}).first;
+  }
+
+  const MipGlyphKey key{idIter->second, index, flag, levelPixelSize, isBoldRequired};
+
+  MipGlyphDataPtr mipGlyphPtr;
+  auto            iter = mLRUMipGlyphCache.Find(key);
+  if(iter == mLRUMipGlyphCache.End())
+  {
+    mipGlyphPtr = RenderMipGlyph(freeTypeFace, index, flag, isBoldRequired, levelPixelSize);
+    if(!mipGlyphPtr)
+    {
+      return false;
+    }
+
+    // Bound the cache by the size of the bitmaps too, as a bitmap of the biggest level is 256 times bigger than one of the smallest.
+    // A bitmap bigger than the whole cache is used once and not cached.
+    const std::size_t mipGlyphBytes = mipGlyphPtr->mBuffer.size();
+    if(mipGlyphBytes <= mMipGlyphCacheMaxBytes)
+    {
+      while(mLRUMipGlyphCache.IsFull() || mMipGlyphCacheBytes + mipGlyphBytes > mMipGlyphCacheMaxBytes)
+      {
+        mMipGlyphCacheBytes -= mLRUMipGlyphCache.Pop()->mBuffer.size();
+      }
+      mLRUMipGlyphCache.Push(key, mipGlyphPtr);
+      mMipGlyphCacheBytes += mipGlyphBytes;
+    }
+  }
+  else
+  {
+    mipGlyphPtr = mLRUMipGlyphCache.Get(key);
   }
+
+  const MipGlyphData& mipGlyph = *mipGlyphPtr.get();
+  if(mipGlyph.mWidth == 0u || mipGlyph.mHeight == 0u)
+  {
+    return false;
+  }
+
+  const uint32_t desiredWidth  = std::max(1u, static_cast<uint32_t>(std::round(static_cast<float>(mipGlyph.mWidth) * scale)));
+  const uint32_t desiredHeight = std::max(1u, static_cast<uint32_t>(std::round(static_cast<float>(mipGlyph.mHeight) * scale)));
+
+  uint8_t* desiredBuffer = (uint8_t*)malloc(desiredWidth * desiredHeight * sizeof(uint8_t)); // @note The caller is responsible for deallocating the bitmap data using free.
+  if(DALI_UNLIKELY(!desiredBuffer))
+  {
+    DALI_LOG_ERROR("malloc is failed. request malloc size : %u x %u x 1\n", desiredWidth, desiredHeight);
+    return false;
+  }
+
+  Dali::Internal::Platform::LanczosSample1BPP(mipGlyph.mBuffer.data(),
+                                              ImageDimensions(mipGlyph.mWidth, mipGlyph.mHeight),
+                                              mipGlyph.mWidth,
+                                              desiredBuffer,
+                                              ImageDimensions(desiredWidth, desiredHeight));
+
+  bitmap            = FT_Bitmap();
+  bitmap.buffer     = desiredBuffer;
+  bitmap.width      = desiredWidth;
+  bitmap.rows       = desiredHeight;
+  bitmap.pitch      = static_cast<int>(desiredWidth);
+  bitmap.num_grays  = 256;
+  bitmap.pixel_mode = FT_PIXEL_MODE_GRAY;
+
+  DALI_LOG_INFO(gFontClientLogFilter, Debug::Verbose, "FontClient::Plugin::GlyphCacheManager::CreateBitmapFromMipLevel. Resample glyph index : %u from pixel size %u to %u\n", index, levelPixelSize, pixelSize);
+  return true;
+}
+
+GlyphCacheManager::MipGlyphDataPtr GlyphCacheManager::RenderMipGlyph(
+  const FT_Face    freeTypeFace,
+  const GlyphIndex index,
+  const FT_Int32   flag,
+  const bool       isBoldRequired,
+  const uint32_t   pixelSize)
+{
+  // Render with another size object, so the size of the face used by the font client doesn't change.
+  FT_Size originalSize = freeTypeFace->size;
+  FT_Size mipSize      = nullptr;
+  if(FT_Err_Ok != FT_New_Size(freeTypeFace, &mipSize))
+  {
+    return nullptr;
+  }
+
+  MipGlyphDataPtr mipGlyphPtr;
+
+  FT_Error error = FT_Activate_Size(mipSize);
+  if(FT_Err_Ok == error)
+  {
+    error = FT_Set_Pixel_Sizes(freeTypeFace, 0u, pixelSize);
+  }
+  if(FT_Err_Ok == error)
+  {
+    error = FT_Load_Glyph(freeTypeFace, index, flag);
+  }
+  if(FT_Err_Ok == error && freeTypeFace->glyph->format == FT_GLYPH_FORMAT_OUTLINE)
+  {
+    if(isBoldRequired && !(freeTypeFace->style_flags & FT_STYLE_FLAG_BOLD))
+    {
+      // Does the software bold.
+      FT_GlyphSlot_Embolden(freeTypeFace->glyph);
+    }
+
+    error = FT_Render_Glyph(freeTypeFace->glyph, FT_RENDER_MODE_NORMAL);
+    IncreaseFreeTypeRenderCount();
+
+    const FT_Bitmap& srcBitmap = freeTypeFace->glyph->bitmap;
+    if(FT_Err_Ok == error && srcBitmap.pixel_mode == FT_PIXEL_MODE_GRAY && srcBitmap.pitch >= static_cast<int>(srcBitmap.width))
+    {
+      mipGlyphPtr          = std::make_shared<MipGlyphData>();
+      mipGlyphPtr->mWidth  = srcBitmap.width;
+      mipGlyphPtr->mHeight = srcBitmap.rows;
+      mipGlyphPtr->mBuffer.resize(static_cast<size_t>(srcBitmap.width) * static_cast<size_t>(srcBitmap.rows));
+      for(uint32_t row = 0u; row < srcBitmap.rows; ++row)
+      {
+        memcpy(mipGlyphPtr->mBuffer.data() + row * srcBitmap.width, srcBitmap.buffer + row * srcBitmap.pitch, srcBitmap.width);
+      }
+    }
+  }
+
+  FT_Activate_Size(originalSize);
+  FT_Done_Size(mipSize);
+
+  DALI_LOG_INFO(gFontClientLogFilter, Debug::Verbose, "FontClient::Plugin::GlyphCacheManager::RenderMipGlyph. Render glyph index : %u at pixel size %u, error : %d\n", index, pixelSize, error);
+  return mipGlyphPtr;
+}
+
+void GlyphCacheManager::IncreaseFreeTypeRenderCount()
+{
+  gFreeTypeRenderCount.fetch_add(1u, std::memory_order_relaxed);
+}
+
+uint32_t GlyphCacheManager::GetFreeTypeRenderCount()
+{
+  return gFreeTypeRenderCount.load(std::memory_order_relaxed);
 }
 
 // GlyphCacheManager::GlyphCacheData
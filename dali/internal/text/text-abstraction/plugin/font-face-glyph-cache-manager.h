@@ -2,7 +2,7 @@
 #define DALI_TEST_ABSTRACTION_INTERNAL_FONT_FACE_GLYPH_CACHE_MANAGER_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -24,6 +24,8 @@
 
 // EXTERNAL INCLUDES
 #include <memory> // for std::shared_ptr
+#include <string>
+#include <unordered_map>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
@@ -38,7 +40,7 @@ class GlyphCacheManager
 {
 public:
   // Constructor
-  GlyphCacheManager(std::size_t maxNumberOfGlyphCache);
+  GlyphCacheManager(std::size_t maxNumberOfGlyphCache, std::size_t maxMipGlyphCacheBytes);
 
   // Destructor
   ~GlyphCacheManager();
@@ -188,6 +190,50 @@ public:
    */
   void ClearCache(const std::size_t remainCount = 0u);
 
+  /**
+   * @brief Create the bitmap of a glyph by resampling a rendering of the same glyph at a bigger size, instead of rendering it.
+   *
+   * The glyphs are rendered once per mip level, a pixel size of the half-octave ladder 16, 23, 32, 45, 64...
+   * and shared by all the point sizes of the same font file and face, so a font-size animation renders
+   * each glyph only for a few levels. The rendering of a level is cached.
+   *
+   * @note The bitmap of a size not smaller than the lowest level isn't resampled, as well as the one of a
+   * size which would be downscaled more than the quality threshold allows.
+   *
+   * @param[in] freeTypeFace The freetype face handle. Its current size is the requested size.
+   * @param[in] path The path of the font file of the face.
+   * @param[in] faceIndex The index of the face in the font file.
+   * @param[in] index Index of glyph in this face.
+   * @param[in] flag Flag when we load the glyph.
+   * @param[in] isBoldRequired True if we require some software bold.
+   * @param[in] qualityThreshold The minimum scale factor between the requested size and the mip level, in (0, 1].
+   * @param[out] bitmap The 8 bit gray bitmap of the glyph. The caller is responsible for deallocating the buffer using free.
+   * @return True if the bitmap has been created. False if the glyph should be rendered.
+   */
+  bool CreateBitmapFromMipLevel(
+    const FT_Face      freeTypeFace,
+    const std::string& path,
+    const FaceIndex    faceIndex,
+    const GlyphIndex   index,
+    const FT_Int32     flag,
+    const bool         isBoldRequired,
+    const float        qualityThreshold,
+    FT_Bitmap&         bitmap);
+
+  /**
+   * @brief Count a glyph rendered to a bitmap by FreeType.
+   * @note Called by every glyph cache manager and font face of the process.
+   */
+  static void IncreaseFreeTypeRenderCount();
+
+  /**
+   * @brief Get the number of glyphs rendered to a bitmap by FreeType in the process.
+   *
+   * The glyphs resampled from a mip level aren't counted, only the renderings of the levels are.
+   * @return The number of renderings.
+   */
+  static uint32_t GetFreeTypeRenderCount();
+
 private:
   // Private struct area.
   /**
@@ -236,13 +282,80 @@ private:
     }
   };
 
+  /**
+   * @brief Key of glyph rendered at a mip level.
+   */
+  struct MipGlyphKey
+  {
+    uint32_t   mFontFileId; ///< The id of the pair of font file path and face index.
+    GlyphIndex mIndex;
+    FT_Int32   mFlag;
+    uint32_t   mPixelSize;
+    bool       mIsBoldRequired;
+
+    bool operator==(MipGlyphKey const& rhs) const noexcept
+    {
+      return mFontFileId == rhs.mFontFileId && mIndex == rhs.mIndex && mFlag == rhs.mFlag && mPixelSize == rhs.mPixelSize && mIsBoldRequired == rhs.mIsBoldRequired;
+    }
+  };
+
+  /**
+   * @brief Hash function of MipGlyphKey.
+   */
+  struct MipGlyphKeyHash
+  {
+    std::size_t operator()(MipGlyphKey const& key) const noexcept
+    {
+      return (static_cast<std::size_t>(key.mFontFileId) << 20) ^
+             static_cast<std::size_t>(key.mIndex) ^
+             (static_cast<std::size_t>(key.mPixelSize) << 12) ^
+             static_cast<std::size_t>(key.mFlag) ^
+             (static_cast<std::size_t>(key.mIsBoldRequired) << 29);
+    }
+  };
+
+  /**
+   * @brief 8 bit gray bitmap of a glyph rendered at a mip level.
+   */
+  struct MipGlyphData
+  {
+    std::vector<uint8_t> mBuffer;
+    uint32_t             mWidth{0u};
+    uint32_t             mHeight{0u};
+  };
+
+  using MipGlyphDataPtr = std::shared_ptr<MipGlyphData>;
+
+  /**
+   * @brief Render a glyph at a mip level, without changing the size of the face.
+   *
+   * @param[in] freeTypeFace The freetype face handle.
+   * @param[in] index Index of glyph in this face.
+   * @param[in] flag Flag when we load the glyph.
+   * @param[in] isBoldRequired True if we require some software bold.
+   * @param[in] pixelSize The pixel size of the mip level.
+   * @return The rendered glyph, or nullptr if it can't be rendered as a gray bitmap.
+   */
+  MipGlyphDataPtr RenderMipGlyph(
+    const FT_Face    freeTypeFace,
+    const GlyphIndex index,
+    const FT_Int32   flag,
+    const bool       isBoldRequired,
+    const uint32_t   pixelSize);
+
 private:
   // Private member value area.
   std::size_t mGlyphCacheMaxSize; ///< The maximum capacity of glyph cache.
 
-  using CacheContainer = LRUCacheContainer<GlyphCacheKey, GlyphCacheDataPtr, GlyphCacheKeyHash>;
+  using CacheContainer    = LRUCacheContainer<GlyphCacheKey, GlyphCacheDataPtr, GlyphCacheKeyHash>;
+  using MipCacheContainer = LRUCacheContainer<MipGlyphKey, MipGlyphDataPtr, MipGlyphKeyHash>;
 
   CacheContainer mLRUGlyphCache; ///< LRU Cache container of glyph
+
+  MipCacheContainer                         mLRUMipGlyphCache;      ///< LRU Cache container of glyph rendered at mip levels.
+  std::unordered_map<std::string, uint32_t> mMipFontFileIds;        ///< The ids of the font files, keyed by path and face index.
+  std::size_t                               mMipGlyphCacheMaxBytes; ///< The maximum size of the bitmaps in mLRUMipGlyphCache.
+  std::size_t                               mMipGlyphCacheBytes;    ///< The size of the bitmaps in mLRUMipGlyphCache.
 };
 
 } // namespace Dali::TextAbstraction::Internal
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,15 +19,25 @@
 #include <dali/internal/text/text-abstraction/shaping-impl.h>
 
 // INTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/text-abstraction/font-client.h>
 #include <dali/devel-api/text-abstraction/glyph-info.h>
 #include <dali/integration-api/debug.h>
+#include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/text/text-abstraction/plugin/lru-cache-container.h>
 #include "font-client-impl.h"
 
 // EXTERNAL INCLUDES
 #include <dali/devel-api/common/singleton-service.h>
 #include <harfbuzz/hb-ft.h>
 #include <harfbuzz/hb.h>
+#include <algorithm>
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
 
 namespace
 {
@@ -35,6 +45,22 @@ namespace
 Dali::Integration::Log::Filter* gLogFilter = Dali::Integration::Log::Filter::New(Debug::NoLogging, false, "LOG_FONT_CLIENT");
 #endif
 
+/**
+ * @brief Default maximum memory size of the shaping results cache, in bytes.
+ */
+constexpr std::size_t DEFAULT_SHAPING_CACHE_MAX_SIZE = 256u * 1024u;
+
+/**
+ * @brief Get the maximum memory size of the shaping results cache from environment.
+ * If not settuped, default as 256KB. Zero disables the cache.
+ * @return The maximum memory size in bytes.
+ */
+std::size_t GetShapingCacheMaximumSize()
+{
+  auto sizeString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_SHAPING_CACHE_MAX_SIZE);
+  return sizeString ? static_cast<std::size_t>(std::strtoul(sizeString, nullptr, 10)) : DEFAULT_SHAPING_CACHE_MAX_SIZE;
+}
+
 } // namespace
 
 namespace Dali
@@ -119,16 +145,218 @@ const hb_script_t SCRIPT_TO_HARFBUZZ[] =
 
 struct Shaping::Plugin
 {
+  /**
+   * @brief The key of a cached shaping result.
+   *
+   * The text itself is not part of the key, only its hash. It is compared with the cached text on a hit.
+   */
+  struct CacheKey
+  {
+    std::size_t     textHash;
+    Length          numberOfCharacters;
+    FontId          fontId;
+    Script          script;
+    PointSize26Dot6 pointSize;
+
+    bool operator==(const CacheKey& rhs) const noexcept
+    {
+      return textHash == rhs.textHash && numberOfCharacters == rhs.numberOfCharacters && fontId == rhs.fontId && script == rhs.script && pointSize == rhs.pointSize;
+    }
+  };
+
+  /**
+   * @brief Custom hash function for CacheKey.
+   */
+  struct CacheKeyHash
+  {
+    std::size_t operator()(const CacheKey& key) const noexcept
+    {
+      std::size_t hash = key.textHash;
+      hash ^= static_cast<std::size_t>(key.fontId) + 0x9e3779b9u + (hash << 6u) + (hash >> 2u);
+      hash ^= static_cast<std::size_t>(key.script) + 0x9e3779b9u + (hash << 6u) + (hash >> 2u);
+      hash ^= static_cast<std::size_t>(key.pointSize) + 0x9e3779b9u + (hash << 6u) + (hash >> 2u);
+      return hash;
+    }
+  };
+
+  /**
+   * @brief A cached shaping result.
+   */
+  struct CacheItem
+  {
+    std::vector<Character> text; ///< The shaped text, to detect hash collisions.
+    Vector<CharacterIndex> indices;
+    Vector<float>          advance;
+    Vector<float>          offset;
+    Vector<CharacterIndex> characterMap;
+    std::size_t            memorySize; ///< The memory used by the item, in bytes.
+  };
+  using CacheItemPtr = std::shared_ptr<CacheItem>;
+
+  using CacheContainer = LRUCacheContainer<CacheKey, CacheItemPtr, CacheKeyHash>;
+
   Plugin()
   : mIndices(),
     mAdvance(),
     mCharacterMap(),
-    mFontId(0u)
+    mFontId(0u),
+    mHarfBuzzBuffer(nullptr),
+    mLocale(),
+    mLanguage(HB_LANGUAGE_INVALID),
+    mCache(),
+    mCacheMemorySize(0u),
+    mCacheMaximumSize(GetShapingCacheMaximumSize()),
+    mCacheGeneration(0u),
+    mCacheHitCount(0u),
+    mCacheMissCount(0u)
   {
   }
 
   ~Plugin()
   {
+    if(mHarfBuzzBuffer)
+    {
+      hb_buffer_destroy(mHarfBuzzBuffer);
+    }
+  }
+
+  /**
+   * @brief Retrieves the harfbuzz language of the current locale.
+   *
+   * The language is parsed only when the locale changes. Otherwise the cached one is returned.
+   *
+   * @return The harfbuzz language.
+   */
+  hb_language_t GetLanguage()
+  {
+    const char* currentLocale = setlocale(LC_MESSAGES, NULL);
+    if(nullptr == currentLocale)
+    {
+      currentLocale = DEFAULT_LANGUAGE;
+    }
+
+    if((HB_LANGUAGE_INVALID == mLanguage) || (mLocale != currentLocale))
+    {
+      mLocale = currentLocale;
+
+      // The language is the part of the locale before the territory, i.e. "en" of "en_US.UTF-8".
+      const size_t languageLength = strcspn(currentLocale, "_");
+      mLanguage                   = hb_language_from_string(currentLocale, static_cast<int>(languageLength));
+
+      DALI_LOG_INFO(gLogFilter, Debug::General, "Shaping language changed. locale : %s\n", currentLocale);
+
+      // The cached results have been shaped with the previous language.
+      ClearCache();
+    }
+
+    return mLanguage;
+  }
+
+  /**
+   * @brief Removes all the cached shaping results.
+   */
+  void ClearCache()
+  {
+    mCache.Clear();
+    mCacheMemorySize = 0u;
+  }
+
+  /**
+   * @brief Sets the maximum memory size of the cache. Removes the least recently used results which don't fit.
+   *
+   * @param[in] maximumSize The maximum memory size in bytes. Zero disables the cache.
+   */
+  void SetCacheMaximumSize(std::size_t maximumSize)
+  {
+    mCacheMaximumSize = maximumSize;
+    ReduceCache(0u);
+  }
+
+  /**
+   * @brief Removes the least recently used results until there is room for @p requiredSize bytes.
+   *
+   * @param[in] requiredSize The memory size in bytes of the result to add.
+   */
+  void ReduceCache(std::size_t requiredSize)
+  {
+    while(!mCache.IsEmpty() && (mCacheMemorySize + requiredSize > mCacheMaximumSize))
+    {
+      CacheItemPtr item = mCache.Pop();
+      mCacheMemorySize -= item->memorySize;
+    }
+  }
+
+  /**
+   * @brief Copies the cached result of the text into the shaping result, if any.
+   *
+   * @param[in] key The key of the text.
+   * @param[in] text The text.
+   * @return Whether the result was cached.
+   */
+  bool GetCachedResult(const CacheKey& key, const Character* const text)
+  {
+    auto iter = mCache.Find(key);
+    if(iter == mCache.End())
+    {
+      return false;
+    }
+
+    const CacheItemPtr& item = mCache.Get(key); // Mark as recently used.
+    if(!std::equal(item->text.begin(), item->text.end(), text))
+    {
+      // Hash collision. The result will be replaced by the new one.
+      return false;
+    }
+
+    const Length numberOfGlyphs = item->indices.Count();
+    mIndices.Resize(numberOfGlyphs);
+    mAdvance.Resize(numberOfGlyphs);
+    mOffset.Resize(2u * numberOfGlyphs);
+    mCharacterMap.Resize(numberOfGlyphs);
+
+    std::copy(item->indices.Begin(), item->indices.End(), mIndices.Begin());
+    std::copy(item->advance.Begin(), item->advance.End(), mAdvance.Begin());
+    std::copy(item->offset.Begin(), item->offset.End(), mOffset.Begin());
+    std::copy(item->characterMap.Begin(), item->characterMap.End(), mCharacterMap.Begin());
+    return true;
+  }
+
+  /**
+   * @brief Caches the current shaping result of the text.
+   *
+   * @param[in] key The key of the text.
+   * @param[in] text The text.
+   * @param[in] numberOfCharacters The number of characters of the text.
+   */
+  void CacheResult(const CacheKey& key, const Character* const text, Length numberOfCharacters)
+  {
+    const Length      numberOfGlyphs = mIndices.Count();
+    const std::size_t memorySize     = sizeof(CacheItem) + numberOfCharacters * sizeof(Character) + numberOfGlyphs * (2u * sizeof(CharacterIndex) + 3u * sizeof(float));
+    if(memorySize > mCacheMaximumSize)
+    {
+      return;
+    }
+
+    auto iter = mCache.Find(key);
+    if(iter != mCache.End())
+    {
+      // Remove the result of the colliding text first.
+      mCacheMemorySize -= mCache.GetElement(iter)->memorySize;
+      mCache.Erase(iter);
+    }
+
+    ReduceCache(memorySize);
+
+    CacheItemPtr item = std::make_shared<CacheItem>();
+    item->text.assign(text, text + numberOfCharacters);
+    item->indices      = mIndices;
+    item->advance      = mAdvance;
+    item->offset       = mOffset;
+    item->characterMap = mCharacterMap;
+    item->memorySize   = memorySize;
+
+    mCache.Push(key, item);
+    mCacheMemorySize += memorySize;
   }
 
   Length Shape(const Character* const text,
@@ -152,6 +380,34 @@ struct Shaping::Plugin
     {
       case FontDescription::FACE_FONT:
       {
+        const hb_language_t language = GetLanguage();
+
+        // The font ids are not valid anymore if the font client's cache has been cleared.
+        const uint32_t fontCacheGeneration = fontClientImpl.GetCacheGeneration();
+        if(mCacheGeneration != fontCacheGeneration)
+        {
+          mCacheGeneration = fontCacheGeneration;
+          ClearCache();
+        }
+
+        const bool useCache = (mCacheMaximumSize > 0u);
+        CacheKey   cacheKey{};
+        if(useCache)
+        {
+          cacheKey.textHash           = std::hash<std::u32string_view>()(std::u32string_view(reinterpret_cast<const char32_t*>(text), numberOfCharacters));
+          cacheKey.numberOfCharacters = numberOfCharacters;
+          cacheKey.fontId             = fontId;
+          cacheKey.script             = script;
+          cacheKey.pointSize          = fontClientImpl.GetPointSize(fontId);
+
+          if(GetCachedResult(cacheKey, text))
+          {
+            ++mCacheHitCount;
+            break;
+          }
+          ++mCacheMissCount;
+        }
+
         // Get our harfbuzz font struct
         hb_font_t* harfBuzzFont = reinterpret_cast<hb_font_t*>(fontClientImpl.GetHarfBuzzFont(fontId));
         if(nullptr == harfBuzzFont)
@@ -167,8 +423,16 @@ struct Shaping::Plugin
         mCharacterMap.Reserve(numberOfGlyphs);
         mOffset.Reserve(2u * numberOfGlyphs);
 
-        /* Create a buffer for harfbuzz to use */
-        hb_buffer_t* harfBuzzBuffer = hb_buffer_create();
+        /* Reuse the buffer for harfbuzz to avoid to allocate it for every text run. */
+        if(!mHarfBuzzBuffer)
+        {
+          mHarfBuzzBuffer = hb_buffer_create();
+        }
+        else
+        {
+          hb_buffer_clear_contents(mHarfBuzzBuffer);
+        }
+        hb_buffer_t* harfBuzzBuffer = mHarfBuzzBuffer;
 
         const bool rtlDirection = IsRightToLeftScript(script);
         hb_buffer_set_direction(harfBuzzBuffer,
@@ -177,12 +441,7 @@ struct Shaping::Plugin
         hb_buffer_set_script(harfBuzzBuffer,
                              SCRIPT_TO_HARFBUZZ[script]); /* see hb-unicode.h */
 
-        char* currentLocale = setlocale(LC_MESSAGES, NULL);
-
-        std::istringstream stringStream(currentLocale);
-        std::string        localeString;
-        std::getline(stringStream, localeString, '_');
-        hb_buffer_set_language(harfBuzzBuffer, hb_language_from_string(localeString.c_str(), localeString.size()));
+        hb_buffer_set_language(harfBuzzBuffer, language);
 
         /* Layout the text */
         hb_buffer_add_utf32(harfBuzzBuffer, text, numberOfCharacters, 0u, numberOfCharacters);
@@ -270,8 +529,10 @@ struct Shaping::Plugin
           }
         }
 
-        /* Cleanup */
-        hb_buffer_destroy(harfBuzzBuffer);
+        if(useCache)
+        {
+          CacheResult(cacheKey, text, numberOfCharacters);
+        }
         break;
       }
       case FontDescription::BITMAP_FONT:
@@ -332,6 +593,17 @@ struct Shaping::Plugin
   Vector<float>          mOffset;
   Vector<CharacterIndex> mCharacterMap;
   FontId                 mFontId;
+
+  hb_buffer_t*  mHarfBuzzBuffer; ///< The buffer reused by every shaping. The plugin is used by one thread only.
+  std::string   mLocale;         ///< The locale the language has been parsed from.
+  hb_language_t mLanguage;       ///< The cached language of the locale.
+
+  CacheContainer mCache;            ///< The LRU cache of the shaping results.
+  std::size_t    mCacheMemorySize;  ///< The memory used by the cached results, in bytes.
+  std::size_t    mCacheMaximumSize; ///< The maximum memory used by the cached results, in bytes.
+  uint32_t       mCacheGeneration;  ///< The generation of the font client's cache the results belong to.
+  uint32_t       mCacheHitCount;    ///< The number of shapings found in the cache.
+  uint32_t       mCacheMissCount;   ///< The number of shapings not found in the cache.
 };
 
 Shaping::Shaping()
@@ -391,6 +663,41 @@ void Shaping::GetGlyphs(GlyphInfo*      glyphInfo,
                      glyphToCharacterMap);
 }
 
+void Shaping::SetCacheMaximumSize(std::size_t maximumSize)
+{
+  CreatePlugin();
+
+  mPlugin->SetCacheMaximumSize(maximumSize);
+}
+
+std::size_t Shaping::GetCacheMaximumSize()
+{
+  CreatePlugin();
+
+  return mPlugin->mCacheMaximumSize;
+}
+
+uint32_t Shaping::GetCacheHitCount()
+{
+  CreatePlugin();
+
+  return mPlugin->mCacheHitCount;
+}
+
+uint32_t Shaping::GetCacheMissCount()
+{
+  CreatePlugin();
+
+  return mPlugin->mCacheMissCount;
+}
+
+void Shaping::ClearCache()
+{
+  CreatePlugin();
+
+  mPlugin->ClearCache();
+}
+
 void Shaping::CreatePlugin()
 {
   if(!mPlugin)
@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_TEXT_ABSTRACTION_SHAPING_IMPL_H
 
 /*
- * Copyright (c) 2021 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -66,6 +66,31 @@ public:
   void GetGlyphs(GlyphInfo*      glyphInfo,
                  CharacterIndex* glyphToCharacterMap);
 
+  /**
+   * @copydoc Dali::Shaping::SetCacheMaximumSize()
+   */
+  void SetCacheMaximumSize(std::size_t maximumSize);
+
+  /**
+   * @copydoc Dali::Shaping::GetCacheMaximumSize()
+   */
+  std::size_t GetCacheMaximumSize();
+
+  /**
+   * @copydoc Dali::Shaping::GetCacheHitCount()
+   */
+  uint32_t GetCacheHitCount();
+
+  /**
+   * @copydoc Dali::Shaping::GetCacheMissCount()
+   */
+  uint32_t GetCacheMissCount();
+
+  /**
+   * @copydoc Dali::Shaping::ClearCache()
+   */
+  void ClearCache();
+
 private:
   /**
    * Helper for lazy initialization.
@@ -0,0 +1,520 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// CLASS HEADER
+#include <dali/internal/trace/common/trace-recorder.h>
+
+// EXTERNAL INCLUDES
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
+#include <dali/integration-api/debug.h>
+#include <dali/public-api/common/dali-common.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+// INTERNAL INCLUDES
+#include <dali/internal/system/common/environment-variables.h>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+namespace
+{
+const char*    EMPTY_TAG             = "(null)";
+const char*    UNKNOWN_TAG           = "(unknown)";
+const uint32_t DEFAULT_CAPACITY      = 64u * 1024u; ///< Events per thread, 1.5MB
+const uint32_t MINIMUM_CAPACITY      = 16u;
+const uint32_t TAG_CACHE_SIZE        = 256u; ///< Must be a power of two
+const uint32_t THREAD_NAME_MAX_SIZE  = 16u;  ///< Including the null terminator, as pthread_getname_np()
+const uint64_t NANOSECONDS_PER_MICRO = 1000u;
+
+/**
+ * @brief An event in a ring buffer.
+ *
+ * The fields are atomic as a dump may read an event while its thread overwrites it.
+ * Such an event is detected and dropped by the reader.
+ */
+struct Event
+{
+  std::atomic<uint64_t> timestamp;  ///< Nanoseconds since the start of the recorder
+  std::atomic<uint64_t> typeAndTag; ///< The tag id in the upper bits, the type in the lower 8 bits
+  std::atomic<int64_t>  value;      ///< The value of a counter
+};
+
+std::atomic<uint64_t> gNextRecorderId{1u};
+
+/**
+ * @brief The recorders alive, so a thread exiting after its recorder was destroyed doesn't use it.
+ */
+struct RecorderRegistry
+{
+  std::mutex                                   mutex;
+  std::unordered_map<uint64_t, TraceRecorder*> recorders;
+};
+
+RecorderRegistry& GetRecorderRegistry()
+{
+  // Never destroyed, as threads may exit while the process exits.
+  static RecorderRegistry* registry = new RecorderRegistry();
+  return *registry;
+}
+
+std::string gOutputPath; ///< The file written on exit by the recorder of the process
+
+uint32_t RoundUpToPowerOfTwo(uint32_t value)
+{
+  uint32_t result = MINIMUM_CAPACITY;
+  while(result < value && result < (1u << 31u))
+  {
+    result <<= 1u;
+  }
+  return result;
+}
+
+uint32_t GetCapacity()
+{
+  auto capacityString = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_TRACE_RECORDER_BUFFER_SIZE);
+  return capacityString ? static_cast<uint32_t>(std::strtoul(capacityString, nullptr, 10)) : DEFAULT_CAPACITY;
+}
+
+uint32_t GetCurrentThreadId()
+{
+#if defined(__linux__)
+  return static_cast<uint32_t>(syscall(SYS_gettid));
+#else
+  static std::atomic<uint32_t> nextThreadId{1u};
+  return nextThreadId++;
+#endif
+}
+
+std::string GetCurrentThreadName()
+{
+#if defined(__GLIBC__)
+  char name[THREAD_NAME_MAX_SIZE] = {};
+  if(pthread_getname_np(pthread_self(), name, sizeof(name)) == 0)
+  {
+    return std::string(name);
+  }
+#endif
+  return std::string();
+}
+
+void WriteJsonString(std::ostream& output, const std::string& string)
+{
+  output << '"';
+  for(const char character : string)
+  {
+    if(character == '"' || character == '\\')
+    {
+      output << '\\' << character;
+    }
+    else if(static_cast<unsigned char>(character) < 0x20)
+    {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(character));
+      output << escaped;
+    }
+    else
+    {
+      output << character;
+    }
+  }
+  output << '"';
+}
+
+void DumpOnExit()
+{
+  if(auto* recorder = TraceRecorder::Get())
+  {
+    recorder->Dump(gOutputPath);
+  }
+}
+
+} // namespace
+
+/**
+ * @brief The ring buffer of a thread. Only this thread writes in it.
+ */
+struct TraceRecorder::ThreadBuffer
+{
+  struct TagCacheEntry
+  {
+    const char* tag{nullptr};
+    uint32_t    id{0u};
+  };
+
+  explicit ThreadBuffer(uint32_t capacity)
+  : events(new Event[capacity]())
+  {
+    Reset();
+  }
+
+  /**
+   * @brief Give the buffer to the current thread.
+   */
+  void Reset()
+  {
+    head.store(0u, std::memory_order_relaxed);
+    std::fill(std::begin(tagCache), std::end(tagCache), TagCacheEntry());
+    tid   = GetCurrentThreadId();
+    name  = GetCurrentThreadName();
+    inUse = true;
+  }
+
+  std::unique_ptr<Event[]> events;
+  std::atomic<uint64_t>    head{0u}; ///< The number of events written since the start
+  TagCacheEntry            tagCache[TAG_CACHE_SIZE];
+  uint32_t                 tid{0u};
+  std::string              name;
+  bool                     inUse{false}; ///< False once the thread has exited, until the buffer is reused
+};
+
+struct TraceRecorder::EventSnapshot
+{
+  uint64_t timestamp;
+  uint64_t typeAndTag;
+  int64_t  value;
+};
+
+struct TraceRecorder::ThreadSnapshot
+{
+  uint32_t                   tid;
+  std::string                name;
+  std::vector<EventSnapshot> events;
+};
+
+TraceRecorder* TraceRecorder::Get()
+{
+  static TraceRecorder* recorder = []() -> TraceRecorder* {
+    auto outputPath = Dali::EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_TRACE_RECORDER_OUTPUT);
+    if(!outputPath || outputPath[0] == '\0')
+    {
+      return nullptr;
+    }
+
+    gOutputPath = outputPath;
+    std::atexit(DumpOnExit);
+
+    // Never destroyed, as threads may still record events while the process exits.
+    return new TraceRecorder(GetCapacity());
+  }();
+  return recorder;
+}
+
+TraceRecorder::TraceRecorder(uint32_t capacity)
+: mRecorderId(gNextRecorderId++),
+  mCapacity(RoundUpToPowerOfTwo(capacity)),
+  mStartTime(Clock::now()),
+  mExitedEventCount(0u)
+{
+  auto&                       registry = GetRecorderRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.recorders.emplace(mRecorderId, this);
+}
+
+TraceRecorder::~TraceRecorder()
+{
+  auto&                       registry = GetRecorderRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.recorders.erase(mRecorderId);
+}
+
+void TraceRecorder::Record(EventType type, const char* tag, int64_t value)
+{
+  const uint64_t timestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - mStartTime).count());
+
+  ThreadBuffer&  buffer = GetThreadBuffer();
+  const uint32_t tagId  = GetTagId(buffer, tag);
+  const uint64_t index  = buffer.head.load(std::memory_order_relaxed);
+
+  // Pairs with the acquire fence of WriteChromeJson(): a reader seeing any field of this event
+  // also sees the head of the buffer, so it knows the previous event of this slot is overwritten.
+  std::atomic_thread_fence(std::memory_order_release);
+
+  Event& event = buffer.events[index & (mCapacity - 1u)];
+  event.timestamp.store(timestamp, std::memory_order_relaxed);
+  event.typeAndTag.store((static_cast<uint64_t>(tagId) << 8u) | static_cast<uint64_t>(type), std::memory_order_relaxed);
+  event.value.store(value, std::memory_order_relaxed);
+
+  buffer.head.store(index + 1u, std::memory_order_release);
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::GetThreadBuffer()
+{
+  struct ThreadBufferCache
+  {
+    ~ThreadBufferCache()
+    {
+      Release();
+    }
+
+    /**
+     * @brief Give the buffer back to its recorder, if it's still alive.
+     */
+    void Release()
+    {
+      if(buffer)
+      {
+        auto&                       registry = GetRecorderRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto                        iter = registry.recorders.find(recorderId);
+        if(iter != registry.recorders.end())
+        {
+          iter->second->ReleaseThreadBuffer(buffer);
+        }
+      }
+      recorderId = 0u;
+      buffer     = nullptr;
+    }
+
+    uint64_t      recorderId{0u};
+    ThreadBuffer* buffer{nullptr};
+  };
+  thread_local ThreadBufferCache cache;
+
+  if(DALI_LIKELY(cache.recorderId == mRecorderId))
+  {
+    return *cache.buffer;
+  }
+
+  // The thread records into another recorder now.
+  cache.Release();
+
+  std::lock_guard<std::mutex> lock(mThreadMutex);
+
+  ThreadBuffer* buffer = nullptr;
+  if(!mFreeThreadBuffers.empty())
+  {
+    buffer = mFreeThreadBuffers.back();
+    mFreeThreadBuffers.pop_back();
+    buffer->Reset();
+  }
+  else
+  {
+    mThreadBuffers.emplace_back(new ThreadBuffer(mCapacity));
+    buffer = mThreadBuffers.back().get();
+  }
+
+  cache.recorderId = mRecorderId;
+  cache.buffer     = buffer;
+  return *cache.buffer;
+}
+
+void TraceRecorder::ReleaseThreadBuffer(ThreadBuffer* buffer)
+{
+  std::lock_guard<std::mutex> lock(mThreadMutex);
+
+  // The events are dumped after the thread has exited.
+  mExitedThreads.emplace_back();
+  TakeSnapshot(*buffer, mExitedThreads.back());
+  mExitedEventCount += static_cast<uint32_t>(mExitedThreads.back().events.size());
+
+  // Drop the oldest events, so the exited threads keep at most a buffer of events.
+  while(mExitedEventCount > mCapacity)
+  {
+    auto&          events  = mExitedThreads.front().events;
+    const uint32_t dropped = std::min(mExitedEventCount - mCapacity, static_cast<uint32_t>(events.size()));
+    events.erase(events.begin(), events.begin() + dropped);
+    mExitedEventCount -= dropped;
+    if(events.empty())
+    {
+      mExitedThreads.erase(mExitedThreads.begin());
+    }
+  }
+  if(!mExitedThreads.empty() && mExitedThreads.back().events.empty())
+  {
+    mExitedThreads.pop_back();
+  }
+
+  buffer->inUse = false;
+  mFreeThreadBuffers.push_back(buffer);
+}
+
+uint32_t TraceRecorder::GetThreadBufferCount() const
+{
+  std::lock_guard<std::mutex> lock(mThreadMutex);
+  return static_cast<uint32_t>(mThreadBuffers.size());
+}
+
+void TraceRecorder::TakeSnapshot(const ThreadBuffer& buffer, ThreadSnapshot& snapshot) const
+{
+  snapshot.tid  = buffer.tid;
+  snapshot.name = buffer.name;
+
+  auto& events = snapshot.events;
+
+  const uint64_t head  = buffer.head.load(std::memory_order_acquire);
+  const uint64_t first = head > mCapacity ? head - mCapacity : 0u;
+  events.reserve(static_cast<size_t>(head - first));
+  for(uint64_t index = first; index < head; ++index)
+  {
+    const Event& event = buffer.events[index & (mCapacity - 1u)];
+    events.push_back({event.timestamp.load(std::memory_order_relaxed), event.typeAndTag.load(std::memory_order_relaxed), event.value.load(std::memory_order_relaxed)});
+  }
+
+  // The thread may have overwritten the oldest events while they were read. It writes
+  // the event of index newHead at most, which overwrites the event of index (newHead - capacity).
+  std::atomic_thread_fence(std::memory_order_acquire);
+  const uint64_t newHead    = buffer.head.load(std::memory_order_relaxed);
+  const uint64_t firstValid = newHead >= mCapacity ? newHead - mCapacity + 1u : 0u;
+  if(firstValid > first)
+  {
+    events.erase(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(std::min(firstValid - first, static_cast<uint64_t>(events.size()))));
+  }
+}
+
+uint32_t TraceRecorder::GetTagId(ThreadBuffer& buffer, const char* tag)
+{
+  if(!tag)
+  {
+    tag = EMPTY_TAG;
+  }
+
+  const auto address = reinterpret_cast<uintptr_t>(tag);
+  auto&      entry   = buffer.tagCache[(address ^ (address >> 8u)) & (TAG_CACHE_SIZE - 1u)];
+  if(DALI_LIKELY(entry.tag == tag))
+  {
+    return entry.id;
+  }
+
+  std::lock_guard<std::mutex> lock(mTagMutex);
+
+  auto iter = mTagIds.find(tag);
+  if(iter == mTagIds.end())
+  {
+    iter = mTagIds.emplace(tag, static_cast<uint32_t>(mTags.size())).first;
+    mTags.emplace_back(tag);
+  }
+
+  entry.tag = tag;
+  entry.id  = iter->second;
+  return entry.id;
+}
+
+void TraceRecorder::WriteChromeJson(std::ostream& output) const
+{
+  std::vector<ThreadSnapshot> threads;
+  {
+    std::lock_guard<std::mutex> lock(mThreadMutex);
+    threads.reserve(mExitedThreads.size() + mThreadBuffers.size());
+
+    // The exited threads first, they are older.
+    threads.assign(mExitedThreads.begin(), mExitedThreads.end());
+
+    for(const auto& buffer : mThreadBuffers)
+    {
+      if(buffer->inUse)
+      {
+        threads.emplace_back();
+        TakeSnapshot(*buffer, threads.back());
+      }
+    }
+  }
+
+  // Copied after the events, so all their tags are known.
+  std::vector<std::string> tags;
+  {
+    std::lock_guard<std::mutex> lock(mTagMutex);
+    tags.assign(mTags.begin(), mTags.end());
+  }
+
+  const auto pid             = static_cast<uint32_t>(getpid());
+  bool       first           = true;
+  auto       writeEventStart = [&](const char* phase, uint32_t tid) {
+    output << (first ? "\n" : ",\n") << "{\"ph\":\"" << phase << "\",\"pid\":" << pid << ",\"tid\":" << tid;
+    first = false;
+  };
+
+  output << "{\"traceEvents\":[";
+  for(const auto& thread : threads)
+  {
+    if(!thread.name.empty())
+    {
+      writeEventStart("M", thread.tid);
+      output << ",\"name\":\"thread_name\",\"args\":{\"name\":";
+      WriteJsonString(output, thread.name);
+      output << "}}";
+    }
+
+    for(const auto& event : thread.events)
+    {
+      static const char* const PHASES[] = {"B", "E", "C"};
+
+      const auto     type  = static_cast<uint32_t>(event.typeAndTag & 0xffu);
+      const uint64_t tagId = event.typeAndTag >> 8u;
+      if(type > static_cast<uint32_t>(EventType::COUNTER))
+      {
+        continue;
+      }
+
+      // Timestamps are in microseconds.
+      char timestamp[32];
+      snprintf(timestamp, sizeof(timestamp), "%llu.%03llu", static_cast<unsigned long long>(event.timestamp / NANOSECONDS_PER_MICRO), static_cast<unsigned long long>(event.timestamp % NANOSECONDS_PER_MICRO));
+
+      writeEventStart(PHASES[type], thread.tid);
+      output << ",\"ts\":" << timestamp << ",\"name\":";
+      WriteJsonString(output, tagId < tags.size() ? tags[tagId] : std::string(UNKNOWN_TAG));
+      if(type == static_cast<uint32_t>(EventType::COUNTER))
+      {
+        output << ",\"args\":{\"value\":" << event.value << "}";
+      }
+      output << "}";
+    }
+  }
+  output << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+bool TraceRecorder::Dump(const std::string& path) const
+{
+  std::ofstream file(path, std::ios::trunc);
+  if(!file.is_open())
+  {
+    DALI_LOG_ERROR("Error creating trace file: %s!\n", path.c_str());
+    return false;
+  }
+
+  WriteChromeJson(file);
+  file.close();
+  if(!file)
+  {
+    DALI_LOG_ERROR("Error writing trace file: %s!\n", path.c_str());
+    return false;
+  }
+
+  DALI_LOG_RELEASE_INFO("Trace written to %s\n", path.c_str());
+  return true;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
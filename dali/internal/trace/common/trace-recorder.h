@@ -0,0 +1,199 @@
+#ifndef DALI_INTERNAL_TRACE_RECORDER_H
+#define DALI_INTERNAL_TRACE_RECORDER_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// EXTERNAL INCLUDES
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Dali
+{
+namespace Internal
+{
+namespace Adaptor
+{
+/**
+ * @brief Records the trace events into per thread ring buffers, and writes them as Chrome trace event JSON.
+ *
+ * Recording an event doesn't take any lock nor allocate: the tag is interned through a per thread cache,
+ * and the event is written in the ring buffer of the thread. When a ring buffer is full, the oldest events
+ * are overwritten. The buffers can be dumped at any time from any thread, e.g. on exit or on demand.
+ *
+ * When a thread exits, its events are copied and its buffer is reused by the next new thread, so the
+ * number of buffers is bounded by the number of threads alive at once. The copied events of the exited
+ * threads are bounded by the capacity of one buffer, the oldest are dropped first.
+ *
+ * The JSON output can be opened with chrome://tracing or https://ui.perfetto.dev
+ *
+ * @note The tags are expected to be string literals, as given to the DALI_TRACE_* macros:
+ * a tag is interned by its content the first time its address is seen by a thread.
+ */
+class TraceRecorder
+{
+public:
+  /**
+   * @brief The type of a trace event.
+   */
+  enum class EventType : uint8_t
+  {
+    BEGIN,  ///< Start of a duration
+    END,    ///< End of a duration
+    COUNTER ///< Value of a counter
+  };
+
+  /**
+   * @brief Get the recorder of the process.
+   *
+   * It is created on the first call if DALI_TRACE_RECORDER_OUTPUT is set, and the events are written
+   * to that file on exit.
+   *
+   * @return The recorder, or nullptr if it is disabled
+   */
+  static TraceRecorder* Get();
+
+  /**
+   * @brief Constructor.
+   * @param[in] capacity The size of the ring buffer of each thread. Rounded up to a power of two.
+   * The latest (capacity - 1) events are written, as the slot of the next event may be written during a dump.
+   */
+  explicit TraceRecorder(uint32_t capacity);
+
+  /**
+   * @brief Destructor.
+   * @note No thread may record events any more.
+   */
+  ~TraceRecorder();
+
+  /**
+   * @brief Record the start of a duration on the current thread.
+   * @param[in] tag The name of the duration
+   */
+  void Begin(const char* tag)
+  {
+    Record(EventType::BEGIN, tag, 0);
+  }
+
+  /**
+   * @brief Record the end of a duration on the current thread.
+   * @param[in] tag The name of the duration
+   */
+  void End(const char* tag)
+  {
+    Record(EventType::END, tag, 0);
+  }
+
+  /**
+   * @brief Record the value of a counter.
+   * @param[in] tag The name of the counter
+   * @param[in] value The value
+   */
+  void Counter(const char* tag, int64_t value)
+  {
+    Record(EventType::COUNTER, tag, value);
+  }
+
+  /**
+   * @brief Write the recorded events as Chrome trace event JSON.
+   * @param[out] output The stream to write to
+   */
+  void WriteChromeJson(std::ostream& output) const;
+
+  /**
+   * @brief Write the recorded events as Chrome trace event JSON into a file.
+   * @param[in] path The path of the file
+   * @return True if the file has been written
+   */
+  bool Dump(const std::string& path) const;
+
+  /**
+   * @brief Get the number of ring buffers, used by the threads alive or kept for reuse.
+   * @return The number of buffers
+   */
+  uint32_t GetThreadBufferCount() const;
+
+  // Not copyable
+  TraceRecorder(const TraceRecorder&) = delete;
+  TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+private:
+  struct ThreadBuffer;
+  struct EventSnapshot;
+  struct ThreadSnapshot;
+
+  /**
+   * @brief Write an event in the ring buffer of the current thread.
+   */
+  void Record(EventType type, const char* tag, int64_t value);
+
+  /**
+   * @brief Get the buffer of the current thread, creating it on its first event.
+   */
+  ThreadBuffer& GetThreadBuffer();
+
+  /**
+   * @brief Copy the events of a thread, and put its buffer in the free list, when the thread exits.
+   * @param[in] buffer The buffer of the thread
+   */
+  void ReleaseThreadBuffer(ThreadBuffer* buffer);
+
+  /**
+   * @brief Copy the valid events of a buffer.
+   * @note The caller holds mThreadMutex.
+   * @param[in] buffer The buffer
+   * @param[out] snapshot The copy of the events
+   */
+  void TakeSnapshot(const ThreadBuffer& buffer, ThreadSnapshot& snapshot) const;
+
+  /**
+   * @brief Get the id of a tag, through the cache of the thread.
+   */
+  uint32_t GetTagId(ThreadBuffer& buffer, const char* tag);
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  const uint64_t          mRecorderId; ///< Unique id, to find the buffer of a thread from its thread local cache
+  const uint32_t          mCapacity;   ///< The number of events per thread, a power of two
+  const Clock::time_point mStartTime;  ///< The origin of the timestamps
+
+  mutable std::mutex                         mThreadMutex; ///< Protects mThreadBuffers, mFreeThreadBuffers and mExitedThreads
+  std::vector<std::unique_ptr<ThreadBuffer>> mThreadBuffers;
+  std::vector<ThreadBuffer*>                 mFreeThreadBuffers; ///< The buffers of the exited threads, reused by the new ones
+  std::vector<ThreadSnapshot>                mExitedThreads;     ///< The events of the exited threads, oldest thread first
+  uint32_t                                   mExitedEventCount;  ///< The number of events in mExitedThreads, up to mCapacity
+
+  mutable std::mutex                        mTagMutex; ///< Protects mTagIds and mTags
+  std::unordered_map<std::string, uint32_t> mTagIds;
+  std::deque<std::string>                   mTags; ///< The interned tags, indexed by id
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // DALI_INTERNAL_TRACE_RECORDER_H
@@ -25,6 +25,7 @@
 // INTERNAL INCLUDES
 #include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/internal/system/common/environment-variables.h>
+#include <dali/internal/trace/common/trace-recorder.h>
 
 namespace Dali
 {
@@ -34,8 +35,9 @@ namespace Adaptor
 {
 namespace
 {
-const char* EMPTY_TAG                   = "(null)";
-static bool gTraceManagerEnablePrintLog = false;
+const char*    EMPTY_TAG                   = "(null)";
+static bool    gTraceManagerEnablePrintLog = false;
+TraceRecorder* gTraceRecorder              = nullptr; ///< Records the markers for the Chrome trace viewer, if enabled
 } // namespace
 
 TraceManagerGeneric* TraceManagerGeneric::traceManagerGeneric = nullptr;
@@ -49,6 +51,8 @@ TraceManagerGeneric::TraceManagerGeneric(PerformanceInterface* performanceInterf
     gTraceManagerEnablePrintLog = true;
   }
 
+  gTraceRecorder = TraceRecorder::Get();
+
   TraceManagerGeneric::traceManagerGeneric = this;
 }
 
@@ -59,6 +63,18 @@ Dali::Integration::Trace::LogContextFunction TraceManagerGeneric::GetLogContextF
 
 void TraceManagerGeneric::LogContext(bool start, const char* tag, const char* message)
 {
+  if(gTraceRecorder)
+  {
+    if(start)
+    {
+      gTraceRecorder->Begin(tag);
+    }
+    else
+    {
+      gTraceRecorder->End(tag);
+    }
+  }
+
   if(traceManagerGeneric && traceManagerGeneric->mPerformanceInterface)
   {
     if(start)
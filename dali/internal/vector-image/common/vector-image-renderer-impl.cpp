@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,7 +23,14 @@
 #include <dali/public-api/object/type-registry.h>
 
 #ifndef THORVG_SUPPORT
+#include <algorithm>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
 // INTERNAL INCLUDES
+#include <dali/internal/system/common/worker-thread-pool.h>
 #include <third-party/nanosvg/nanosvg.h>
 #include <third-party/nanosvg/nanosvgrast.h>
 #endif
@@ -50,6 +57,88 @@ Dali::TypeRegistration type(typeid(Dali::VectorImageRenderer), typeid(Dali::Base
 Debug::Filter* gVectorImageLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_VECTOR_IMAGE");
 #endif
 
+#ifndef THORVG_SUPPORT
+const uint32_t MINIMUM_PIXELS_FOR_MULTI_THREAD = 512u * 512u;
+const uint32_t MINIMUM_ROWS_PER_BAND           = 64u;
+
+/**
+ * A parsed image, shared by all the renderers which loaded the same data.
+ */
+struct ParsedImageCacheEntry
+{
+  std::vector<uint8_t>     data; ///< A copy of the data, as nsvgParse() modifies the data it parses
+  float                    dpi;
+  std::weak_ptr<NSVGimage> image;
+};
+
+std::mutex                                                 gParsedImageCacheMutex;
+std::unordered_multimap<std::size_t, ParsedImageCacheEntry> gParsedImageCache; ///< Keyed by the hash of the data
+
+std::size_t CalculateDataHash(const Vector<uint8_t>& data)
+{
+  return std::hash<std::string_view>()(std::string_view(reinterpret_cast<const char*>(data.Begin()), data.Size()));
+}
+
+std::shared_ptr<NSVGimage> FindParsedImage(std::size_t hash, const Vector<uint8_t>& data, float dpi)
+{
+  auto range = gParsedImageCache.equal_range(hash);
+  for(auto iter = range.first; iter != range.second; ++iter)
+  {
+    const ParsedImageCacheEntry& entry = iter->second;
+    if(entry.dpi == dpi && entry.data.size() == data.Size() && std::equal(entry.data.begin(), entry.data.end(), data.Begin()))
+    {
+      return entry.image.lock();
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * @brief Gets the parsed image of the data from the cache, or parses it.
+ * @return The parsed image, or nullptr if the data can't be parsed
+ */
+std::shared_ptr<NSVGimage> GetParsedImage(const Vector<uint8_t>& data, float dpi)
+{
+  const std::size_t hash = CalculateDataHash(data);
+  {
+    std::lock_guard<std::mutex> lock(gParsedImageCacheMutex);
+    if(auto image = FindParsedImage(hash, data, dpi))
+    {
+      DALI_LOG_INFO(gVectorImageLogFilter, Debug::Verbose, "Parsed image found in the cache, size : %u\n", data.Size());
+      return image;
+    }
+  }
+
+  ParsedImageCacheEntry entry{std::vector<uint8_t>(data.Begin(), data.End()), dpi, {}};
+
+  // Parse without the lock, the same data may be parsed twice by different threads
+  NSVGimage* parsedImage = nsvgParse(const_cast<char*>(reinterpret_cast<const char*>(data.Begin())), UNITS, dpi);
+  if(!parsedImage || !parsedImage->shapes)
+  {
+    DALI_LOG_ERROR("VectorImageRenderer::Load: nsvgParse failed\n");
+    if(parsedImage)
+    {
+      nsvgDelete(parsedImage);
+    }
+    return nullptr;
+  }
+
+  std::shared_ptr<NSVGimage> image(parsedImage, nsvgDelete);
+
+  std::lock_guard<std::mutex> lock(gParsedImageCacheMutex);
+
+  // Forget the images no renderer uses any more
+  for(auto iter = gParsedImageCache.begin(); iter != gParsedImageCache.end();)
+  {
+    iter = iter->second.image.expired() ? gParsedImageCache.erase(iter) : std::next(iter);
+  }
+
+  entry.image = image;
+  gParsedImageCache.emplace(hash, std::move(entry));
+  return image;
+}
+#endif
+
 } // unnamed namespace
 
 VectorImageRendererPtr VectorImageRenderer::New()
@@ -91,11 +180,7 @@ VectorImageRenderer::~VectorImageRenderer()
 
   tvg::Initializer::term(tvg::CanvasEngine::Sw);
 #else
-  if(mParsedImage)
-  {
-    nsvgDelete(mParsedImage);
-    mParsedImage = nullptr;
-  }
+  mParsedImage.reset();
 
   if(mRasterizer)
   {
@@ -193,18 +278,9 @@ bool VectorImageRenderer::Load(const Vector<uint8_t>& data, float dpi)
     return true;
   }
 
-  mParsedImage = nsvgParse(reinterpret_cast<char*>(data.Begin()), UNITS, dpi);
-  if(!mParsedImage || !mParsedImage->shapes)
+  mParsedImage = GetParsedImage(data, dpi);
+  if(!mParsedImage)
   {
-    DALI_LOG_ERROR("VectorImageRenderer::Load: nsvgParse failed\n");
-
-    // Destroy mParsedImage and make it as nullptr, so we can notify that we fail to load svg file.
-    if(mParsedImage)
-    {
-      nsvgDelete(mParsedImage);
-      mParsedImage = nullptr;
-    }
-
     return false;
   }
 
@@ -305,7 +381,54 @@ Dali::Devel::PixelBuffer VectorImageRenderer::Rasterize(uint32_t width, uint32_t
     float scale  = scaleX < scaleY ? scaleX : scaleY;
     int   stride = pixelBuffer.GetWidth() * Pixel::GetBytesPerPixel(Dali::Pixel::RGBA8888);
 
-    nsvgRasterize(mRasterizer, mParsedImage, 0.0f, 0.0f, scale, pixelBuffer.GetBuffer(), width, height, stride);
+    auto  buffer = pixelBuffer.GetBuffer();
+
+    uint32_t numberOfBands = 1u;
+    if(width * height >= MINIMUM_PIXELS_FOR_MULTI_THREAD)
+    {
+      // The calling thread rasterizes a band too.
+      numberOfBands = std::max(1u, std::min(WorkerThreadPool::Get().GetWorkerCount() + 1u, height / MINIMUM_ROWS_PER_BAND));
+    }
+
+    // The shapes are flattened once, and shared by the bands.
+    NSVGflattenedImage* flattenedImage = nullptr;
+    if(numberOfBands > 1u)
+    {
+      flattenedImage = nsvgFlattenImage(mRasterizer, mParsedImage.get(), 0.0f, 0.0f, scale);
+    }
+
+    // Each band needs its own rasterizer. The bands are identical to the rows of the whole image.
+    std::vector<NSVGrasterizer*> rasterizers{mRasterizer};
+    for(uint32_t i = 1u; i < numberOfBands && flattenedImage; ++i)
+    {
+      NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+      if(!rasterizer)
+      {
+        break;
+      }
+      rasterizers.push_back(rasterizer);
+    }
+    numberOfBands = static_cast<uint32_t>(rasterizers.size());
+
+    if(numberOfBands == 1u)
+    {
+      nsvgDeleteFlattenedImage(flattenedImage);
+      nsvgRasterize(mRasterizer, mParsedImage.get(), 0.0f, 0.0f, scale, buffer, width, height, stride);
+      return pixelBuffer;
+    }
+
+    DALI_LOG_INFO(gVectorImageLogFilter, Debug::Verbose, "Rasterize size[%d x %d] in %u bands [%p]\n", width, height, numberOfBands, this);
+
+    const uint32_t rowsPerBand = (height + numberOfBands - 1u) / numberOfBands;
+    WorkerThreadPool::Get().Run(numberOfBands, [&rasterizers, flattenedImage, buffer, width, height, stride, rowsPerBand](uint32_t index) {
+      nsvgRasterizeFlattened(rasterizers[index], flattenedImage, buffer, width, height, stride, index * rowsPerBand, (index + 1u) * rowsPerBand);
+    });
+
+    nsvgDeleteFlattenedImage(flattenedImage);
+    for(uint32_t i = 1u; i < numberOfBands; ++i)
+    {
+      nsvgDeleteRasterizer(rasterizers[i]);
+    }
     return pixelBuffer;
   }
   return Devel::PixelBuffer();
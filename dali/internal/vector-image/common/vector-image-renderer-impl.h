@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_VECTOR_IMAGE_RENDERER_IMPL_H
 
 /*
- * Copyright (c) 2022 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -22,6 +22,7 @@
 #include <dali/devel-api/threading/mutex.h>
 #include <dali/public-api/object/base-object.h>
 #include <dali/public-api/signals/connection-tracker.h>
+#include <memory>
 
 #ifdef THORVG_SUPPORT
 #include <thorvg.h>
@@ -104,8 +105,8 @@ private:
   std::unique_ptr<tvg::SwCanvas> mSwCanvas{nullptr};
   tvg::Picture*                  mPicture{nullptr}; ///< The pointer to the picture
 #else
-  NSVGimage*      mParsedImage{nullptr};
-  NSVGrasterizer* mRasterizer{nullptr};
+  std::shared_ptr<NSVGimage> mParsedImage{nullptr}; ///< Shared with the renderers loading the same data, read only
+  NSVGrasterizer*            mRasterizer{nullptr};
 #endif
   Dali::Mutex mMutex{};          ///< The mutex
   uint32_t    mDefaultWidth{0};  ///< The default width of the file
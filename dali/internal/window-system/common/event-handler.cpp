@@ -61,6 +61,7 @@ EventHandler::EventHandler(WindowBase* windowBase, DamageObserver& damageObserve
     windowBase->FocusChangedSignal().Connect(this, &EventHandler::OnFocusChanged);
     windowBase->RotationSignal().Connect(this, &EventHandler::OnRotation);
     windowBase->TouchEventSignal().Connect(this, &EventHandler::OnTouchEvent);
+    windowBase->TouchHistorySignal().Connect(this, &EventHandler::OnTouchHistory);
     windowBase->MouseFrameEventSignal().Connect(this, &EventHandler::OnMouseFrameEvent);
     windowBase->WheelEventSignal().Connect(this, &EventHandler::OnWheelEvent);
     windowBase->KeyEventSignal().Connect(this, &EventHandler::OnKeyEvent);
@@ -107,6 +108,14 @@ void EventHandler::OnTouchEvent(Integration::Point& point, uint32_t timeStamp)
   }
 }
 
+void EventHandler::OnTouchHistory(Integration::Point& point, uint32_t timeStamp)
+{
+  for(ObserverContainer::iterator iter = mObservers.begin(), endIter = mObservers.end(); iter != endIter; ++iter)
+  {
+    (*iter)->OnTouchHistoryPoint(point, timeStamp);
+  }
+}
+
 void EventHandler::OnMouseFrameEvent()
 {
   for(ObserverContainer::iterator iter = mObservers.begin(), endIter = mObservers.end(); iter != endIter; ++iter)
@@ -68,6 +68,13 @@ public:
      */
     virtual void OnTouchPoint(Dali::Integration::Point& point, int timeStamp) = 0;
 
+    /**
+     * Deriving classes should override this to be notified of a touch point coalesced into the next one.
+     * @param[in] point The touch point
+     * @param[in] timeStamp The time stamp
+     */
+    virtual void OnTouchHistoryPoint(Dali::Integration::Point& point, int timeStamp) = 0;
+
     /**
      * @brief Deriving classes should override this to be notified when we receive a mouse frame event.
      */
@@ -161,6 +168,11 @@ private:
    */
   void OnTouchEvent(Integration::Point& point, uint32_t timeStamp);
 
+  /**
+   * Called for a touch point coalesced into the next touch event.
+   */
+  void OnTouchHistory(Integration::Point& point, uint32_t timeStamp);
+
   /**
    * Called when a mouse frame event is received.
    */
@@ -502,6 +502,12 @@ void GlWindow::OnTouchPoint(Dali::Integration::Point& point, int timeStamp)
   mTouchedSignal.Emit(touchEvent);
 }
 
+void GlWindow::OnTouchHistoryPoint(Dali::Integration::Point& point, int timeStamp)
+{
+  // There are no core events to process together, the application gets every point.
+  OnTouchPoint(point, timeStamp);
+}
+
 void GlWindow::OnMouseFrameEvent()
 {
 }
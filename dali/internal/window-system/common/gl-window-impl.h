@@ -311,6 +311,11 @@ private:
    */
   void OnTouchPoint(Dali::Integration::Point& point, int timeStamp) override;
 
+  /**
+   * @copydoc Dali::Internal::Adaptor::EventHandler::Observer::OnTouchHistoryPoint
+   */
+  void OnTouchHistoryPoint(Dali::Integration::Point& point, int timeStamp) override;
+
   /**
    * @copydoc Dali::Internal::Adaptor::EventHandler::Observer::OnMouseFrameEvent
    */
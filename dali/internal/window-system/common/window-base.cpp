@@ -33,6 +33,7 @@ WindowBase::WindowBase()
   mWindowDamagedSignal(),
   mRotationSignal(),
   mTouchEventSignal(),
+  mTouchHistorySignal(),
   mMouseFrameEventSignal(),
   mWheelEventSignal(),
   mKeyEventSignal(),
@@ -96,6 +97,11 @@ WindowBase::TouchEventSignalType& WindowBase::TouchEventSignal()
   return mTouchEventSignal;
 }
 
+WindowBase::TouchEventSignalType& WindowBase::TouchHistorySignal()
+{
+  return mTouchHistorySignal;
+}
+
 WindowBase::MouseFrameEventSignalType& WindowBase::MouseFrameEventSignal()
 {
   return mMouseFrameEventSignal;
@@ -635,6 +635,11 @@ public:
    */
   TouchEventSignalType& TouchEventSignal();
 
+  /**
+   * @brief This signal is emitted for each touch point coalesced into the next touch event, oldest first.
+   */
+  TouchEventSignalType& TouchHistorySignal();
+
   /**
    * @brief This signal is emitted when a mouse frame event is received.
    */
@@ -741,6 +746,7 @@ protected:
   DamageSignalType                        mWindowDamagedSignal;
   RotationSignalType                      mRotationSignal;
   TouchEventSignalType                    mTouchEventSignal;
+  TouchEventSignalType                    mTouchHistorySignal;
   MouseFrameEventSignalType               mMouseFrameEventSignal;
   WheelEventSignalType                    mWheelEventSignal;
   KeyEventSignalType                      mKeyEventSignal;
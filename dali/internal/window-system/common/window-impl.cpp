@@ -1121,6 +1121,11 @@ void Window::OnTouchPoint(Dali::Integration::Point& point, int timeStamp)
   FeedTouchPoint(point, timeStamp);
 }
 
+void Window::OnTouchHistoryPoint(Dali::Integration::Point& point, int timeStamp)
+{
+  FeedTouchHistoryPoint(point, timeStamp);
+}
+
 void Window::OnMouseFrameEvent()
 {
   FeedMouseFrameEvent();
@@ -842,6 +842,11 @@ private: // Dali::Internal::Adaptor::EventHandler::Observer
    */
   void OnTouchPoint(Dali::Integration::Point& point, int timeStamp) override;
 
+  /**
+   * @copydoc Dali::Internal::Adaptor::EventHandler::Observer::OnTouchHistoryPoint
+   */
+  void OnTouchHistoryPoint(Dali::Integration::Point& point, int timeStamp) override;
+
   /**
    * @copydoc Dali::Internal::Adaptor::EventHandler::Observer::OnMouseFrameEvent
    */
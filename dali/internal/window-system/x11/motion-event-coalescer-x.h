@@ -0,0 +1,181 @@
+#ifndef DALI_INTERNAL_WINDOW_SYSTEM_X11_MOTION_EVENT_COALESCER_X_H
+#define DALI_INTERNAL_WINDOW_SYSTEM_X11_MOTION_EVENT_COALESCER_X_H
+
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// EXTERNAL INCLUDES
+#include <X11/Xlib.h>
+#include <cstdint>
+#include <vector>
+
+namespace Dali::Internal::Adaptor::WindowSystem
+{
+/**
+ * @brief Coalesces the pointer motion events read in one pass over the X event queue.
+ *
+ * Only the latest MotionNotify of each window is delivered. When a button was held, the positions
+ * it replaced are kept as its history, oldest first, so that gestures still see every sample.
+ * Any other event must be preceded by Flush(), which keeps the order of motions, presses and releases.
+ *
+ * The motions are coalesced per window and per pass over the queue, not per device or per frame:
+ * a pass covers the events received since the event thread was last idle, which is about a frame
+ * only when the thread is behind, and fewer events when it keeps up with the device. The core
+ * MotionNotify events all come from the core pointer, the XI2 events are not coalesced.
+ *
+ * What is saved is the core events processing, one per delivered motion instead of one per motion.
+ * Each history sample is still a touch event for the core, hit-tested and emitted to the touch
+ * signals, so that the gestures get every sample.
+ */
+class MotionEventCoalescerX
+{
+public:
+  /**
+   * @brief A motion replaced by a later one.
+   */
+  struct Sample
+  {
+    unsigned long timestamp; ///< time in milliseconds
+    int           x;
+    int           y;
+  };
+
+  using History = std::vector<Sample>;
+
+  /**
+   * @brief Constructor.
+   * @param[in] enabled Whether the motion events are coalesced, otherwise AddEvent() keeps nothing
+   */
+  explicit MotionEventCoalescerX(bool enabled)
+  : mEnabled(enabled)
+  {
+  }
+
+  /**
+   * @return Whether the motion events are coalesced
+   */
+  bool IsEnabled() const
+  {
+    return mEnabled;
+  }
+
+  /**
+   * @brief Keeps a motion event until the next Flush().
+   * @param[in] event The event read from the queue
+   * @return false if the event is not coalesced. The pending motions must be flushed, then the event handled.
+   */
+  bool AddEvent(const XEvent& event)
+  {
+    if(!mEnabled || event.type != MotionNotify)
+    {
+      return false;
+    }
+
+    ++mReceivedCount;
+
+    const ::Window window = GetWindow(event);
+    for(auto& motion : mMotions)
+    {
+      if(GetWindow(motion.event) == window)
+      {
+        const XMotionEvent& previous = motion.event.xmotion;
+        if(previous.state & BUTTON_MASK)
+        {
+          motion.history.push_back(Sample{previous.time, previous.x, previous.y});
+          ++mHistoryCount;
+        }
+        motion.event = event;
+        return true;
+      }
+    }
+
+    mMotions.push_back(Motion{event, History()});
+    return true;
+  }
+
+  /**
+   * @brief Delivers the pending motions, in the order their windows were first seen.
+   * @param[in] handler Called as handler(const XEvent& event, History& history) for each pending motion
+   */
+  template<typename Handler>
+  void Flush(Handler&& handler)
+  {
+    for(auto& motion : mMotions)
+    {
+      ++mDeliveredCount;
+      handler(motion.event, motion.history);
+    }
+    mMotions.clear();
+  }
+
+  /**
+   * @return The number of motion events received since the last ResetCounts()
+   */
+  uint32_t GetReceivedCount() const
+  {
+    return mReceivedCount;
+  }
+
+  /**
+   * @return The number of motion events delivered since the last ResetCounts()
+   */
+  uint32_t GetDeliveredCount() const
+  {
+    return mDeliveredCount;
+  }
+
+  /**
+   * @return The number of motion events kept as the history of the delivered ones since the last ResetCounts()
+   */
+  uint32_t GetHistoryCount() const
+  {
+    return mHistoryCount;
+  }
+
+  /**
+   * @brief Resets the numbers of received, delivered and history motion events.
+   */
+  void ResetCounts()
+  {
+    mReceivedCount  = 0u;
+    mDeliveredCount = 0u;
+    mHistoryCount   = 0u;
+  }
+
+private:
+  static constexpr unsigned int BUTTON_MASK = Button1Mask | Button2Mask | Button3Mask;
+
+  struct Motion
+  {
+    XEvent  event;
+    History history;
+  };
+
+  static ::Window GetWindow(const XEvent& event)
+  {
+    return event.xmotion.subwindow ? event.xmotion.subwindow : event.xmotion.window;
+  }
+
+  std::vector<Motion> mMotions;
+  uint32_t            mReceivedCount{0u};
+  uint32_t            mDeliveredCount{0u};
+  uint32_t            mHistoryCount{0u};
+  bool                mEnabled;
+};
+
+} // namespace Dali::Internal::Adaptor::WindowSystem
+
+#endif // DALI_INTERNAL_WINDOW_SYSTEM_X11_MOTION_EVENT_COALESCER_X_H
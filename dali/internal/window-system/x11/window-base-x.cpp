@@ -525,6 +525,14 @@ void WindowBaseX::OnMouseButtonMove(void* data, WindowSystemBase::Event type, Wi
     point.SetPressure(static_cast<float>(touchEvent->multi.pressure));
     point.SetAngle(Degree(static_cast<float>(touchEvent->multi.angle)));
 
+    // The motions coalesced into this one, for the gestures.
+    for(const auto& sample : touchEvent->history)
+    {
+      Integration::Point historyPoint(point);
+      historyPoint.SetScreenPosition(Vector2(static_cast<float>(sample.x), static_cast<float>(sample.y)));
+      mTouchHistorySignal.Emit(historyPoint, sample.timestamp);
+    }
+
     mTouchEventSignal.Emit(point, touchEvent->timestamp);
 
     mMouseFrameEventSignal.Emit();
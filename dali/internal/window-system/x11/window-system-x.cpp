@@ -19,10 +19,12 @@
 #include <dali/internal/window-system/x11/window-system-x.h>
 
 // INTERNAL HEADERS
+#include <dali/devel-api/adaptor-framework/environment-variable.h>
 #include <dali/devel-api/adaptor-framework/keyboard.h>
 #include <dali/integration-api/adaptor-framework/adaptor.h>
 #include <dali/integration-api/adaptor-framework/scene-holder.h>
 #include <dali/integration-api/debug.h>
+#include <dali/internal/system/common/environment-variables.h>
 #include <dali/internal/system/common/file-descriptor-monitor.h>
 #include <dali/internal/system/common/system-factory.h>
 #include <dali/internal/window-system/common/window-system.h>
@@ -38,6 +40,7 @@
 #include <unistd.h>
 #include <algorithm>
 #include <cerrno>
+#include <cstdlib>
 #include <cstring>
 #include <unordered_map>
 #include <vector>
@@ -59,6 +62,19 @@ const int MOUSE_SCROLL_WHEEL_DOWN{5};
 const int MOUSE_SCROLL_WHEEL_LEFT{6};
 const int MOUSE_SCROLL_WHEEL_RIGHT{7};
 
+#if defined(DEBUG_ENABLED)
+Debug::Filter* gWindowSystemLogFilter = Debug::Filter::New(Debug::NoLogging, false, "LOG_WINDOW_SYSTEM_X");
+#endif
+
+/**
+ * @brief Whether the pointer motions read in one pass over the event queue are coalesced, enabled unless the variable is 0.
+ */
+bool IsMotionCoalescingEnabled()
+{
+  auto coalescingString = EnvironmentVariable::GetEnvironmentVariable(DALI_ENV_X11_MOTION_COALESCING);
+  return coalescingString ? std::atoi(coalescingString) != 0 : true;
+}
+
 /**
  * @brief Get an XWindow property
  *
@@ -274,9 +290,13 @@ void ExposeEventHandler(const XEvent* xevent)
   GetImplementation().TriggerEventHandler(WindowSystemBase::Event::DAMAGE, x11ExposeEvent);
 }
 
-void HandlePointerMove(int x, int y, unsigned long timestamp, ::Window window)
+void HandlePointerMove(int x, int y, unsigned long timestamp, ::Window window, MotionEventCoalescerX::History* history = nullptr)
 {
   WindowSystemX::X11MouseEvent mouseEvent;
+  if(history)
+  {
+    mouseEvent.history.swap(*history);
+  }
   mouseEvent.window         = window;
   mouseEvent.timestamp      = timestamp;
   mouseEvent.x              = x;
@@ -374,6 +394,11 @@ void MotionNotifyEventHandler(const XEvent* xevent)
   HandlePointerMove(xevent->xmotion.x, xevent->xmotion.y, xevent->xmotion.time, xevent->xmotion.subwindow ? xevent->xmotion.subwindow : xevent->xmotion.window);
 }
 
+void CoalescedMotionNotifyEventHandler(const XEvent& xevent, MotionEventCoalescerX::History& history)
+{
+  HandlePointerMove(xevent.xmotion.x, xevent.xmotion.y, xevent.xmotion.time, xevent.xmotion.subwindow ? xevent.xmotion.subwindow : xevent.xmotion.window, &history);
+}
+
 void EnterNotifyEventHandler(const XEvent* xevent)
 {
   HandlePointerMove(xevent->xcrossing.x, xevent->xcrossing.y, xevent->xcrossing.time, xevent->xcrossing.subwindow ? xevent->xcrossing.subwindow : xevent->xcrossing.window);
@@ -535,12 +560,24 @@ struct WindowSystemX::Impl
   {
     if(eventType & (FileDescriptorMonitor::FD_READABLE | FileDescriptorMonitor::FD_WRITABLE))
     {
+      uint32_t eventCount = 0u;
       while(XPending(mDisplay))
       {
         XEvent event;
         XNextEvent(mDisplay, &event);
-        HandleXEvent(event);
+        ++eventCount;
+
+        if(!mMotionCoalescer.AddEvent(event))
+        {
+          mMotionCoalescer.Flush(&CoalescedMotionNotifyEventHandler);
+          HandleXEvent(event);
+        }
       }
+      mMotionCoalescer.Flush(&CoalescedMotionNotifyEventHandler);
+
+      // A delivered motion is a core events processing, a history sample is only a queued touch event.
+      DALI_LOG_INFO(gWindowSystemLogFilter, Debug::Verbose, "XPollCallback: %u events, %u of %u motions delivered, %u kept as history\n", eventCount, mMotionCoalescer.GetDeliveredCount(), mMotionCoalescer.GetReceivedCount(), mMotionCoalescer.GetHistoryCount());
+      mMotionCoalescer.ResetCounts();
     }
   }
 
@@ -720,6 +757,7 @@ struct WindowSystemX::Impl
   XIDeviceInfo*                                        mXi2Devices{nullptr};
   int                                                  mXi2NumberOfDevices{0};
   int                                                  mXi2OpCode{-1};
+  MotionEventCoalescerX                                mMotionCoalescer{IsMotionCoalescingEnabled()};
 };
 
 WindowSystemX::WindowSystemX()
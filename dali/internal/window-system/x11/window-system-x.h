@@ -2,7 +2,7 @@
 #define DALI_INTERNAL_WINDOW_SYSTEM_X11_WINDOW_SYSTEM_H
 
 /*
- * COPYRIGHT (c) 2023 Samsung Electronics Co., Ltd.
+ * COPYRIGHT (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -19,6 +19,7 @@
 
 #include <X11/Xlib.h>
 #include <dali/internal/window-system/common/window-system.h>
+#include <dali/internal/window-system/x11/motion-event-coalescer-x.h>
 #include <climits>
 #include <cstdint>
 #include <string>
@@ -143,6 +144,8 @@ public:
       int   radiusX;
       int   radiusY;
     } multi;
+
+    MotionEventCoalescerX::History history; ///< The coalesced motions preceding this one, while a button was held
   };
 
   /**
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -23,15 +23,17 @@
 namespace Dali
 {
 AsyncTask::AsyncTask(CallbackBase* callback, PriorityType priority, ThreadType threadType)
-: mCompletedCallback(std::unique_ptr<CallbackBase>(callback)),
+: mImpl(new Impl(callback)),
   mPriorityType(priority),
   mThreadType(threadType)
 {
 }
 
+AsyncTask::~AsyncTask() = default;
+
 CallbackBase* AsyncTask::GetCompletedCallback()
 {
-  return mCompletedCallback.get();
+  return mImpl->completedCallback.get();
 }
 
 AsyncTask::ThreadType AsyncTask::GetCallbackInvocationThread() const
@@ -44,6 +46,34 @@ AsyncTask::PriorityType AsyncTask::GetPriorityType() const
   return mPriorityType;
 }
 
+void AsyncTask::AddDependency(AsyncTaskPtr task)
+{
+  if(task && task.Get() != this)
+  {
+    Internal::Adaptor::AsyncTaskManager::AddTaskDependency(*this, task);
+  }
+}
+
+void AsyncTask::SetPriorityValue(int32_t priorityValue)
+{
+  Internal::Adaptor::AsyncTaskManager::SetTaskPriorityValue(*this, priorityValue);
+}
+
+int32_t AsyncTask::GetPriorityValue() const
+{
+  return Internal::Adaptor::AsyncTaskManager::GetTaskPriorityValue(*this);
+}
+
+void AsyncTask::SetDeadline(uint32_t milliSeconds)
+{
+  Internal::Adaptor::AsyncTaskManager::SetTaskDeadline(*this, milliSeconds);
+}
+
+bool AsyncTask::IsCanceled() const
+{
+  return Internal::Adaptor::AsyncTaskManager::IsTaskCanceled(*this);
+}
+
 AsyncTaskManager::AsyncTaskManager() = default;
 
 AsyncTaskManager::~AsyncTaskManager() = default;
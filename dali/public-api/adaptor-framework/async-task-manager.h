@@ -2,7 +2,7 @@
 #define DALI_ASYNC_TASK_MANAGER_H
 
 /*
- * Copyright (c) 2023 Samsung Electronics Co., Ltd.
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -107,11 +107,68 @@ public:
    */
   PriorityType GetPriorityType() const;
 
+  /**
+   * @brief Add the task which should be completed before this task is processed.
+   *
+   * This task is not pushed into the waiting queue until all the dependencies are completed,
+   * or removed from the AsyncTaskManager.
+   *
+   * @note Dependencies should be added before this task is added to the AsyncTaskManager.
+   * A dependency which is not in the AsyncTaskManager when this task is added, is regarded as completed.
+   *
+   * @SINCE_2_3.34
+   * @param[in] task The task this task depends on.
+   */
+  void AddDependency(AsyncTaskPtr task);
+
+  /**
+   * @brief Set the priority value of this task among the waiting tasks.
+   *
+   * The ready task with larger value is processed first. Default is 0.
+   *
+   * @note It should be set before this task is added to the AsyncTaskManager.
+   *
+   * @SINCE_2_3.34
+   * @param[in] priorityValue The priority value.
+   */
+  void SetPriorityValue(int32_t priorityValue);
+
+  /**
+   * @brief Get the priority value of this task.
+   *
+   * @SINCE_2_3.34
+   * @return The priority value.
+   */
+  int32_t GetPriorityValue() const;
+
+  /**
+   * @brief Set the deadline of this task, from now.
+   *
+   * The task which is not started before its deadline is processed after all the other tasks
+   * with the same priority type. e.g. the image load of a view which is scrolled out.
+   *
+   * @note It should be set before this task is added to the AsyncTaskManager.
+   *
+   * @SINCE_2_3.34
+   * @param[in] milliSeconds The deadline in milliseconds from now.
+   */
+  void SetDeadline(uint32_t milliSeconds);
+
+  /**
+   * @brief Whether this task is removed from the AsyncTaskManager while processing.
+   *
+   * Process() can check it, to abort the work which is not needed anymore.
+   *
+   * @SINCE_2_3.34
+   * @return True if the task is canceled.
+   */
+  bool IsCanceled() const;
+
   /**
    * Destructor.
    * @SINCE_2_2.3
    */
-  virtual ~AsyncTask() = default;
+  virtual ~AsyncTask();
 
   /**
    * Process the task
@@ -137,10 +194,15 @@ public:
     return "";
   }
 
+  /// @cond internal
 private:
-  std::unique_ptr<CallbackBase> mCompletedCallback;
-  const PriorityType            mPriorityType;
-  ThreadType                    mThreadType;
+  friend class Internal::Adaptor::AsyncTaskManager;
+
+  struct Impl;
+  std::unique_ptr<Impl> mImpl; ///< The completed callback, and the state used by the AsyncTaskManager.
+  const PriorityType    mPriorityType;
+  ThreadType            mThreadType;
+  /// @endcond
 
   // Undefined
   AsyncTask(const AsyncTask& task) = delete;
@@ -54,10 +54,16 @@ typedef struct NSVGpoint {
 	unsigned char flags;
 } NSVGpoint;
 
+/**
+ * In the original software, the active edges with the same x are ordered by the time they were inserted.
+ * We added the index of the edge, to order them by index, so the active edges of a scanline
+ * don't depend on the previous scanlines, and a band can start at its first scanline.
+ */
 typedef struct NSVGactiveEdge {
 	int x,dx;
 	float ey;
 	int dir;
+	int index;
 	struct NSVGactiveEdge *next;
 } NSVGactiveEdge;
 
@@ -813,7 +819,7 @@ static int nsvg__cmpEdge(const void *p, const void *q)
 }
 
 
-static NSVGactiveEdge* nsvg__addActive(NSVGrasterizer* r, NSVGedge* e, float startPoint)
+static NSVGactiveEdge* nsvg__addActive(NSVGrasterizer* r, const NSVGedge* e, int index, float startPoint)
 {
 	 NSVGactiveEdge* z;
 
@@ -839,10 +845,36 @@ static NSVGactiveEdge* nsvg__addActive(NSVGrasterizer* r, NSVGedge* e, float sta
 	z->ey = e->y1;
 	z->next = 0;
 	z->dir = e->dir;
+	z->index = index;
 
 	return z;
 }
 
+static int nsvg__isActiveEdgeAfter(const NSVGactiveEdge* a, const NSVGactiveEdge* b)
+{
+	return a->x > b->x || (a->x == b->x && a->index > b->index);
+}
+
+static void nsvg__insertActive(NSVGactiveEdge** active, NSVGactiveEdge* z)
+{
+	// find insertion point
+	if (*active == NULL) {
+		*active = z;
+	} else if (nsvg__isActiveEdgeAfter(*active, z)) {
+		// insert at front
+		z->next = *active;
+		*active = z;
+	} else {
+		// find thing to insert AFTER
+		NSVGactiveEdge* p = *active;
+		while (p->next && nsvg__isActiveEdgeAfter(z, p->next))
+			p = p->next;
+		// at this point, p->next is NOT before z
+		z->next = p->next;
+		p->next = z;
+	}
+}
+
 static void nsvg__freeActive(NSVGrasterizer* r, NSVGactiveEdge* z)
 {
 	z->next = r->freelist;
@@ -1079,15 +1111,66 @@ static void nsvg__scanlineSolid(unsigned char* dst, int count, unsigned char* co
 	}
 }
 
-static void nsvg__rasterizeSortedEdges(NSVGrasterizer *r, float tx, float ty, float scale, NSVGcachedPaint* cache, char fillRule)
+/**
+ * In the original software, there is no such function, the active edges are advanced from the first scanline.
+ * We added it, so the rasterization starts at the first scanline of a band, or of a shape.
+ * It builds the active edges of the subsample scanline before 'scanline', as the loop below would have:
+ * the x of an edge is computed where it is inserted, then advanced once per subsample scanline.
+ */
+static NSVGactiveEdge* nsvg__skipScanlines(NSVGrasterizer *r, const NSVGedge* edges, int nedges, int scanline, int* next)
+{
+	NSVGactiveEdge *active = NULL;
+	const float lastScany = (float)(scanline - 1) + 0.5f;
+	int e = 0;
+
+	while (e < nedges && edges[e].y0 <= lastScany) {
+		const NSVGedge* edge = &edges[e];
+		// omit the edges which end before the last scanline
+		if (edge->y1 > lastScany) {
+			// find the first scanline which inserted the edge
+			int inserted = edge->y0 < 0.5f ? 0 : (int)ceilf(edge->y0 - 0.5f);
+			while ((float)inserted + 0.5f < edge->y0) inserted++;
+			while (inserted > 0 && (float)(inserted - 1) + 0.5f >= edge->y0) inserted--;
+
+			NSVGactiveEdge* z = nsvg__addActive(r, edge, e, (float)inserted + 0.5f);
+			if (z == NULL) break;
+			z->x += z->dx * (scanline - 1 - inserted);
+			nsvg__insertActive(&active, z);
+		}
+		e++;
+	}
+
+	*next = e;
+	return active;
+}
+
+/**
+ * In the original software, all the scanlines are filled, from the top of the image.
+ * We fill only the scanlines from y0 to y1, so an image can be rasterized by bands on several threads,
+ * and we start at the first scanline of the band or of the edges. The edges are given, so they can be shared by the bands.
+ */
+static void nsvg__rasterizeSortedEdges(NSVGrasterizer *r, const NSVGedge* edges, int nedges, float tx, float ty, float scale, NSVGcachedPaint* cache, char fillRule, int y0, int y1)
 {
 	NSVGactiveEdge *active = NULL;
 	int y, s;
 	int e = 0;
 	int maxWeight = (255 / NSVG__SUBSAMPLES);  // weight per vertical scanline
 	int xmin, xmax;
+	float first;
+
+	if (nedges == 0) return;
+
+	// the rows before the first edge are empty
+	first = floorf(edges[0].y0 / NSVG__SUBSAMPLES);
+	y = y0;
+	if (first > (float)y0) y = first < (float)y1 ? (int)first : y1;
+	if (y >= y1) return;
+	if (y > 0) active = nsvg__skipScanlines(r, edges, nedges, y * NSVG__SUBSAMPLES, &e);
+
+	for (; y < y1; y++) {
+		// the rows after the last edge are empty
+		if (active == NULL && e >= nedges) break;
 
-	for (y = 0; y < r->height; y++) {
 		memset(r->scanline, 0, r->width);
 		xmin = r->width;
 		xmax = 0;
@@ -1115,7 +1198,7 @@ static void nsvg__rasterizeSortedEdges(NSVGrasterizer *r, float tx, float ty, fl
 				int changed = 0;
 				step = &active;
 				while (*step && (*step)->next) {
-					if ((*step)->x > (*step)->next->x) {
+					if (nsvg__isActiveEdgeAfter(*step, (*step)->next)) {
 						NSVGactiveEdge* t = *step;
 						NSVGactiveEdge* q = t->next;
 						t->next = q->next;
@@ -1129,26 +1212,11 @@ static void nsvg__rasterizeSortedEdges(NSVGrasterizer *r, float tx, float ty, fl
 			}
 
 			// insert all edges that start before the center of this scanline -- omit ones that also end on this scanline
-			while (e < r->nedges && r->edges[e].y0 <= scany) {
-				if (r->edges[e].y1 > scany) {
-					NSVGactiveEdge* z = nsvg__addActive(r, &r->edges[e], scany);
+			while (e < nedges && edges[e].y0 <= scany) {
+				if (edges[e].y1 > scany) {
+					NSVGactiveEdge* z = nsvg__addActive(r, &edges[e], e, scany);
 					if (z == NULL) break;
-					// find insertion point
-					if (active == NULL) {
-						active = z;
-					} else if (z->x < active->x) {
-						// insert at front
-						z->next = active;
-						active = z;
-					} else {
-						// find thing to insert AFTER
-						NSVGactiveEdge* p = active;
-						while (p->next && p->next->x < z->x)
-							p = p->next;
-						// at this point, p->next->x is NOT < z->x
-						z->next = p->next;
-						p->next = z;
-					}
+					nsvg__insertActive(&active, z);
 				}
 				e++;
 			}
@@ -1233,13 +1301,30 @@ static void nsvg__initPaint(NSVGcachedPaint* cache, NSVGpaint* paint, float opac
 
 }
 
-void nsvgRasterize(NSVGrasterizer* r,
-				   NSVGimage* image, float tx, float ty, float scale,
-				   unsigned char* dst, int w, int h, int stride)
+/**
+ * In the original software, the edges of the shapes are translated and sorted in nsvgRasterize().
+ * We moved it here, so the edges can be prepared once for all the bands of an image.
+ */
+static void nsvg__prepareEdges(NSVGrasterizer* r, float tx, float ty)
 {
-	NSVGshape *shape = NULL;
 	NSVGedge *e = NULL;
-	NSVGcachedPaint cache;
+	int i;
+
+	// Scale and translate edges
+	for (i = 0; i < r->nedges; i++) {
+		e = &r->edges[i];
+		e->x0 = tx + e->x0;
+		e->y0 = (ty + e->y0) * NSVG__SUBSAMPLES;
+		e->x1 = tx + e->x1;
+		e->y1 = (ty + e->y1) * NSVG__SUBSAMPLES;
+	}
+
+	// Rasterize edges
+	qsort(r->edges, r->nedges, sizeof(NSVGedge), nsvg__cmpEdge);
+}
+
+static int nsvg__beginRasterize(NSVGrasterizer* r, unsigned char* dst, int w, int h, int stride, int y0, int y1)
+{
 	int i;
 
 	r->bitmap = dst;
@@ -1250,12 +1335,37 @@ void nsvgRasterize(NSVGrasterizer* r,
 	if (w > r->cscanline) {
 		r->cscanline = w;
 		r->scanline = (unsigned char*)realloc(r->scanline, w);
-		if (r->scanline == NULL) return;
+		if (r->scanline == NULL) return 0;
 	}
 
-	for (i = 0; i < h; i++)
+	for (i = y0; i < y1; i++)
 		memset(&dst[i*stride], 0, w*4);
 
+	return 1;
+}
+
+static void nsvg__endRasterize(NSVGrasterizer* r)
+{
+    /**
+     * In the original file, the pre-multiplied alpha format is transformed to the convertional non-pre format.
+     * We skip this process here, and render the pre-multiplied alpha format directly in our svg renderer.
+     */
+
+	r->bitmap = NULL;
+	r->width = 0;
+	r->height = 0;
+	r->stride = 0;
+}
+
+void nsvgRasterize(NSVGrasterizer* r,
+				   NSVGimage* image, float tx, float ty, float scale,
+				   unsigned char* dst, int w, int h, int stride)
+{
+	NSVGshape *shape = NULL;
+	NSVGcachedPaint cache;
+
+	if (!nsvg__beginRasterize(r, dst, w, h, stride, 0, h)) return;
+
 	for (shape = image->shapes; shape != NULL; shape = shape->next) {
 		if (!(shape->flags & NSVG_FLAGS_VISIBLE))
 			continue;
@@ -1266,23 +1376,12 @@ void nsvgRasterize(NSVGrasterizer* r,
 			r->nedges = 0;
 
 			nsvg__flattenShape(r, shape, scale);
-
-			// Scale and translate edges
-			for (i = 0; i < r->nedges; i++) {
-				e = &r->edges[i];
-				e->x0 = tx + e->x0;
-				e->y0 = (ty + e->y0) * NSVG__SUBSAMPLES;
-				e->x1 = tx + e->x1;
-				e->y1 = (ty + e->y1) * NSVG__SUBSAMPLES;
-			}
-
-			// Rasterize edges
-			qsort(r->edges, r->nedges, sizeof(NSVGedge), nsvg__cmpEdge);
+			nsvg__prepareEdges(r, tx, ty);
 
 			// now, traverse the scanlines and find the intersections on each scanline, use non-zero rule
 			nsvg__initPaint(&cache, &shape->fill, shape->opacity);
 
-			nsvg__rasterizeSortedEdges(r, tx,ty,scale, &cache, shape->fillRule);
+			nsvg__rasterizeSortedEdges(r, r->edges, r->nedges, tx,ty,scale, &cache, shape->fillRule, 0, h);
 		}
 		if (shape->stroke.type != NSVG_PAINT_NONE && (shape->strokeWidth * scale) > 0.01f) {
 			nsvg__resetPool(r);
@@ -1293,32 +1392,139 @@ void nsvgRasterize(NSVGrasterizer* r,
 
 //			dumpEdges(r, "edge.svg");
 
-			// Scale and translate edges
-			for (i = 0; i < r->nedges; i++) {
-				e = &r->edges[i];
-				e->x0 = tx + e->x0;
-				e->y0 = (ty + e->y0) * NSVG__SUBSAMPLES;
-				e->x1 = tx + e->x1;
-				e->y1 = (ty + e->y1) * NSVG__SUBSAMPLES;
-			}
-
-			// Rasterize edges
-			qsort(r->edges, r->nedges, sizeof(NSVGedge), nsvg__cmpEdge);
+			nsvg__prepareEdges(r, tx, ty);
 
 			// now, traverse the scanlines and find the intersections on each scanline, use non-zero rule
 			nsvg__initPaint(&cache, &shape->stroke, shape->opacity);
 
-			nsvg__rasterizeSortedEdges(r, tx,ty,scale, &cache, NSVG_FILLRULE_NONZERO);
+			nsvg__rasterizeSortedEdges(r, r->edges, r->nedges, tx,ty,scale, &cache, NSVG_FILLRULE_NONZERO, 0, h);
 		}
 	}
 
-    /**
-     * In the original file, the pre-multiplied alpha format is transformed to the convertional non-pre format.
-     * We skip this process here, and render the pre-multiplied alpha format directly in our svg renderer.
-     */
+	nsvg__endRasterize(r);
+}
 
-	r->bitmap = NULL;
-	r->width = 0;
-	r->height = 0;
-	r->stride = 0;
+/**
+ * In the original software, there is no flattened image.
+ * We added it, so the shapes of an image are flattened once, and the bands of the image
+ * are rasterized from the same edges on several threads.
+ */
+typedef struct NSVGflattenedPass {
+	int firstEdge;
+	int nedges;
+	signed char fillRule;
+	NSVGcachedPaint cache;
+} NSVGflattenedPass;
+
+struct NSVGflattenedImage {
+	NSVGedge* edges;
+	int nedges;
+	int cedges;
+	NSVGflattenedPass* passes;
+	int npasses;
+	int cpasses;
+	float tx, ty, scale;
+};
+
+static int nsvg__addFlattenedPass(NSVGflattenedImage* flattened, NSVGrasterizer* r, NSVGpaint* paint, float opacity, signed char fillRule)
+{
+	NSVGflattenedPass* pass;
+
+	if (r->nedges == 0) return 1;
+
+	if (flattened->nedges + r->nedges > flattened->cedges) {
+		NSVGedge* edges;
+		int cedges = flattened->cedges > 0 ? flattened->cedges * 2 : 256;
+		while (cedges < flattened->nedges + r->nedges) cedges *= 2;
+		edges = (NSVGedge*)realloc(flattened->edges, sizeof(NSVGedge) * cedges);
+		if (edges == NULL) return 0;
+		flattened->edges = edges;
+		flattened->cedges = cedges;
+	}
+	if (flattened->npasses + 1 > flattened->cpasses) {
+		NSVGflattenedPass* passes;
+		int cpasses = flattened->cpasses > 0 ? flattened->cpasses * 2 : 16;
+		passes = (NSVGflattenedPass*)realloc(flattened->passes, sizeof(NSVGflattenedPass) * cpasses);
+		if (passes == NULL) return 0;
+		flattened->passes = passes;
+		flattened->cpasses = cpasses;
+	}
+
+	pass = &flattened->passes[flattened->npasses++];
+	pass->firstEdge = flattened->nedges;
+	pass->nedges = r->nedges;
+	pass->fillRule = fillRule;
+	nsvg__initPaint(&pass->cache, paint, opacity);
+
+	memcpy(&flattened->edges[flattened->nedges], r->edges, sizeof(NSVGedge) * r->nedges);
+	flattened->nedges += r->nedges;
+	return 1;
+}
+
+NSVGflattenedImage* nsvgFlattenImage(NSVGrasterizer* r, NSVGimage* image, float tx, float ty, float scale)
+{
+	NSVGshape *shape = NULL;
+	NSVGflattenedImage* flattened = (NSVGflattenedImage*)malloc(sizeof(NSVGflattenedImage));
+	if (flattened == NULL) return NULL;
+	memset(flattened, 0, sizeof(NSVGflattenedImage));
+
+	flattened->tx = tx;
+	flattened->ty = ty;
+	flattened->scale = scale;
+
+	for (shape = image->shapes; shape != NULL; shape = shape->next) {
+		if (!(shape->flags & NSVG_FLAGS_VISIBLE))
+			continue;
+
+		if (shape->fill.type != NSVG_PAINT_NONE) {
+			r->nedges = 0;
+			nsvg__flattenShape(r, shape, scale);
+			nsvg__prepareEdges(r, tx, ty);
+			if (!nsvg__addFlattenedPass(flattened, r, &shape->fill, shape->opacity, shape->fillRule)) goto error;
+		}
+		if (shape->stroke.type != NSVG_PAINT_NONE && (shape->strokeWidth * scale) > 0.01f) {
+			r->nedges = 0;
+			nsvg__flattenShapeStroke(r, shape, scale);
+			nsvg__prepareEdges(r, tx, ty);
+			if (!nsvg__addFlattenedPass(flattened, r, &shape->stroke, shape->opacity, NSVG_FILLRULE_NONZERO)) goto error;
+		}
+	}
+
+	return flattened;
+
+error:
+	nsvgDeleteFlattenedImage(flattened);
+	return NULL;
+}
+
+void nsvgRasterizeFlattened(NSVGrasterizer* r, const NSVGflattenedImage* flattened,
+							unsigned char* dst, int w, int h, int stride, int y0, int y1)
+{
+	int i;
+
+	if (y0 < 0) y0 = 0;
+	if (y1 > h) y1 = h;
+	if (y0 >= y1) return;
+
+	if (!nsvg__beginRasterize(r, dst, w, h, stride, y0, y1)) return;
+
+	for (i = 0; i < flattened->npasses; i++) {
+		const NSVGflattenedPass* pass = &flattened->passes[i];
+		NSVGcachedPaint cache = pass->cache;
+
+		nsvg__resetPool(r);
+		r->freelist = NULL;
+
+		nsvg__rasterizeSortedEdges(r, &flattened->edges[pass->firstEdge], pass->nedges, flattened->tx, flattened->ty, flattened->scale, &cache, pass->fillRule, y0, y1);
+	}
+
+	nsvg__endRasterize(r);
+}
+
+void nsvgDeleteFlattenedImage(NSVGflattenedImage* flattened)
+{
+	if (flattened == NULL) return;
+	if (flattened->edges) free(flattened->edges);
+	if (flattened->passes) free(flattened->passes);
+	free(flattened);
 }
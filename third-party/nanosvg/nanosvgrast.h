@@ -58,6 +58,29 @@ void nsvgRasterize(NSVGrasterizer* r,
                    NSVGimage* image, float tx, float ty, float scale,
                    unsigned char* dst, int w, int h, int stride);
 
+/**
+ * In the original software, there is no function to rasterize a part of the image.
+ * We added them, so the shapes of a large image are flattened once, then its bands are rasterized
+ * on several threads, each with its own rasterizer context. The result is identical to nsvgRasterize().
+ */
+typedef struct NSVGflattenedImage NSVGflattenedImage;
+
+// Flattens the shapes of an image into edges, returns NULL on failure.
+// Parameters are the same as nsvgRasterize().
+NSVGflattenedImage* nsvgFlattenImage(NSVGrasterizer* r,
+                                     NSVGimage* image, float tx, float ty, float scale);
+
+// Rasterizes the rows from y0 (included) to y1 (excluded) of a flattened image.
+// The flattened image is only read, the bands can be rasterized concurrently with different contexts.
+//   dst - pointer to the destination of the whole image, only the rows of the band are written
+//   y0, y1 - the band to rasterize
+// Other parameters are the same as nsvgRasterize().
+void nsvgRasterizeFlattened(NSVGrasterizer* r, const NSVGflattenedImage* flattened,
+                            unsigned char* dst, int w, int h, int stride, int y0, int y1);
+
+// Deletes a flattened image.
+void nsvgDeleteFlattenedImage(NSVGflattenedImage* flattened);
+
 // Deletes rasterizer context.
 void nsvgDeleteRasterizer(NSVGrasterizer*);
 